@@ -20,6 +20,7 @@
 #include "CFCClass.h"
 #include "CFCDocument.h"
 #include "CFCHierarchy.h"
+#include "CFCMemPool.h"
 #include "CFCParcel.h"
 #include "CFCUtil.h"
 
@@ -45,6 +46,8 @@ struct CFCArgs {
     char **parcels;
     char  *header_filename;
     char  *footer_filename;
+    char  *jobs;
+    char  *method_profile;
 };
 typedef struct CFCArgs CFCArgs;
 
@@ -117,6 +120,14 @@ S_parse_arguments(int argc, char **argv, CFCArgs *args) {
         if (S_parse_string_argument(arg, "--footer", &args->footer_filename)) {
             continue;
         }
+        if (S_parse_string_argument(arg, "--jobs", &args->jobs)) {
+            continue;
+        }
+        if (S_parse_string_argument(arg, "--method-profile",
+                                    &args->method_profile)
+           ) {
+            continue;
+        }
         if (S_parse_string_array_argument(arg, "--source",
                                           &args->num_source_dirs,
                                           &args->source_dirs)
@@ -144,6 +155,15 @@ S_parse_arguments(int argc, char **argv, CFCArgs *args) {
         fprintf(stderr, "Mandatory argument --dest missing\n");
         exit(EXIT_FAILURE);
     }
+
+    if (args->jobs) {
+        char *end;
+        long jobs = strtol(args->jobs, &end, 10);
+        if (end == args->jobs || *end != '\0' || jobs < 0) {
+            fprintf(stderr, "Invalid --jobs argument '%s'\n", args->jobs);
+            exit(EXIT_FAILURE);
+        }
+    }
 }
 
 static void S_free_arguments(CFCArgs *args) {
@@ -152,6 +172,8 @@ static void S_free_arguments(CFCArgs *args) {
     if (args->dest)            { FREEMEM(args->dest); }
     if (args->header_filename) { FREEMEM(args->header_filename); }
     if (args->footer_filename) { FREEMEM(args->footer_filename); }
+    if (args->jobs)            { FREEMEM(args->jobs); }
+    if (args->method_profile)  { FREEMEM(args->method_profile); }
 
     for (i = 0; args->source_dirs[i]; ++i) {
         FREEMEM(args->source_dirs[i]);
@@ -174,6 +196,7 @@ main(int argc, char **argv) {
     int           i;
     size_t        file_len;
     CFCArgs       args;
+    CFCMemPool   *pool;
     CFCHierarchy *hierarchy;
     CFCBindCore  *core_binding;
     CFCC         *c_binding;
@@ -183,6 +206,16 @@ main(int argc, char **argv) {
 
     S_parse_arguments(argc, argv, &args);
 
+    if (args.jobs) {
+        CFCUtil_set_num_threads(atoi(args.jobs));
+    }
+
+    /* Allocate the object model from an arena which is freed in bulk at
+     * the end of the run. */
+    pool = CFCMemPool_new(0x10000);
+    CFCBase_set_pool(pool);
+    CFCBase_decref((CFCBase*)pool);
+
     hierarchy = CFCHierarchy_new(args.dest);
 
     for (i = 0; args.source_dirs[i]; ++i) {
@@ -224,6 +257,10 @@ main(int argc, char **argv) {
 
     CFCHierarchy_build(hierarchy);
 
+    if (args.method_profile) {
+        CFCHierarchy_read_method_profile(hierarchy, args.method_profile);
+    }
+
     if (args.header_filename) {
         header = CFCUtil_slurp_text(args.header_filename, &file_len);
     }
@@ -259,6 +296,8 @@ main(int argc, char **argv) {
     CFCDocument_clear_registry();
     CFCParcel_reap_singletons();
 
+    CFCBase_set_pool(NULL);
+
     S_free_arguments(&args);
 
     return EXIT_SUCCESS;
@@ -7936,6 +7936,12 @@ S_write_makefile(struct chaz_CLI *cli);
 static void
 S_source_file_callback(const char *dir, char *file, void *context);
 
+static int
+S_need_libpthread(chaz_CLI *cli);
+
+static const char*
+S_thread_local_keyword(void);
+
 int main(int argc, const char **argv) {
     /* Initialize. */
     chaz_CLI *cli
@@ -7944,6 +7950,14 @@ int main(int argc, const char **argv) {
                       CHAZ_CLI_ARG_REQUIRED);
     chaz_CLI_register(cli, "disable-threads", "whether to disable threads",
                       CHAZ_CLI_NO_ARG);
+    /* Only used by the runtime, but accepted so that the runtime's configure
+     * script can pass all its options on. */
+    chaz_CLI_register(cli, "enable-instrumentation",
+                      "count allocations and method calls per class",
+                      CHAZ_CLI_NO_ARG);
+    chaz_CLI_register(cli, "enable-audit",
+                      "track live objects and report leaks at exit",
+                      CHAZ_CLI_NO_ARG);
     chaz_CLI_set_usage(cli, "Usage: charmonizer [OPTIONS] [-- [CFLAGS]]");
     {
         int result = chaz_Probe_parse_cli_args(argc, argv, cli);
@@ -7981,6 +7995,16 @@ int main(int argc, const char **argv) {
         chaz_ConfWriter_append_conf("#define CHY_HAS_VA_COPY\n\n");
     }
 
+    /* Needed for parallel code generation. */
+    if (!chaz_CLI_defined(cli, "disable-threads")) {
+        const char *thread_local = S_thread_local_keyword();
+        if (thread_local) {
+            chaz_ConfWriter_append_conf("#define CHY_HAS_THREAD_LOCAL\n");
+            chaz_ConfWriter_append_conf("#define CHY_THREAD_LOCAL %s\n\n",
+                                        thread_local);
+        }
+    }
+
     /* Clean up. */
     chaz_CLI_destroy(cli);
     chaz_Probe_clean_up();
@@ -8147,6 +8171,9 @@ S_write_makefile(struct chaz_CLI *cli) {
     if (chaz_CLI_defined(cli, "enable-coverage")) {
         chaz_CFlags_enable_code_coverage(link_flags);
     }
+    if (S_need_libpthread(cli)) {
+        chaz_CFlags_add_external_library(link_flags, "pthread");
+    }
     if (strcmp(chaz_CLI_strval(cli, "host"), "c") == 0) {
         chaz_MakeFile_add_exe(makefile, cfc_exe, "$(COMMON_OBJS) $(CFC_OBJS)",
                               link_flags);
@@ -8236,4 +8263,71 @@ S_source_file_callback(const char *dir, char *file, void *context) {
     free(obj_file);
 }
 
+static int
+S_need_libpthread(chaz_CLI *cli) {
+    static const char source[] =
+        "#include <pthread.h>\n"
+        "\n"
+        "int main() {\n"
+        "    pthread_create(0, 0, 0, 0);\n"
+        "    pthread_join(0, 0);\n"
+        "    return 0;\n"
+        "}\n";
+    chaz_CFlags *temp_cflags;
+
+    if (chaz_CLI_defined(cli, "disable-threads")
+        || chaz_HeadCheck_check_header("windows.h")
+        || !chaz_HeadCheck_check_header("pthread.h")
+    ) {
+        return 0;
+    }
+
+    if (chaz_CC_test_link(source)) {
+        return 0;
+    }
+
+    temp_cflags = chaz_CC_get_temp_cflags();
+    chaz_CFlags_add_external_library(temp_cflags, "pthread");
+    if (!chaz_CC_test_link(source)) {
+        chaz_Util_die("Can't link with libpthread. Try --disable-threads.");
+    }
+    chaz_CFlags_clear(temp_cflags);
+
+    return 1;
+}
+
+/* Find a storage class specifier for thread-local variables. Prefer the GNU
+ * extension, which doesn't trigger warnings under -std=gnu99 -pedantic.
+ */
+static const char*
+S_thread_local_keyword(void) {
+    static const char *const keywords[] = {
+        "__thread",
+        "_Thread_local",
+        NULL
+    };
+    static const char code[] =
+        "static %s int counter;\n"
+        "\n"
+        "int main() {\n"
+        "    counter++;\n"
+        "    return counter - 1;\n"
+        "}\n";
+    int i;
+
+    for (i = 0; keywords[i] != NULL; i++) {
+        size_t  size   = sizeof(code) + strlen(keywords[i]) + 10;
+        char   *source = (char*)malloc(size);
+        int     success;
+
+        sprintf(source, code, keywords[i]);
+        success = chaz_CC_test_link(source);
+        free(source);
+        if (success) {
+            return keywords[i];
+        }
+    }
+
+    return NULL;
+}
 
@@ -40,7 +40,7 @@ var installDir string
 var cfIncludeDir string
 
 func init() {
-	_, buildGO, _, _ = runtime.Caller(1)
+	_, buildGO, _, _ = runtime.Caller(0)
 	buildDir = path.Dir(buildGO)
 	configGO = path.Join(buildDir, "cfc", "config.go")
 
@@ -17,17 +17,20 @@
 #include "CFCBase.h"
 #include "CFCCBlock.h"
 #include "CFCCallable.h"
+#include "CFCCharBuf.h"
 #include "CFCClass.h"
 #include "CFCDocuComment.h"
 #include "CFCDocument.h"
 #include "CFCFile.h"
 #include "CFCFileSpec.h"
 #include "CFCFunction.h"
+#include "CFCHash.h"
 #include "CFCHierarchy.h"
 #include "CFCMethod.h"
 #include "CFCMemPool.h"
 #include "CFCParamList.h"
 #include "CFCParcel.h"
+#include "CFCParseCache.h"
 #include "CFCParser.h"
 #include "CFCSymbol.h"
 #include "CFCTest.h"
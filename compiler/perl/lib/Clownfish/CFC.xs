@@ -909,6 +909,7 @@ ALIAS:
     set_host_alias     = 19
     get_host_alias     = 20
     excluded_from_host = 22
+    nogil              = 24
 PPCODE:
 {
     START_SET_OR_GET_SWITCH
@@ -941,6 +942,9 @@ PPCODE:
         case 22:
             retval = newSViv(CFCMethod_excluded_from_host(self));
             break;
+        case 24:
+            retval = newSViv(CFCMethod_nogil(self));
+            break;
     END_SET_OR_GET_SWITCH
 }
 
@@ -33,6 +33,11 @@ import unittest
 # CFLAGS.
 compiler = distutils.ccompiler.new_compiler()
 cflags = sysconfig.get_config_var('CFLAGS')
+# libcfc.a gets linked into a shared extension, so it must be built as
+# position-independent code (also required for its thread-local variables).
+ccshared = sysconfig.get_config_var('CCSHARED')
+if ccshared:
+    cflags = cflags + ' ' + ccshared
 compiler_type = distutils.ccompiler.get_default_compiler()
 
 # There's no public way to get a string representing the compiler executable
@@ -14,13 +14,49 @@
  * limitations under the License.
  */
 
+#include "charmony.h"
+
+#include <string.h>
+
 #define CFC_NEED_BASE_STRUCT_DEF
 #include "CFCBase.h"
+#include "CFCMemPool.h"
 #include "CFCUtil.h"
 
+/* Code generators share model objects across threads, see
+ * CFCUtil_run_parallel.
+ */
+#if defined(__GNUC__)
+  #define CFCBASE_INC(count) __sync_add_and_fetch(&(count), 1)
+  #define CFCBASE_DEC(count) __sync_sub_and_fetch(&(count), 1)
+#else
+  #define CFCBASE_INC(count) (++(count))
+  #define CFCBASE_DEC(count) (--(count))
+#endif
+
+/* Worker threads of CFCUtil_run_parallel don't share the pool of the thread
+ * that started them.
+ */
+#ifdef CHY_HAS_THREAD_LOCAL
+  #define CFCBASE_THREAD_LOCAL CHY_THREAD_LOCAL
+#else
+  #define CFCBASE_THREAD_LOCAL
+#endif
+
+static CFCBASE_THREAD_LOCAL CFCMemPool *current_pool;
+
 CFCBase*
 CFCBase_allocate(const CFCMeta *meta) {
-    CFCBase *self = (CFCBase*)CALLOCATE(meta->obj_alloc_size, 1);
+    CFCBase *self;
+    if (current_pool) {
+        self = (CFCBase*)CFCMemPool_allocate(current_pool,
+                                             meta->obj_alloc_size);
+        memset(self, 0, meta->obj_alloc_size);
+        self->pool = current_pool;
+    }
+    else {
+        self = (CFCBase*)CALLOCATE(meta->obj_alloc_size, 1);
+    }
     self->refcount = 1;
     self->meta = meta;
     return self;
@@ -28,13 +64,40 @@ CFCBase_allocate(const CFCMeta *meta) {
 
 void
 CFCBase_destroy(CFCBase *self) {
-    FREEMEM(self);
+    if (!self->pool) {
+        FREEMEM(self);
+    }
+    else if (self->pool == current_pool) {
+        // Objects destroyed by other threads are left to the arena, because
+        // the pool isn't thread-safe.
+        CFCMemPool_release(self->pool, self, self->meta->obj_alloc_size);
+    }
+}
+
+void
+CFCBase_set_pool(CFCMemPool *pool) {
+    if (pool) {
+        if (current_pool) {
+            CFCUtil_die("Memory pool sessions can't be nested");
+        }
+        if (((CFCBase*)pool)->pool) {
+            CFCUtil_die("Memory pool was allocated from another pool");
+        }
+    }
+    CFCMemPool *old_pool = current_pool;
+    current_pool = (CFCMemPool*)CFCBase_incref((CFCBase*)pool);
+    CFCBase_decref((CFCBase*)old_pool);
+}
+
+CFCMemPool*
+CFCBase_get_pool(void) {
+    return current_pool;
 }
 
 CFCBase*
 CFCBase_incref(CFCBase *self) {
     if (self) {
-        self->refcount++;
+        CFCBASE_INC(self->refcount);
     }
     return self;
 }
@@ -42,7 +105,7 @@ CFCBase_incref(CFCBase *self) {
 unsigned
 CFCBase_decref(CFCBase *self) {
     if (!self) { return 0; }
-    unsigned modified_refcount = --self->refcount;
+    unsigned modified_refcount = CFCBASE_DEC(self->refcount);
     if (modified_refcount == 0) {
         self->meta->destroy(self);
     }
@@ -28,12 +28,14 @@ extern "C" {
 
 typedef struct CFCBase CFCBase;
 typedef struct CFCMeta CFCMeta;
+struct CFCMemPool;
 typedef void (*CFCBase_destroy_t)(CFCBase *self);
 
 #ifdef CFC_NEED_BASE_STRUCT_DEF
 struct CFCBase {
     const CFCMeta *meta;
     int refcount;
+    struct CFCMemPool *pool;
 };
 #endif
 struct CFCMeta {
@@ -56,6 +58,28 @@ CFCBase_allocate(const CFCMeta *meta);
 void
 CFCBase_destroy(CFCBase *self);
 
+/** Allocate all CFC objects created by the calling thread from `pool`,
+ * typically for the duration of a compiler run. When a pooled object is
+ * destroyed on the thread that allocated it, its memory is handed back to
+ * the pool for reuse, so short-lived objects don't make the pool grow. The
+ * arenas themselves are only freed in bulk when the pool is destroyed.
+ * Destructors still run, so strings and other objects they own are freed as
+ * usual.
+ *
+ * The pool is incref'd until the session is ended by passing NULL. Sessions
+ * can't be nested, and the pool itself must not be allocated from another
+ * pool, because it would be freed together with the other pool. The caller
+ * must make sure that no pooled object is used after the pool has been
+ * destroyed.
+ */
+void
+CFCBase_set_pool(struct CFCMemPool *pool);
+
+/** Return the pool set for the calling thread or NULL.
+ */
+struct CFCMemPool*
+CFCBase_get_pool(void);
+
 /** Increment the refcount of the object.
  *
  * @return the object itself, allowing an assignment idiom.
@@ -22,6 +22,7 @@
 #include "CFCBindFunction.h"
 #include "CFCBindMethod.h"
 #include "CFCBase.h"
+#include "CFCCharBuf.h"
 #include "CFCClass.h"
 #include "CFCFunction.h"
 #include "CFCMethod.h"
@@ -285,16 +286,16 @@ CFCBindClass_to_c_data(CFCBindClass *self) {
 
     CFCMethod **methods  = CFCClass_methods(client);
 
-    char *offsets           = CFCUtil_strdup("");
-    char *method_defs       = CFCUtil_strdup("");
+    CFCCharBuf *offsets_buf     = CFCCharBuf_new(0);
+    CFCCharBuf *method_defs_buf = CFCCharBuf_new(0);
 
     for (int meth_num = 0; methods[meth_num] != NULL; meth_num++) {
         CFCMethod *method = methods[meth_num];
 
         // Define method offset variable.
         char *full_offset_sym = CFCMethod_full_offset_sym(method, client);
-        offsets = CFCUtil_cat(offsets, "uint32_t ", full_offset_sym, ";\n",
-                              NULL);
+        CFCCharBuf_cat(offsets_buf, "uint32_t ", full_offset_sym, ";\n",
+                       NULL);
         FREEMEM(full_offset_sym);
 
         int is_fresh = CFCMethod_is_fresh(method, client);
@@ -302,10 +303,14 @@ CFCBindClass_to_c_data(CFCBindClass *self) {
         // Create a default implementation for abstract methods.
         if (is_fresh && CFCMethod_abstract(method)) {
             char *method_def = CFCBindMeth_abstract_method_def(method, client);
-            method_defs = CFCUtil_cat(method_defs, method_def, "\n", NULL);
+            CFCCharBuf_cat(method_defs_buf, method_def, "\n", NULL);
             FREEMEM(method_def);
         }
     }
+    char *offsets     = CFCCharBuf_yield_string(offsets_buf);
+    char *method_defs = CFCCharBuf_yield_string(method_defs_buf);
+    CFCBase_decref((CFCBase*)offsets_buf);
+    CFCBase_decref((CFCBase*)method_defs_buf);
 
     const char pattern[] =
         "/* Offset from the top of the object at which the IVARS struct\n"
@@ -404,6 +409,16 @@ S_parent_include(CFCBindClass *self) {
     return parent_include;
 }
 
+// Return true if a method profile recorded calls to any method implemented
+// in the class.
+static int
+S_has_profiled_calls(CFCMethod **fresh_methods) {
+    for (int i = 0; fresh_methods[i] != NULL; i++) {
+        if (CFCMethod_get_imp_calls(fresh_methods[i]) > 0) { return 1; }
+    }
+    return 0;
+}
+
 // Add a C function definition for each method and each function.
 static char*
 S_sub_declarations(CFCBindClass *self) {
@@ -420,9 +435,16 @@ S_sub_declarations(CFCBindClass *self) {
         declarations = CFCUtil_cat(declarations, dec, "\n\n", NULL);
         FREEMEM(dec);
     }
+    // Only mark implementations as cold if the class was covered by the
+    // method profile. Otherwise, a missing profile entry says nothing about
+    // how often the method is called.
+    int is_profiled = S_has_profiled_calls(fresh_methods);
     for (int i = 0; fresh_methods[i] != NULL; i++) {
         CFCMethod *method = fresh_methods[i];
         char *dec = CFCBindMeth_imp_declaration(method, self->client);
+        if (is_profiled && CFCMethod_get_imp_calls(method) == 0) {
+            declarations = CFCUtil_cat(declarations, "CFISH_COLD ", NULL);
+        }
         declarations = CFCUtil_cat(declarations, dec, "\n\n", NULL);
         FREEMEM(dec);
     }
@@ -483,13 +505,15 @@ S_wrapper_defs(CFCBindClass *self) {
 static char*
 S_method_defs(CFCBindClass *self) {
     CFCMethod **methods = CFCClass_methods(self->client);
-    char *method_defs = CFCUtil_strdup("");
+    CFCCharBuf *buf = CFCCharBuf_new(0);
     for (int i = 0; methods[i] != NULL; i++) {
         CFCMethod *method = methods[i];
         char *def = CFCBindMeth_method_def(method, self->client);
-        method_defs = CFCUtil_cat(method_defs, def, "\n", NULL);
+        CFCCharBuf_cat(buf, def, "\n", NULL);
         FREEMEM(def);
     }
+    char *method_defs = CFCCharBuf_yield_string(buf);
+    CFCBase_decref((CFCBase*)buf);
     return method_defs;
 }
 
@@ -539,19 +563,17 @@ S_override_decs(CFCBindClass *self) {
 static char*
 S_short_names(CFCBindClass *self) {
     CFCClass *client = self->client;
-    char *short_names = CFCUtil_strdup("");
-    short_names = CFCUtil_cat(short_names, "#ifdef ", self->short_names_macro,
-                              "\n", NULL);
+    CFCCharBuf *buf = CFCCharBuf_new(0);
+    CFCCharBuf_cat(buf, "#ifdef ", self->short_names_macro, "\n", NULL);
 
     if (!CFCClass_inert(client)) {
         const char *short_struct    = CFCClass_get_struct_sym(client);
         const char *full_struct     = CFCClass_full_struct_sym(client);
         const char *short_class_var = CFCClass_short_class_var(client);
         const char *full_class_var  = CFCClass_full_class_var(client);
-        short_names = CFCUtil_cat(short_names, "  #define ",
-                                  short_struct, " ", full_struct, "\n",
-                                  "  #define ", short_class_var, " ",
-                                  full_class_var, "\n", NULL);
+        CFCCharBuf_cat(buf, "  #define ", short_struct, " ", full_struct,
+                       "\n", "  #define ", short_class_var, " ",
+                       full_class_var, "\n", NULL);
     }
 
     CFCFunction **functions = CFCClass_functions(client);
@@ -559,8 +581,8 @@ S_short_names(CFCBindClass *self) {
         CFCFunction *func = functions[i];
         char *short_sym = CFCFunction_short_func_sym(func, client);
         char *full_sym  = CFCFunction_full_func_sym(func, client);
-        short_names = CFCUtil_cat(short_names, "  #define ", short_sym, " ",
-                                  full_sym, "\n", NULL);
+        CFCCharBuf_cat(buf, "  #define ", short_sym, " ", full_sym, "\n",
+                       NULL);
         FREEMEM(short_sym);
         FREEMEM(full_sym);
     }
@@ -570,8 +592,8 @@ S_short_names(CFCBindClass *self) {
         CFCVariable *var = inert_vars[i];
         char *short_sym = CFCVariable_short_sym(var, client);
         char *full_sym  = CFCVariable_full_sym(var, client);
-        short_names = CFCUtil_cat(short_names, "  #define ", short_sym, " ",
-                                  full_sym, "\n", NULL);
+        CFCCharBuf_cat(buf, "  #define ", short_sym, " ", full_sym, "\n",
+                       NULL);
         FREEMEM(short_sym);
         FREEMEM(full_sym);
     }
@@ -591,9 +613,8 @@ S_short_names(CFCBindClass *self) {
         const char *nickname = CFCClass_get_nickname(client);
         for (int i = 0; i < num_wrapped_funcs; i++) {
             const char *func = wrapped_funcs[i];
-            short_names
-                = CFCUtil_cat(short_names, "  #define ", nickname, "_", func,
-                              " ", prefix, nickname, "_", func, "\n", NULL);
+            CFCCharBuf_cat(buf, "  #define ", nickname, "_", func, " ",
+                           prefix, nickname, "_", func, "\n", NULL);
         }
     }
 
@@ -605,8 +626,8 @@ S_short_names(CFCBindClass *self) {
             // Implementing functions.
             char *short_imp = CFCMethod_short_imp_func(meth, client);
             char *full_imp  = CFCMethod_imp_func(meth, client);
-            short_names = CFCUtil_cat(short_names, "  #define ", short_imp,
-                                      " ", full_imp, "\n", NULL);
+            CFCCharBuf_cat(buf, "  #define ", short_imp, " ", full_imp, "\n",
+                           NULL);
             FREEMEM(short_imp);
             FREEMEM(full_imp);
         }
@@ -617,28 +638,25 @@ S_short_names(CFCBindClass *self) {
             static const char pattern[] = "  #define %s %s\n";
 
             // Method invocation symbols.
-            char *short_sym  = CFCMethod_short_method_sym(meth, client);
-            char *full_sym   = CFCMethod_full_method_sym(meth, client);
-            char *define_sym = CFCUtil_sprintf(pattern, short_sym, full_sym);
-            short_names = CFCUtil_cat(short_names, define_sym, NULL);
+            char *short_sym = CFCMethod_short_method_sym(meth, client);
+            char *full_sym  = CFCMethod_full_method_sym(meth, client);
+            CFCCharBuf_catf(buf, pattern, short_sym, full_sym);
             FREEMEM(short_sym);
             FREEMEM(full_sym);
-            FREEMEM(define_sym);
 
             // Method typedefs.
-            char *short_typedef  = CFCMethod_short_typedef(meth, client);
-            char *full_typedef   = CFCMethod_full_typedef(meth, client);
-            char *define_typedef = CFCUtil_sprintf(pattern, short_typedef,
-                                                   full_typedef);
-            short_names = CFCUtil_cat(short_names, define_typedef, NULL);
+            char *short_typedef = CFCMethod_short_typedef(meth, client);
+            char *full_typedef  = CFCMethod_full_typedef(meth, client);
+            CFCCharBuf_catf(buf, pattern, short_typedef, full_typedef);
             FREEMEM(short_typedef);
             FREEMEM(full_typedef);
-            FREEMEM(define_typedef);
         }
     }
-    short_names = CFCUtil_cat(short_names, "#endif /* ",
-                              self->short_names_macro, " */\n", NULL);
+    CFCCharBuf_cat(buf, "#endif /* ", self->short_names_macro, " */\n",
+                   NULL);
 
+    char *short_names = CFCCharBuf_yield_string(buf);
+    CFCBase_decref((CFCBase*)buf);
     return short_names;
 }
 
@@ -25,6 +25,7 @@
 #include "CFCBindClass.h"
 #include "CFCBindFile.h"
 #include "CFCBindSpecs.h"
+#include "CFCCharBuf.h"
 #include "CFCClass.h"
 #include "CFCFile.h"
 #include "CFCHierarchy.h"
@@ -41,6 +42,20 @@ struct CFCBindCore {
     char         *c_footer;
 };
 
+/* Files written by CFCBindCore_write_all_modified. Every tick of the
+ * parallel run writes a single output file.
+ */
+typedef struct CFCBindCoreOutputs {
+    CFCBindCore  *self;
+    CFCFile     **files;
+    size_t        num_files;
+    CFCParcel   **parcels;
+    size_t        num_parcels;
+} CFCBindCoreOutputs;
+
+static void
+S_write_output(void *context, size_t tick);
+
 /* Write the "parcel.h" header file, which contains common symbols needed by
  * all classes, plus typedefs for all class structs.
  */
@@ -109,42 +124,87 @@ CFCBindCore_destroy(CFCBindCore *self) {
 int
 CFCBindCore_write_all_modified(CFCBindCore *self, int modified) {
     CFCHierarchy *hierarchy = self->hierarchy;
-    const char   *header    = self->c_header;
-    const char   *footer    = self->c_footer;
 
     // Discover whether files need to be regenerated.
+    CFCHierarchy_add_build_input(hierarchy, "header", self->c_header,
+                                 strlen(self->c_header));
+    CFCHierarchy_add_build_input(hierarchy, "footer", self->c_footer,
+                                 strlen(self->c_footer));
     modified = CFCHierarchy_propagate_modified(hierarchy, modified);
 
-    // Iterate over all File objects, writing out those which don't have
-    // up-to-date auto-generated files.
-    const char *inc_dest = CFCHierarchy_get_include_dest(hierarchy);
+    CFCBindCoreOutputs outputs;
+    outputs.self        = self;
+    outputs.num_files   = 0;
+    outputs.num_parcels = 0;
+
+    // Collect all File objects which don't have up-to-date auto-generated
+    // files.
     CFCFile **files = CFCHierarchy_files(hierarchy);
-    for (int i = 0; files[i] != NULL; i++) {
+    size_t num_files = 0;
+    while (files[num_files] != NULL) { num_files++; }
+    outputs.files = (CFCFile**)MALLOCATE((num_files + 1) * sizeof(CFCFile*));
+    for (size_t i = 0; i < num_files; i++) {
         if (CFCFile_get_modified(files[i])) {
-            CFCBindFile_write_h(files[i], inc_dest, header, footer);
+            outputs.files[outputs.num_files++] = files[i];
         }
     }
 
     // If any class definition has changed, rewrite the parcel.h and parcel.c
     // files.
+    CFCParcel **parcels = CFCParcel_all_parcels();
+    size_t num_parcels = 0;
+    while (parcels[num_parcels] != NULL) { num_parcels++; }
+    outputs.parcels
+        = (CFCParcel**)MALLOCATE((num_parcels + 1) * sizeof(CFCParcel*));
     if (modified) {
-        S_write_platform_h(self);
-
-        CFCParcel **parcels = CFCParcel_all_parcels();
-        for (size_t i = 0; parcels[i]; ++i) {
-            CFCParcel *parcel = parcels[i];
-            if (CFCParcel_required(parcel)) {
-                S_write_parcel_h(self, parcel);
-                if (!CFCParcel_included(parcel)) {
-                    S_write_parcel_c(self, parcel);
-                }
+        for (size_t i = 0; i < num_parcels; i++) {
+            if (CFCParcel_required(parcels[i])) {
+                outputs.parcels[outputs.num_parcels++] = parcels[i];
             }
         }
     }
 
+    // Headers, parcel files and cfish_platform.h are independent of each
+    // other, so generate them concurrently.
+    size_t num_outputs = outputs.num_files + 2 * outputs.num_parcels
+                         + (modified ? 1 : 0);
+    CFCUtil_run_parallel(S_write_output, &outputs, num_outputs);
+
+    FREEMEM(outputs.files);
+    FREEMEM(outputs.parcels);
+
+    CFCHierarchy_write_cache(hierarchy);
+
     return modified;
 }
 
+static void
+S_write_output(void *context, size_t tick) {
+    CFCBindCoreOutputs *outputs = (CFCBindCoreOutputs*)context;
+    CFCBindCore        *self    = outputs->self;
+
+    if (tick < outputs->num_files) {
+        const char *inc_dest = CFCHierarchy_get_include_dest(self->hierarchy);
+        CFCBindFile_write_h(outputs->files[tick], inc_dest, self->c_header,
+                            self->c_footer);
+        return;
+    }
+    tick -= outputs->num_files;
+
+    if (tick < 2 * outputs->num_parcels) {
+        CFCParcel *parcel = outputs->parcels[tick / 2];
+        if (tick % 2 == 0) {
+            S_write_parcel_h(self, parcel);
+        }
+        else if (!CFCParcel_included(parcel)) {
+            S_write_parcel_c(self, parcel);
+        }
+        return;
+    }
+
+    S_write_platform_h(self);
+}
+
 /* Write the "parcel.h" header file, which contains common symbols needed by
  * all classes, plus typedefs for all class structs.
  */
@@ -157,8 +217,8 @@ S_write_parcel_h(CFCBindCore *self, CFCParcel *parcel) {
 
     // Declare object structs and class singletons for all instantiable
     // classes.
-    char *typedefs    = CFCUtil_strdup("");
-    char *class_decls = CFCUtil_strdup("");
+    CFCCharBuf *typedefs_buf    = CFCCharBuf_new(0);
+    CFCCharBuf *class_decls_buf = CFCCharBuf_new(0);
     CFCClass **ordered = CFCHierarchy_ordered_classes(hierarchy);
     for (int i = 0; ordered[i] != NULL; i++) {
         CFCClass *klass = ordered[i];
@@ -167,15 +227,18 @@ S_write_parcel_h(CFCBindCore *self, CFCParcel *parcel) {
 
         if (!CFCClass_inert(klass)) {
             const char *full_struct = CFCClass_full_struct_sym(klass);
-            typedefs = CFCUtil_cat(typedefs, "typedef struct ", full_struct,
-                                   " ", full_struct, ";\n", NULL);
+            CFCCharBuf_cat(typedefs_buf, "typedef struct ", full_struct,
+                           " ", full_struct, ";\n", NULL);
             const char *class_var = CFCClass_full_class_var(klass);
-            class_decls = CFCUtil_cat(class_decls, "extern ", PREFIX,
-                                      "VISIBLE cfish_Class *", class_var,
-                                      ";\n", NULL);
+            CFCCharBuf_cat(class_decls_buf, "extern ", PREFIX,
+                           "VISIBLE cfish_Class *", class_var, ";\n", NULL);
         }
     }
     FREEMEM(ordered);
+    char *typedefs    = CFCCharBuf_yield_string(typedefs_buf);
+    char *class_decls = CFCCharBuf_yield_string(class_decls_buf);
+    CFCBase_decref((CFCBase*)typedefs_buf);
+    CFCBase_decref((CFCBase*)class_decls_buf);
 
     // Special includes and macros for Clownfish parcel.
     const char *cfish_includes =
@@ -190,6 +253,15 @@ S_write_parcel_h(CFCBindCore *self, CFCParcel *parcel) {
         "#define CFISH_UNUSED_VAR(var) ((void)var)\n"
         "#define CFISH_UNREACHABLE_RETURN(type) return (type)0\n"
         "\n"
+        "/* Mark functions which are rarely called so that the compiler can\n"
+        " * optimize them for size and move them to a separate section. */\n"
+        "#if defined(__GNUC__) && (__GNUC__ > 4 \\\n"
+        "                          || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3))\n"
+        "  #define CFISH_COLD __attribute__((cold))\n"
+        "#else\n"
+        "  #define CFISH_COLD\n"
+        "#endif\n"
+        "\n"
         "/* Generic method pointer.\n"
         " */\n"
         "typedef void\n"
@@ -207,6 +279,17 @@ S_write_parcel_h(CFCBindCore *self, CFCParcel *parcel) {
         "    return ptr.fptr[0];\n"
         "}\n"
         "\n"
+        "/* Sample method dispatch if built with instrumentation. See\n"
+        " * Clownfish::Util::Instrument. */\n"
+        "#ifdef CFISH_INSTRUMENT\n"
+        "  CFISH_VISIBLE void\n"
+        "  cfish_Instrument_sample_dispatch(cfish_Obj *obj, uint32_t offset);\n"
+        "  #define CFISH_INSTRUMENT_DISPATCH(_self, _offset) \\\n"
+        "      cfish_Instrument_sample_dispatch((cfish_Obj*)(_self), _offset)\n"
+        "#else\n"
+        "  #define CFISH_INSTRUMENT_DISPATCH(_self, _offset)\n"
+        "#endif\n"
+        "\n"
         "typedef struct cfish_Dummy {\n"
         "   CFISH_OBJ_HEAD\n"
         "   void *klass;\n"
@@ -384,12 +467,11 @@ S_write_parcel_h(CFCBindCore *self, CFCParcel *parcel) {
                           typedefs, class_decls, extra_defs, PREFIX, prefix,
                           PREFIX, prefix, prefix, PREFIX, self->c_footer);
 
-    // Unlink then write file.
+    // Keep the timestamp of unchanged files to avoid recompilation.
     const char *inc_dest = CFCHierarchy_get_include_dest(hierarchy);
     char *filepath = CFCUtil_sprintf("%s" CHY_DIR_SEP "%sparcel.h", inc_dest,
                                      prefix);
-    remove(filepath);
-    CFCUtil_write_file(filepath, file_content, strlen(file_content));
+    CFCUtil_write_if_changed(filepath, file_content, strlen(file_content));
     FREEMEM(filepath);
 
     FREEMEM(typedefs);
@@ -405,9 +487,9 @@ S_write_parcel_c(CFCBindCore *self, CFCParcel *parcel) {
     const char   *prefix    = CFCParcel_get_prefix(parcel);
 
     // Aggregate C code for the parcel.
-    char *privacy_syms = CFCUtil_strdup("");
-    char *includes     = CFCUtil_strdup("");
-    char *c_data       = CFCUtil_strdup("");
+    CFCCharBuf *privacy_syms_buf = CFCCharBuf_new(0);
+    CFCCharBuf *includes_buf     = CFCCharBuf_new(0);
+    CFCCharBuf *c_data_buf       = CFCCharBuf_new(0);
     CFCBindSpecs *specs = CFCBindSpecs_new();
     CFCClass **ordered = CFCHierarchy_ordered_classes(hierarchy);
 
@@ -417,20 +499,20 @@ S_write_parcel_c(CFCBindCore *self, CFCParcel *parcel) {
         if (strcmp(class_prefix, prefix) != 0) { continue; }
 
         const char *include_h = CFCClass_include_h(klass);
-        includes = CFCUtil_cat(includes, "#include \"", include_h,
-                               "\"\n", NULL);
+        CFCCharBuf_cat(includes_buf, "#include \"", include_h, "\"\n",
+                       NULL);
 
         CFCBindClass *class_binding = CFCBindClass_new(klass);
 
         char *class_c_data = CFCBindClass_to_c_data(class_binding);
-        c_data = CFCUtil_cat(c_data, class_c_data, "\n", NULL);
+        CFCCharBuf_cat(c_data_buf, class_c_data, "\n", NULL);
         FREEMEM(class_c_data);
 
         CFCBindSpecs_add_class(specs, klass);
 
         const char *privacy_sym = CFCClass_privacy_symbol(klass);
-        privacy_syms = CFCUtil_cat(privacy_syms, "#define ",
-                                   privacy_sym, "\n", NULL);
+        CFCCharBuf_cat(privacy_syms_buf, "#define ", privacy_sym, "\n",
+                       NULL);
 
         CFCBase_decref((CFCBase*)class_binding);
     }
@@ -438,6 +520,12 @@ S_write_parcel_c(CFCBindCore *self, CFCParcel *parcel) {
     char *spec_defs      = CFCBindSpecs_defs(specs);
     char *spec_init_func = CFCBindSpecs_init_func_def(specs);
     FREEMEM(ordered);
+    char *privacy_syms = CFCCharBuf_yield_string(privacy_syms_buf);
+    char *includes     = CFCCharBuf_yield_string(includes_buf);
+    char *c_data       = CFCCharBuf_yield_string(c_data_buf);
+    CFCBase_decref((CFCBase*)privacy_syms_buf);
+    CFCBase_decref((CFCBase*)includes_buf);
+    CFCBase_decref((CFCBase*)c_data_buf);
 
     char *prereq_bootstrap = CFCUtil_strdup("");
     CFCParcel **prereq_parcels = CFCParcel_prereq_parcels(parcel);
@@ -493,12 +581,10 @@ S_write_parcel_c(CFCBindCore *self, CFCParcel *parcel) {
                           c_data, spec_defs, spec_init_func, prefix, prefix,
                           prefix, prereq_bootstrap, prefix, self->c_footer);
 
-    // Unlink then open file.
     const char *src_dest = CFCHierarchy_get_source_dest(hierarchy);
     char *filepath = CFCUtil_sprintf("%s" CHY_DIR_SEP "%sparcel.c", src_dest,
                                      prefix);
-    remove(filepath);
-    CFCUtil_write_file(filepath, file_content, strlen(file_content));
+    CFCUtil_write_if_changed(filepath, file_content, strlen(file_content));
     FREEMEM(filepath);
 
     CFCBase_decref((CFCBase*)specs);
@@ -553,12 +639,10 @@ S_write_platform_h(CFCBindCore *self) {
                           stdbool_defs, stdint_defs, alloca_defs,
                           self->c_footer);
 
-    // Unlink then write file.
     const char *inc_dest = CFCHierarchy_get_include_dest(self->hierarchy);
     char *filepath = CFCUtil_sprintf("%s" CHY_DIR_SEP "cfish_platform.h",
                                      inc_dest);
-    remove(filepath);
-    CFCUtil_write_file(filepath, file_content, strlen(file_content));
+    CFCUtil_write_if_changed(filepath, file_content, strlen(file_content));
     FREEMEM(filepath);
 
     FREEMEM(feature_defs);
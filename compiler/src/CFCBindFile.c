@@ -21,6 +21,7 @@
 #include "CFCBindFile.h"
 #include "CFCBindClass.h"
 #include "CFCBase.h"
+#include "CFCCharBuf.h"
 #include "CFCFile.h"
 #include "CFCClass.h"
 #include "CFCCBlock.h"
@@ -57,11 +58,10 @@ CFCBindFile_write_h(CFCFile *file, const char *dest, const char *header,
     const char *include_guard_close = CFCFile_guard_close(file);
 
     // Include parcel header.
-    char *content = CFCUtil_strdup("");
+    CFCCharBuf *content = CFCCharBuf_new(0);
     CFCParcel *parcel = CFCFile_get_parcel(file);
     const char *prefix = CFCParcel_get_prefix(parcel);
-    content = CFCUtil_cat(content, "#include \"", prefix, "parcel.h\"\n\n",
-                          NULL);
+    CFCCharBuf_cat(content, "#include \"", prefix, "parcel.h\"\n\n", NULL);
 
     // Aggregate block content.
     CFCBase **blocks = CFCFile_blocks(file);
@@ -72,14 +72,14 @@ CFCBindFile_write_h(CFCFile *file, const char *dest, const char *header,
             CFCBindClass *class_binding
                 = CFCBindClass_new((CFCClass*)blocks[i]);
             char *c_header = CFCBindClass_to_c_header(class_binding);
-            content = CFCUtil_cat(content, c_header, "\n", NULL);
+            CFCCharBuf_cat(content, c_header, "\n", NULL);
             FREEMEM(c_header);
             CFCBase_decref((CFCBase*)class_binding);
         }
         else if (strcmp(cfc_class, "Clownfish::CFC::Model::CBlock") == 0) {
             const char *block_contents 
                 = CFCCBlock_get_contents((CFCCBlock*)blocks[i]);
-            content = CFCUtil_cat(content, block_contents, "\n", NULL);
+            CFCCharBuf_cat(content, block_contents, "\n", NULL);
         }
         else {
             CFCUtil_die("Unexpected class: %s", cfc_class);
@@ -106,14 +106,14 @@ CFCBindFile_write_h(CFCFile *file, const char *dest, const char *header,
         "%s\n"
         "\n";
     char *file_content
-        = CFCUtil_sprintf(pattern, header, include_guard_start, content,
-                          include_guard_close, footer);
+        = CFCUtil_sprintf(pattern, header, include_guard_start,
+                          CFCCharBuf_get_text(content), include_guard_close,
+                          footer);
 
-    // Unlink then write file.
-    remove(h_path);
-    CFCUtil_write_file(h_path, file_content, strlen(file_content));
+    // Only touch the header if its content changed.
+    CFCUtil_write_if_changed(h_path, file_content, strlen(file_content));
 
-    FREEMEM(content);
+    CFCBase_decref((CFCBase*)content);
     FREEMEM(file_content);
     FREEMEM(h_path);
 }
@@ -17,6 +17,8 @@
 #include <stdio.h>
 #include <string.h>
 #include "CFCBindMethod.h"
+#include "CFCBase.h"
+#include "CFCCharBuf.h"
 #include "CFCUtil.h"
 #include "CFCMethod.h"
 #include "CFCFunction.h"
@@ -97,10 +99,12 @@ S_method_def(CFCMethod *method, CFCClass *klass, int optimized_final_meth) {
 
     const char innards_pattern[] =
         "    const %s method = (%s)cfish_obj_method(%s, %s);\n"
+        "    CFISH_INSTRUMENT_DISPATCH(%s, %s);\n"
         "    %smethod(%s);\n"
         ;
     char *innards = CFCUtil_sprintf(innards_pattern, full_typedef,
                                     full_typedef, self_name, full_offset_sym,
+                                    self_name, full_offset_sym,
                                     maybe_return, arg_names);
     if (optimized_final_meth) {
         CFCParcel  *parcel = CFCClass_get_parcel(klass);
@@ -175,14 +179,11 @@ CFCBindMeth_abstract_method_def(CFCMethod *method, CFCClass *klass) {
 
     // All variables other than the invocant are unused, and the return is
     // unreachable.
-    char *unused = CFCUtil_strdup("");
+    CFCCharBuf *unused = CFCCharBuf_new(0);
     for (int i = 1; vars[i] != NULL; i++) {
         const char *var_name = CFCVariable_get_name(vars[i]);
-        size_t size = strlen(unused) + strlen(var_name) + 80;
-        unused = (char*)REALLOCATE(unused, size);
-        strcat(unused, "\n    CFISH_UNUSED_VAR(");
-        strcat(unused, var_name);
-        strcat(unused, ");");
+        CFCCharBuf_cat(unused, "\n    CFISH_UNUSED_VAR(", var_name, ");",
+                       NULL);
     }
     char *unreachable;
     if (!CFCType_is_void(ret_type)) {
@@ -204,10 +205,10 @@ CFCBindMeth_abstract_method_def(CFCMethod *method, CFCClass *klass) {
         "}\n";
     char *abstract_def
         = CFCUtil_sprintf(pattern, ret_type_str, full_func_sym, params,
-                          unused, invocant, class_var, meth_name,
-                          unreachable);
+                          CFCCharBuf_get_text(unused), invocant, class_var,
+                          meth_name, unreachable);
 
-    FREEMEM(unused);
+    CFCBase_decref((CFCBase*)unused);
     FREEMEM(unreachable);
     FREEMEM(full_func_sym);
     return abstract_def;
@@ -20,6 +20,7 @@
 
 #define CFC_NEED_BASE_STRUCT_DEF
 #include "CFCBase.h"
+#include "CFCCharBuf.h"
 #include "CFCClass.h"
 #include "CFCMethod.h"
 #include "CFCParcel.h"
@@ -28,11 +29,11 @@
 struct CFCBindSpecs {
     CFCBase base;
 
-    char *novel_specs;
-    char *overridden_specs;
-    char *inherited_specs;
-    char *class_specs;
-    char *init_code;
+    CFCCharBuf *novel_specs;
+    CFCCharBuf *overridden_specs;
+    CFCCharBuf *inherited_specs;
+    CFCCharBuf *class_specs;
+    CFCCharBuf *init_code;
 
     int num_novel;
     int num_overridden;
@@ -73,22 +74,22 @@ CFCBindSpecs_new() {
 
 CFCBindSpecs*
 CFCBindSpecs_init(CFCBindSpecs *self) {
-    self->novel_specs      = CFCUtil_strdup("");
-    self->overridden_specs = CFCUtil_strdup("");
-    self->inherited_specs  = CFCUtil_strdup("");
-    self->class_specs      = CFCUtil_strdup("");
-    self->init_code        = CFCUtil_strdup("");
+    self->novel_specs      = CFCCharBuf_new(0);
+    self->overridden_specs = CFCCharBuf_new(0);
+    self->inherited_specs  = CFCCharBuf_new(0);
+    self->class_specs      = CFCCharBuf_new(0);
+    self->init_code        = CFCCharBuf_new(0);
 
     return self;
 }
 
 void
 CFCBindSpecs_destroy(CFCBindSpecs *self) {
-    FREEMEM(self->novel_specs);
-    FREEMEM(self->overridden_specs);
-    FREEMEM(self->inherited_specs);
-    FREEMEM(self->class_specs);
-    FREEMEM(self->init_code);
+    CFCBase_decref((CFCBase*)self->novel_specs);
+    CFCBase_decref((CFCBase*)self->overridden_specs);
+    CFCBase_decref((CFCBase*)self->inherited_specs);
+    CFCBase_decref((CFCBase*)self->class_specs);
+    CFCBase_decref((CFCBase*)self->init_code);
     CFCBase_destroy((CFCBase*)self);
 }
 
@@ -142,6 +143,31 @@ CFCBindSpecs_get_typedefs() {
         "\n";
 }
 
+static uint64_t
+S_slot_calls(CFCClass *klass, CFCMethod *method) {
+    // Methods of final classes may be copies. Profile data is attached to
+    // the fresh Method object.
+    const char *name  = CFCMethod_get_name(method);
+    CFCMethod  *fresh = CFCClass_fresh_method(klass, name);
+    return CFCMethod_get_slot_calls(fresh ? fresh : method);
+}
+
+/* Stable insertion sort, descending by slot calls.
+ */
+static void
+S_sort_by_slot_calls(CFCClass *klass, CFCMethod **methods, int num_methods) {
+    for (int i = 1; i < num_methods; i++) {
+        CFCMethod *method = methods[i];
+        uint64_t   calls  = S_slot_calls(klass, method);
+        int j = i;
+        while (j > 0 && S_slot_calls(klass, methods[j-1]) < calls) {
+            methods[j] = methods[j-1];
+            j--;
+        }
+        methods[j] = method;
+    }
+}
+
 void
 CFCBindSpecs_add_class(CFCBindSpecs *self, CFCClass *klass) {
     if (CFCClass_inert(klass)) { return; }
@@ -172,10 +198,8 @@ CFCBindSpecs_add_class(CFCBindSpecs *self, CFCClass *klass) {
             const char *pattern =
                 "    /* %s */\n"
                 "    class_specs[%d].parent = &%s;\n";
-            char *init_code = CFCUtil_sprintf(pattern, class_name,
-                                              self->num_specs, parent_var);
-            self->init_code = CFCUtil_cat(self->init_code, init_code, NULL);
-            FREEMEM(init_code);
+            CFCCharBuf_catf(self->init_code, pattern, class_name,
+                            self->num_specs, parent_var);
         }
     }
 
@@ -184,14 +208,17 @@ CFCBindSpecs_add_class(CFCBindSpecs *self, CFCClass *klass) {
     int num_new_inherited  = 0;
     CFCMethod **methods = CFCClass_methods(klass);
 
+    size_t num_methods = 0;
+    while (methods[num_methods] != NULL) { num_methods++; }
+    CFCMethod **novel_methods
+        = (CFCMethod**)MALLOCATE((num_methods + 1) * sizeof(CFCMethod*));
+
     for (int meth_num = 0; methods[meth_num] != NULL; meth_num++) {
         CFCMethod *method = methods[meth_num];
 
         if (CFCMethod_is_fresh(method, klass)) {
             if (CFCMethod_novel(method)) {
-                int meth_index = self->num_novel + num_new_novel;
-                S_add_novel_meth(self, method, klass, meth_index);
-                ++num_new_novel;
+                novel_methods[num_new_novel++] = method;
             }
             else {
                 int meth_index = self->num_overridden + num_new_overridden;
@@ -206,6 +233,15 @@ CFCBindSpecs_add_class(CFCBindSpecs *self, CFCClass *klass) {
         }
     }
 
+    // Novel methods are assigned vtable slots in the order of their specs.
+    // Sort them by profiled call counts so that hot methods end up next to
+    // each other. Without a profile, the order is left unchanged.
+    S_sort_by_slot_calls(klass, novel_methods, num_new_novel);
+    for (int i = 0; i < num_new_novel; i++) {
+        S_add_novel_meth(self, novel_methods[i], klass, self->num_novel + i);
+    }
+    FREEMEM(novel_methods);
+
     char pattern[] =
         "    {\n"
         "        &%s, /* class */\n"
@@ -218,20 +254,17 @@ CFCBindSpecs_add_class(CFCBindSpecs *self, CFCClass *klass) {
         "        %d, /* num_inherited */\n"
         "        %s /* flags */\n"
         "    }";
-    char *class_spec
-        = CFCUtil_sprintf(pattern, class_var, parent_ptr, class_name,
-                          ivars_size, ivars_offset_name, num_new_novel,
-                          num_new_overridden, num_new_inherited, flags);
-
     const char *sep = self->num_specs == 0 ? "" : ",\n";
-    self->class_specs = CFCUtil_cat(self->class_specs, sep, class_spec, NULL);
+    CFCCharBuf_cat(self->class_specs, sep, NULL);
+    CFCCharBuf_catf(self->class_specs, pattern, class_var, parent_ptr,
+                    class_name, ivars_size, ivars_offset_name, num_new_novel,
+                    num_new_overridden, num_new_inherited, flags);
 
     self->num_novel      += num_new_novel;
     self->num_overridden += num_new_overridden;
     self->num_inherited  += num_new_inherited;
     self->num_specs      += 1;
 
-    FREEMEM(class_spec);
     FREEMEM(parent_ptr);
     FREEMEM(ivars_size);
 }
@@ -240,6 +273,11 @@ char*
 CFCBindSpecs_defs(CFCBindSpecs *self) {
     if (self->num_specs == 0) { return CFCUtil_strdup(""); }
 
+    const char *novel_text      = CFCCharBuf_get_text(self->novel_specs);
+    const char *overridden_text = CFCCharBuf_get_text(self->overridden_specs);
+    const char *inherited_text  = CFCCharBuf_get_text(self->inherited_specs);
+    const char *class_text      = CFCCharBuf_get_text(self->class_specs);
+
     const char *novel_pattern =
         "static cfish_NovelMethSpec novel_specs[] = {\n"
         "%s\n"
@@ -247,7 +285,7 @@ CFCBindSpecs_defs(CFCBindSpecs *self) {
         "\n";
     char *novel_specs = self->num_novel == 0
                         ? CFCUtil_strdup("")
-                        : CFCUtil_sprintf(novel_pattern, self->novel_specs);
+                        : CFCUtil_sprintf(novel_pattern, novel_text);
 
     const char *overridden_pattern =
         "static cfish_OverriddenMethSpec overridden_specs[] = {\n"
@@ -257,7 +295,7 @@ CFCBindSpecs_defs(CFCBindSpecs *self) {
     char *overridden_specs = self->num_overridden == 0
                              ? CFCUtil_strdup("")
                              : CFCUtil_sprintf(overridden_pattern,
-                                               self->overridden_specs);
+                                               overridden_text);
 
     const char *inherited_pattern =
         "static cfish_InheritedMethSpec inherited_specs[] = {\n"
@@ -267,7 +305,7 @@ CFCBindSpecs_defs(CFCBindSpecs *self) {
     char *inherited_specs = self->num_inherited == 0
                             ? CFCUtil_strdup("")
                             : CFCUtil_sprintf(inherited_pattern,
-                                              self->inherited_specs);
+                                              inherited_text);
 
     const char *pattern =
         "%s"
@@ -285,7 +323,7 @@ CFCBindSpecs_defs(CFCBindSpecs *self) {
         "    %d\n" // num_classes
         "};\n";
     char *defs = CFCUtil_sprintf(pattern, novel_specs, overridden_specs,
-                                 inherited_specs, self->class_specs,
+                                 inherited_specs, class_text,
                                  self->num_specs);
 
     FREEMEM(inherited_specs);
@@ -303,7 +341,7 @@ CFCBindSpecs_init_func_def(CFCBindSpecs *self) {
         "\n"
         "    cfish_Class_bootstrap(&parcel_spec);\n"
         "}\n";
-    return CFCUtil_sprintf(pattern, self->init_code);
+    return CFCUtil_sprintf(pattern, CFCCharBuf_get_text(self->init_code));
 }
 
 static char*
@@ -356,12 +394,10 @@ S_add_novel_meth(CFCBindSpecs *self, CFCMethod *method, CFCClass *klass,
         "        (cfish_method_t)%s, /* func */\n"
         "        (cfish_method_t)%s /* callback_func */\n"
         "    }";
-    char *def
-        = CFCUtil_sprintf(pattern, full_offset_sym, meth_name, imp_func,
-                          full_override_sym);
-    self->novel_specs = CFCUtil_cat(self->novel_specs, sep, def, NULL);
+    CFCCharBuf_cat(self->novel_specs, sep, NULL);
+    CFCCharBuf_catf(self->novel_specs, pattern, full_offset_sym, meth_name,
+                    imp_func, full_override_sym);
 
-    FREEMEM(def);
     FREEMEM(full_offset_sym);
     FREEMEM(imp_func);
     FREEMEM(full_override_sym);
@@ -386,10 +422,8 @@ S_parent_offset(CFCBindSpecs *self, CFCMethod *method, CFCClass *klass,
         parent_offset = CFCUtil_strdup("NULL");
 
         char pattern[] = "    %s_specs[%d].parent_offset = &%s;\n";
-        char *code = CFCUtil_sprintf(pattern, meth_type, meth_index,
-                                     parent_offset_sym);
-        self->init_code = CFCUtil_cat(self->init_code, code, NULL);
-        FREEMEM(code);
+        CFCCharBuf_catf(self->init_code, pattern, meth_type, meth_index,
+                        parent_offset_sym);
     }
 
     FREEMEM(parent_offset_sym);
@@ -413,12 +447,10 @@ S_add_overridden_meth(CFCBindSpecs *self, CFCMethod *method, CFCClass *klass,
         "        %s, /* parent_offset */\n"
         "        (cfish_method_t)%s /* func */\n"
         "    }";
-    char *def
-        = CFCUtil_sprintf(pattern, full_offset_sym, parent_offset, imp_func);
-    self->overridden_specs
-        = CFCUtil_cat(self->overridden_specs, sep, def, NULL);
+    CFCCharBuf_cat(self->overridden_specs, sep, NULL);
+    CFCCharBuf_catf(self->overridden_specs, pattern, full_offset_sym,
+                    parent_offset, imp_func);
 
-    FREEMEM(def);
     FREEMEM(parent_offset);
     FREEMEM(full_offset_sym);
     FREEMEM(imp_func);
@@ -438,10 +470,10 @@ S_add_inherited_meth(CFCBindSpecs *self, CFCMethod *method, CFCClass *klass,
         "        &%s, /* offset */\n"
         "        %s /* parent_offset */\n"
         "    }";
-    char *def = CFCUtil_sprintf(pattern, full_offset_sym, parent_offset);
-    self->inherited_specs = CFCUtil_cat(self->inherited_specs, sep, def, NULL);
+    CFCCharBuf_cat(self->inherited_specs, sep, NULL);
+    CFCCharBuf_catf(self->inherited_specs, pattern, full_offset_sym,
+                    parent_offset);
 
-    FREEMEM(def);
     FREEMEM(full_offset_sym);
     FREEMEM(parent_offset);
 }
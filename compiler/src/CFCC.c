@@ -41,6 +41,14 @@ struct CFCC {
     char         *man_footer;
 };
 
+typedef struct CFCCManPages {
+    CFCClass **classes;
+    char     **pages;
+} CFCCManPages;
+
+static void
+S_create_man_page(void *context, size_t tick);
+
 static const CFCMeta CFCC_META = {
     "Clownfish::CFC::Binding::C",
     sizeof(CFCC),
@@ -96,16 +104,20 @@ CFCC_write_man_pages(CFCC *self) {
     }
     char **man_pages = (char**)CALLOCATE(num_classes, sizeof(char*));
 
-    // Generate man pages, but don't write.  That way, if there's an error
-    // while generating the pages, we leak memory but don't clutter up the file 
-    // system.
+    // Generate man pages concurrently, but don't write.  That way, if
+    // there's an error while generating the pages, we leak memory but don't
+    // clutter up the file system.
+    CFCCManPages context;
+    context.classes = (CFCClass**)MALLOCATE((num_classes + 1)
+                                            * sizeof(CFCClass*));
+    context.pages   = man_pages;
     for (size_t i = 0, j = 0; ordered[i] != NULL; i++) {
         CFCClass *klass = ordered[i];
         if (CFCClass_included(klass)) { continue; }
-
-        char *man_page = CFCCMan_create_man_page(klass);
-        man_pages[j++] = man_page;
+        context.classes[j++] = klass;
     }
+    CFCUtil_run_parallel(S_create_man_page, &context, num_classes);
+    FREEMEM(context.classes);
 
     const char *dest = CFCHierarchy_get_dest(hierarchy);
     char *man3_path
@@ -141,6 +153,12 @@ CFCC_write_man_pages(CFCC *self) {
     FREEMEM(ordered);
 }
 
+static void
+S_create_man_page(void *context, size_t tick) {
+    CFCCManPages *man_pages = (CFCCManPages*)context;
+    man_pages->pages[tick] = CFCCMan_create_man_page(man_pages->classes[tick]);
+}
+
 void
 CFCC_write_hostdefs(CFCC *self) {
     const char pattern[] =
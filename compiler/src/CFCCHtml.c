@@ -57,6 +57,14 @@ struct CFCCHtml {
     char *index_filename;
 };
 
+typedef struct CFCCHtmlDocs {
+    CFCCHtml     *self;
+    CFCClass    **classes;
+    size_t        num_classes;
+    CFCDocument **md_docs;
+    char        **html_docs;
+} CFCCHtmlDocs;
+
 static const CFCMeta CFCCHTML_META = {
     "Clownfish::CFC::Binding::C::Html",
     sizeof(CFCCHtml),
@@ -125,6 +133,9 @@ S_create_standalone_doc(CFCCHtml *self, CFCDocument *doc);
 static int
 S_compare_class_name(const void *va, const void *vb);
 
+static void
+S_create_doc(void *context, size_t tick);
+
 static int
 S_compare_doc_path(const void *va, const void *vb);
 
@@ -266,6 +277,15 @@ CFCCHtml_write_html_docs(CFCCHtml *self) {
         num_docs++;
     }
 
+    // Class and standalone docs are generated concurrently.
+    CFCCHtmlDocs docs;
+    docs.self        = self;
+    docs.classes     = (CFCClass**)MALLOCATE((num_classes + 1)
+                                             * sizeof(CFCClass*));
+    docs.num_classes = 0;
+    docs.md_docs     = md_docs;
+    docs.html_docs   = html_docs + num_docs;
+
     for (size_t i = 0; ordered[i] != NULL; i++) {
         CFCClass *klass = ordered[i];
         if (CFCClass_included(klass) || !CFCClass_public(klass)) {
@@ -275,7 +295,7 @@ CFCCHtml_write_html_docs(CFCCHtml *self) {
         const char *class_name = CFCClass_get_name(klass);
         char *path = CFCUtil_global_replace(class_name, "::", CHY_DIR_SEP);
         filenames[num_docs] = CFCUtil_sprintf("%s.html", path);
-        html_docs[num_docs] = CFCCHtml_create_html_doc(self, klass);
+        docs.classes[docs.num_classes++] = klass;
         ++num_docs;
 
         FREEMEM(path);
@@ -285,10 +305,13 @@ CFCCHtml_write_html_docs(CFCCHtml *self) {
         CFCDocument *md_doc = md_docs[i];
         const char *path = CFCDocument_get_path_part(md_doc);
         filenames[num_docs] = CFCUtil_sprintf("%s.html", path);
-        html_docs[num_docs] = S_create_standalone_doc(self, md_doc);
         ++num_docs;
     }
 
+    CFCUtil_run_parallel(S_create_doc, &docs,
+                         docs.num_classes + num_md_docs);
+    FREEMEM(docs.classes);
+
     // Write out docs.
 
     for (size_t i = 0; i < num_docs; ++i) {
@@ -329,6 +352,19 @@ CFCCHtml_write_html_docs(CFCCHtml *self) {
     FREEMEM(ordered);
 }
 
+static void
+S_create_doc(void *context, size_t tick) {
+    CFCCHtmlDocs *docs = (CFCCHtmlDocs*)context;
+    if (tick < docs->num_classes) {
+        docs->html_docs[tick]
+            = CFCCHtml_create_html_doc(docs->self, docs->classes[tick]);
+    }
+    else {
+        CFCDocument *md_doc = docs->md_docs[tick - docs->num_classes];
+        docs->html_docs[tick] = S_create_standalone_doc(docs->self, md_doc);
+    }
+}
+
 char*
 S_create_index_doc(CFCCHtml *self, CFCClass **classes, CFCDocument **docs) {
     CFCParcel **parcels = CFCParcel_all_parcels();
@@ -0,0 +1,137 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "charmony.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/* va_copy is not part of C89. Assume that simple assignment works if it
+ * isn't defined.
+ */
+#ifndef va_copy
+  #define va_copy(dst, src) ((dst) = (src))
+#endif
+
+#define CFC_NEED_BASE_STRUCT_DEF
+#include "CFCBase.h"
+#include "CFCCharBuf.h"
+#include "CFCUtil.h"
+
+struct CFCCharBuf {
+    CFCBase base;
+    char   *ptr;
+    size_t  size;
+    size_t  capacity;
+};
+
+static const CFCMeta CFCCHARBUF_META = {
+    "Clownfish::CFC::Util::CharBuf",
+    sizeof(CFCCharBuf),
+    (CFCBase_destroy_t)CFCCharBuf_destroy
+};
+
+CFCCharBuf*
+CFCCharBuf_new(size_t capacity) {
+    CFCCharBuf *self = (CFCCharBuf*)CFCBase_allocate(&CFCCHARBUF_META);
+    return CFCCharBuf_init(self, capacity);
+}
+
+CFCCharBuf*
+CFCCharBuf_init(CFCCharBuf *self, size_t capacity) {
+    self->capacity = capacity < 64 ? 64 : capacity;
+    self->ptr      = (char*)MALLOCATE(self->capacity + 1);
+    self->ptr[0]   = '\0';
+    self->size     = 0;
+    return self;
+}
+
+void
+CFCCharBuf_destroy(CFCCharBuf *self) {
+    FREEMEM(self->ptr);
+    CFCBase_destroy((CFCBase*)self);
+}
+
+// Make room for `extra` more bytes plus the terminating NUL.
+static void
+S_grow(CFCCharBuf *self, size_t extra) {
+    size_t min_capacity = self->size + extra;
+    if (min_capacity <= self->capacity) { return; }
+
+    size_t capacity = self->capacity * 2;
+    if (capacity < min_capacity) { capacity = min_capacity; }
+    self->ptr      = (char*)REALLOCATE(self->ptr, capacity + 1);
+    self->capacity = capacity;
+}
+
+void
+CFCCharBuf_cat(CFCCharBuf *self, ...) {
+    va_list args;
+    const char *appended;
+    va_start(args, self);
+    while (NULL != (appended = va_arg(args, const char*))) {
+        CFCCharBuf_cat_len(self, appended, strlen(appended));
+    }
+    va_end(args);
+}
+
+void
+CFCCharBuf_cat_len(CFCCharBuf *self, const char *ptr, size_t len) {
+    S_grow(self, len);
+    memcpy(self->ptr + self->size, ptr, len);
+    self->size += len;
+    self->ptr[self->size] = '\0';
+}
+
+void
+CFCCharBuf_catf(CFCCharBuf *self, const char *fmt, ...) {
+    va_list args;
+    va_list args_copy;
+
+    va_start(args, fmt);
+    va_copy(args_copy, args);
+#if defined(CHY_HAS_C99_SNPRINTF)
+    int size = vsnprintf(NULL, 0, fmt, args_copy);
+    if (size < 0) { CFCUtil_die("snprintf failed"); }
+#else
+    int size = _vscprintf(fmt, args_copy);
+    if (size < 0) { CFCUtil_die("_scprintf failed"); }
+#endif
+    va_end(args_copy);
+
+    S_grow(self, (size_t)size);
+    vsprintf(self->ptr + self->size, fmt, args);
+    self->size += (size_t)size;
+    va_end(args);
+}
+
+const char*
+CFCCharBuf_get_text(CFCCharBuf *self) {
+    return self->ptr;
+}
+
+size_t
+CFCCharBuf_get_size(CFCCharBuf *self) {
+    return self->size;
+}
+
+char*
+CFCCharBuf_yield_string(CFCCharBuf *self) {
+    char *string = self->ptr;
+    CFCCharBuf_init(self, 0);
+    return string;
+}
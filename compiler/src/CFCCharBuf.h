@@ -0,0 +1,84 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** Clownfish::CFC::Util::CharBuf - Growable string buffer.
+ *
+ * Appending to a CharBuf takes amortized constant time per byte, unlike
+ * CFCUtil_cat which rescans and reallocates the whole string on every
+ * call. Code generators should use it to accumulate output in loops.
+ */
+
+#ifndef H_CFCCHARBUF
+#define H_CFCCHARBUF
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+typedef struct CFCCharBuf CFCCharBuf;
+
+/**
+ * @param capacity Initial capacity in bytes, not counting the terminating
+ * NUL.
+ */
+CFCCharBuf*
+CFCCharBuf_new(size_t capacity);
+
+CFCCharBuf*
+CFCCharBuf_init(CFCCharBuf *self, size_t capacity);
+
+void
+CFCCharBuf_destroy(CFCCharBuf *self);
+
+/** Append a NULL-terminated list of strings.
+ */
+void
+CFCCharBuf_cat(CFCCharBuf *self, ...);
+
+/** Append `len` bytes from `ptr`.
+ */
+void
+CFCCharBuf_cat_len(CFCCharBuf *self, const char *ptr, size_t len);
+
+/** Append content defined by a printf format string and additional
+ * arguments.
+ */
+void
+CFCCharBuf_catf(CFCCharBuf *self, const char *fmt, ...);
+
+/** Return the NUL-terminated content of the buffer. The pointer is
+ * invalidated by the next append.
+ */
+const char*
+CFCCharBuf_get_text(CFCCharBuf *self);
+
+size_t
+CFCCharBuf_get_size(CFCCharBuf *self);
+
+/** Return the content as a dynamically allocated string which must be freed
+ * by the caller, and leave the buffer empty.
+ */
+char*
+CFCCharBuf_yield_string(CFCCharBuf *self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H_CFCCHARBUF */
+
@@ -28,6 +28,7 @@
 #include "CFCClass.h"
 #include "CFCSymbol.h"
 #include "CFCFunction.h"
+#include "CFCHash.h"
 #include "CFCMethod.h"
 #include "CFCParcel.h"
 #include "CFCDocuComment.h"
@@ -35,15 +36,16 @@
 #include "CFCVariable.h"
 #include "CFCFileSpec.h"
 
-typedef struct CFCClassRegEntry {
-    char *key;
-    struct CFCClass *klass;
-} CFCClassRegEntry;
-
-static CFCClassRegEntry *registry = NULL;
+static CFCClass **registry = NULL;
 static size_t registry_size = 0;
 static size_t registry_cap  = 0;
 
+// Indices into the registry by class name, full struct symbol, and parcel
+// prefix plus nickname.
+static CFCHash *registry_by_name       = NULL;
+static CFCHash *registry_by_struct_sym = NULL;
+static CFCHash *registry_by_nickname   = NULL;
+
 // Store a new CFCClass in a registry.
 static void
 S_register(CFCClass *self);
@@ -373,46 +375,45 @@ CFCClass_destroy(CFCClass *self) {
 static void
 S_register(CFCClass *self) {
     if (registry_size == registry_cap) {
-        size_t new_cap = registry_cap + 10;
-        registry = (CFCClassRegEntry*)REALLOCATE(
-                       registry,
-                       (new_cap + 1) * sizeof(CFCClassRegEntry));
-        for (size_t i = registry_cap; i <= new_cap; i++) {
-            registry[i].key = NULL;
-            registry[i].klass = NULL;
-        }
+        size_t new_cap = registry_cap ? registry_cap * 2 : 16;
+        registry = (CFCClass**)REALLOCATE(registry,
+                                          (new_cap + 1) * sizeof(CFCClass*));
         registry_cap = new_cap;
     }
+    if (!registry_by_name) {
+        registry_by_name       = CFCHash_new(0);
+        registry_by_struct_sym = CFCHash_new(0);
+        registry_by_nickname   = CFCHash_new(0);
+    }
 
-    const char *prefix   = CFCParcel_get_prefix(self->parcel);
-    const char *name     = self->name;
-    const char *nickname = self->nickname;
-    const char *key      = self->full_struct_sym;
-
-    for (size_t i = 0; i < registry_size; i++) {
-        CFCClass   *other          = registry[i].klass;
-        const char *other_prefix   = CFCParcel_get_prefix(other->parcel);
-        const char *other_name     = other->name;
-        const char *other_nickname = other->nickname;
+    const char *prefix       = CFCParcel_get_prefix(self->parcel);
+    const char *name         = self->name;
+    const char *key          = self->full_struct_sym;
+    char       *nickname_key = CFCUtil_sprintf("%s %s", prefix,
+                                               self->nickname);
+    CFCClass   *other;
 
-        if (strcmp(name, other_name) == 0) {
-            CFCUtil_die("Two classes with name %s", name);
-        }
-        if (strcmp(registry[i].key, key) == 0) {
-            CFCUtil_die("Class name conflict between %s and %s",
-                        name, other_name);
-        }
-        if (strcmp(prefix, other_prefix) == 0
-            && strcmp(nickname, other_nickname) == 0
-           ) {
-            CFCUtil_die("Class nickname conflict between %s and %s",
-                        name, other_name);
-        }
+    if (CFCHash_fetch(registry_by_name, name)) {
+        CFCUtil_die("Two classes with name %s", name);
+    }
+    other = (CFCClass*)CFCHash_fetch(registry_by_struct_sym, key);
+    if (other) {
+        CFCUtil_die("Class name conflict between %s and %s",
+                    name, other->name);
+    }
+    other = (CFCClass*)CFCHash_fetch(registry_by_nickname, nickname_key);
+    if (other) {
+        CFCUtil_die("Class nickname conflict between %s and %s",
+                    name, other->name);
     }
 
-    registry[registry_size].key   = CFCUtil_strdup(key);
-    registry[registry_size].klass = (CFCClass*)CFCBase_incref((CFCBase*)self);
-    registry_size++;
+    CFCHash_store(registry_by_name, name, self);
+    CFCHash_store(registry_by_struct_sym, key, self);
+    CFCHash_store(registry_by_nickname, nickname_key, self);
+    FREEMEM(nickname_key);
+
+    registry[registry_size++] = (CFCClass*)CFCBase_incref((CFCBase*)self);
+    registry[registry_size]   = NULL;
 }
 
 #define MAX_SINGLETON_LEN 256
@@ -442,30 +443,39 @@ CFCClass*
 CFCClass_fetch_by_struct_sym(const char *key) {
     CFCUTIL_NULL_CHECK(key);
 
-    for (size_t i = 0; i < registry_size; i++) {
-        if (strcmp(registry[i].key, key) == 0) {
-            return registry[i].klass;
-        }
-    }
-    return NULL;
+    if (!registry_by_struct_sym) { return NULL; }
+    return (CFCClass*)CFCHash_fetch(registry_by_struct_sym, key);
+}
+
+CFCClass*
+CFCClass_fetch_by_name(const char *class_name) {
+    CFCUTIL_NULL_CHECK(class_name);
+
+    if (!registry_by_name) { return NULL; }
+    return (CFCClass*)CFCHash_fetch(registry_by_name, class_name);
 }
 
 void
 CFCClass_clear_registry(void) {
     for (size_t i = 0; i < registry_size; i++) {
-        CFCClass *klass = registry[i].klass;
+        CFCClass *klass = registry[i];
         if (klass->parent) {
             // Break circular ref.
             CFCBase_decref((CFCBase*)klass->parent);
             klass->parent = NULL;
         }
         CFCBase_decref((CFCBase*)klass);
-        FREEMEM(registry[i].key);
     }
     FREEMEM(registry);
-    registry_size = 0;
-    registry_cap  = 0;
-    registry      = NULL;
+    CFCBase_decref((CFCBase*)registry_by_name);
+    CFCBase_decref((CFCBase*)registry_by_struct_sym);
+    CFCBase_decref((CFCBase*)registry_by_nickname);
+    registry_size          = 0;
+    registry_cap           = 0;
+    registry               = NULL;
+    registry_by_name       = NULL;
+    registry_by_struct_sym = NULL;
+    registry_by_nickname   = NULL;
 }
 
 void
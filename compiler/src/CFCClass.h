@@ -102,6 +102,13 @@ CFCClass_fetch_singleton(struct CFCParcel *parcel, const char *class_name);
 CFCClass*
 CFCClass_fetch_by_struct_sym(const char *full_struct_sym);
 
+/** Retrieve a Class by its full name, e.g. "Crustacean::Lobster".
+ *
+ * @param class_name The name of the Class.
+ */
+CFCClass*
+CFCClass_fetch_by_name(const char *class_name);
+
 /** Empty out the registry, decrementing the refcount of all Class singleton
  * objects.
  */
@@ -207,6 +207,30 @@ CFCDocuComment_parse(const char *raw_text) {
     return self;
 }
 
+CFCDocuComment*
+CFCDocuComment_new(const char *description, const char *brief,
+                   const char *long_des, const char **param_names,
+                   const char **param_docs, const char *retval) {
+    CFCDocuComment *self
+        = (CFCDocuComment*)CFCBase_allocate(&CFCDOCUCOMMENT_META);
+
+    size_t num_params = 0;
+    while (param_names[num_params]) { num_params++; }
+    self->param_names = (char**)CALLOCATE(num_params + 1, sizeof(char*));
+    self->param_docs  = (char**)CALLOCATE(num_params + 1, sizeof(char*));
+    for (size_t i = 0; i < num_params; i++) {
+        self->param_names[i] = CFCUtil_strdup(param_names[i]);
+        self->param_docs[i]  = CFCUtil_strdup(param_docs[i]);
+    }
+
+    self->description = CFCUtil_strdup(description);
+    self->brief       = CFCUtil_strdup(brief);
+    self->long_des    = CFCUtil_strdup(long_des);
+    self->retval      = CFCUtil_strdup(retval);
+
+    return self;
+}
+
 void
 CFCDocuComment_destroy(CFCDocuComment *self) {
     CFCUtil_free_string_array(self->param_names);
@@ -33,6 +33,18 @@ struct cmark_node;
 CFCDocuComment*
 CFCDocuComment_parse(const char *raw_text);
 
+/** Create a DocuComment from its already parsed components.
+ *
+ * @param param_names A NULL-terminated array of parameter names.
+ * @param param_docs A NULL-terminated array with the documentation of each
+ * parameter.
+ * @param retval The documentation of the return value. May be NULL.
+ */
+CFCDocuComment*
+CFCDocuComment_new(const char *description, const char *brief,
+                   const char *long_des, const char **param_names,
+                   const char **param_docs, const char *retval);
+
 void
 CFCDocuComment_destroy(CFCDocuComment *self);
 
@@ -40,6 +40,7 @@ struct CFCFile {
     CFCClass **classes;
     CFCFileSpec *spec;
     int modified;
+    char *content_hash;
     char *guard_name;
     char *guard_start;
     char *guard_close;
@@ -64,6 +65,7 @@ CFCFile_init(CFCFile *self, CFCParcel *parcel, CFCFileSpec *spec) {
     CFCUTIL_NULL_CHECK(spec);
     self->parcel     = (CFCParcel*)CFCBase_incref((CFCBase*)parcel);
     self->modified   = false;
+    self->content_hash = NULL;
     self->spec       = (CFCFileSpec*)CFCBase_incref((CFCBase*)spec);
     self->blocks     = (CFCBase**)CALLOCATE(1, sizeof(CFCBase*));
     self->classes    = (CFCClass**)CALLOCATE(1, sizeof(CFCBase*));
@@ -103,6 +105,7 @@ CFCFile_destroy(CFCFile *self) {
         CFCBase_decref((CFCBase*)self->classes[i]);
     }
     FREEMEM(self->classes);
+    FREEMEM(self->content_hash);
     FREEMEM(self->guard_name);
     FREEMEM(self->guard_start);
     FREEMEM(self->guard_close);
@@ -210,6 +213,17 @@ CFCFile_get_modified(CFCFile *self) {
     return self->modified;
 }
 
+void
+CFCFile_set_content_hash(CFCFile *self, const char *content_hash) {
+    FREEMEM(self->content_hash);
+    self->content_hash = CFCUtil_strdup(content_hash);
+}
+
+const char*
+CFCFile_get_content_hash(CFCFile *self) {
+    return self->content_hash;
+}
+
 const char*
 CFCFile_get_source_dir(CFCFile *self) {
     return CFCFileSpec_get_source_dir(self->spec);
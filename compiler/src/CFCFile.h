@@ -90,6 +90,15 @@ CFCFile_set_modified(CFCFile *self, int modified);
 int
 CFCFile_get_modified(CFCFile *self);
 
+/** Setter for the content hash of the source .cfh file, which is used to
+ * decide whether generated files are current.  Initially NULL.
+ */
+void
+CFCFile_set_content_hash(CFCFile *self, const char *content_hash);
+
+const char*
+CFCFile_get_content_hash(CFCFile *self);
+
 const char*
 CFCFile_get_source_dir(CFCFile *self);
 
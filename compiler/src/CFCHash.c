@@ -0,0 +1,155 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "charmony.h"
+
+#include <string.h>
+
+#define CFC_NEED_BASE_STRUCT_DEF
+#include "CFCBase.h"
+#include "CFCHash.h"
+#include "CFCUtil.h"
+
+typedef struct CFCHashEntry {
+    char   *key;
+    void   *value;
+    size_t  hash_sum;
+} CFCHashEntry;
+
+struct CFCHash {
+    CFCBase base;
+    CFCHashEntry *entries;
+    size_t capacity;
+    size_t size;
+};
+
+static const CFCMeta CFCHASH_META = {
+    "Clownfish::CFC::Util::Hash",
+    sizeof(CFCHash),
+    (CFCBase_destroy_t)CFCHash_destroy
+};
+
+// FNV-1a.
+static size_t
+S_hash_sum(const char *key) {
+    uint64_t hash_sum = UINT64_C(0xcbf29ce484222325);
+    for (const unsigned char *ptr = (const unsigned char*)key; *ptr; ptr++) {
+        hash_sum ^= *ptr;
+        hash_sum *= UINT64_C(0x100000001b3);
+    }
+    return (size_t)hash_sum;
+}
+
+// Find the slot of `key` or the empty slot where it would be inserted.
+static CFCHashEntry*
+S_find_entry(CFCHashEntry *entries, size_t capacity, const char *key,
+             size_t hash_sum) {
+    size_t mask = capacity - 1;
+    for (size_t tick = hash_sum & mask; ; tick = (tick + 1) & mask) {
+        CFCHashEntry *entry = &entries[tick];
+        if (entry->key == NULL
+            || (entry->hash_sum == hash_sum && strcmp(entry->key, key) == 0)
+           ) {
+            return entry;
+        }
+    }
+}
+
+static void
+S_grow(CFCHash *self) {
+    size_t        old_capacity = self->capacity;
+    CFCHashEntry *old_entries  = self->entries;
+
+    self->capacity *= 2;
+    self->entries = (CFCHashEntry*)CALLOCATE(self->capacity,
+                                             sizeof(CFCHashEntry));
+    for (size_t i = 0; i < old_capacity; i++) {
+        CFCHashEntry *old_entry = &old_entries[i];
+        if (old_entry->key == NULL) { continue; }
+        CFCHashEntry *entry = S_find_entry(self->entries, self->capacity,
+                                           old_entry->key,
+                                           old_entry->hash_sum);
+        *entry = *old_entry;
+    }
+
+    FREEMEM(old_entries);
+}
+
+CFCHash*
+CFCHash_new(size_t capacity) {
+    CFCHash *self = (CFCHash*)CFCBase_allocate(&CFCHASH_META);
+    return CFCHash_init(self, capacity);
+}
+
+CFCHash*
+CFCHash_init(CFCHash *self, size_t capacity) {
+    // Keep the load factor at or below 0.5.
+    size_t min_capacity = capacity * 2;
+    self->capacity = 16;
+    while (self->capacity < min_capacity) {
+        self->capacity *= 2;
+    }
+    self->entries = (CFCHashEntry*)CALLOCATE(self->capacity,
+                                             sizeof(CFCHashEntry));
+    self->size = 0;
+    return self;
+}
+
+void
+CFCHash_destroy(CFCHash *self) {
+    for (size_t i = 0; i < self->capacity; i++) {
+        FREEMEM(self->entries[i].key);
+    }
+    FREEMEM(self->entries);
+    CFCBase_destroy((CFCBase*)self);
+}
+
+void*
+CFCHash_store(CFCHash *self, const char *key, void *value) {
+    CFCUTIL_NULL_CHECK(key);
+    if ((self->size + 1) * 2 > self->capacity) {
+        S_grow(self);
+    }
+
+    size_t hash_sum = S_hash_sum(key);
+    CFCHashEntry *entry = S_find_entry(self->entries, self->capacity, key,
+                                       hash_sum);
+    if (entry->key != NULL) {
+        void *old_value = entry->value;
+        entry->value = value;
+        return old_value;
+    }
+
+    entry->key      = CFCUtil_strdup(key);
+    entry->value    = value;
+    entry->hash_sum = hash_sum;
+    self->size++;
+    return NULL;
+}
+
+void*
+CFCHash_fetch(CFCHash *self, const char *key) {
+    CFCUTIL_NULL_CHECK(key);
+    size_t hash_sum = S_hash_sum(key);
+    CFCHashEntry *entry = S_find_entry(self->entries, self->capacity, key,
+                                       hash_sum);
+    return entry->value;
+}
+
+size_t
+CFCHash_get_size(CFCHash *self) {
+    return self->size;
+}
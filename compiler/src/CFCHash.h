@@ -0,0 +1,66 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** Clownfish::CFC::Util::Hash - String-keyed hash table.
+ *
+ * Maps NUL-terminated strings to arbitrary pointers. Keys are copied. Values
+ * are not refcounted, so the caller must keep them alive while they're
+ * stored in the table.
+ */
+
+#ifndef H_CFCHASH
+#define H_CFCHASH
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+typedef struct CFCHash CFCHash;
+
+/**
+ * @param capacity Number of entries the table can hold without growing.
+ */
+CFCHash*
+CFCHash_new(size_t capacity);
+
+CFCHash*
+CFCHash_init(CFCHash *self, size_t capacity);
+
+void
+CFCHash_destroy(CFCHash *self);
+
+/** Store a value, replacing any value previously stored under the same key.
+ *
+ * @return the replaced value or NULL.
+ */
+void*
+CFCHash_store(CFCHash *self, const char *key, void *value);
+
+/** Return the value stored under `key` or NULL.
+ */
+void*
+CFCHash_fetch(CFCHash *self, const char *key);
+
+size_t
+CFCHash_get_size(CFCHash *self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H_CFCHASH */
@@ -31,13 +31,22 @@
 #define CFC_NEED_BASE_STRUCT_DEF
 #include "CFCBase.h"
 #include "CFCHierarchy.h"
+#include "CFCCallable.h"
+#include "CFCCharBuf.h"
 #include "CFCClass.h"
 #include "CFCFile.h"
 #include "CFCFileSpec.h"
+#include "CFCFunction.h"
+#include "CFCHash.h"
+#include "CFCMethod.h"
+#include "CFCParamList.h"
 #include "CFCParcel.h"
+#include "CFCParseCache.h"
 #include "CFCSymbol.h"
+#include "CFCType.h"
 #include "CFCUtil.h"
 #include "CFCParser.h"
+#include "CFCVariable.h"
 #include "CFCDocument.h"
 
 struct CFCHierarchy {
@@ -59,6 +68,16 @@ struct CFCHierarchy {
     CFCClass **classes;
     size_t classes_cap;
     size_t num_classes;
+    CFCHash *files_by_path_part;
+    CFCHash *classes_by_name;
+    char *cache_path;
+    int cache_loaded;
+    char **cached_paths;
+    char **cached_hashes;
+    size_t num_cached;
+    char *cached_inputs_hash;
+    CFCCharBuf *inputs;
+    CFCParseCache *parse_cache;
 };
 
 typedef struct CFCFindFilesContext {
@@ -67,11 +86,19 @@ typedef struct CFCFindFilesContext {
     size_t       num_paths;
 } CFCFindFilesContext;
 
+typedef struct CFCSourceText {
+    const char *path;
+    char       *path_part;
+    char       *content;
+    char       *content_hash;
+} CFCSourceText;
+
 static void
 S_do_make_path(const char *path);
 
 static void
-S_parse_parcel_files(const char *source_dir, int is_included);
+S_parse_parcel_files(CFCHierarchy *self, const char *source_dir,
+                     int is_included);
 
 static void
 S_check_prereqs(CFCHierarchy *self);
@@ -79,6 +106,12 @@ S_check_prereqs(CFCHierarchy *self);
 static void
 S_parse_cf_files(CFCHierarchy *self, const char *source_dir, int is_included);
 
+static void
+S_read_source_text(void *context, size_t tick);
+
+static void
+S_cache_c_strings(CFCClass *klass);
+
 static void
 S_find_doc_files(const char *source_dir);
 
@@ -104,6 +137,19 @@ S_fetch_file(CFCHierarchy *self, const char *path_part);
 static int
 S_do_propagate_modified(CFCHierarchy *self, CFCClass *klass, int modified);
 
+static int
+S_file_exists(const char *path);
+
+static void
+S_load_cache(CFCHierarchy *self);
+
+static int
+S_is_current(CFCHierarchy *self, CFCFile *file, const char *source_path,
+             const char *h_path);
+
+static char*
+S_inputs_hash(CFCHierarchy *self);
+
 static const CFCMeta CFCHIERARCHY_META = {
     "Clownfish::CFC::Model::Hierarchy",
     sizeof(CFCHierarchy),
@@ -136,13 +182,28 @@ CFCHierarchy_init(CFCHierarchy *self, const char *dest) {
     self->classes      = (CFCClass**)CALLOCATE(
                             (self->classes_cap + 1), sizeof(CFCClass*));
     self->num_classes  = 0;
+    self->files_by_path_part = CFCHash_new(0);
+    self->classes_by_name    = CFCHash_new(0);
     self->parser       = CFCParser_new();
+    self->cache_loaded  = false;
+    self->cached_paths  = (char**)CALLOCATE(1, sizeof(char*));
+    self->cached_hashes = (char**)CALLOCATE(1, sizeof(char*));
+    self->num_cached    = 0;
+    self->cached_inputs_hash = NULL;
+    self->inputs        = CFCCharBuf_new(0);
 
     self->inc_dest = CFCUtil_sprintf("%s" CHY_DIR_SEP "include", self->dest);
     self->src_dest = CFCUtil_sprintf("%s" CHY_DIR_SEP "source", self->dest);
+    self->cache_path
+        = CFCUtil_sprintf("%s" CHY_DIR_SEP "build_cache.txt", self->dest);
     S_do_make_path(self->inc_dest);
     S_do_make_path(self->src_dest);
 
+    char *parse_cache_path
+        = CFCUtil_sprintf("%s" CHY_DIR_SEP "parse_cache", self->dest);
+    self->parse_cache = CFCParseCache_new(parse_cache_path);
+    FREEMEM(parse_cache_path);
+
     return self;
 }
 
@@ -160,12 +221,20 @@ CFCHierarchy_destroy(CFCHierarchy *self) {
     CFCUtil_free_string_array(self->sources);
     CFCUtil_free_string_array(self->includes);
     CFCUtil_free_string_array(self->prereqs);
+    CFCUtil_free_string_array(self->cached_paths);
+    CFCUtil_free_string_array(self->cached_hashes);
     FREEMEM(self->trees);
     FREEMEM(self->files);
     FREEMEM(self->classes);
     FREEMEM(self->dest);
     FREEMEM(self->inc_dest);
     FREEMEM(self->src_dest);
+    FREEMEM(self->cache_path);
+    FREEMEM(self->cached_inputs_hash);
+    CFCBase_decref((CFCBase*)self->inputs);
+    CFCBase_decref((CFCBase*)self->parse_cache);
+    CFCBase_decref((CFCBase*)self->files_by_path_part);
+    CFCBase_decref((CFCBase*)self->classes_by_name);
     CFCBase_decref((CFCBase*)self->parser);
     CFCBase_destroy((CFCBase*)self);
 }
@@ -224,10 +293,14 @@ void
 CFCHierarchy_build(CFCHierarchy *self) {
     // Read .cfp files.
     for (size_t i = 0; self->sources[i] != NULL; i++) {
-        S_parse_parcel_files(self->sources[i], false);
+        S_parse_parcel_files(self, self->sources[i], false);
     }
     for (size_t i = 0; self->includes[i] != NULL; i++) {
-        S_parse_parcel_files(self->includes[i], true);
+        S_parse_parcel_files(self, self->includes[i], true);
+    }
+    for (size_t i = 0; self->prereqs[i] != NULL; i++) {
+        CFCCharBuf_cat(self->inputs, "prereq ", self->prereqs[i], "\n",
+                       NULL);
     }
 
     S_check_prereqs(self);
@@ -249,10 +322,17 @@ CFCHierarchy_build(CFCHierarchy *self) {
     for (size_t i = 0; self->trees[i] != NULL; i++) {
         CFCClass_grow_tree(self->trees[i]);
     }
+
+    // Generate lazily computed C strings up front, so that code generators
+    // can share the model across threads.
+    for (size_t i = 0; self->classes[i] != NULL; i++) {
+        S_cache_c_strings(self->classes[i]);
+    }
 }
 
 static void
-S_parse_parcel_files(const char *source_dir, int is_included) {
+S_parse_parcel_files(CFCHierarchy *self, const char *source_dir,
+                     int is_included) {
     CFCFindFilesContext context;
     context.ext       = ".cfp";
     context.paths     = (char**)CALLOCATE(1, sizeof(char*));
@@ -267,6 +347,15 @@ S_parse_parcel_files(const char *source_dir, int is_included) {
             = CFCFileSpec_new(source_dir, path_part, is_included);
         CFCParcel *parcel = CFCParcel_new_from_file(path, file_spec);
         const char *name = CFCParcel_get_name(parcel);
+
+        // Parcel files affect every generated file.
+        size_t len;
+        char *content = CFCUtil_slurp_text(path, &len);
+        char *input_name = CFCUtil_sprintf("parcel %s", path);
+        CFCHierarchy_add_build_input(self, input_name, content, len);
+        FREEMEM(input_name);
+        FREEMEM(content);
+
         CFCParcel *existing = CFCParcel_fetch(name);
         if (existing) {
             const char *existing_source_dir
@@ -322,30 +411,54 @@ S_parse_cf_files(CFCHierarchy *self, const char *source_dir, int is_included) {
     context.num_paths = 0;
     CFCUtil_walk(source_dir, S_find_files, &context);
 
-    // Process any file that has at least one class declaration.
-    for (int i = 0; context.paths[i] != NULL; i++) {
+    // Ignore hidden files.
+    CFCSourceText *sources = (CFCSourceText*)CALLOCATE(
+                                 context.num_paths + 1, sizeof(CFCSourceText));
+    size_t num_sources = 0;
+    for (size_t i = 0; context.paths[i] != NULL; i++) {
         // Derive the name of the class that owns the module file.
         char *source_path = context.paths[i];
         char *path_part = S_extract_path_part(source_path, source_dir, ".cfh");
-
-        // Ignore hidden files.
         if (path_part[0] == '.'
             || strstr(path_part, CHY_DIR_SEP ".") != NULL) {
+            FREEMEM(path_part);
             continue;
         }
+        sources[num_sources].path      = source_path;
+        sources[num_sources].path_part = path_part;
+        num_sources++;
+    }
+
+    // Slurp and hash files concurrently. The grammar actions register classes
+    // in global registries, so parsing happens serially in path order.
+    CFCUtil_run_parallel(S_read_source_text, sources, num_sources);
+
+    // Process any file that has at least one class declaration.
+    for (size_t i = 0; i < num_sources; i++) {
+        const char *source_path = sources[i].path;
+        char       *path_part   = sources[i].path_part;
 
         CFCFileSpec *file_spec = CFCFileSpec_new(source_dir, path_part,
                                                  is_included);
 
-        // Slurp and parse file.
-        size_t unused;
-        char *content = CFCUtil_slurp_text(source_path, &unused);
-        CFCFile *file = CFCParser_parse_file(self->parser, content, file_spec);
-        FREEMEM(content);
+        // Restore the parse result of an unchanged file from the cache or
+        // parse the file.
+        CFCFile *file = CFCParseCache_fetch(self->parse_cache, source_path,
+                                            sources[i].content_hash,
+                                            file_spec);
         if (!file) {
-            int lineno = CFCParser_get_lineno(self->parser);
-            CFCUtil_die("%s:%d: parser error", source_path, lineno);
+            file = CFCParser_parse_file(self->parser, sources[i].content,
+                                        file_spec);
+            if (!file) {
+                int lineno = CFCParser_get_lineno(self->parser);
+                CFCUtil_die("%s:%d: parser error", source_path, lineno);
+            }
+            CFCParseCache_store(self->parse_cache, source_path,
+                                sources[i].content_hash, file);
         }
+        CFCFile_set_content_hash(file, sources[i].content_hash);
+        FREEMEM(sources[i].content_hash);
+        FREEMEM(sources[i].content);
 
         // Add parsed file to pool if it's from a required parcel. Skip
         // file if it's from an include dir and the parcel was already
@@ -373,9 +486,63 @@ S_parse_cf_files(CFCHierarchy *self, const char *source_dir, int is_included) {
     }
     self->classes[self->num_classes] = NULL;
 
+    FREEMEM(sources);
     CFCUtil_free_string_array(context.paths);
 }
 
+static void
+S_read_source_text(void *context, size_t tick) {
+    CFCSourceText *source = (CFCSourceText*)context + tick;
+    size_t len;
+    source->content      = CFCUtil_slurp_text(source->path, &len);
+    source->content_hash = CFCUtil_content_hash(source->content, len);
+}
+
+static void
+S_cache_type_c_strings(CFCType *type) {
+    CFCType_to_c(type);
+    CFCType_get_class_var(type);
+}
+
+static void
+S_cache_var_c_strings(CFCVariable *var) {
+    CFCVariable_local_c(var);
+    CFCVariable_local_declaration(var);
+    S_cache_type_c_strings(CFCVariable_get_type(var));
+}
+
+static void
+S_cache_callable_c_strings(CFCCallable *callable) {
+    CFCParamList *param_list = CFCCallable_get_param_list(callable);
+    CFCVariable **vars = CFCParamList_get_variables(param_list);
+    CFCParamList_to_c(param_list);
+    CFCParamList_name_list(param_list);
+    for (size_t i = 0; vars[i] != NULL; i++) {
+        S_cache_var_c_strings(vars[i]);
+    }
+    S_cache_type_c_strings(CFCCallable_get_return_type(callable));
+}
+
+static void
+S_cache_c_strings(CFCClass *klass) {
+    CFCFunction **functions   = CFCClass_functions(klass);
+    CFCMethod   **methods     = CFCClass_methods(klass);
+    CFCVariable **member_vars = CFCClass_member_vars(klass);
+    CFCVariable **inert_vars  = CFCClass_inert_vars(klass);
+    for (size_t i = 0; functions[i] != NULL; i++) {
+        S_cache_callable_c_strings((CFCCallable*)functions[i]);
+    }
+    for (size_t i = 0; methods[i] != NULL; i++) {
+        S_cache_callable_c_strings((CFCCallable*)methods[i]);
+    }
+    for (size_t i = 0; member_vars[i] != NULL; i++) {
+        S_cache_var_c_strings(member_vars[i]);
+    }
+    for (size_t i = 0; inert_vars[i] != NULL; i++) {
+        S_cache_var_c_strings(inert_vars[i]);
+    }
+}
+
 static void
 S_find_doc_files(const char *source_dir) {
     CFCFindFilesContext context;
@@ -453,18 +620,12 @@ S_connect_classes(CFCHierarchy *self) {
         CFCClass *klass = self->classes[i];
         const char *parent_name = CFCClass_get_parent_class_name(klass);
         if (parent_name) {
-            for (size_t j = 0; ; j++) {
-                CFCClass *maybe_parent = self->classes[j];
-                if (!maybe_parent) {
-                    CFCUtil_die("Parent class '%s' not defined", parent_name);
-                }
-                const char *maybe_parent_name
-                    = CFCClass_get_name(maybe_parent);
-                if (strcmp(parent_name, maybe_parent_name) == 0) {
-                    CFCClass_add_child(maybe_parent, klass);
-                    break;
-                }
+            CFCClass *parent
+                = (CFCClass*)CFCHash_fetch(self->classes_by_name, parent_name);
+            if (!parent) {
+                CFCUtil_die("Parent class '%s' not defined", parent_name);
             }
+            CFCClass_add_child(parent, klass);
         }
         else {
             S_add_tree(self, klass);
@@ -472,8 +633,104 @@ S_connect_classes(CFCHierarchy *self) {
     }
 }
 
+static void
+S_apply_profile_entry(const char *class_name, const char *meth_name,
+                      uint64_t num_calls) {
+    CFCClass *klass = CFCClass_fetch_by_name(class_name);
+    if (!klass) { return; }
+    CFCMethod *method = CFCClass_method(klass, meth_name);
+    if (!method) { return; }
+
+    // Credit the fresh Method object. Final classes hold copies of inherited
+    // methods which aren't used for code generation.
+    CFCClass *ancestor = klass;
+    while (!CFCMethod_is_fresh(method, ancestor)) {
+        ancestor = CFCClass_get_parent(ancestor);
+    }
+    CFCMethod *fresh = CFCClass_fresh_method(ancestor, meth_name);
+    CFCMethod_add_profiled_calls(fresh, num_calls);
+}
+
+void
+CFCHierarchy_read_method_profile(CFCHierarchy *self, const char *path) {
+    CFCUTIL_NULL_CHECK(path);
+
+    size_t  len;
+    char   *content  = CFCUtil_slurp_text(path, &len);
+    char   *end      = content + len;
+    char   *line     = content;
+    int     line_num = 0;
+
+    // The profile changes the generated code, so outputs of a previous run
+    // with another profile or without a profile are stale.
+    char *input_name = CFCUtil_sprintf("method_profile %s", path);
+    CFCHierarchy_add_build_input(self, input_name, content, len);
+    FREEMEM(input_name);
+
+    while (line < end) {
+        char *next = strchr(line, '\n');
+        if (next) { *next++ = '\0'; }
+        else      { next = end; }
+        line_num++;
+
+        char *ptr = line;
+        while (isspace(*ptr)) { ptr++; }
+        if (*ptr != '\0' && *ptr != '#') {
+            char     *class_name = NULL;
+            char     *meth_name  = NULL;
+            char     *num_end;
+            uint64_t  num_calls  = strtoull(ptr, &num_end, 10);
+
+            if (num_end != ptr && isspace(*num_end)) {
+                class_name = num_end;
+                while (isspace(*class_name)) { class_name++; }
+                meth_name = class_name;
+                while (*meth_name && !isspace(*meth_name)) { meth_name++; }
+                if (*meth_name) {
+                    *meth_name++ = '\0';
+                    while (isspace(*meth_name)) { meth_name++; }
+                }
+                char *meth_end = meth_name;
+                while (*meth_end && !isspace(*meth_end)) { meth_end++; }
+                *meth_end = '\0';
+            }
+            if (!class_name || *class_name == '\0' || *meth_name == '\0') {
+                CFCUtil_die("Invalid entry in method profile '%s' line %d",
+                            path, line_num);
+            }
+
+            S_apply_profile_entry(class_name, meth_name, num_calls);
+        }
+
+        line = next;
+    }
+
+    FREEMEM(content);
+}
+
+void
+CFCHierarchy_add_build_input(CFCHierarchy *self, const char *name,
+                             const char *content, size_t len) {
+    char *content_hash = CFCUtil_content_hash(content, len);
+    CFCCharBuf_cat(self->inputs, name, " ", content_hash, "\n", NULL);
+    FREEMEM(content_hash);
+}
+
 int
 CFCHierarchy_propagate_modified(CFCHierarchy *self, int modified) {
+    S_load_cache(self);
+
+    // Regenerate everything if an input other than the .cfh files changed.
+    if (self->cache_loaded) {
+        char *inputs_hash = S_inputs_hash(self);
+        if (!self->cached_inputs_hash
+            || strcmp(self->cached_inputs_hash, inputs_hash) != 0
+           ) {
+            modified = true;
+        }
+        FREEMEM(inputs_hash);
+    }
+
     // Seed the recursive write.
     int somebody_is_modified = false;
     for (size_t i = 0; self->trees[i] != NULL; i++) {
@@ -482,6 +739,12 @@ CFCHierarchy_propagate_modified(CFCHierarchy *self, int modified) {
             somebody_is_modified = true;
         }
     }
+
+    // A removed file doesn't show up in the class trees but still requires
+    // the parcel files to be regenerated.
+    if (self->cache_loaded && self->num_cached != self->num_files) {
+        somebody_is_modified = true;
+    }
     if (somebody_is_modified || modified) {
         return true;
     }
@@ -501,7 +764,7 @@ S_do_propagate_modified(CFCHierarchy *self, CFCClass *klass, int modified) {
     char *source_path = CFCFile_cfh_path(file, source_dir);
     char *h_path      = CFCFile_h_path(file, self->inc_dest);
 
-    if (!CFCUtil_current(source_path, h_path)) {
+    if (!S_is_current(self, file, source_path, h_path)) {
         modified = true;
     }
     FREEMEM(h_path);
@@ -528,6 +791,101 @@ S_do_propagate_modified(CFCHierarchy *self, CFCClass *klass, int modified) {
     return somebody_is_modified;
 }
 
+static int
+S_file_exists(const char *path) {
+    struct stat path_stat;
+    return stat(path, &path_stat) == 0;
+}
+
+static void
+S_load_cache(CFCHierarchy *self) {
+    if (self->cache_loaded || !S_file_exists(self->cache_path)) {
+        return;
+    }
+
+    // The first line contains the hash of all other inputs. Every following
+    // line contains a content hash and a path part, separated by a space.
+    size_t len;
+    char *content = CFCUtil_slurp_text(self->cache_path, &len);
+    char *line    = content;
+    static const char inputs_prefix[] = "inputs ";
+    size_t prefix_len = sizeof(inputs_prefix) - 1;
+    while (*line) {
+        char *end = strchr(line, '\n');
+        if (!end) { break; }
+        *end = '\0';
+
+        char *space = strchr(line, ' ');
+        if (line == content && strncmp(line, inputs_prefix, prefix_len) == 0) {
+            self->cached_inputs_hash = CFCUtil_strdup(line + prefix_len);
+        }
+        else if (space) {
+            size_t n = self->num_cached;
+            size_t size = (n + 2) * sizeof(char*);
+            self->cached_paths  = (char**)REALLOCATE(self->cached_paths, size);
+            self->cached_hashes = (char**)REALLOCATE(self->cached_hashes, size);
+            self->cached_hashes[n]   = CFCUtil_strndup(line, space - line);
+            self->cached_paths[n]    = CFCUtil_strdup(space + 1);
+            self->cached_hashes[n+1] = NULL;
+            self->cached_paths[n+1]  = NULL;
+            self->num_cached = n + 1;
+        }
+
+        line = end + 1;
+    }
+    FREEMEM(content);
+
+    self->cache_loaded = true;
+}
+
+static int
+S_is_current(CFCHierarchy *self, CFCFile *file, const char *source_path,
+             const char *h_path) {
+    if (!S_file_exists(h_path)) { return false; }
+
+    // Without a build cache, fall back to comparing modification times.
+    const char *content_hash = CFCFile_get_content_hash(file);
+    if (!self->cache_loaded || !content_hash) {
+        return CFCUtil_current(source_path, h_path);
+    }
+
+    // Compare content hashes, so that touching a file or checking it out
+    // again doesn't trigger a rebuild.
+    const char *path_part = CFCFile_get_path_part(file);
+    for (size_t i = 0; i < self->num_cached; i++) {
+        if (strcmp(self->cached_paths[i], path_part) == 0) {
+            return strcmp(self->cached_hashes[i], content_hash) == 0;
+        }
+    }
+
+    return false;
+}
+
+static char*
+S_inputs_hash(CFCHierarchy *self) {
+    return CFCUtil_content_hash(CFCCharBuf_get_text(self->inputs),
+                                CFCCharBuf_get_size(self->inputs));
+}
+
+void
+CFCHierarchy_write_cache(CFCHierarchy *self) {
+    CFCCharBuf *content = CFCCharBuf_new(0);
+    char *inputs_hash = S_inputs_hash(self);
+    CFCCharBuf_cat(content, "inputs ", inputs_hash, "\n", NULL);
+    FREEMEM(inputs_hash);
+    for (size_t i = 0; self->files[i] != NULL; i++) {
+        CFCFile *file = self->files[i];
+        const char *content_hash = CFCFile_get_content_hash(file);
+        if (!content_hash) { continue; }
+        CFCCharBuf_cat(content, content_hash, " ",
+                       CFCFile_get_path_part(file), "\n", NULL);
+    }
+    CFCUtil_write_if_changed(self->cache_path, CFCCharBuf_get_text(content),
+                             CFCCharBuf_get_size(content));
+    CFCBase_decref((CFCBase*)content);
+    CFCParseCache_write(self->parse_cache);
+}
+
 static void
 S_add_tree(CFCHierarchy *self, CFCClass *klass) {
     CFCUTIL_NULL_CHECK(klass);
@@ -585,13 +943,7 @@ CFCHierarchy_write_log(CFCHierarchy *self) {
 
 static CFCFile*
 S_fetch_file(CFCHierarchy *self, const char *path_part) {
-    for (size_t i = 0; self->files[i] != NULL; i++) {
-        const char *existing = CFCFile_get_path_part(self->files[i]);
-        if (strcmp(path_part, existing) == 0) {
-            return self->files[i];
-        }
-    }
-    return NULL;
+    return (CFCFile*)CFCHash_fetch(self->files_by_path_part, path_part);
 }
 
 static void
@@ -599,22 +951,15 @@ S_add_file(CFCHierarchy *self, CFCFile *file) {
     CFCUTIL_NULL_CHECK(file);
     CFCClass **classes = CFCFile_classes(file);
 
-    for (size_t i = 0; self->files[i] != NULL; i++) {
-        CFCFile *existing = self->files[i];
-        CFCClass **existing_classes = CFCFile_classes(existing);
-        for (size_t j = 0; classes[j] != NULL; j++) {
-            const char *new_class_name = CFCClass_get_name(classes[j]);
-            for (size_t k = 0; existing_classes[k] != NULL; k++) {
-                const char *existing_class_name
-                    = CFCClass_get_name(existing_classes[k]);
-                if (strcmp(new_class_name, existing_class_name) == 0) {
-                    CFCUtil_die("Class '%s' already registered",
-                                new_class_name);
-                }
-            }
+    for (size_t i = 0; classes[i] != NULL; i++) {
+        const char *class_name = CFCClass_get_name(classes[i]);
+        if (CFCHash_fetch(self->classes_by_name, class_name)) {
+            CFCUtil_die("Class '%s' already registered", class_name);
         }
     }
 
+    CFCHash_store(self->files_by_path_part, CFCFile_get_path_part(file),
+                  file);
     self->num_files++;
     size_t size = (self->num_files + 1) * sizeof(CFCFile*);
     self->files = (CFCFile**)REALLOCATE(self->files, size);
@@ -624,7 +969,7 @@ S_add_file(CFCHierarchy *self, CFCFile *file) {
 
     for (size_t i = 0; classes[i] != NULL; i++) {
         if (self->num_classes == self->classes_cap) {
-            self->classes_cap += 10;
+            self->classes_cap *= 2;
             self->classes = (CFCClass**)REALLOCATE(
                               self->classes,
                               (self->classes_cap + 1) * sizeof(CFCClass*));
@@ -632,6 +977,8 @@ S_add_file(CFCHierarchy *self, CFCFile *file) {
         self->classes[self->num_classes++]
             = (CFCClass*)CFCBase_incref((CFCBase*)classes[i]);
         self->classes[self->num_classes] = NULL;
+        CFCHash_store(self->classes_by_name, CFCClass_get_name(classes[i]),
+                      classes[i]);
     }
 }
 
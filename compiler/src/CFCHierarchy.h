@@ -27,6 +27,8 @@
 #ifndef H_CFCHIERARCHY
 #define H_CFCHIERARCHY
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -68,6 +70,36 @@ CFCHierarchy_add_prereq(CFCHierarchy *self, const char *parcel);
 void
 CFCHierarchy_build(CFCHierarchy *self);
 
+/** Read a method call profile and attach the call counts to the Method
+ * objects of the hierarchy.  Must be called after build().
+ *
+ * Every line of the profile has the form
+ *
+ *     <calls> <class name> <method name>
+ *
+ * where `calls` is the number of times the method was invoked on instances
+ * of the class.  Empty lines and lines starting with `#` are skipped, as
+ * are entries for unknown classes or methods.  The counts are used to order
+ * the vtable slots of novel methods and to mark never-called implementing
+ * functions as cold.  The path and content of the profile are registered
+ * as a build input.
+ */
+void
+CFCHierarchy_read_method_profile(CFCHierarchy *self, const char *path);
+
+/** Register an input other than a .cfh file which affects the generated
+ * files, like a parcel file or a header comment.  If the content of any input
+ * differs from the previous run, CFCHierarchy_propagate_modified marks all
+ * Files as modified.  Parcel files are registered by build().
+ *
+ * @param name A name which identifies the input.
+ * @param content The content of the input.
+ * @param len The length of the content.
+ */
+void
+CFCHierarchy_add_build_input(CFCHierarchy *self, const char *name,
+                             const char *content, size_t len);
+
 /** Visit all File objects in the hierarchy.  If a parent node is modified, mark
  * all of its children as modified.
  *
@@ -76,6 +108,18 @@ CFCHierarchy_build(CFCHierarchy *self);
 int
 CFCHierarchy_propagate_modified(CFCHierarchy *self, int modified);
 
+/** Write the build cache which stores a content hash for every .cfh file
+ * and a hash of all other build inputs.
+ * On the next run, CFCHierarchy_propagate_modified uses these hashes instead of
+ * modification times to find out whether a file changed.  The cache should
+ * only be written after all generated files were written successfully.
+ *
+ * Also write the parse results of all .cfh files, so that the next
+ * CFCHierarchy_build doesn't have to parse unchanged files again.
+ */
+void
+CFCHierarchy_write_cache(CFCHierarchy *self);
+
 /** Write a JSON files with statistics about the class hierarchy. At the
  * moment, this file is empty. It is only used for reliable dependency
  * handling in the Makefiles of the C build. Thus, the log file should only
@@ -601,6 +601,7 @@ char *yytext;
         {"int8_t", CFC_TOKENTYPE_INTEGER_TYPE_NAME },
         {"long", CFC_TOKENTYPE_INTEGER_TYPE_NAME },
         {"nickname", CFC_TOKENTYPE_NICKNAME },
+        {"nogil", CFC_TOKENTYPE_NOGIL },
         {"nullable", CFC_TOKENTYPE_NULLABLE },
         {"parcel", CFC_TOKENTYPE_PARCEL },
         {"public", CFC_TOKENTYPE_PUBLIC },
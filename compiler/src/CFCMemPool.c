@@ -21,6 +21,13 @@
 #include "CFCMemPool.h"
 #include "CFCUtil.h"
 
+/* Released chunks are kept in free lists by size, in steps of 8 bytes. */
+#define NUM_FREE_LISTS 64
+
+typedef struct FreeChunk {
+    struct FreeChunk *next;
+} FreeChunk;
+
 struct CFCMemPool {
     CFCBase base;
     size_t arena_size;
@@ -28,6 +35,7 @@ struct CFCMemPool {
     char *current;
     size_t num_arenas;
     char **arenas;
+    FreeChunk *free_lists[NUM_FREE_LISTS];
 };
 
 static const CFCMeta CFCMEMPOOL_META = {
@@ -50,6 +58,9 @@ CFCMemPool_init(CFCMemPool *self, size_t arena_size) {
     self->remaining  = 0;
     self->num_arenas = 0;
     self->arenas     = NULL;
+    for (size_t i = 0; i < NUM_FREE_LISTS; i++) {
+        self->free_lists[i] = NULL;
+    }
     return self;
 }
 
@@ -57,22 +68,38 @@ void*
 CFCMemPool_allocate(CFCMemPool *self, size_t size) {
     size_t overage = (8 - (size % 8)) % 8;
     size_t amount = size + overage;
-    size_t arena_size = self->arena_size > amount
-                        ? self->arena_size : amount;
+    size_t list = amount / 8;
+    if (list < NUM_FREE_LISTS && self->free_lists[list]) {
+        FreeChunk *chunk = self->free_lists[list];
+        self->free_lists[list] = chunk->next;
+        return chunk;
+    }
     if (amount > self->remaining) {
+        size_t arena_size = self->arena_size > amount
+                            ? self->arena_size : amount;
         self->num_arenas += 1;
         self->arenas = (char**)REALLOCATE(self->arenas,
                                           self->num_arenas * sizeof(char*));
         self->current = (char*)MALLOCATE(arena_size);
         self->arenas[self->num_arenas - 1] = self->current;
-        self->remaining = amount;
+        self->remaining = arena_size;
     }
-    size_t offset = arena_size - self->remaining;
-    void *result = self->current + offset;
+    void *result = self->current;
+    self->current   += amount;
     self->remaining -= amount;
     return result;
 }
 
+void
+CFCMemPool_release(CFCMemPool *self, void *ptr, size_t size) {
+    size_t overage = (8 - (size % 8)) % 8;
+    size_t list = (size + overage) / 8;
+    if (list == 0 || list >= NUM_FREE_LISTS) { return; }
+    FreeChunk *chunk = (FreeChunk*)ptr;
+    chunk->next = self->free_lists[list];
+    self->free_lists[list] = chunk;
+}
+
 void
 CFCMemPool_destroy(CFCMemPool *self) {
     for (size_t i = 0; i < self->num_arenas; i++) {
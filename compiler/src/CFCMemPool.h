@@ -32,6 +32,13 @@ CFCMemPool_init(CFCMemPool *self, size_t arena_size);
 void*
 CFCMemPool_allocate(CFCMemPool *self, size_t size);
 
+/** Hand memory obtained from CFCMemPool_allocate back to the pool, so that
+ * later allocations of the same size can reuse it. Large chunks are only
+ * freed with the pool.
+ */
+void
+CFCMemPool_release(CFCMemPool *self, void *ptr, size_t size);
+
 void
 CFCMemPool_destroy(CFCMemPool *self);
 
@@ -42,6 +42,9 @@ struct CFCMethod {
     int is_abstract;
     int is_novel;
     int is_excluded;
+    int is_nogil;
+    uint64_t imp_calls;
+    uint64_t slot_calls;
 };
 
 static const CFCMeta CFCMETHOD_META = {
@@ -126,6 +129,9 @@ CFCMethod_init(CFCMethod *self, const char *exposure, const char *name,
     self->is_final          = is_final;
     self->is_abstract       = is_abstract;
     self->is_excluded       = false;
+    self->is_nogil          = false;
+    self->imp_calls         = 0;
+    self->slot_calls        = 0;
 
     // Assume that this method is novel until we discover when applying
     // inheritance that it overrides another.
@@ -238,6 +244,7 @@ CFCMethod_finalize(CFCMethod *self) {
     finalized->novel_method
         = (CFCMethod*)CFCBase_incref((CFCBase*)self->novel_method);
     finalized->is_novel = self->is_novel;
+    finalized->is_nogil = self->is_nogil;
     return finalized;
 }
 
@@ -294,6 +301,35 @@ CFCMethod_excluded_from_host(CFCMethod *self) {
     return novel_method->is_excluded;
 }
 
+void
+CFCMethod_set_nogil(CFCMethod *self) {
+    self->is_nogil = true;
+}
+
+int
+CFCMethod_nogil(CFCMethod *self) {
+    if (self->is_nogil) { return true; }
+    CFCMethod *novel_method = CFCMethod_find_novel_method(self);
+    return novel_method->is_nogil;
+}
+
+void
+CFCMethod_add_profiled_calls(CFCMethod *self, uint64_t num_calls) {
+    CFCMethod *novel_method = CFCMethod_find_novel_method(self);
+    self->imp_calls          += num_calls;
+    novel_method->slot_calls += num_calls;
+}
+
+uint64_t
+CFCMethod_get_imp_calls(CFCMethod *self) {
+    return self->imp_calls;
+}
+
+uint64_t
+CFCMethod_get_slot_calls(CFCMethod *self) {
+    return self->slot_calls;
+}
+
 CFCMethod*
 CFCMethod_find_novel_method(CFCMethod *self) {
     if (self->is_novel) {
@@ -28,6 +28,8 @@
 #ifndef H_CFCMETHOD
 #define H_CFCMETHOD
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -202,6 +204,39 @@ CFCMethod_exclude_from_host(CFCMethod *self);
 int
 CFCMethod_excluded_from_host(CFCMethod *self);
 
+/** Mark the method as safe to run while host language interpreter locks are
+ * released (e.g. the Python GIL).  The flag is inherited by all methods
+ * which override this one.
+ */
+void
+CFCMethod_set_nogil(CFCMethod *self);
+
+/** Return true if the method or the method it overrides was declared
+ * `nogil`.
+ */
+int
+CFCMethod_nogil(CFCMethod *self);
+
+/** Record `num_calls` calls from a method profile which were dispatched to
+ * the implementation of this method.  The calls are also credited to the
+ * novel method which owns the vtable slot.  `self` must be the fresh Method
+ * object, not a copy created by finalize().
+ */
+void
+CFCMethod_add_profiled_calls(CFCMethod *self, uint64_t num_calls);
+
+/** Return the number of profiled calls which ended up in the implementing
+ * function of this method.
+ */
+uint64_t
+CFCMethod_get_imp_calls(CFCMethod *self);
+
+/** Return the number of profiled calls dispatched through the vtable slot of
+ * this novel method, including calls to overriding methods.
+ */
+uint64_t
+CFCMethod_get_slot_calls(CFCMethod *self);
+
 const char*
 CFCMethod_get_exposure(CFCMethod *self);
 
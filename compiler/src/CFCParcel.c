@@ -27,6 +27,7 @@
 #include "CFCBase.h"
 #include "CFCParcel.h"
 #include "CFCFileSpec.h"
+#include "CFCHash.h"
 #include "CFCVersion.h"
 #include "CFCUtil.h"
 
@@ -43,8 +44,7 @@ struct CFCParcel {
     int is_required;
     char **inherited_parcels;
     size_t num_inherited_parcels;
-    char **struct_syms;
-    size_t num_struct_syms;
+    CFCHash *struct_syms;
     CFCPrereq **prereqs;
     size_t num_prereqs;
 };
@@ -231,8 +231,7 @@ CFCParcel_init(CFCParcel *self, const char *name, const char *nickname,
     // Initialize arrays.
     self->inherited_parcels = (char**)CALLOCATE(1, sizeof(char*));
     self->num_inherited_parcels = 0;
-    self->struct_syms = (char**)CALLOCATE(1, sizeof(char*));
-    self->num_struct_syms = 0;
+    self->struct_syms = CFCHash_new(0);
     self->prereqs = (CFCPrereq**)CALLOCATE(1, sizeof(CFCPrereq*));
     self->num_prereqs = 0;
 
@@ -365,7 +364,7 @@ CFCParcel_destroy(CFCParcel *self) {
     FREEMEM(self->PREFIX);
     FREEMEM(self->privacy_sym);
     CFCUtil_free_string_array(self->inherited_parcels);
-    CFCUtil_free_string_array(self->struct_syms);
+    CFCBase_decref((CFCBase*)self->struct_syms);
     for (size_t i = 0; self->prereqs[i]; ++i) {
         CFCBase_decref((CFCBase*)self->prereqs[i]);
     }
@@ -554,24 +553,12 @@ CFCParcel_has_prereq(CFCParcel *self, CFCParcel *parcel) {
 
 void
 CFCParcel_add_struct_sym(CFCParcel *self, const char *struct_sym) {
-    size_t num_struct_syms = self->num_struct_syms + 1;
-    size_t size = (num_struct_syms + 1) * sizeof(char*);
-    char **struct_syms = (char**)REALLOCATE(self->struct_syms, size);
-    struct_syms[num_struct_syms-1] = CFCUtil_strdup(struct_sym);
-    struct_syms[num_struct_syms]   = NULL;
-    self->struct_syms     = struct_syms;
-    self->num_struct_syms = num_struct_syms;
+    CFCHash_store(self->struct_syms, struct_sym, self);
 }
 
 static CFCParcel*
 S_lookup_struct_sym(CFCParcel *self, const char *struct_sym) {
-    for (size_t i = 0; self->struct_syms[i]; ++i) {
-        if (strcmp(self->struct_syms[i], struct_sym) == 0) {
-            return self;
-        }
-    }
-
-    return NULL;
+    return (CFCParcel*)CFCHash_fetch(self->struct_syms, struct_sym);
 }
 
 CFCParcel*
@@ -0,0 +1,747 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "charmony.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define CFC_NEED_BASE_STRUCT_DEF
+#include "CFCBase.h"
+#include "CFCParseCache.h"
+#include "CFCCBlock.h"
+#include "CFCCallable.h"
+#include "CFCCharBuf.h"
+#include "CFCClass.h"
+#include "CFCDocuComment.h"
+#include "CFCFile.h"
+#include "CFCFileSpec.h"
+#include "CFCFunction.h"
+#include "CFCHash.h"
+#include "CFCMethod.h"
+#include "CFCParamList.h"
+#include "CFCParcel.h"
+#include "CFCSymbol.h"
+#include "CFCType.h"
+#include "CFCUtil.h"
+#include "CFCVariable.h"
+
+// Bump the version whenever the serialized form or the grammar actions
+// change.
+#define CFCPARSECACHE_MAGIC   "cfc-parse-cache"
+#define CFCPARSECACHE_VERSION 1
+
+typedef struct CFCParseCacheEntry {
+    char   *content_hash;
+    char   *data;
+    size_t  data_len;
+} CFCParseCacheEntry;
+
+struct CFCParseCache {
+    CFCBase base;
+    char *path;
+    char *content;
+    CFCHash *entries;
+    CFCParseCacheEntry **entry_list;
+    size_t num_entries;
+    CFCCharBuf *output;
+};
+
+typedef struct CFCParseCacheReader {
+    char *ptr;
+    char *end;
+} CFCParseCacheReader;
+
+static void
+S_load(CFCParseCache *self);
+
+static void
+S_clear_entries(CFCParseCache *self);
+
+static void
+S_append_entry(CFCParseCache *self, const char *source_path,
+               const char *content_hash, const char *data, size_t data_len);
+
+static void
+S_write_number(CFCCharBuf *buf, unsigned long value, char terminator);
+
+static void
+S_write_class(CFCCharBuf *buf, CFCClass *klass);
+
+static CFCClass*
+S_read_class(CFCParseCacheReader *reader, CFCParcel *parcel,
+             CFCFileSpec *file_spec);
+
+static const CFCMeta CFCPARSECACHE_META = {
+    "Clownfish::CFC::ParseCache",
+    sizeof(CFCParseCache),
+    (CFCBase_destroy_t)CFCParseCache_destroy
+};
+
+CFCParseCache*
+CFCParseCache_new(const char *path) {
+    CFCParseCache *self
+        = (CFCParseCache*)CFCBase_allocate(&CFCPARSECACHE_META);
+    return CFCParseCache_init(self, path);
+}
+
+CFCParseCache*
+CFCParseCache_init(CFCParseCache *self, const char *path) {
+    CFCUTIL_NULL_CHECK(path);
+    self->path        = CFCUtil_strdup(path);
+    self->content     = NULL;
+    self->entries     = CFCHash_new(0);
+    self->entry_list  = NULL;
+    self->num_entries = 0;
+    self->output      = CFCCharBuf_new(0);
+    S_load(self);
+    return self;
+}
+
+void
+CFCParseCache_destroy(CFCParseCache *self) {
+    S_clear_entries(self);
+    FREEMEM(self->path);
+    FREEMEM(self->content);
+    CFCBase_decref((CFCBase*)self->entries);
+    CFCBase_decref((CFCBase*)self->output);
+    CFCBase_destroy((CFCBase*)self);
+}
+
+static void
+S_clear_entries(CFCParseCache *self) {
+    for (size_t i = 0; i < self->num_entries; i++) {
+        FREEMEM(self->entry_list[i]);
+    }
+    FREEMEM(self->entry_list);
+    self->entry_list  = NULL;
+    self->num_entries = 0;
+    CFCBase_decref((CFCBase*)self->entries);
+    self->entries = CFCHash_new(0);
+}
+
+static void
+S_load(CFCParseCache *self) {
+    struct stat path_stat;
+    if (stat(self->path, &path_stat) != 0) { return; }
+
+    // The first line contains the format version and a checksum of the
+    // rest of the file. Every entry consists of a line with the content
+    // hash, the length of the data and the source path, followed by the
+    // data and a newline. Entries point into the slurped file content.
+    size_t len;
+    self->content = CFCUtil_slurp_text(self->path, &len);
+    char *body = (char*)memchr(self->content, '\n', len);
+    if (!body) { return; }
+    *body++ = '\0';
+    char *end = self->content + len;
+
+    char *checksum = CFCUtil_content_hash(body, (size_t)(end - body));
+    char *header   = CFCUtil_sprintf("%s %d %s", CFCPARSECACHE_MAGIC,
+                                     CFCPARSECACHE_VERSION, checksum);
+    int valid = strcmp(self->content, header) == 0;
+    FREEMEM(header);
+    FREEMEM(checksum);
+    if (!valid) { return; }
+
+    size_t cap = 0;
+    char *ptr = body;
+    while (ptr < end) {
+        char *eol = (char*)memchr(ptr, '\n', (size_t)(end - ptr));
+        if (!eol) { break; }
+        *eol = '\0';
+
+        char *content_hash = ptr;
+        char *space = strchr(content_hash, ' ');
+        if (!space) { break; }
+        *space = '\0';
+        char *num_end;
+        unsigned long data_len = strtoul(space + 1, &num_end, 10);
+        if (num_end == space + 1 || *num_end != ' ') { break; }
+        char *source_path = num_end + 1;
+        char *data = eol + 1;
+        if (data_len >= (unsigned long)(end - data) || data[data_len] != '\n') {
+            break;
+        }
+        data[data_len] = '\0';
+
+        if (self->num_entries == cap) {
+            cap = cap ? cap * 2 : 64;
+            self->entry_list = (CFCParseCacheEntry**)REALLOCATE(
+                self->entry_list, cap * sizeof(CFCParseCacheEntry*));
+        }
+        CFCParseCacheEntry *entry
+            = (CFCParseCacheEntry*)MALLOCATE(sizeof(CFCParseCacheEntry));
+        entry->content_hash = content_hash;
+        entry->data         = data;
+        entry->data_len     = data_len;
+        self->entry_list[self->num_entries++] = entry;
+        CFCHash_store(self->entries, source_path, entry);
+
+        ptr = data + data_len + 1;
+    }
+
+    // Don't trust a partially readable cache.
+    if (ptr != end) {
+        S_clear_entries(self);
+    }
+}
+
+CFCFile*
+CFCParseCache_fetch(CFCParseCache *self, const char *source_path,
+                    const char *content_hash, CFCFileSpec *file_spec) {
+    CFCParseCacheEntry *entry
+        = (CFCParseCacheEntry*)CFCHash_fetch(self->entries, source_path);
+    if (!entry
+        || !entry->data
+        || strcmp(entry->content_hash, content_hash) != 0
+       ) {
+        return NULL;
+    }
+
+    // Carry the entry over before deserializing modifies the data.
+    S_append_entry(self, source_path, content_hash, entry->data,
+                   entry->data_len);
+    char *data = entry->data;
+    entry->data = NULL;
+    return CFCParseCache_deserialize(data, entry->data_len, file_spec);
+}
+
+void
+CFCParseCache_store(CFCParseCache *self, const char *source_path,
+                    const char *content_hash, CFCFile *file) {
+    char *data = CFCParseCache_serialize(file);
+    S_append_entry(self, source_path, content_hash, data, strlen(data));
+    FREEMEM(data);
+}
+
+static void
+S_append_entry(CFCParseCache *self, const char *source_path,
+               const char *content_hash, const char *data, size_t data_len) {
+    CFCCharBuf_cat(self->output, content_hash, " ", NULL);
+    S_write_number(self->output, (unsigned long)data_len, ' ');
+    CFCCharBuf_cat(self->output, source_path, "\n", NULL);
+    CFCCharBuf_cat_len(self->output, data, data_len);
+    CFCCharBuf_cat_len(self->output, "\n", 1);
+}
+
+void
+CFCParseCache_write(CFCParseCache *self) {
+    const char *body     = CFCCharBuf_get_text(self->output);
+    size_t      body_len = CFCCharBuf_get_size(self->output);
+    char       *checksum = CFCUtil_content_hash(body, body_len);
+
+    CFCCharBuf *content = CFCCharBuf_new(body_len + 64);
+    CFCCharBuf_catf(content, "%s %d %s\n", CFCPARSECACHE_MAGIC,
+                    CFCPARSECACHE_VERSION, checksum);
+    CFCCharBuf_cat_len(content, body, body_len);
+    CFCUtil_write_if_changed(self->path, CFCCharBuf_get_text(content),
+                             CFCCharBuf_get_size(content));
+
+    CFCBase_decref((CFCBase*)content);
+    FREEMEM(checksum);
+}
+
+/***************************************************************************
+ * Serialization
+ *
+ * Integers are written as decimal numbers followed by a space. Strings are
+ * written as their length, a colon, the string and a space. NULL strings are
+ * written as "~". Objects start with a single tag character.
+ */
+
+// Append a decimal number followed by `terminator`. Avoids the overhead of
+// sprintf, which dominates serialization otherwise.
+static void
+S_write_number(CFCCharBuf *buf, unsigned long value, char terminator) {
+    char digits[24];
+    char *end = digits + sizeof(digits);
+    char *ptr = end;
+    *--ptr = terminator;
+    do {
+        *--ptr = (char)('0' + value % 10);
+        value /= 10;
+    } while (value);
+    CFCCharBuf_cat_len(buf, ptr, (size_t)(end - ptr));
+}
+
+static void
+S_write_int(CFCCharBuf *buf, int value) {
+    if (value < 0) {
+        CFCCharBuf_cat_len(buf, "-", 1);
+        value = -value;
+    }
+    S_write_number(buf, (unsigned long)value, ' ');
+}
+
+static void
+S_write_string(CFCCharBuf *buf, const char *string) {
+    if (!string) {
+        CFCCharBuf_cat_len(buf, "~", 1);
+        return;
+    }
+    size_t len = strlen(string);
+    S_write_number(buf, (unsigned long)len, ':');
+    CFCCharBuf_cat_len(buf, string, len);
+    CFCCharBuf_cat_len(buf, " ", 1);
+}
+
+static void
+S_write_tag(CFCCharBuf *buf, char tag) {
+    CFCCharBuf_cat_len(buf, &tag, 1);
+}
+
+static void
+S_write_type(CFCCharBuf *buf, CFCType *type) {
+    if (CFCType_is_composite(type)) {
+        S_write_tag(buf, 'C');
+        S_write_int(buf, !!CFCType_nullable(type));
+        S_write_int(buf, CFCType_get_indirection(type));
+        S_write_string(buf, CFCType_get_array(type));
+        S_write_type(buf, CFCType_get_child(type));
+    }
+    else if (CFCType_is_object(type)) {
+        int flags = 0;
+        if (CFCType_const(type))       { flags |= CFCTYPE_CONST; }
+        if (CFCType_nullable(type))    { flags |= CFCTYPE_NULLABLE; }
+        if (CFCType_incremented(type)) { flags |= CFCTYPE_INCREMENTED; }
+        if (CFCType_decremented(type)) { flags |= CFCTYPE_DECREMENTED; }
+        S_write_tag(buf, 'O');
+        S_write_int(buf, flags);
+        S_write_string(buf, CFCType_get_specifier(type));
+    }
+    else if (CFCType_is_integer(type)) {
+        S_write_tag(buf, 'I');
+        S_write_int(buf, !!CFCType_const(type));
+        S_write_string(buf, CFCType_get_specifier(type));
+    }
+    else if (CFCType_is_floating(type)) {
+        S_write_tag(buf, 'F');
+        S_write_int(buf, !!CFCType_const(type));
+        S_write_string(buf, CFCType_get_specifier(type));
+    }
+    else if (CFCType_is_void(type)) {
+        S_write_tag(buf, 'V');
+        S_write_int(buf, !!CFCType_const(type));
+    }
+    else if (CFCType_is_va_list(type)) {
+        S_write_tag(buf, 'L');
+    }
+    else if (CFCType_is_arbitrary(type)) {
+        S_write_tag(buf, 'A');
+        S_write_string(buf, CFCType_get_specifier(type));
+    }
+    else {
+        CFCUtil_die("Can't serialize type '%s'", CFCType_get_specifier(type));
+    }
+}
+
+static void
+S_write_var(CFCCharBuf *buf, CFCVariable *var) {
+    S_write_string(buf, CFCSymbol_get_exposure((CFCSymbol*)var));
+    S_write_string(buf, CFCVariable_get_name(var));
+    S_write_int(buf, !!CFCVariable_inert(var));
+    S_write_type(buf, CFCVariable_get_type(var));
+}
+
+static void
+S_write_param_list(CFCCharBuf *buf, CFCParamList *param_list) {
+    CFCVariable **vars   = CFCParamList_get_variables(param_list);
+    const char  **values = CFCParamList_get_initial_values(param_list);
+    int num_vars = (int)CFCParamList_num_vars(param_list);
+    S_write_int(buf, !!CFCParamList_variadic(param_list));
+    S_write_int(buf, num_vars);
+    for (int i = 0; i < num_vars; i++) {
+        S_write_var(buf, vars[i]);
+        S_write_string(buf, values[i]);
+    }
+}
+
+static void
+S_write_docucomment(CFCCharBuf *buf, CFCDocuComment *docucomment) {
+    if (!docucomment) {
+        S_write_tag(buf, '~');
+        return;
+    }
+    const char **names = CFCDocuComment_get_param_names(docucomment);
+    const char **docs  = CFCDocuComment_get_param_docs(docucomment);
+    int num_params = 0;
+    while (names[num_params]) { num_params++; }
+
+    S_write_tag(buf, 'D');
+    S_write_string(buf, CFCDocuComment_get_description(docucomment));
+    S_write_string(buf, CFCDocuComment_get_brief(docucomment));
+    S_write_string(buf, CFCDocuComment_get_long(docucomment));
+    S_write_string(buf, CFCDocuComment_get_retval(docucomment));
+    S_write_int(buf, num_params);
+    for (int i = 0; i < num_params; i++) {
+        S_write_string(buf, names[i]);
+        S_write_string(buf, docs[i]);
+    }
+}
+
+static void
+S_write_callable(CFCCharBuf *buf, CFCCallable *callable) {
+    S_write_string(buf, CFCSymbol_get_exposure((CFCSymbol*)callable));
+    S_write_string(buf, CFCCallable_get_name(callable));
+    S_write_type(buf, CFCCallable_get_return_type(callable));
+    S_write_param_list(buf, CFCCallable_get_param_list(callable));
+    S_write_docucomment(buf, CFCCallable_get_docucomment(callable));
+}
+
+static void
+S_write_class(CFCCharBuf *buf, CFCClass *klass) {
+    CFCVariable **member_vars = CFCClass_fresh_member_vars(klass);
+    CFCVariable **inert_vars  = CFCClass_inert_vars(klass);
+    CFCFunction **functions   = CFCClass_functions(klass);
+    CFCMethod   **methods     = CFCClass_fresh_methods(klass);
+    int num_member_vars = 0;
+    int num_inert_vars  = 0;
+    int num_functions   = 0;
+    int num_methods     = 0;
+    while (member_vars[num_member_vars]) { num_member_vars++; }
+    while (inert_vars[num_inert_vars])   { num_inert_vars++; }
+    while (functions[num_functions])     { num_functions++; }
+    while (methods[num_methods])         { num_methods++; }
+
+    S_write_string(buf, CFCClass_get_exposure(klass));
+    S_write_string(buf, CFCClass_get_name(klass));
+    S_write_string(buf, CFCClass_get_nickname(klass));
+    S_write_string(buf, CFCClass_get_parent_class_name(klass));
+    S_write_docucomment(buf, CFCClass_get_docucomment(klass));
+    S_write_int(buf, !!CFCClass_final(klass));
+    S_write_int(buf, !!CFCClass_inert(klass));
+    S_write_int(buf, !!CFCClass_abstract(klass));
+
+    S_write_int(buf, num_member_vars);
+    for (int i = 0; i < num_member_vars; i++) {
+        S_write_var(buf, member_vars[i]);
+    }
+    S_write_int(buf, num_inert_vars);
+    for (int i = 0; i < num_inert_vars; i++) {
+        S_write_var(buf, inert_vars[i]);
+    }
+    S_write_int(buf, num_functions);
+    for (int i = 0; i < num_functions; i++) {
+        S_write_callable(buf, (CFCCallable*)functions[i]);
+        S_write_int(buf, !!CFCFunction_inline(functions[i]));
+    }
+    S_write_int(buf, num_methods);
+    for (int i = 0; i < num_methods; i++) {
+        S_write_callable(buf, (CFCCallable*)methods[i]);
+        S_write_int(buf, !!CFCMethod_final(methods[i]));
+        S_write_int(buf, !!CFCMethod_abstract(methods[i]));
+        S_write_int(buf, !!CFCMethod_nogil(methods[i]));
+    }
+}
+
+char*
+CFCParseCache_serialize(CFCFile *file) {
+    CFCCharBuf *buf = CFCCharBuf_new(0);
+    CFCBase **blocks = CFCFile_blocks(file);
+    int num_blocks = 0;
+    while (blocks[num_blocks]) { num_blocks++; }
+
+    S_write_string(buf, CFCParcel_get_name(CFCFile_get_parcel(file)));
+    S_write_int(buf, num_blocks);
+    for (int i = 0; i < num_blocks; i++) {
+        const char *cfc_class = CFCBase_get_cfc_class(blocks[i]);
+        if (strcmp(cfc_class, "Clownfish::CFC::Model::Class") == 0) {
+            S_write_tag(buf, 'K');
+            S_write_class(buf, (CFCClass*)blocks[i]);
+        }
+        else if (strcmp(cfc_class, "Clownfish::CFC::Model::CBlock") == 0) {
+            S_write_tag(buf, 'B');
+            S_write_string(buf, CFCCBlock_get_contents((CFCCBlock*)blocks[i]));
+        }
+        else {
+            CFCUtil_die("Can't serialize block of type '%s'", cfc_class);
+        }
+    }
+
+    char *data = CFCCharBuf_yield_string(buf);
+    CFCBase_decref((CFCBase*)buf);
+    return data;
+}
+
+/***************************************************************************
+ * Deserialization
+ *
+ * Replays the constructor calls of the grammar actions in
+ * CFCParseHeader.y. Strings are terminated in place and point into the
+ * data.
+ */
+
+static void
+S_corrupt(void) {
+    CFCUtil_die("Corrupt parse cache entry");
+}
+
+static char
+S_read_tag(CFCParseCacheReader *reader) {
+    if (reader->ptr >= reader->end) { S_corrupt(); }
+    return *reader->ptr++;
+}
+
+static int
+S_read_int(CFCParseCacheReader *reader) {
+    char *num_end;
+    long value = strtol(reader->ptr, &num_end, 10);
+    if (num_end == reader->ptr || num_end >= reader->end || *num_end != ' ') {
+        S_corrupt();
+    }
+    reader->ptr = num_end + 1;
+    return (int)value;
+}
+
+static const char*
+S_read_string(CFCParseCacheReader *reader) {
+    if (reader->ptr < reader->end && *reader->ptr == '~') {
+        reader->ptr++;
+        return NULL;
+    }
+    char *num_end;
+    unsigned long len = strtoul(reader->ptr, &num_end, 10);
+    if (num_end == reader->ptr
+        || num_end >= reader->end
+        || *num_end != ':'
+        || len >= (unsigned long)(reader->end - num_end - 1)
+       ) {
+        S_corrupt();
+    }
+    char *string = num_end + 1;
+    if (string[len] != ' ') { S_corrupt(); }
+    string[len] = '\0';
+    reader->ptr = string + len + 1;
+    return string;
+}
+
+static CFCType*
+S_read_type(CFCParseCacheReader *reader, CFCParcel *parcel) {
+    char tag = S_read_tag(reader);
+    CFCType *type = NULL;
+    if (tag == 'C') {
+        int nullable       = S_read_int(reader);
+        int indirection    = S_read_int(reader);
+        const char *array  = S_read_string(reader);
+        CFCType    *child  = S_read_type(reader, parcel);
+        type = CFCType_new_composite(nullable ? CFCTYPE_NULLABLE : 0, child,
+                                     indirection, array);
+        CFCBase_decref((CFCBase*)child);
+    }
+    else if (tag == 'O') {
+        int flags = S_read_int(reader);
+        const char *specifier = S_read_string(reader);
+        if (!specifier) { S_corrupt(); }
+        type = CFCType_new_object(flags, parcel, specifier, 1);
+    }
+    else if (tag == 'I' || tag == 'F') {
+        int flags = S_read_int(reader) ? CFCTYPE_CONST : 0;
+        const char *specifier = S_read_string(reader);
+        if (!specifier) { S_corrupt(); }
+        type = tag == 'I'
+               ? CFCType_new_integer(flags, specifier)
+               : CFCType_new_float(flags, specifier);
+    }
+    else if (tag == 'V') {
+        type = CFCType_new_void(S_read_int(reader));
+    }
+    else if (tag == 'L') {
+        type = CFCType_new_va_list();
+    }
+    else if (tag == 'A') {
+        const char *specifier = S_read_string(reader);
+        if (!specifier) { S_corrupt(); }
+        type = CFCType_new_arbitrary(parcel, specifier);
+    }
+    else {
+        S_corrupt();
+    }
+    return type;
+}
+
+static CFCVariable*
+S_read_var(CFCParseCacheReader *reader, CFCParcel *parcel) {
+    const char *exposure = S_read_string(reader);
+    const char *name     = S_read_string(reader);
+    int         inert    = S_read_int(reader);
+    CFCType    *type     = S_read_type(reader, parcel);
+    CFCVariable *var = CFCVariable_new(exposure, name, type, inert);
+    CFCBase_decref((CFCBase*)type);
+    return var;
+}
+
+static CFCParamList*
+S_read_param_list(CFCParseCacheReader *reader, CFCParcel *parcel) {
+    int variadic = S_read_int(reader);
+    int num_vars = S_read_int(reader);
+    CFCParamList *param_list = CFCParamList_new(variadic);
+    for (int i = 0; i < num_vars; i++) {
+        CFCVariable *var   = S_read_var(reader, parcel);
+        const char  *value = S_read_string(reader);
+        CFCParamList_add_param(param_list, var, value);
+        CFCBase_decref((CFCBase*)var);
+    }
+    return param_list;
+}
+
+static CFCDocuComment*
+S_read_docucomment(CFCParseCacheReader *reader) {
+    char tag = S_read_tag(reader);
+    if (tag == '~') { return NULL; }
+    if (tag != 'D') { S_corrupt(); }
+
+    const char *description = S_read_string(reader);
+    const char *brief       = S_read_string(reader);
+    const char *long_des    = S_read_string(reader);
+    const char *retval      = S_read_string(reader);
+    int num_params = S_read_int(reader);
+    if (num_params < 0) { S_corrupt(); }
+    const char **names
+        = (const char**)CALLOCATE((size_t)num_params + 1, sizeof(char*));
+    const char **docs
+        = (const char**)CALLOCATE((size_t)num_params + 1, sizeof(char*));
+    for (int i = 0; i < num_params; i++) {
+        names[i] = S_read_string(reader);
+        docs[i]  = S_read_string(reader);
+        if (!names[i] || !docs[i]) { S_corrupt(); }
+    }
+
+    CFCDocuComment *docucomment
+        = CFCDocuComment_new(description, brief, long_des, names, docs,
+                             retval);
+    FREEMEM(names);
+    FREEMEM(docs);
+    return docucomment;
+}
+
+static CFCClass*
+S_read_class(CFCParseCacheReader *reader, CFCParcel *parcel,
+             CFCFileSpec *file_spec) {
+    const char *exposure    = S_read_string(reader);
+    const char *name        = S_read_string(reader);
+    const char *nickname    = S_read_string(reader);
+    const char *parent_name = S_read_string(reader);
+    CFCDocuComment *docucomment = S_read_docucomment(reader);
+    int is_final    = S_read_int(reader);
+    int is_inert    = S_read_int(reader);
+    int is_abstract = S_read_int(reader);
+    CFCClass *klass = CFCClass_create(parcel, exposure, name, nickname,
+                                      docucomment, file_spec, parent_name,
+                                      is_final, is_inert, is_abstract);
+    CFCBase_decref((CFCBase*)docucomment);
+
+    int num_member_vars = S_read_int(reader);
+    for (int i = 0; i < num_member_vars; i++) {
+        CFCVariable *var = S_read_var(reader, parcel);
+        CFCClass_add_member_var(klass, var);
+        CFCBase_decref((CFCBase*)var);
+    }
+    int num_inert_vars = S_read_int(reader);
+    for (int i = 0; i < num_inert_vars; i++) {
+        CFCVariable *var = S_read_var(reader, parcel);
+        CFCClass_add_inert_var(klass, var);
+        CFCBase_decref((CFCBase*)var);
+    }
+
+    int num_functions = S_read_int(reader);
+    for (int i = 0; i < num_functions; i++) {
+        const char     *exposure    = S_read_string(reader);
+        const char     *name        = S_read_string(reader);
+        CFCType        *type        = S_read_type(reader, parcel);
+        CFCParamList   *param_list  = S_read_param_list(reader, parcel);
+        CFCDocuComment *docucomment = S_read_docucomment(reader);
+        int             is_inline   = S_read_int(reader);
+        CFCFunction *func = CFCFunction_new(exposure, name, type, param_list,
+                                            docucomment, is_inline);
+        CFCClass_add_function(klass, func);
+        CFCBase_decref((CFCBase*)func);
+        CFCBase_decref((CFCBase*)docucomment);
+        CFCBase_decref((CFCBase*)param_list);
+        CFCBase_decref((CFCBase*)type);
+    }
+
+    int num_methods = S_read_int(reader);
+    for (int i = 0; i < num_methods; i++) {
+        const char     *exposure    = S_read_string(reader);
+        const char     *meth_name   = S_read_string(reader);
+        CFCType        *type        = S_read_type(reader, parcel);
+        CFCParamList   *param_list  = S_read_param_list(reader, parcel);
+        CFCDocuComment *docucomment = S_read_docucomment(reader);
+        int             is_final    = S_read_int(reader);
+        int             is_abstract = S_read_int(reader);
+        int             is_nogil    = S_read_int(reader);
+        CFCMethod *method = CFCMethod_new(exposure, meth_name, type,
+                                          param_list, docucomment, name,
+                                          is_final, is_abstract);
+        if (is_nogil) {
+            CFCMethod_set_nogil(method);
+        }
+        CFCClass_add_method(klass, method);
+        CFCBase_decref((CFCBase*)method);
+        CFCBase_decref((CFCBase*)docucomment);
+        CFCBase_decref((CFCBase*)param_list);
+        CFCBase_decref((CFCBase*)type);
+    }
+
+    return klass;
+}
+
+CFCFile*
+CFCParseCache_deserialize(char *data, size_t len, CFCFileSpec *file_spec) {
+    CFCParseCacheReader reader;
+    reader.ptr = data;
+    reader.end = data + len;
+
+    const char *parcel_name = S_read_string(&reader);
+    if (!parcel_name) { S_corrupt(); }
+    CFCParcel *parcel = CFCParcel_fetch(parcel_name);
+    if (!parcel) {
+        // Allow unregistered parcels like the parser does.
+        parcel = CFCParcel_new(parcel_name, NULL, NULL, NULL);
+        CFCParcel_register(parcel);
+    }
+    else {
+        CFCBase_incref((CFCBase*)parcel);
+    }
+    CFCFile *file = CFCFile_new(parcel, file_spec);
+
+    int num_blocks = S_read_int(&reader);
+    for (int i = 0; i < num_blocks; i++) {
+        char tag = S_read_tag(&reader);
+        CFCBase *block = NULL;
+        if (tag == 'K') {
+            block = (CFCBase*)S_read_class(&reader, parcel, file_spec);
+        }
+        else if (tag == 'B') {
+            const char *contents = S_read_string(&reader);
+            if (!contents) { S_corrupt(); }
+            block = (CFCBase*)CFCCBlock_new(contents);
+        }
+        else {
+            S_corrupt();
+        }
+        CFCFile_add_block(file, block);
+        CFCBase_decref(block);
+    }
+    if (reader.ptr != reader.end) { S_corrupt(); }
+
+    CFCBase_decref((CFCBase*)parcel);
+    return file;
+}
+
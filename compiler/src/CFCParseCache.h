@@ -0,0 +1,91 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** Clownfish::CFC::ParseCache - Parse results of .cfh files across runs.
+ *
+ * The cache stores the parse result of every .cfh file together with the
+ * content hash of the source, so that unchanged files can be restored
+ * without running the parser. A parse result records the arguments of the
+ * constructors called by the grammar actions. It must be taken before types
+ * are resolved and classes are connected.
+ *
+ * The cache file starts with a format version and a checksum. A cache file
+ * with another version or a wrong checksum is ignored.
+ */
+
+#ifndef H_CFCPARSECACHE
+#define H_CFCPARSECACHE
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct CFCParseCache CFCParseCache;
+struct CFCFile;
+struct CFCFileSpec;
+
+/** Load the cache file at `path` if it exists.
+ */
+CFCParseCache*
+CFCParseCache_new(const char *path);
+
+CFCParseCache*
+CFCParseCache_init(CFCParseCache *self, const char *path);
+
+void
+CFCParseCache_destroy(CFCParseCache *self);
+
+/** Restore the parse result of the file at `source_path`.
+ *
+ * @return a new File or NULL if the cache has no entry for the source path
+ * or if the content of the source changed.
+ */
+struct CFCFile*
+CFCParseCache_fetch(CFCParseCache *self, const char *source_path,
+                    const char *content_hash, struct CFCFileSpec *file_spec);
+
+/** Add the parse result of a freshly parsed file.
+ */
+void
+CFCParseCache_store(CFCParseCache *self, const char *source_path,
+                    const char *content_hash, struct CFCFile *file);
+
+/** Write the entries of all files fetched or stored since the cache was
+ * loaded.  Entries of files which weren't seen are dropped.
+ */
+void
+CFCParseCache_write(CFCParseCache *self);
+
+/** Return the parse result of a File as a string.
+ */
+char*
+CFCParseCache_serialize(struct CFCFile *file);
+
+/** Create a File from a string returned by CFCParseCache_serialize. The
+ * string is modified in place.
+ */
+struct CFCFile*
+CFCParseCache_deserialize(char *data, size_t len,
+                          struct CFCFileSpec *file_spec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H_CFCPARSECACHE */
+
@@ -640,11 +640,117 @@ S_write_callbacks_c(CFCPerl *self) {
         "#include \"XSBind.h\"\n"
         "#include \"Clownfish/Err.h\"\n"
         "#include \"Clownfish/Obj.h\"\n"
+        "#include \"Clownfish/Util/Memory.h\"\n"
+        "#include \"Clownfish/Util/ThreadLocal.h\"\n"
         "%s"
         "\n"
+        "/* Every callback caches the CV it resolved for the class of its\n"
+        " * last invocant. Redefining a sub or changing @ISA anywhere in the\n"
+        " * class's ancestry bumps the method cache generation of the stash.\n"
+        " * Defining the method in the class itself replaces the CV of the\n"
+        " * glob which Perl uses to cache inherited methods. Either change\n"
+        " * invalidates the entry, which is then overwritten in place.\n"
+        " *\n"
+        " * Under ithreads, every thread gets its own cache so entries are\n"
+        " * never shared between interpreters. Without thread-local storage,\n"
+        " * methods aren't cached at all.\n"
+        " */\n"
+        "typedef struct S_MethCache {\n"
+        "#ifdef MULTIPLICITY\n"
+        "    PerlInterpreter *interp;\n"
+        "#endif\n"
+        "    HV  *stash;\n"
+        "    U32  generation;\n"
+        "    GV  *gv;\n"
+        "    CV  *cv;\n"
+        "} S_MethCache;\n"
+        "\n"
+        "#if !defined(USE_ITHREADS)\n"
+        "  #define S_METH_CACHE static\n"
+        "#elif defined(CFISH_HAS_THREAD_LOCAL)\n"
+        "  #define S_METH_CACHE static CFISH_THREAD_LOCAL\n"
+        "#else\n"
+        "  #define S_METH_CACHE static\n"
+        "  #define S_METH_CACHE_DISABLED\n"
+        "#endif\n"
+        "\n"
+        "#ifdef HvMROMETA\n"
+        "  #define S_METH_CACHE_GEN(stash) \\\n"
+        "      ((U32)(PL_sub_generation + HvMROMETA(stash)->cache_gen))\n"
+        "#else\n"
+        "  #define S_METH_CACHE_GEN(stash) ((U32)PL_sub_generation)\n"
+        "#endif\n"
+        "\n"
+        "/* Find the CV for the invocant on the Perl stack, which must already be\n"
+        " * set up for the call. Return NULL if the method can't be cached, for\n"
+        " * example if it's resolved via AUTOLOAD.\n"
+        " */\n"
+        "static CV*\n"
+        "S_lookup_method(pTHX_ S_MethCache *cache, const char *meth_name) {\n"
+        "#ifdef S_METH_CACHE_DISABLED\n"
+        "    CFISH_UNUSED_VAR(cache);\n"
+        "    CFISH_UNUSED_VAR(meth_name);\n"
+        "    return NULL;\n"
+        "#else\n"
+        "    SV *invocant = *(PL_stack_base + TOPMARK + 1);\n"
+        "    if (!SvROK(invocant) || !SvOBJECT(SvRV(invocant))) { return NULL; }\n"
+        "    HV  *stash      = SvSTASH(SvRV(invocant));\n"
+        "    U32  generation = S_METH_CACHE_GEN(stash);\n"
+        "\n"
+        "    if (cache->cv\n"
+        "        && cache->stash == stash\n"
+        "        && cache->generation == generation\n"
+        "#ifdef MULTIPLICITY\n"
+        "        && cache->interp == aTHX\n"
+        "#endif\n"
+        "        && GvCV(cache->gv) == cache->cv\n"
+        "       ) {\n"
+        "        return cache->cv;\n"
+        "    }\n"
+        "\n"
+        "    STRLEN len = strlen(meth_name);\n"
+        "    GV *gv = gv_fetchmeth(stash, meth_name, len, 0);\n"
+        "    if (!gv || !GvCV(gv)) { return NULL; }\n"
+        "    // Watch the glob in the invocant's own stash.\n"
+        "    SV **svp = hv_fetch(stash, meth_name, len, 0);\n"
+        "    if (!svp || !isGV(*svp) || GvCV((GV*)*svp) != GvCV(gv)) {\n"
+        "        return NULL;\n"
+        "    }\n"
+        "\n"
+        "    // Release the previous entry. References held for another\n"
+        "    // interpreter are left alone; they go away when it's destroyed.\n"
+        "    if (cache->cv\n"
+        "#ifdef MULTIPLICITY\n"
+        "        && cache->interp == aTHX\n"
+        "#endif\n"
+        "       ) {\n"
+        "        SvREFCNT_dec((SV*)cache->stash);\n"
+        "        SvREFCNT_dec((SV*)cache->gv);\n"
+        "        SvREFCNT_dec((SV*)cache->cv);\n"
+        "    }\n"
+        "\n"
+        "#ifdef MULTIPLICITY\n"
+        "    cache->interp     = aTHX;\n"
+        "#endif\n"
+        "    cache->stash      = (HV*)SvREFCNT_inc((SV*)stash);\n"
+        "    cache->generation = generation;\n"
+        "    cache->gv         = (GV*)SvREFCNT_inc(*svp);\n"
+        "    cache->cv         = (CV*)SvREFCNT_inc((SV*)GvCV(gv));\n"
+        "\n"
+        "    return cache->cv;\n"
+        "#endif\n"
+        "}\n"
+        "\n"
+        "static int\n"
+        "S_call_method(pTHX_ S_MethCache *cache, const char *meth_name,\n"
+        "              I32 flags) {\n"
+        "    CV *cv = S_lookup_method(aTHX_ cache, meth_name);\n"
+        "    return cv ? call_sv((SV*)cv, flags) : call_method(meth_name, flags);\n"
+        "}\n"
+        "\n"
         "static void\n"
-        "S_finish_callback_void(pTHX_ const char *meth_name) {\n"
-        "    int count = call_method(meth_name, G_VOID | G_DISCARD);\n"
+        "S_finish_callback_void(pTHX_ S_MethCache *cache, const char *meth_name) {\n"
+        "    int count = S_call_method(aTHX_ cache, meth_name, G_VOID | G_DISCARD);\n"
         "    if (count != 0) {\n"
         "        CFISH_THROW(CFISH_ERR, \"Bad callback to '%%s': %%i32\",\n"
         "                    meth_name, (int32_t)count);\n"
@@ -654,8 +760,8 @@ S_write_callbacks_c(CFCPerl *self) {
         "}\n"
         "\n"
         "static CFISH_INLINE SV*\n"
-        "SI_do_callback_sv(pTHX_ const char *meth_name) {\n"
-        "    int count = call_method(meth_name, G_SCALAR);\n"
+        "SI_do_callback_sv(pTHX_ S_MethCache *cache, const char *meth_name) {\n"
+        "    int count = S_call_method(aTHX_ cache, meth_name, G_SCALAR);\n"
         "    if (count != 1) {\n"
         "        CFISH_THROW(CFISH_ERR, \"Bad callback to '%%s': %%i32\",\n"
         "                    meth_name, (int32_t)count);\n"
@@ -667,8 +773,8 @@ S_write_callbacks_c(CFCPerl *self) {
         "}\n"
         "\n"
         "static int64_t\n"
-        "S_finish_callback_i64(pTHX_ const char *meth_name) {\n"
-        "    SV *return_sv = SI_do_callback_sv(aTHX_ meth_name);\n"
+        "S_finish_callback_i64(pTHX_ S_MethCache *cache, const char *meth_name) {\n"
+        "    SV *return_sv = SI_do_callback_sv(aTHX_ cache, meth_name);\n"
         "    int64_t retval;\n"
         "    if (sizeof(IV) == 8) {\n"
         "        retval = (int64_t)SvIV(return_sv);\n"
@@ -690,8 +796,8 @@ S_write_callbacks_c(CFCPerl *self) {
         "}\n"
         "\n"
         "static double\n"
-        "S_finish_callback_f64(pTHX_ const char *meth_name) {\n"
-        "    SV *return_sv = SI_do_callback_sv(aTHX_ meth_name);\n"
+        "S_finish_callback_f64(pTHX_ S_MethCache *cache, const char *meth_name) {\n"
+        "    SV *return_sv = SI_do_callback_sv(aTHX_ cache, meth_name);\n"
         "    double retval = SvNV(return_sv);\n"
         "    FREETMPS;\n"
         "    LEAVE;\n"
@@ -699,9 +805,9 @@ S_write_callbacks_c(CFCPerl *self) {
         "}\n"
         "\n"
         "static cfish_Obj*\n"
-        "S_finish_callback_obj(pTHX_ void *vself, const char *meth_name,\n"
-        "                      int nullable) {\n"
-        "    SV *return_sv = SI_do_callback_sv(aTHX_ meth_name);\n"
+        "S_finish_callback_obj(pTHX_ void *vself, S_MethCache *cache,\n"
+        "                      const char *meth_name, int nullable) {\n"
+        "    SV *return_sv = SI_do_callback_sv(aTHX_ cache, meth_name);\n"
         "    cfish_Obj *retval\n"
         "        = XSBind_perl_to_cfish_nullable(aTHX_ return_sv, CFISH_OBJ);\n"
         "    FREETMPS;\n"
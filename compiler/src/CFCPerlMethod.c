@@ -450,6 +450,7 @@ static char*
 S_callback_start(CFCMethod *method) {
     CFCParamList *param_list = CFCMethod_get_param_list(method);
     static const char pattern[] =
+        "    S_METH_CACHE S_MethCache cfcb_CACHE;\n"
         "    dTHX;\n"
         "    dSP;\n"
         "    EXTEND(SP, %d);\n"
@@ -598,7 +599,7 @@ S_void_callback_body(CFCMethod *method, const char *callback_start,
     char *perl_name = CFCPerlMethod_perl_name(method);
     const char pattern[] =
         "%s"
-        "    S_finish_callback_void(aTHX_ \"%s\");\n"
+        "    S_finish_callback_void(aTHX_ &cfcb_CACHE, \"%s\");\n"
         "%s";
     char *callback_body
         = CFCUtil_sprintf(pattern, callback_start, perl_name, refcount_mods);
@@ -633,7 +634,7 @@ S_primitive_callback_body(CFCMethod *method, const char *callback_start,
 
     char pattern[] =
         "%s"
-        "    %s retval = (%s)%s(aTHX_ \"%s\");\n"
+        "    %s retval = (%s)%s(aTHX_ &cfcb_CACHE, \"%s\");\n"
         "%s"
         "    return retval;\n";
     char *callback_body
@@ -655,7 +656,8 @@ S_obj_callback_body(CFCMethod *method, const char *callback_start,
 
     char pattern[] =
         "%s"
-        "    %s retval = (%s)S_finish_callback_obj(aTHX_ self, \"%s\", %s);\n"
+        "    %s retval = (%s)S_finish_callback_obj(aTHX_ self, &cfcb_CACHE,\n"
+        "        \"%s\", %s);\n"
         "%s"
         "    return retval;\n";
     char *callback_body
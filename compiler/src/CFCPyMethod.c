@@ -259,7 +259,8 @@ S_build_pymeth_invocation(CFCMethod *method) {
 
     if (CFCType_is_void(return_type)) {
         const char pattern[] =
-            "    CALL_PYMETH_VOID((PyObject*)self, \"%s\", cfcb_ARGS);";
+            "    static S_MethCache cfcb_CACHE;\n"
+            "    CFBIND_TRY(CALL_PYMETH_VOID((PyObject*)self, \"%s\", &cfcb_CACHE, cfcb_ARGS));";
         invocation = CFCUtil_sprintf(pattern, micro_sym);
     }
     else if (CFCType_is_object(return_type)) {
@@ -267,7 +268,9 @@ S_build_pymeth_invocation(CFCMethod *method) {
             = CFCType_nullable(return_type) ? "true" : "false";
         const char *ret_class = CFCType_get_class_var(return_type);
         const char pattern[] =
-            "    %s cfcb_RESULT = (%s)CALL_PYMETH_OBJ((PyObject*)self, \"%s\", cfcb_ARGS, %s, %s);";
+            "    static S_MethCache cfcb_CACHE;\n"
+            "    %s cfcb_RESULT = NULL;\n"
+            "    CFBIND_TRY(cfcb_RESULT = (%s)CALL_PYMETH_OBJ((PyObject*)self, \"%s\", &cfcb_CACHE, cfcb_ARGS, %s, %s));";
         invocation = CFCUtil_sprintf(pattern, ret_type_str, ret_type_str, micro_sym,
                                      ret_class, nullable);
     }
@@ -280,7 +283,9 @@ S_build_pymeth_invocation(CFCMethod *method) {
             type_upcase[i] = toupper(ret_type_str[i]);
         }
         const char pattern[] =
-            "    %s cfcb_RESULT = CALL_PYMETH_%s((PyObject*)self, \"%s\", cfcb_ARGS);";
+            "    static S_MethCache cfcb_CACHE;\n"
+            "    %s cfcb_RESULT = 0;\n"
+            "    CFBIND_TRY(cfcb_RESULT = CALL_PYMETH_%s((PyObject*)self, \"%s\", &cfcb_CACHE, cfcb_ARGS));";
         invocation = CFCUtil_sprintf(pattern, ret_type_str, type_upcase,
                                      micro_sym);
     }
@@ -336,17 +341,27 @@ CFCPyMethod_callback_def(CFCMethod *method, CFCClass *invoker) {
                                    ? ""
                                    : "    return cfcb_RESULT;\n";
 
+        // Callbacks may be invoked from within `nogil` methods, so acquire
+        // the GIL for the duration of the call into Python if necessary.
+        // Errors are trapped and rethrown after the GIL has been released.
         const char pattern[] =
             "%s\n"
             "%s(%s) {\n"
+            "    PyGILState_STATE cfcb_GIL;\n"
+            "    int cfcb_ACQUIRED = CFBind_ensure_gil(&cfcb_GIL);\n"
             "%s\n"
             "%s\n"
             "%s"
+            "    CFBind_release_gil(cfcb_GIL, cfcb_ACQUIRED);\n"
+            "    CFBind_rethrow_cferr();\n"
             "%s"
             "}\n";
         content = CFCUtil_sprintf(pattern, ret_type_str, override_sym, params,
                                   py_args, invocation, refcount_mods,
                                   maybe_return);
+        FREEMEM(py_args);
+        FREEMEM(invocation);
+        FREEMEM(refcount_mods);
     }
     else {
         char *unused = S_build_unused_vars(vars);
@@ -520,14 +535,29 @@ S_gen_meth_invocation(CFCMethod *method, CFCClass *invoker) {
         maybe_assign = "retvalCF = ";
     }
 
+    // Release the GIL around methods declared `nogil`.
+    const char *maybe_allow_threads = "";
+    const char *maybe_end_allow_threads = "";
+    if (CFCMethod_nogil(method)) {
+        maybe_allow_threads
+            = "    Py_BEGIN_ALLOW_THREADS\n"
+              "    int prev_lacks_gil = CFBind_enter_nogil();\n";
+        maybe_end_allow_threads
+            = "    CFBind_leave_nogil(prev_lacks_gil);\n"
+              "    Py_END_ALLOW_THREADS\n";
+    }
+
     const char pattern[] =
         "%s"
         "    %s method = CFISH_METHOD_PTR(%s, %s);\n"
+        "%s"
         "    CFBIND_TRY(%smethod(%s));\n"
+        "%s"
         ;
     char *content
         = CFCUtil_sprintf(pattern, maybe_declare, meth_type_c, class_var,
-                          full_meth, maybe_assign, arg_list);
+                          full_meth, maybe_allow_threads, maybe_assign,
+                          arg_list, maybe_end_allow_threads);
 
     FREEMEM(arg_list);
     FREEMEM(first_arg);
@@ -162,17 +162,111 @@ S_gen_callbacks(CFCPython *self, CFCParcel *parcel, CFCClass **ordered) {
         "        CFBind_swap_env(prev_env); \\\n"
         "    } while (0)\n"
         "\n"
+        "/* Every callback caches the attribute it resolved for the type of its\n"
+        " * last invocant. The entry is valid as long as the type's version tag\n"
+        " * is unchanged, which CPython guarantees until the type or one of its\n"
+        " * bases is modified. Types without a valid version tag and types which\n"
+        " * customize attribute access bypass the cache.\n"
+        " *\n"
+        " * Like PyObject_GenericGetAttr, an attribute in the instance dict takes\n"
+        " * precedence over anything but a data descriptor in the type.\n"
+        " */\n"
+        "typedef struct S_MethCache {\n"
+        "    PyObject     *name;\n"
+        "    PyTypeObject *type;\n"
+        "    unsigned int  version_tag;\n"
+        "    PyObject     *descr;\n"
+        "} S_MethCache;\n"
+        "\n"
+        "/* Search the MRO of `type` for `name`. Return a borrowed reference or\n"
+        " * NULL without setting an exception.\n"
+        " */\n"
         "static PyObject*\n"
-        "S_call_pymeth(PyObject *self, const char *meth_name, PyObject *args,\n"
-        "              const char *file, int line, const char *func) {\n"
-        "    PyObject *callable = PyObject_GetAttrString(self, meth_name);\n"
-        "    if (!PyCallable_Check(callable)) {\n"
+        "S_find_in_mro(PyTypeObject *type, PyObject *name) {\n"
+        "    PyObject *mro = type->tp_mro;\n"
+        "    if (mro == NULL) { return NULL; }\n"
+        "    Py_ssize_t num_bases = PyTuple_GET_SIZE(mro);\n"
+        "    for (Py_ssize_t i = 0; i < num_bases; i++) {\n"
+        "        PyTypeObject *base = (PyTypeObject*)PyTuple_GET_ITEM(mro, i);\n"
+        "        if (base->tp_dict == NULL) { continue; }\n"
+        "        PyObject *descr = PyDict_GetItem(base->tp_dict, name);\n"
+        "        if (descr != NULL) { return descr; }\n"
+        "    }\n"
+        "    return NULL;\n"
+        "}\n"
+        "\n"
+        "static int\n"
+        "S_has_instance_dict(PyTypeObject *type) {\n"
+        "#ifdef Py_TPFLAGS_MANAGED_DICT\n"
+        "    if (PyType_HasFeature(type, Py_TPFLAGS_MANAGED_DICT)) { return 1; }\n"
+        "#endif\n"
+        "    return type->tp_dictoffset != 0;\n"
+        "}\n"
+        "\n"
+        "static PyObject*\n"
+        "S_lookup_pymeth(PyObject *self, const char *meth_name, S_MethCache *cache) {\n"
+        "    PyTypeObject *type = Py_TYPE(self);\n"
+        "    if (cache->name == NULL) {\n"
+        "        cache->name = PyUnicode_InternFromString(meth_name);\n"
+        "        if (cache->name == NULL) { return NULL; }\n"
+        "    }\n"
+        "    if (type->tp_getattro != PyObject_GenericGetAttr) {\n"
+        "        return PyObject_GetAttr(self, cache->name);\n"
+        "    }\n"
+        "    if (cache->type != type\n"
+        "        || !PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG)\n"
+        "        || cache->version_tag != type->tp_version_tag\n"
+        "       ) {\n"
+        "        if (!PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG)) {\n"
+        "            // The generic lookup assigns a version tag if possible.\n"
+        "            return PyObject_GetAttr(self, cache->name);\n"
+        "        }\n"
+        "        PyObject *descr = S_find_in_mro(type, cache->name);\n"
+        "        Py_XINCREF(descr);\n"
+        "        Py_INCREF(type);\n"
+        "        Py_XDECREF(cache->descr);\n"
+        "        Py_XDECREF(cache->type);\n"
+        "        cache->descr       = descr;\n"
+        "        cache->type        = type;\n"
+        "        cache->version_tag = type->tp_version_tag;\n"
+        "    }\n"
+        "    PyObject *descr = cache->descr;\n"
+        "    if (descr == NULL) {\n"
+        "        return PyObject_GetAttr(self, cache->name);\n"
+        "    }\n"
+        "    descrgetfunc get = Py_TYPE(descr)->tp_descr_get;\n"
+        "    if ((get == NULL || Py_TYPE(descr)->tp_descr_set == NULL)\n"
+        "        && S_has_instance_dict(type)\n"
+        "       ) {\n"
+        "        PyObject *dict = PyObject_GenericGetDict(self, NULL);\n"
+        "        if (dict == NULL) { return NULL; }\n"
+        "        PyObject *attr = PyDict_GetItem(dict, cache->name);\n"
+        "        Py_XINCREF(attr);\n"
+        "        Py_DECREF(dict);\n"
+        "        if (attr != NULL) { return attr; }\n"
+        "    }\n"
+        "    if (get == NULL) {\n"
+        "        Py_INCREF(descr);\n"
+        "        return descr;\n"
+        "    }\n"
+        "    return get(descr, self, (PyObject*)type);\n"
+        "}\n"
+        "\n"
+        "static PyObject*\n"
+        "S_call_pymeth(PyObject *self, const char *meth_name, S_MethCache *cache,\n"
+        "              PyObject *args, const char *file, int line,\n"
+        "              const char *func) {\n"
+        "    PyObject *callable = S_lookup_pymeth(self, meth_name, cache);\n"
+        "    if (callable == NULL || !PyCallable_Check(callable)) {\n"
+        "        Py_XDECREF(callable);\n"
+        "        Py_DECREF(args);\n"
         "        cfish_String *mess\n"
         "            = cfish_Err_make_mess(file, line, func, \"Attr '%s' not callable\",\n"
         "                                  meth_name);\n"
         "        cfish_Err_throw_mess(CFISH_ERR, mess);\n"
         "    }\n"
         "    PyObject *result = PyObject_CallObject(callable, args);\n"
+        "    Py_DECREF(callable);\n"
         "    Py_DECREF(args);\n"
         "    if (result == NULL) {\n"
         "        cfish_String *mess\n"
@@ -183,15 +277,15 @@ S_gen_callbacks(CFCPython *self, CFCParcel *parcel, CFCClass **ordered) {
         "    return result;\n"
         "}\n"
         "\n"
-        "#define CALL_PYMETH_VOID(self, meth_name, args) \\\n"
-        "    S_call_pymeth_void(self, meth_name, args, \\\n"
+        "#define CALL_PYMETH_VOID(self, meth_name, cache, args) \\\n"
+        "    S_call_pymeth_void(self, meth_name, cache, args, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO)\n"
         "\n"
         "static void\n"
-        "S_call_pymeth_void(PyObject *self, const char *meth_name, PyObject *args,\n"
-        "                   const char *file, int line, const char *func) {\n"
+        "S_call_pymeth_void(PyObject *self, const char *meth_name, S_MethCache *cache,\n"
+        "                   PyObject *args, const char *file, int line, const char *func) {\n"
         "    PyObject *py_result\n"
-        "        = S_call_pymeth(self, meth_name, args, file, line, func);\n"
+        "        = S_call_pymeth(self, meth_name, cache, args, file, line, func);\n"
         "    if (py_result == NULL) {\n"
         "        cfish_String *mess\n"
         "            = cfish_Err_make_mess(file, line, func, \"Call to %s failed\",\n"
@@ -201,15 +295,15 @@ S_gen_callbacks(CFCPython *self, CFCParcel *parcel, CFCClass **ordered) {
         "    Py_DECREF(py_result);\n"
         "}\n"
         "\n"
-        "#define CALL_PYMETH_BOOL(self, meth_name, args) \\\n"
-        "    S_call_pymeth_bool(self, meth_name, args, \\\n"
+        "#define CALL_PYMETH_BOOL(self, meth_name, cache, args) \\\n"
+        "    S_call_pymeth_bool(self, meth_name, cache, args, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO)\n"
         "\n"
         "static bool\n"
-        "S_call_pymeth_bool(PyObject *self, const char *meth_name, PyObject *args,\n"
-        "                   const char *file, int line, const char *func) {\n"
+        "S_call_pymeth_bool(PyObject *self, const char *meth_name, S_MethCache *cache,\n"
+        "                   PyObject *args, const char *file, int line, const char *func) {\n"
         "    PyObject *py_result\n"
-        "        = S_call_pymeth(self, meth_name, args, file, line, func);\n"
+        "        = S_call_pymeth(self, meth_name, cache, args, file, line, func);\n"
         "    int truthiness = py_result != NULL\n"
         "                     ? PyObject_IsTrue(py_result)\n"
         "                     : -1;\n"
@@ -223,16 +317,16 @@ S_gen_callbacks(CFCPython *self, CFCParcel *parcel, CFCClass **ordered) {
         "    return !!truthiness;\n"
         "}\n"
         "\n"
-        "#define CALL_PYMETH_OBJ(self, meth_name, args, ret_class, nullable) \\\n"
-        "    S_call_pymeth_obj(self, meth_name, args, ret_class, nullable, \\\n"
+        "#define CALL_PYMETH_OBJ(self, meth_name, cache, args, ret_class, nullable) \\\n"
+        "    S_call_pymeth_obj(self, meth_name, cache, args, ret_class, nullable, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO)\n"
         "\n"
         "static cfish_Obj*\n"
-        "S_call_pymeth_obj(PyObject *self, const char *meth_name,\n"
+        "S_call_pymeth_obj(PyObject *self, const char *meth_name, S_MethCache *cache,\n"
         "                  PyObject *args, cfish_Class *ret_class, bool nullable,\n"
         "                  const char *file, int line, const char *func) {\n"
         "    PyObject *py_result\n"
-        "        = S_call_pymeth(self, meth_name, args, file, line, func);\n"
+        "        = S_call_pymeth(self, meth_name, cache, args, file, line, func);\n"
         "    cfish_Obj *result = CFBind_py_to_cfish(py_result, ret_class);\n"
         "    Py_DECREF(py_result);\n"
         "    if (!nullable && result == NULL) {\n"
@@ -248,18 +342,18 @@ S_gen_callbacks(CFCPython *self, CFCParcel *parcel, CFCClass **ordered) {
         "    return result;\n"
         "}\n"
         "\n"
-        "#define CALL_PYMETH_DOUBLE(self, meth_name, args) \\\n"
-        "    S_call_pymeth_f64(self, meth_name, args, \\\n"
+        "#define CALL_PYMETH_DOUBLE(self, meth_name, cache, args) \\\n"
+        "    S_call_pymeth_f64(self, meth_name, cache, args, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO)\n"
-        "#define CALL_PYMETH_FLOAT(self, meth_name, args) \\\n"
-        "    ((float)S_call_pymeth_f64(self, meth_name, args, \\\n"
+        "#define CALL_PYMETH_FLOAT(self, meth_name, cache, args) \\\n"
+        "    ((float)S_call_pymeth_f64(self, meth_name, cache, args, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO))\n"
         "\n"
         "static double\n"
-        "S_call_pymeth_f64(PyObject *self, const char *meth_name, PyObject *args,\n"
-        "                  const char *file, int line, const char *func) {\n"
+        "S_call_pymeth_f64(PyObject *self, const char *meth_name, S_MethCache *cache,\n"
+        "                  PyObject *args, const char *file, int line, const char *func) {\n"
         "    PyObject *py_result\n"
-        "        = S_call_pymeth(self, meth_name, args, file, line, func);\n"
+        "        = S_call_pymeth(self, meth_name, cache, args, file, line, func);\n"
         "    PyErr_Clear();\n"
         "    double result = PyFloat_AsDouble(py_result);\n"
         "    if (PyErr_Occurred()) {\n"
@@ -273,37 +367,37 @@ S_gen_callbacks(CFCPython *self, CFCParcel *parcel, CFCClass **ordered) {
         "    return result;\n"
         "}\n"
         "\n"
-        "#define CALL_PYMETH_INT64_T(self, meth_name, args) \\\n"
-        "    S_call_pymeth_i64(self, meth_name, args, INT64_MAX, INT64_MIN, \\\n"
+        "#define CALL_PYMETH_INT64_T(self, meth_name, cache, args) \\\n"
+        "    S_call_pymeth_i64(self, meth_name, cache, args, INT64_MAX, INT64_MIN, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO)\n"
-        "#define CALL_PYMETH_INT32_T(self, meth_name, args) \\\n"
-        "    ((int32_t)S_call_pymeth_i64(self, meth_name, args, INT32_MAX, INT32_MIN, \\\n"
+        "#define CALL_PYMETH_INT32_T(self, meth_name, cache, args) \\\n"
+        "    ((int32_t)S_call_pymeth_i64(self, meth_name, cache, args, INT32_MAX, INT32_MIN, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO))\n"
-        "#define CALL_PYMETH_INT16_T(self, meth_name, args) \\\n"
-        "    ((int16_t)S_call_pymeth_i64(self, meth_name, args, INT16_MAX, INT16_MIN, \\\n"
+        "#define CALL_PYMETH_INT16_T(self, meth_name, cache, args) \\\n"
+        "    ((int16_t)S_call_pymeth_i64(self, meth_name, cache, args, INT16_MAX, INT16_MIN, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO))\n"
-        "#define CALL_PYMETH_INT8_T(self, meth_name, args) \\\n"
-        "    ((int8_t)S_call_pymeth_i64(self, meth_name, args, INT8_MAX, INT8_MIN, \\\n"
+        "#define CALL_PYMETH_INT8_T(self, meth_name, cache, args) \\\n"
+        "    ((int8_t)S_call_pymeth_i64(self, meth_name, cache, args, INT8_MAX, INT8_MIN, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO))\n"
-        "#define CALL_PYMETH_CHAR(self, meth_name, args) \\\n"
-        "    ((char)S_call_pymeth_i64(self, meth_name, args, CHAR_MAX, CHAR_MIN, \\\n"
+        "#define CALL_PYMETH_CHAR(self, meth_name, cache, args) \\\n"
+        "    ((char)S_call_pymeth_i64(self, meth_name, cache, args, CHAR_MAX, CHAR_MIN, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO))\n"
-        "#define CALL_PYMETH_SHORT(self, meth_name, args) \\\n"
-        "    ((short)S_call_pymeth_i64(self, meth_name, args, SHRT_MAX, SHRT_MIN, \\\n"
+        "#define CALL_PYMETH_SHORT(self, meth_name, cache, args) \\\n"
+        "    ((short)S_call_pymeth_i64(self, meth_name, cache, args, SHRT_MAX, SHRT_MIN, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO))\n"
-        "#define CALL_PYMETH_INT(self, meth_name, args) \\\n"
-        "    ((int16_t)S_call_pymeth_i64(self, meth_name, args, INT_MAX, INT_MIN, \\\n"
+        "#define CALL_PYMETH_INT(self, meth_name, cache, args) \\\n"
+        "    ((int16_t)S_call_pymeth_i64(self, meth_name, cache, args, INT_MAX, INT_MIN, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO))\n"
-        "#define CALL_PYMETH_LONG(self, meth_name, args) \\\n"
-        "    ((int16_t)S_call_pymeth_i64(self, meth_name, args, LONG_MAX, LONG_MIN, \\\n"
+        "#define CALL_PYMETH_LONG(self, meth_name, cache, args) \\\n"
+        "    ((int16_t)S_call_pymeth_i64(self, meth_name, cache, args, LONG_MAX, LONG_MIN, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO))\n"
         "\n"
         "static int64_t\n"
-        "S_call_pymeth_i64(PyObject *self, const char *meth_name, PyObject *args,\n"
-        "                  int64_t max, int64_t min,\n"
+        "S_call_pymeth_i64(PyObject *self, const char *meth_name, S_MethCache *cache,\n"
+        "                  PyObject *args, int64_t max, int64_t min,\n"
         "                  const char *file, int line, const char *func) {\n"
         "    PyObject *py_result\n"
-        "        = S_call_pymeth(self, meth_name, args, file, line, func);\n"
+        "        = S_call_pymeth(self, meth_name, cache, args, file, line, func);\n"
         "    PyErr_Clear();\n"
         "    int64_t result = PyLong_AsLongLong(py_result);\n"
         "    if (PyErr_Occurred() || result > max || result < min) {\n"
@@ -317,28 +411,28 @@ S_gen_callbacks(CFCPython *self, CFCParcel *parcel, CFCClass **ordered) {
         "    return result;\n"
         "}\n"
         "\n"
-        "#define CALL_PYMETH_UINT64_T(self, meth_name, args) \\\n"
-        "    S_call_pymeth_u64(self, meth_name, args, UINT64_MAX, \\\n"
+        "#define CALL_PYMETH_UINT64_T(self, meth_name, cache, args) \\\n"
+        "    S_call_pymeth_u64(self, meth_name, cache, args, UINT64_MAX, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO)\n"
-        "#define CALL_PYMETH_UINT32_T(self, meth_name, args) \\\n"
-        "    ((uint32_t)S_call_pymeth_u64(self, meth_name, args, UINT32_MAX, \\\n"
+        "#define CALL_PYMETH_UINT32_T(self, meth_name, cache, args) \\\n"
+        "    ((uint32_t)S_call_pymeth_u64(self, meth_name, cache, args, UINT32_MAX, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO))\n"
-        "#define CALL_PYMETH_UINT16_T(self, meth_name, args) \\\n"
-        "    ((uint32_t)S_call_pymeth_u64(self, meth_name, args, UINT16_MAX, \\\n"
+        "#define CALL_PYMETH_UINT16_T(self, meth_name, cache, args) \\\n"
+        "    ((uint32_t)S_call_pymeth_u64(self, meth_name, cache, args, UINT16_MAX, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO))\n"
-        "#define CALL_PYMETH_UINT8_T(self, meth_name, args) \\\n"
-        "    ((uint32_t)S_call_pymeth_u64(self, meth_name, args, UINT8_MAX, \\\n"
+        "#define CALL_PYMETH_UINT8_T(self, meth_name, cache, args) \\\n"
+        "    ((uint32_t)S_call_pymeth_u64(self, meth_name, cache, args, UINT8_MAX, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO))\n"
-        "#define CALL_PYMETH_SIZE_T(self, meth_name, args) \\\n"
-        "    S_call_pymeth_u64(self, meth_name, args, SIZE_MAX, \\\n"
+        "#define CALL_PYMETH_SIZE_T(self, meth_name, cache, args) \\\n"
+        "    S_call_pymeth_u64(self, meth_name, cache, args, SIZE_MAX, \\\n"
         "        __FILE__, __LINE__, CFISH_ERR_FUNC_MACRO)\n"
         "\n"
         "static uint64_t\n"
-        "S_call_pymeth_u64(PyObject *self, const char *meth_name, PyObject *args,\n"
-        "                  uint64_t max,\n"
+        "S_call_pymeth_u64(PyObject *self, const char *meth_name, S_MethCache *cache,\n"
+        "                  PyObject *args, uint64_t max,\n"
         "                  const char *file, int line, const char *func) {\n"
         "    PyObject *py_result\n"
-        "        = S_call_pymeth(self, meth_name, args, file, line, func);\n"
+        "        = S_call_pymeth(self, meth_name, cache, args, file, line, func);\n"
         "    PyErr_Clear();\n"
         "    uint64_t result = PyLong_AsUnsignedLongLong(py_result);\n"
         "    if (PyErr_Occurred()) {\n"
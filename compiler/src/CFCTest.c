@@ -140,6 +140,7 @@ static const CFCTestBatch *const S_batches[] = {
     &CFCTEST_BATCH_PARCEL,
     &CFCTEST_BATCH_FILE,
     &CFCTEST_BATCH_HIERARCHY,
+    &CFCTEST_BATCH_PARSE_CACHE,
     &CFCTEST_BATCH_PARSER,
     NULL
 };
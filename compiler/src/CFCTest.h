@@ -171,6 +171,7 @@ extern const CFCTestBatch CFCTEST_BATCH_HIERARCHY;
 extern const CFCTestBatch CFCTEST_BATCH_METHOD;
 extern const CFCTestBatch CFCTEST_BATCH_PARAM_LIST;
 extern const CFCTestBatch CFCTEST_BATCH_PARCEL;
+extern const CFCTestBatch CFCTEST_BATCH_PARSE_CACHE;
 extern const CFCTestBatch CFCTEST_BATCH_PARSER;
 extern const CFCTestBatch CFCTEST_BATCH_SYMBOL;
 extern const CFCTestBatch CFCTEST_BATCH_TYPE;
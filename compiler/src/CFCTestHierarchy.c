@@ -30,10 +30,15 @@
 
 #define CFC_USE_TEST_MACROS
 #include "CFCBase.h"
+#include "CFCBindClass.h"
+#include "CFCBindCore.h"
+#include "CFCBindSpecs.h"
 #include "CFCClass.h"
 #include "CFCFile.h"
 #include "CFCHierarchy.h"
+#include "CFCMethod.h"
 #include "CFCParcel.h"
+#include "CFCParser.h"
 #include "CFCTest.h"
 #include "CFCUtil.h"
 
@@ -53,9 +58,15 @@ S_run_include_tests(CFCTest *test);
 static void
 S_run_clash_tests(CFCTest *test);
 
+static void
+S_run_profile_tests(CFCTest *test);
+
+static void
+S_run_profile_cache_tests(CFCTest *test);
+
 const CFCTestBatch CFCTEST_BATCH_HIERARCHY = {
     "Clownfish::CFC::Model::Hierarchy",
-    48,
+    73,
     S_run_tests
 };
 
@@ -64,6 +75,8 @@ S_run_tests(CFCTest *test) {
     S_run_basic_tests(test);
     S_run_include_tests(test);
     S_run_clash_tests(test);
+    S_run_profile_tests(test);
+    S_run_profile_cache_tests(test);
 }
 
 static void
@@ -153,9 +166,37 @@ S_run_basic_tests(CFCTest *test) {
     OK(test, !CFCFile_get_modified(util),
        "Modification doesn't propagate to inert class");
 
+    // With a build cache, content hashes are compared instead of times.
+    CFCHierarchy_write_cache(hierarchy);
+    CFCFile_set_modified(animal, 0);
+    CFCFile_set_modified(dog, 0);
+    CFCHierarchy_propagate_modified(hierarchy, 0);
+    OK(test, !CFCFile_get_modified(animal),
+       "Newer file with unchanged content isn't modified");
+
+    CFCFile_set_content_hash(animal, "0000000000000000");
+    CFCHierarchy_propagate_modified(hierarchy, 0);
+    OK(test, CFCFile_get_modified(animal),
+       "File with changed content is modified");
+    OK(test, CFCFile_get_modified(dog),
+       "Content change propagates to child's file");
+
+    // A changed input other than a .cfh file regenerates all files.
+    CFCHierarchy_write_cache(hierarchy);
+    CFCFile_set_modified(animal, 0);
+    CFCFile_set_modified(dog, 0);
+    CFCHierarchy_propagate_modified(hierarchy, 0);
+    OK(test, !CFCFile_get_modified(util), "Unchanged inputs");
+    const char *header = "Copyright";
+    CFCHierarchy_add_build_input(hierarchy, "header", header, strlen(header));
+    CFCHierarchy_propagate_modified(hierarchy, 0);
+    OK(test, CFCFile_get_modified(util), "Changed input modifies all files");
+
     for (int i = 0; i < 3; ++i) {
         remove(h_paths[i]);
     }
+    remove(AUTOGEN CHY_DIR_SEP "build_cache.txt");
+    remove(AUTOGEN CHY_DIR_SEP "parse_cache");
     rmdir(AUTOGEN_INCLUDE CHY_DIR_SEP "Animal");
     rmdir(AUTOGEN_INCLUDE);
     rmdir(AUTOGEN_SOURCE);
@@ -375,3 +416,160 @@ S_run_clash_tests(CFCTest *test) {
     FREEMEM(cfclash_bar_path);
 }
 
+static void
+S_run_profile_tests(CFCTest *test) {
+    CFCParser *parser = CFCParser_new();
+    CFCParcel *neato = CFCTest_parse_parcel(test, parser, "parcel Neato;");
+    CFCClass *base = CFCTest_parse_class(test, parser,
+        "class Neato::Base {\n"
+        "    void Cold(Base *self);\n"
+        "    void Hot(Base *self);\n"
+        "    void Warm(Base *self);\n"
+        "}\n");
+    CFCClass *kid = CFCTest_parse_class(test, parser,
+        "class Neato::Kid inherits Neato::Base {\n"
+        "    void Hot(Kid *self);\n"
+        "}\n");
+    CFCClass *leaf = CFCTest_parse_class(test, parser,
+        "final class Neato::Leaf inherits Neato::Base { }\n");
+    CFCClass_add_child(base, kid);
+    CFCClass_add_child(base, leaf);
+    CFCClass_grow_tree(base);
+
+    const char *profile =
+        "# calls class method\n"
+        "\n"
+        "100 Neato::Kid Hot\n"
+        "  10 Neato::Leaf  Warm\n"
+        "5 Neato::Unknown Hot\n"
+        "5 Neato::Kid Unknown\n";
+    const char *profile_path = "method_profile.txt";
+    CFCUtil_write_file(profile_path, profile, strlen(profile));
+
+    CFCHierarchy *hierarchy = CFCHierarchy_new(AUTOGEN);
+    CFCHierarchy_read_method_profile(hierarchy, profile_path);
+
+    CFCMethod *base_hot  = CFCClass_fresh_method(base, "Hot");
+    CFCMethod *base_warm = CFCClass_fresh_method(base, "Warm");
+    CFCMethod *kid_hot   = CFCClass_fresh_method(kid, "Hot");
+    INT_EQ(test, (long)CFCMethod_get_imp_calls(kid_hot), 100,
+           "profile calls credited to overriding method");
+    INT_EQ(test, (long)CFCMethod_get_imp_calls(base_hot), 0,
+           "profile calls not credited to overridden method");
+    INT_EQ(test, (long)CFCMethod_get_slot_calls(base_hot), 100,
+           "profile calls credited to vtable slot");
+    INT_EQ(test, (long)CFCMethod_get_imp_calls(base_warm), 10,
+           "profile calls of final class credited to fresh method");
+
+    {
+        CFCBindSpecs *specs = CFCBindSpecs_new();
+        CFCBindSpecs_add_class(specs, base);
+        char *defs = CFCBindSpecs_defs(specs);
+        const char *hot  = strstr(defs, "\"Hot\"");
+        const char *warm = strstr(defs, "\"Warm\"");
+        const char *cold = strstr(defs, "\"Cold\"");
+        OK(test, hot && warm && cold && hot < warm && warm < cold,
+           "novel methods sorted by profiled calls");
+        FREEMEM(defs);
+        CFCBase_decref((CFCBase*)specs);
+    }
+
+    {
+        CFCBindClass *binding = CFCBindClass_new(base);
+        char *header = CFCBindClass_to_c_header(binding);
+        OK(test, strstr(header, "CFISH_COLD void\nNEATO_Base_Cold_IMP")
+                 != NULL,
+           "uncalled method marked cold");
+        OK(test, strstr(header, "CFISH_COLD void\nNEATO_Base_Warm_IMP")
+                 == NULL,
+           "called method not marked cold");
+        FREEMEM(header);
+        CFCBase_decref((CFCBase*)binding);
+    }
+
+    {
+        const char *bad_profile = "12 Neato::Kid\n";
+        CFCUtil_write_file(profile_path, bad_profile, strlen(bad_profile));
+        char *error;
+        CFCUTIL_TRY {
+            CFCHierarchy_read_method_profile(hierarchy, profile_path);
+        }
+        CFCUTIL_CATCH(error);
+        OK(test, error && strstr(error, "line 1"), "invalid profile entry");
+        FREEMEM(error);
+    }
+
+    remove(profile_path);
+
+    CFCBase_decref((CFCBase*)hierarchy);
+    CFCBase_decref((CFCBase*)base);
+    CFCBase_decref((CFCBase*)kid);
+    CFCBase_decref((CFCBase*)leaf);
+    CFCBase_decref((CFCBase*)neato);
+    CFCBase_decref((CFCBase*)parser);
+
+    CFCClass_clear_registry();
+    CFCParcel_reap_singletons();
+}
+
+static int
+S_write_profiled(const char *profile_path, char **thing_h) {
+    char *cfprofile_path = CFCTest_path("cfprofile");
+    CFCHierarchy *hierarchy = CFCHierarchy_new(AUTOGEN);
+    CFCHierarchy_add_source_dir(hierarchy, cfprofile_path);
+    CFCHierarchy_build(hierarchy);
+    if (profile_path) {
+        CFCHierarchy_read_method_profile(hierarchy, profile_path);
+    }
+
+    CFCBindCore *core_binding = CFCBindCore_new(hierarchy, "", "");
+    int modified = CFCBindCore_write_all_modified(core_binding, 0);
+
+    size_t len;
+    *thing_h = CFCUtil_slurp_text(AUTOGEN_INCLUDE CHY_DIR_SEP "Prof"
+                                  CHY_DIR_SEP "Thing.h", &len);
+
+    CFCBase_decref((CFCBase*)core_binding);
+    CFCBase_decref((CFCBase*)hierarchy);
+    FREEMEM(cfprofile_path);
+    CFCClass_clear_registry();
+    CFCParcel_reap_singletons();
+
+    return modified;
+}
+
+static void
+S_run_profile_cache_tests(CFCTest *test) {
+    const char *profile      = "5 Prof::Thing Hot\n";
+    const char *profile_path = "method_profile.txt";
+    CFCUtil_write_file(profile_path, profile, strlen(profile));
+    static const char cold_decl[] = "CFISH_COLD void\nPROF_Thing_Cold_IMP";
+    char *thing_h;
+
+    S_write_profiled(profile_path, &thing_h);
+    OK(test, strstr(thing_h, cold_decl) != NULL,
+       "profiled build marks cold method");
+    FREEMEM(thing_h);
+
+    int modified = S_write_profiled(profile_path, &thing_h);
+    OK(test, !modified, "unchanged profile doesn't regenerate files");
+    FREEMEM(thing_h);
+
+    modified = S_write_profiled(NULL, &thing_h);
+    OK(test, modified, "dropping the profile regenerates files");
+    OK(test, strstr(thing_h, cold_decl) == NULL,
+       "build without profile doesn't mark cold method");
+    FREEMEM(thing_h);
+
+    remove(profile_path);
+    remove(AUTOGEN_INCLUDE CHY_DIR_SEP "Prof" CHY_DIR_SEP "Thing.h");
+    remove(AUTOGEN_INCLUDE CHY_DIR_SEP "prof_parcel.h");
+    remove(AUTOGEN_INCLUDE CHY_DIR_SEP "cfish_platform.h");
+    remove(AUTOGEN_SOURCE CHY_DIR_SEP "prof_parcel.c");
+    remove(AUTOGEN CHY_DIR_SEP "build_cache.txt");
+    remove(AUTOGEN CHY_DIR_SEP "parse_cache");
+    rmdir(AUTOGEN_INCLUDE CHY_DIR_SEP "Prof");
+    rmdir(AUTOGEN_INCLUDE);
+    rmdir(AUTOGEN_SOURCE);
+    rmdir(AUTOGEN);
+}
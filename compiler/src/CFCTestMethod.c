@@ -23,6 +23,7 @@
 #include "CFCParamList.h"
 #include "CFCParcel.h"
 #include "CFCParser.h"
+#include "CFCPyMethod.h"
 #include "CFCSymbol.h"
 #include "CFCTest.h"
 #include "CFCType.h"
@@ -43,9 +44,12 @@ S_run_overridden_tests(CFCTest *test);
 static void
 S_run_final_tests(CFCTest *test);
 
+static void
+S_run_py_nogil_tests(CFCTest *test);
+
 const CFCTestBatch CFCTEST_BATCH_METHOD = {
     "Clownfish::CFC::Model::Method",
-    84,
+    102,
     S_run_tests
 };
 
@@ -55,6 +59,7 @@ S_run_tests(CFCTest *test) {
     S_run_parser_tests(test);
     S_run_overridden_tests(test);
     S_run_final_tests(test);
+    S_run_py_nogil_tests(test);
 }
 
 static char*
@@ -246,6 +251,15 @@ S_run_parser_tests(CFCTest *test) {
             = CFCTest_parse_method(test, parser,
                                    "public final void The_End(Obj *self);");
         OK(test, CFCMethod_final(method), "final");
+        OK(test, !CFCMethod_nogil(method), "not nogil by default");
+        CFCBase_decref((CFCBase*)method);
+    }
+
+    {
+        CFCMethod *method
+            = CFCTest_parse_method(test, parser,
+                                   "public nogil void Crunch(Obj *self);");
+        OK(test, CFCMethod_nogil(method), "nogil");
         CFCBase_decref((CFCBase*)method);
     }
 
@@ -274,9 +288,11 @@ S_run_overridden_tests(CFCTest *test) {
         = CFCMethod_new(NULL, "Return_An_Obj", return_type,
                         overrider_param_list, NULL, "Neato::Foo::FooJr", 0, 0);
 
+    CFCMethod_set_nogil(orig);
     CFCMethod_override(overrider, orig);
     OK(test, !CFCMethod_novel(overrider),
        "A Method which overrides another is not 'novel'");
+    OK(test, CFCMethod_nogil(overrider), "overrider inherits nogil");
 
     CFCBase_decref((CFCBase*)parser);
     CFCBase_decref((CFCBase*)neato_parcel);
@@ -338,3 +354,96 @@ S_run_final_tests(CFCTest *test) {
     CFCParcel_reap_singletons();
 }
 
+// Return true if all strings appear in `text` in the given order.
+static int
+S_in_order(const char *text, const char **strings) {
+    for (int i = 0; strings[i] != NULL; i++) {
+        const char *found = strstr(text, strings[i]);
+        if (found == NULL) { return 0; }
+        text = found + strlen(strings[i]);
+    }
+    return 1;
+}
+
+static void
+S_run_py_nogil_tests(CFCTest *test) {
+    CFCParser *parser = CFCParser_new();
+    CFCParcel *neato_parcel
+        = CFCTest_parse_parcel(test, parser, "parcel Neato;");
+    CFCClass *obj_class
+        = CFCTest_parse_class(test, parser, "class Obj {}");
+    CFCClass *foo_class
+        = CFCTest_parse_class(test, parser,
+                              "class Neato::Foo {\n"
+                              "    public nogil void Crunch(Foo *self);\n"
+                              "    public void Munch(Foo *self);\n"
+                              "}\n");
+    CFCClass_resolve_types(foo_class);
+    CFCMethod *crunch = CFCClass_fresh_method(foo_class, "Crunch");
+    CFCMethod *munch  = CFCClass_fresh_method(foo_class, "Munch");
+
+    {
+        char *wrapper = CFCPyMethod_wrapper(crunch, foo_class);
+        static const char *expected[] = {
+            "Py_BEGIN_ALLOW_THREADS\n",
+            "int prev_lacks_gil = CFBind_enter_nogil();\n",
+            "CFBIND_TRY(method((neato_Foo*)self));\n",
+            "CFBind_leave_nogil(prev_lacks_gil);\n",
+            "Py_END_ALLOW_THREADS\n",
+            "if (CFBind_migrate_cferr()) {",
+            NULL
+        };
+        OK(test, S_in_order(wrapper, expected),
+           "nogil wrapper releases the GIL around the call");
+        FREEMEM(wrapper);
+    }
+
+    {
+        char *wrapper = CFCPyMethod_wrapper(munch, foo_class);
+        OK(test,
+           strstr(wrapper, "CFBIND_TRY(method((neato_Foo*)self));") != NULL,
+           "wrapper calls method");
+        OK(test, !strstr(wrapper, "ALLOW_THREADS"),
+           "wrapper without nogil keeps the GIL");
+        OK(test, !strstr(wrapper, "nogil"),
+           "wrapper without nogil doesn't mark thread");
+        FREEMEM(wrapper);
+    }
+
+    {
+        char *callback = CFCPyMethod_callback_def(crunch, foo_class);
+        static const char *expected[] = {
+            "PyGILState_STATE cfcb_GIL;\n",
+            "int cfcb_ACQUIRED = CFBind_ensure_gil(&cfcb_GIL);\n",
+            "CALL_PYMETH_VOID(",
+            "CFBind_release_gil(cfcb_GIL, cfcb_ACQUIRED);\n",
+            "CFBind_rethrow_cferr();\n",
+            NULL
+        };
+        OK(test, S_in_order(callback, expected),
+           "callback acquires the GIL around the Python call");
+        OK(test, !strstr(callback, "ALLOW_THREADS"),
+           "callback doesn't release a GIL it doesn't own");
+        FREEMEM(callback);
+    }
+
+    {
+        char *callback = CFCPyMethod_callback_def(munch, foo_class);
+        static const char *expected[] = {
+            "CFBind_ensure_gil(&cfcb_GIL)",
+            "CFBind_release_gil(cfcb_GIL, cfcb_ACQUIRED)",
+            NULL
+        };
+        OK(test, S_in_order(callback, expected),
+           "callback of GIL-holding method can be reached from nogil code");
+        FREEMEM(callback);
+    }
+
+    CFCBase_decref((CFCBase*)parser);
+    CFCBase_decref((CFCBase*)neato_parcel);
+    CFCBase_decref((CFCBase*)obj_class);
+    CFCBase_decref((CFCBase*)foo_class);
+
+    CFCClass_clear_registry();
+    CFCParcel_reap_singletons();
+}
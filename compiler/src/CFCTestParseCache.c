@@ -0,0 +1,300 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "charmony.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* For rmdir */
+#ifdef CHY_HAS_UNISTD_H
+  #include <unistd.h>
+#endif
+#ifdef CHY_HAS_DIRECT_H
+  #include <direct.h>
+#endif
+
+#define CFC_USE_TEST_MACROS
+#include "CFCBase.h"
+#include "CFCCallable.h"
+#include "CFCClass.h"
+#include "CFCDocuComment.h"
+#include "CFCFile.h"
+#include "CFCFileSpec.h"
+#include "CFCFunction.h"
+#include "CFCHierarchy.h"
+#include "CFCMethod.h"
+#include "CFCParcel.h"
+#include "CFCParseCache.h"
+#include "CFCParser.h"
+#include "CFCTest.h"
+#include "CFCUtil.h"
+
+#define AUTOGEN          "autogen"
+#define AUTOGEN_INCLUDE  AUTOGEN CHY_DIR_SEP "include"
+#define AUTOGEN_SOURCE   AUTOGEN CHY_DIR_SEP "source"
+#define CACHE_PATH       AUTOGEN CHY_DIR_SEP "parse_cache"
+
+static void
+S_run_tests(CFCTest *test);
+
+static void
+S_run_round_trip_tests(CFCTest *test);
+
+static void
+S_run_cache_file_tests(CFCTest *test);
+
+static void
+S_run_hierarchy_tests(CFCTest *test);
+
+const CFCTestBatch CFCTEST_BATCH_PARSE_CACHE = {
+    "Clownfish::CFC::ParseCache",
+    18,
+    S_run_tests
+};
+
+static const char *S_source =
+    "parcel Neato;\n"
+    "\n"
+    "/** Stuff.\n"
+    " *\n"
+    " * Does things.\n"
+    " */\n"
+    "public abstract class Neato::Stuff nickname Stf inherits Neato::Base {\n"
+    "    int32_t num;\n"
+    "    nullable Obj *maybe;\n"
+    "    public inert const char *name;\n"
+    "    inert foo_t[] foos;\n"
+    "\n"
+    "    /** Make some stuff.\n"
+    "     *\n"
+    "     * @param num How much.\n"
+    "     * @return New stuff.\n"
+    "     */\n"
+    "    public inert incremented Stuff*\n"
+    "    new(int32_t num = 1, decremented nullable String *label = NULL);\n"
+    "\n"
+    "    inert inline void*\n"
+    "    raw(const void *ptr, ...);\n"
+    "\n"
+    "    public abstract nogil double\n"
+    "    Crunch(Stuff *self, va_list args, uint8_t **bytes);\n"
+    "\n"
+    "    final bool\n"
+    "    Is_Ready(const Stuff *self);\n"
+    "}\n"
+    "\n"
+    "__C__\n"
+    "#define STUFF_MAX 42\n"
+    "__END_C__\n";
+
+static void
+S_run_tests(CFCTest *test) {
+    S_run_round_trip_tests(test);
+    S_run_cache_file_tests(test);
+    S_run_hierarchy_tests(test);
+}
+
+static CFCFile*
+S_parse_source(CFCParser *parser, CFCFileSpec *file_spec) {
+    CFCFile *file = CFCParser_parse_file(parser, S_source, file_spec);
+    if (!file) { CFCUtil_die("Parse error"); }
+    return file;
+}
+
+static void
+S_run_round_trip_tests(CFCTest *test) {
+    CFCParser   *parser    = CFCParser_new();
+    CFCFileSpec *file_spec = CFCFileSpec_new(".", "Neato/Stuff", 0);
+
+    CFCFile *file = S_parse_source(parser, file_spec);
+    char *data = CFCParseCache_serialize(file);
+    CFCBase_decref((CFCBase*)file);
+    CFCClass_clear_registry();
+
+    char *copy = CFCUtil_strdup(data);
+    CFCFile *restored
+        = CFCParseCache_deserialize(copy, strlen(copy), file_spec);
+    OK(test, restored != NULL, "deserialize");
+    char *restored_data = CFCParseCache_serialize(restored);
+    STR_EQ(test, restored_data, data, "round trip");
+
+    CFCClass **classes = CFCFile_classes(restored);
+    CFCClass *stuff = classes[0];
+    STR_EQ(test, CFCClass_get_name(stuff), "Neato::Stuff", "class name");
+    STR_EQ(test, CFCClass_get_nickname(stuff), "Stf", "nickname");
+    STR_EQ(test, CFCClass_get_parent_class_name(stuff), "Neato::Base",
+           "parent class name");
+    OK(test, CFCClass_fetch_singleton(CFCClass_get_parcel(stuff),
+                                      "Neato::Stuff") == stuff,
+       "restored class is registered");
+
+    CFCMethod *crunch = CFCClass_fresh_method(stuff, "Crunch");
+    OK(test, crunch != NULL && CFCMethod_nogil(crunch)
+             && CFCMethod_abstract(crunch),
+       "method modifiers");
+
+    CFCFunction *ctor = CFCClass_function(stuff, "new");
+    CFCDocuComment *docucomment
+        = CFCCallable_get_docucomment((CFCCallable*)ctor);
+    STR_EQ(test, CFCDocuComment_get_retval(docucomment), "New stuff.",
+           "docucomment retval");
+    STR_EQ(test, CFCDocuComment_get_param_docs(docucomment)[0], "How much.",
+           "docucomment param docs");
+
+    FREEMEM(restored_data);
+    FREEMEM(copy);
+    FREEMEM(data);
+    CFCBase_decref((CFCBase*)restored);
+    CFCBase_decref((CFCBase*)file_spec);
+    CFCBase_decref((CFCBase*)parser);
+    CFCClass_clear_registry();
+    CFCParcel_reap_singletons();
+}
+
+static void
+S_run_cache_file_tests(CFCTest *test) {
+    CFCParser   *parser    = CFCParser_new();
+    CFCFileSpec *file_spec = CFCFileSpec_new(".", "Neato/Stuff", 0);
+    OK(test, CFCUtil_make_path(AUTOGEN), "make_path");
+    remove(CACHE_PATH);
+
+    CFCFile *file = S_parse_source(parser, file_spec);
+    char *data = CFCParseCache_serialize(file);
+    {
+        CFCParseCache *cache = CFCParseCache_new(CACHE_PATH);
+        OK(test, CFCParseCache_fetch(cache, "Neato/Stuff.cfh", "aaaa",
+                                     file_spec) == NULL,
+           "empty cache");
+        CFCParseCache_store(cache, "Neato/Stuff.cfh", "aaaa", file);
+        CFCParseCache_write(cache);
+        CFCBase_decref((CFCBase*)cache);
+    }
+    CFCBase_decref((CFCBase*)file);
+    CFCClass_clear_registry();
+
+    {
+        CFCParseCache *cache = CFCParseCache_new(CACHE_PATH);
+        OK(test, CFCParseCache_fetch(cache, "Neato/Stuff.cfh", "bbbb",
+                                     file_spec) == NULL,
+           "changed content isn't restored");
+        CFCFile *restored = CFCParseCache_fetch(cache, "Neato/Stuff.cfh",
+                                                "aaaa", file_spec);
+        OK(test, restored != NULL, "unchanged content is restored");
+        char *restored_data = CFCParseCache_serialize(restored);
+        STR_EQ(test, restored_data, data, "restored file");
+        FREEMEM(restored_data);
+        CFCBase_decref((CFCBase*)restored);
+        CFCBase_decref((CFCBase*)cache);
+    }
+    CFCClass_clear_registry();
+
+    // Flip a byte in the data. The checksum doesn't match anymore.
+    {
+        size_t len;
+        char *content = CFCUtil_slurp_text(CACHE_PATH, &len);
+        content[len - 2] ^= 1;
+        CFCUtil_write_file(CACHE_PATH, content, len);
+        FREEMEM(content);
+
+        CFCParseCache *cache = CFCParseCache_new(CACHE_PATH);
+        OK(test, CFCParseCache_fetch(cache, "Neato/Stuff.cfh", "aaaa",
+                                     file_spec) == NULL,
+           "corrupt cache is ignored");
+        CFCBase_decref((CFCBase*)cache);
+    }
+
+    remove(CACHE_PATH);
+    rmdir(AUTOGEN_INCLUDE);
+    rmdir(AUTOGEN_SOURCE);
+    rmdir(AUTOGEN);
+
+    FREEMEM(data);
+    CFCBase_decref((CFCBase*)file_spec);
+    CFCBase_decref((CFCBase*)parser);
+    CFCClass_clear_registry();
+    CFCParcel_reap_singletons();
+}
+
+static char**
+S_serialize_files(CFCHierarchy *hierarchy) {
+    CFCFile **files = CFCHierarchy_files(hierarchy);
+    size_t num_files = 0;
+    while (files[num_files]) { num_files++; }
+    char **serialized = (char**)CALLOCATE(num_files + 1, sizeof(char*));
+    for (size_t i = 0; i < num_files; i++) {
+        serialized[i] = CFCParseCache_serialize(files[i]);
+    }
+    return serialized;
+}
+
+static void
+S_run_hierarchy_tests(CFCTest *test) {
+    char *cfbase_path = CFCTest_path("cfbase");
+    char **parsed;
+    char **restored;
+
+    {
+        CFCHierarchy *hierarchy = CFCHierarchy_new(AUTOGEN);
+        CFCHierarchy_add_source_dir(hierarchy, cfbase_path);
+        CFCHierarchy_build(hierarchy);
+        parsed = S_serialize_files(hierarchy);
+        CFCHierarchy_write_cache(hierarchy);
+        CFCBase_decref((CFCBase*)hierarchy);
+        CFCClass_clear_registry();
+        CFCParcel_reap_singletons();
+    }
+
+    {
+        size_t len;
+        char *content = CFCUtil_slurp_text(CACHE_PATH, &len);
+        OK(test, strstr(content, "Animal" CHY_DIR_SEP "Dog.cfh") != NULL,
+           "write_cache writes parse cache");
+        FREEMEM(content);
+    }
+
+    {
+        CFCHierarchy *hierarchy = CFCHierarchy_new(AUTOGEN);
+        CFCHierarchy_add_source_dir(hierarchy, cfbase_path);
+        CFCHierarchy_build(hierarchy);
+        restored = S_serialize_files(hierarchy);
+        CFCBase_decref((CFCBase*)hierarchy);
+        CFCClass_clear_registry();
+        CFCParcel_reap_singletons();
+    }
+
+    int num_files = 0;
+    int num_equal = 0;
+    for (int i = 0; parsed[i] != NULL; i++) {
+        num_files++;
+        if (restored[i] && strcmp(parsed[i], restored[i]) == 0) {
+            num_equal++;
+        }
+    }
+    INT_EQ(test, num_files, 3, "parsed all files");
+    INT_EQ(test, num_equal, num_files,
+           "hierarchy built from cache matches parsed hierarchy");
+
+    CFCUtil_free_string_array(parsed);
+    CFCUtil_free_string_array(restored);
+    remove(AUTOGEN CHY_DIR_SEP "build_cache.txt");
+    remove(CACHE_PATH);
+    rmdir(AUTOGEN_INCLUDE);
+    rmdir(AUTOGEN_SOURCE);
+    rmdir(AUTOGEN);
+    FREEMEM(cfbase_path);
+}
+
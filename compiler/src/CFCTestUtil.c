@@ -18,7 +18,12 @@
 #include <string.h>
 #include <time.h>
 
+#define CFC_NEED_BASE_STRUCT_DEF
 #define CFC_USE_TEST_MACROS
+#include "CFCBase.h"
+#include "CFCCharBuf.h"
+#include "CFCHash.h"
+#include "CFCMemPool.h"
 #include "CFCUtil.h"
 #include "CFCTest.h"
 
@@ -31,9 +36,21 @@ S_run_string_tests(CFCTest *test);
 static void
 S_run_file_tests(CFCTest *test);
 
+static void
+S_run_parallel_tests(CFCTest *test);
+
+static void
+S_run_hash_tests(CFCTest *test);
+
+static void
+S_run_char_buf_tests(CFCTest *test);
+
+static void
+S_run_pool_tests(CFCTest *test);
+
 const CFCTestBatch CFCTEST_BATCH_UTIL = {
     "Clownfish::CFC::Util",
-    15,
+    36,
     S_run_tests
 };
 
@@ -41,6 +58,10 @@ static void
 S_run_tests(CFCTest *test) {
     S_run_string_tests(test);
     S_run_file_tests(test);
+    S_run_parallel_tests(test);
+    S_run_hash_tests(test);
+    S_run_char_buf_tests(test);
+    S_run_pool_tests(test);
 }
 
 static void
@@ -118,3 +139,165 @@ S_run_file_tests(CFCTest *test) {
     remove(foo_txt);
 }
 
+static void
+S_square_tick(void *context, size_t tick) {
+    size_t *slots = (size_t*)context;
+    slots[tick] = tick * tick;
+}
+
+static void
+S_fail_odd_tick(void *context, size_t tick) {
+    (void)context;
+    if (tick % 2 == 1) {
+        CFCUtil_die("tick %d", (int)tick);
+    }
+}
+
+static void
+S_run_parallel_tests(CFCTest *test) {
+    size_t slots[100];
+    int    ok = 1;
+    char  *error;
+
+    memset(slots, 0, sizeof(slots));
+    CFCUtil_run_parallel(S_square_tick, slots, 100);
+    for (size_t i = 0; i < 100; i++) {
+        if (slots[i] != i * i) { ok = 0; }
+    }
+    OK(test, ok, "run_parallel runs every tick");
+
+    CFCUTIL_TRY {
+        CFCUtil_run_parallel(S_fail_odd_tick, NULL, 100);
+    }
+    CFCUTIL_CATCH(error);
+    STR_EQ(test, error, "tick 1", "run_parallel rethrows error of lowest tick");
+    FREEMEM(error);
+
+    CFCUtil_set_num_threads(1);
+    INT_EQ(test, CFCUtil_get_num_threads(), 1, "set_num_threads");
+    CFCUtil_set_num_threads(0);
+}
+
+static void
+S_run_hash_tests(CFCTest *test) {
+    CFCHash *hash = CFCHash_new(0);
+    int foo = 1, bar = 2;
+
+    OK(test, CFCHash_store(hash, "foo", &foo) == NULL, "hash store new key");
+    OK(test, CFCHash_fetch(hash, "foo") == &foo, "hash fetch");
+    OK(test, CFCHash_store(hash, "foo", &bar) == &foo,
+       "hash store returns replaced value");
+    OK(test, CFCHash_fetch(hash, "nope") == NULL, "hash fetch missing key");
+
+    int ok = 1;
+    for (int i = 0; i < 1000; i++) {
+        char *key = CFCUtil_sprintf("key%d", i);
+        CFCHash_store(hash, key, &foo);
+        FREEMEM(key);
+    }
+    for (int i = 0; i < 1000; i++) {
+        char *key = CFCUtil_sprintf("key%d", i);
+        if (CFCHash_fetch(hash, key) != &foo) { ok = 0; }
+        FREEMEM(key);
+    }
+    OK(test, ok && CFCHash_get_size(hash) == 1001, "hash grows");
+
+    CFCBase_decref((CFCBase*)hash);
+}
+
+static void
+S_run_char_buf_tests(CFCTest *test) {
+    CFCCharBuf *buf = CFCCharBuf_new(0);
+
+    CFCCharBuf_cat(buf, "foo", "", "bar", NULL);
+    STR_EQ(test, CFCCharBuf_get_text(buf), "foobar", "char buf cat");
+    CFCCharBuf_catf(buf, " %s %d", "baz", 42);
+    STR_EQ(test, CFCCharBuf_get_text(buf), "foobar baz 42", "char buf catf");
+
+    for (int i = 0; i < 1000; i++) {
+        CFCCharBuf_cat_len(buf, "xyz", 2);
+    }
+    INT_EQ(test, CFCCharBuf_get_size(buf), 2013, "char buf grows");
+
+    char *str = CFCCharBuf_yield_string(buf);
+    OK(test, strncmp(str, "foobar baz 42xyxy", 17) == 0
+             && CFCCharBuf_get_size(buf) == 0
+             && CFCCharBuf_get_text(buf)[0] == '\0',
+       "char buf yield_string");
+    FREEMEM(str);
+
+    CFCBase_decref((CFCBase*)buf);
+}
+
+static void
+S_run_pool_tests(CFCTest *test) {
+    CFCCharBuf *unpooled = CFCCharBuf_new(0);
+
+    CFCMemPool *pool = CFCMemPool_new(0);
+    CFCBase_set_pool(pool);
+    CFCBase_decref((CFCBase*)pool);
+    OK(test, CFCBase_get_pool() == pool, "set_pool");
+
+    {
+        CFCMemPool *nested = CFCMemPool_new(0);
+        char       *error;
+        CFCUTIL_TRY {
+            CFCBase_set_pool(nested);
+        }
+        CFCUTIL_CATCH(error);
+        OK(test, error && strstr(error, "nested"), "nested set_pool dies");
+        OK(test, CFCBase_get_pool() == pool, "nested set_pool keeps pool");
+        FREEMEM(error);
+        CFCBase_decref((CFCBase*)nested);
+    }
+
+    CFCHash *hash = CFCHash_new(0);
+    OK(test, ((CFCBase*)hash)->pool == pool, "objects are allocated from pool");
+    int foo = 1;
+    for (int i = 0; i < 100; i++) {
+        CFCCharBuf *buf = CFCCharBuf_new(0);
+        CFCCharBuf_catf(buf, "key%d", i);
+        CFCHash_store(hash, CFCCharBuf_get_text(buf), &foo);
+        CFCBase_decref((CFCBase*)buf);
+    }
+    OK(test, CFCHash_get_size(hash) == 100 && CFCHash_fetch(hash, "key99"),
+       "pooled objects");
+    CFCBase_decref((CFCBase*)hash);
+
+    // Objects allocated before the session are freed as usual.
+    CFCBase_decref((CFCBase*)unpooled);
+
+    CFCCharBuf *buf1 = CFCCharBuf_new(0);
+    CFCCharBuf *buf2 = CFCCharBuf_new(0);
+    void *address1 = buf1;
+    void *address2 = buf2;
+    CFCBase_decref((CFCBase*)buf1);
+    CFCBase_decref((CFCBase*)buf2);
+    buf1 = CFCCharBuf_new(0);
+    buf2 = CFCCharBuf_new(0);
+    OK(test, (void*)buf1 == address2 && (void*)buf2 == address1,
+       "memory of destroyed objects is reused");
+    CFCBase_decref((CFCBase*)buf1);
+    CFCBase_decref((CFCBase*)buf2);
+
+    // Keep the pool alive, so that a pool allocated from it stays valid.
+    CFCMemPool *inner = CFCMemPool_new(0);
+    CFCBase_incref((CFCBase*)pool);
+    CFCBase_set_pool(NULL);
+    OK(test, CFCBase_get_pool() == NULL, "end pool session");
+
+    {
+        char *error;
+        CFCUTIL_TRY {
+            CFCBase_set_pool(inner);
+        }
+        CFCUTIL_CATCH(error);
+        OK(test, error && strstr(error, "another pool"),
+           "set_pool with pool allocated from another pool dies");
+        OK(test, CFCBase_get_pool() == NULL,
+           "failed set_pool keeps session ended");
+        FREEMEM(error);
+    }
+    CFCBase_decref((CFCBase*)inner);
+    CFCBase_decref((CFCBase*)pool);
+}
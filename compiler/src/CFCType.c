@@ -449,6 +449,11 @@ CFCType_get_array(CFCType *self) {
     return self->array;
 }
 
+CFCType*
+CFCType_get_child(CFCType *self) {
+    return self->child;
+}
+
 int
 CFCType_const(CFCType *self) {
     return !!(self->flags & CFCTYPE_CONST);
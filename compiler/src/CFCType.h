@@ -229,6 +229,11 @@ CFCType_get_width(CFCType *self);
 const char*
 CFCType_get_array(CFCType *self);
 
+/** Return the child of a composite type or NULL.
+ */
+CFCType*
+CFCType_get_child(CFCType *self);
+
 int
 CFCType_const(CFCType *self);
 
@@ -46,10 +46,30 @@
     #define false 0
 #endif
 
+#include "CFCBase.h"
+#include "CFCCharBuf.h"
 #include "CFCUtil.h"
 
-static char    *thrown_error;
-static jmp_buf *current_env;
+/* Worker threads need their own error state. Threads are only used when
+ * CFC runs standalone or under Go. The Perl and Python hosts report warnings
+ * and errors through the interpreter, which must not be entered from a
+ * worker thread.
+ */
+#if defined(CHY_HAS_PTHREAD_H) \
+    && defined(CHY_HAS_THREAD_LOCAL) \
+    && defined(__GNUC__) \
+    && !defined(CFCPERL) \
+    && !defined(CFCPYTHON)
+  #define CFCUTIL_USE_THREADS
+  #include <pthread.h>
+  #include <unistd.h>
+  #define CFCUTIL_THREAD_LOCAL CHY_THREAD_LOCAL
+#else
+  #define CFCUTIL_THREAD_LOCAL
+#endif
+
+static CFCUTIL_THREAD_LOCAL char    *thrown_error;
+static CFCUTIL_THREAD_LOCAL jmp_buf *current_env;
 
 void
 CFCUtil_null_check(const void *arg, const char *name, const char *file,
@@ -197,7 +217,9 @@ CFCUtil_enclose_lines(const char *text, const char *line_prefix,
     if (!prefix)       { prefix       = ""; }
     if (!postfix)      { postfix      = ""; }
 
-    char *result = CFCUtil_strdup(prefix);
+    CFCCharBuf *buf = CFCCharBuf_new(strlen(text) + strlen(prefix)
+                                     + strlen(postfix));
+    CFCCharBuf_cat(buf, prefix, NULL);
 
     const char *line_start = text;
     const char *text_end   = text + strlen(text);
@@ -216,18 +238,17 @@ CFCUtil_enclose_lines(const char *text, const char *line_prefix,
             next_start = line_end + 1;
         }
 
-        char *line = (char*)MALLOCATE(line_len + 1);
-        memcpy(line, line_start, line_len);
-        line[line_len] = '\0';
-        result = CFCUtil_cat(result, line_prefix, line, line_postfix, "\n",
-                             NULL);
-        FREEMEM(line);
+        CFCCharBuf_cat(buf, line_prefix, NULL);
+        CFCCharBuf_cat_len(buf, line_start, line_len);
+        CFCCharBuf_cat(buf, line_postfix, "\n", NULL);
 
         line_start = next_start;
     }
 
-    result = CFCUtil_cat(result, postfix, NULL);
+    CFCCharBuf_cat(buf, postfix, NULL);
 
+    char *result = CFCCharBuf_yield_string(buf);
+    CFCBase_decref((CFCBase*)buf);
     return result;
 }
 
@@ -405,6 +426,24 @@ CFCUtil_write_if_changed(const char *path, const char *content, size_t len) {
     return true;
 }
 
+char*
+CFCUtil_content_hash(const char *data, size_t len) {
+    // 64-bit FNV-1a.
+    uint64_t hash = UINT64_C(0xCBF29CE484222325);
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (unsigned char)data[i];
+        hash *= UINT64_C(0x100000001B3);
+    }
+
+    char *digest = (char*)MALLOCATE(17);
+    for (int i = 15; i >= 0; i--) {
+        digest[i] = "0123456789abcdef"[hash & 0xF];
+        hash >>= 4;
+    }
+    digest[16] = '\0';
+    return digest;
+}
+
 long
 CFCUtil_flength(void *file) {
     FILE *f = (FILE*)file;
@@ -454,7 +493,10 @@ CFCUtil_make_path(const char *path) {
                 }
             }
             else {
-                int success = CFCUtil_make_dir(target);
+                // Another thread may have created the directory in the
+                // meantime.
+                int success = CFCUtil_make_dir(target)
+                              || CFCUtil_is_dir(target);
                 if (!success) {
                     FREEMEM(target);
                     return false;
@@ -605,6 +647,130 @@ CFCUtil_closedir(void *dirhandle, const char *dir) {
 
 /***************************************************************************/
 
+static int num_threads = 0;
+
+void
+CFCUtil_set_num_threads(int threads) {
+    num_threads = threads < 0 ? 0 : threads;
+}
+
+int
+CFCUtil_get_num_threads(void) {
+#ifdef CFCUTIL_USE_THREADS
+    if (num_threads > 0) { return num_threads; }
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return num_cpus > 0 ? (int)num_cpus : 1;
+#else
+    return 1;
+#endif
+}
+
+#ifdef CFCUTIL_USE_THREADS
+
+typedef struct CFCUtilParallelRun {
+    CFCUtil_task_t   task;
+    void            *context;
+    size_t           num_ticks;
+    size_t           next_tick;
+    char            *error;
+    size_t           error_tick;
+    pthread_mutex_t  mutex;
+} CFCUtilParallelRun;
+
+static CFCUTIL_THREAD_LOCAL int in_parallel_run;
+
+static void*
+S_run_ticks(void *arg) {
+    CFCUtilParallelRun *run = (CFCUtilParallelRun*)arg;
+    in_parallel_run = true;
+
+    while (1) {
+        pthread_mutex_lock(&run->mutex);
+        size_t tick = run->next_tick++;
+        pthread_mutex_unlock(&run->mutex);
+        if (tick >= run->num_ticks) { break; }
+
+        char *error;
+        CFCUTIL_TRY {
+            run->task(run->context, tick);
+        }
+        CFCUTIL_CATCH(error);
+
+        if (error) {
+            // Keep the error from the lowest tick so that the reported
+            // error doesn't depend on scheduling.
+            pthread_mutex_lock(&run->mutex);
+            if (!run->error || tick < run->error_tick) {
+                char *old_error = run->error;
+                run->error      = error;
+                run->error_tick = tick;
+                error           = old_error;
+            }
+            pthread_mutex_unlock(&run->mutex);
+            FREEMEM(error);
+        }
+    }
+
+    in_parallel_run = false;
+    return NULL;
+}
+
+void
+CFCUtil_run_parallel(CFCUtil_task_t task, void *context, size_t num_ticks) {
+    size_t threads = (size_t)CFCUtil_get_num_threads();
+    if (threads > num_ticks) { threads = num_ticks; }
+
+    // Nested runs execute serially in the calling worker.
+    if (threads <= 1 || in_parallel_run) {
+        for (size_t i = 0; i < num_ticks; i++) {
+            task(context, i);
+        }
+        return;
+    }
+
+    CFCUtilParallelRun run;
+    run.task       = task;
+    run.context    = context;
+    run.num_ticks  = num_ticks;
+    run.next_tick  = 0;
+    run.error      = NULL;
+    run.error_tick = 0;
+    pthread_mutex_init(&run.mutex, NULL);
+
+    // The calling thread acts as one of the workers.
+    pthread_t *workers
+        = (pthread_t*)MALLOCATE((threads - 1) * sizeof(pthread_t));
+    size_t num_started = 0;
+    for (size_t i = 0; i < threads - 1; i++) {
+        if (pthread_create(&workers[i], NULL, S_run_ticks, &run) != 0) {
+            break;
+        }
+        num_started++;
+    }
+    S_run_ticks(&run);
+    for (size_t i = 0; i < num_started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+
+    FREEMEM(workers);
+    pthread_mutex_destroy(&run.mutex);
+
+    if (run.error) {
+        CFCUtil_rethrow(run.error);
+    }
+}
+
+#else /* CFCUTIL_USE_THREADS */
+
+void
+CFCUtil_run_parallel(CFCUtil_task_t task, void *context, size_t num_ticks) {
+    for (size_t i = 0; i < num_ticks; i++) {
+        task(context, i);
+    }
+}
+
+#endif /* CFCUTIL_USE_THREADS */
+
 jmp_buf*
 CFCUtil_try_start(jmp_buf *env) {
     jmp_buf *prev_env = current_env;
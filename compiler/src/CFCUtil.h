@@ -174,6 +174,13 @@ CFCUtil_write_file(const char *filename, const char *content, size_t len);
 int
 CFCUtil_write_if_changed(const char *path, const char *content, size_t len);
 
+/** Return a content hash of `len` bytes at `data` as a string of 16
+ * hexadecimal digits.  The hash is stable across platforms and runs, so it
+ * can be stored in build caches.
+ */
+char*
+CFCUtil_content_hash(const char *data, size_t len);
+
 /* Read an entire file (as text) into memory.
  */
 char*
@@ -245,6 +252,28 @@ CFCUtil_rethrow(char *error);
 void
 CFCUtil_warn(const char *format, ...);
 
+typedef void
+(*CFCUtil_task_t)(void *context, size_t tick);
+
+/** Invoke `task` once for every tick from 0 to `num_ticks - 1`, spreading
+ * the calls across worker threads. Tasks must store their results in
+ * per-tick slots so that callers can consume them in a deterministic order.
+ * If any call throws, the error of the lowest failing tick is rethrown after
+ * all calls have finished. Calls are made serially if CFC was built without
+ * thread support or if invoked from within a task.
+ */
+void
+CFCUtil_run_parallel(CFCUtil_task_t task, void *context, size_t num_ticks);
+
+/** Set the number of threads used by CFCUtil_run_parallel. 0 selects the
+ * number of online CPUs.
+ */
+void
+CFCUtil_set_num_threads(int num_threads);
+
+int
+CFCUtil_get_num_threads(void);
+
 jmp_buf*
 CFCUtil_try_start(jmp_buf *env);
 
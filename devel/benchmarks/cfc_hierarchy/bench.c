@@ -0,0 +1,134 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Build a synthetic parcel with a large number of classes and time the
+ * phases of the Clownfish compiler to track how they scale.
+ *
+ * Usage: ./bench [num_classes]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "CFCBase.h"
+#include "CFCBindCore.h"
+#include "CFCClass.h"
+#include "CFCDocument.h"
+#include "CFCHierarchy.h"
+#include "CFCMemPool.h"
+#include "CFCParcel.h"
+#include "CFCUtil.h"
+
+#define SOURCE_DIR  "bench_source"
+#define DEST_DIR    "bench_autogen"
+#define INCLUDE_DIR "../../../runtime/core"
+
+static double
+S_now(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+static void
+S_write_source(int num_classes) {
+    CFCUtil_make_path(SOURCE_DIR "/Bench");
+    const char *cfp =
+        "{\n"
+        "    \"name\": \"Bench\",\n"
+        "    \"version\": \"v0.1.0\",\n"
+        "    \"prerequisites\": { \"Clownfish\": null }\n"
+        "}\n";
+    CFCUtil_write_if_changed(SOURCE_DIR "/Bench.cfp", cfp, strlen(cfp));
+
+    for (int i = 0; i < num_classes; i++) {
+        // Every class has eight children, so the trees stay shallow.
+        char *parent = i == 0
+                       ? CFCUtil_strdup("")
+                       : CFCUtil_sprintf(" inherits Bench::Class%d",
+                                         (i - 1) / 8);
+        char *content = CFCUtil_sprintf(
+            "parcel Bench;\n"
+            "\n"
+            "public class Bench::Class%d%s {\n"
+            "    int64_t value%d;\n"
+            "\n"
+            "    public inert incremented Class%d*\n"
+            "    new();\n"
+            "\n"
+            "    public inert Class%d*\n"
+            "    init(Class%d *self);\n"
+            "\n"
+            "    public int64_t\n"
+            "    Get_Value%d(Class%d *self);\n"
+            "\n"
+            "    public void\n"
+            "    Set_Value%d(Class%d *self, int64_t value);\n"
+            "}\n",
+            i, parent, i, i, i, i, i, i, i, i);
+        char *path = CFCUtil_sprintf(SOURCE_DIR "/Bench/Class%d.cfh", i);
+        CFCUtil_write_if_changed(path, content, strlen(content));
+        FREEMEM(path);
+        FREEMEM(content);
+        FREEMEM(parent);
+    }
+}
+
+int
+main(int argc, char **argv) {
+    int num_classes = argc > 1 ? atoi(argv[1]) : 10000;
+    if (num_classes < 1) {
+        fprintf(stderr, "Usage: %s [num_classes]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    double start = S_now();
+    S_write_source(num_classes);
+    double sources_written = S_now();
+
+    // Allocate from an arena like the cfc executable does.
+    CFCMemPool *pool = CFCMemPool_new(0x10000);
+    CFCBase_set_pool(pool);
+    CFCBase_decref((CFCBase*)pool);
+
+    CFCHierarchy *hierarchy = CFCHierarchy_new(DEST_DIR);
+    CFCHierarchy_add_source_dir(hierarchy, SOURCE_DIR);
+    CFCHierarchy_add_include_dir(hierarchy, INCLUDE_DIR);
+    CFCHierarchy_build(hierarchy);
+    double built = S_now();
+
+    CFCBindCore *core_binding = CFCBindCore_new(hierarchy, "", "");
+    CFCBindCore_write_all_modified(core_binding, 1);
+    double headers_written = S_now();
+
+    CFCBase_decref((CFCBase*)core_binding);
+    CFCBase_decref((CFCBase*)hierarchy);
+    CFCClass_clear_registry();
+    CFCDocument_clear_registry();
+    CFCParcel_reap_singletons();
+    CFCBase_set_pool(NULL);
+    double cleaned_up = S_now();
+
+    printf("classes:         %d\n", num_classes);
+    printf("write sources:   %.3f s\n", sources_written - start);
+    printf("build hierarchy: %.3f s\n", built - sources_written);
+    printf("write headers:   %.3f s\n", headers_written - built);
+    printf("clean up:        %.3f s\n", cleaned_up - headers_written);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,116 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Time StrHelp_format_f64 against the printf family.  `%g` is the baseline
+ * to beat although it doesn't round trip.  `%.17g` always round trips but
+ * isn't the shortest.  "printf shortest" is the approach of trying `%.15g`
+ * to `%.17g` until strtod returns the original value.
+ *
+ * Usage: ./exe [num_doubles]
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#define CFISH_USE_SHORT_NAMES
+#include "Clownfish/Util/StringHelper.h"
+
+static double
+S_now(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+static uint64_t
+S_random_u64(uint64_t *state) {
+    // xorshift64
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *state = x;
+}
+
+static size_t
+S_format_g(double value, char *buffer) {
+    return (size_t)sprintf(buffer, "%g", value);
+}
+
+static size_t
+S_format_17g(double value, char *buffer) {
+    return (size_t)sprintf(buffer, "%.17g", value);
+}
+
+static size_t
+S_format_printf_shortest(double value, char *buffer) {
+    int size = 0;
+    for (int precision = 15; precision <= 17; precision++) {
+        size = sprintf(buffer, "%.*g", precision, value);
+        if (strtod(buffer, NULL) == value) { break; }
+    }
+    return (size_t)size;
+}
+
+static void
+S_time(const char *label, size_t (*format)(double, char*),
+       const double *values, size_t num_values) {
+    char   buffer[64];
+    size_t total = 0;
+    double start = S_now();
+    for (size_t i = 0; i < num_values; i++) {
+        total += format(values[i], buffer);
+    }
+    double elapsed = S_now() - start;
+    printf("%-18s %8.3f s  %6.1f ns/value  (%lu chars)\n", label, elapsed,
+           elapsed * 1e9 / num_values, (unsigned long)total);
+}
+
+int
+main(int argc, char **argv) {
+    size_t num_values = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10)
+                                 : 2000000;
+    double *values = (double*)malloc(num_values * sizeof(double));
+    uint64_t state = 88172645463325252ULL;
+
+    // Half random bit patterns, half short decimals like prices or
+    // measurements.
+    for (size_t i = 0; i < num_values; i++) {
+        uint64_t bits = S_random_u64(&state);
+        double value;
+        if (i % 2) {
+            value = (double)(int64_t)(bits % 2000001 - 1000000) / 1000.0;
+        }
+        else {
+            memcpy(&value, &bits, sizeof(value));
+            if (value != value || value - value != 0) { value = 0.5; }
+        }
+        values[i] = value;
+    }
+
+    printf("Formatting %lu doubles\n", (unsigned long)num_values);
+    S_time("%g", S_format_g, values, num_values);
+    S_time("%.17g", S_format_17g, values, num_values);
+    S_time("printf shortest", S_format_printf_shortest, values,
+           num_values);
+    S_time("StrHelp_format_f64", StrHelp_format_f64, values, num_values);
+
+    free(values);
+    return 0;
+}
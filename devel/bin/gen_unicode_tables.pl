@@ -0,0 +1,295 @@
+#!/usr/bin/perl
+
+# Licensed to the Apache Software Foundation (ASF) under one or more
+# contributor license agreements.  See the NOTICE file distributed with
+# this work for additional information regarding copyright ownership.
+# The ASF licenses this file to You under the Apache License, Version 2.0
+# (the "License"); you may not use this file except in compliance with
+# the License.  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Generate the Unicode property tables used by Clownfish::Util::Unicode from
+# the Unicode Character Database shipped with Perl.
+#
+# Usage: devel/bin/gen_unicode_tables.pl
+#
+# Rerun after upgrading Perl to pick up a new version of Unicode.
+
+use strict;
+use warnings;
+use feature qw( fc unicode_strings );
+
+use FindBin qw( $Bin );
+use File::Spec::Functions qw( catdir catfile updir );
+use Unicode::Normalize qw( getCanon getCompat getCombinClass isComp_Ex );
+use Unicode::UCD qw( charinfo prop_invmap );
+
+# Execute from the root of the Clownfish repository.
+chdir catdir( $Bin, updir(), updir() );
+
+my $OUTPUT = catfile(qw( runtime core Clownfish Util UnicodeTables.h ));
+
+# Code points at or above LIMIT have default properties.  Keeping the
+# first-stage tables short saves a lot of space.
+my $LIMIT = 0x30000;
+my $SHIFT = 5;
+my $BLOCK_SIZE = 1 << $SHIFT;
+
+my $HANGUL_BASE = 0xAC00;
+my $HANGUL_END  = 0xD7A3;
+
+my $NFC_QC_NO     = 0x01;
+my $NFC_QC_MAYBE  = 0x02;
+my $NFKC_QC_NO    = 0x04;
+my $NFKC_QC_MAYBE = 0x08;
+
+my $SEQ_FLAG = 0x40000000;
+
+# Values of the quick check properties by code point.
+my %quick_check;
+for my $spec (
+    [ 'NFC_Quick_Check',  $NFC_QC_NO,  $NFC_QC_MAYBE ],
+    [ 'NFKC_Quick_Check', $NFKC_QC_NO, $NFKC_QC_MAYBE ],
+) {
+    my ( $prop, $no_flag, $maybe_flag ) = @$spec;
+    my ( $ranges, $values ) = prop_invmap($prop);
+    die "Can't get $prop" if !$ranges;
+    for my $i ( 0 .. $#$ranges ) {
+        my $value = $values->[$i];
+        next if $value eq 'Y' || $value eq 'Yes';
+        my $flag = $value =~ /^N/ ? $no_flag : $maybe_flag;
+        my $end = $i < $#$ranges ? $ranges->[ $i + 1 ] - 1 : 0x10FFFF;
+        for my $cp ( $ranges->[$i] .. $end ) {
+            die sprintf( "$prop of U+%04X beyond limit", $cp )
+                if $cp >= $LIMIT;
+            $quick_check{$cp} |= $flag;
+        }
+    }
+}
+
+# Sequences of code points.  Index 0 is reserved for "none".
+my @sequences = (0);
+my %sequence_index;
+
+sub add_sequence {
+    my @code_points = @_;
+    my $key = join( ',', @code_points );
+    if ( !exists $sequence_index{$key} ) {
+        $sequence_index{$key} = scalar @sequences;
+        push @sequences, scalar(@code_points), @code_points;
+    }
+    return $sequence_index{$key};
+}
+
+# Encode a case mapping as delta or as index into the sequences.
+sub case_mapping {
+    my ( $cp, $mapped ) = @_;
+    my @code_points = map { ord } split( //, $mapped );
+    return 0 if @code_points == 1 && $code_points[0] == $cp;
+    return $code_points[0] - $cp if @code_points == 1;
+    return $SEQ_FLAG | add_sequence(@code_points);
+}
+
+# Decompositions.  Index 0 is reserved for "none".
+my @decomps = (0);
+
+my @props_records = ( [ 0, 0, 0, 0 ] );
+my %props_index   = ( '0,0,0,0' => 0 );
+my @props_values;
+my @decomp_values;
+my @compositions;
+
+for my $cp ( 0 .. $LIMIT - 1 ) {
+    if ( $cp >= 0xD800 && $cp <= 0xDFFF ) {
+        push @props_values,  0;
+        push @decomp_values, 0;
+        next;
+    }
+
+    my $char  = chr($cp);
+    my $ccc   = getCombinClass($cp);
+    my $flags = $quick_check{$cp} || 0;
+    my $lower = case_mapping( $cp, lc($char) );
+    my $fold  = case_mapping( $cp, fc($char) );
+
+    my $key = "$ccc,$flags,$lower,$fold";
+    if ( !exists $props_index{$key} ) {
+        $props_index{$key} = scalar @props_records;
+        push @props_records, [ $ccc, $flags, $lower, $fold ];
+    }
+    push @props_values, $props_index{$key};
+
+    # Hangul syllables are decomposed and composed algorithmically.
+    my $canon  = getCanon($cp);
+    my $compat = getCompat($cp);
+    if ( ( $cp >= $HANGUL_BASE && $cp <= $HANGUL_END )
+         || ( !defined($canon) && !defined($compat) )
+    ) {
+        push @decomp_values, 0;
+        next;
+    }
+
+    my @canon  = defined($canon)  ? map { ord } split( //, $canon )  : ();
+    my @compat = defined($compat) ? map { ord } split( //, $compat ) : ();
+    my $same   = "@canon" eq "@compat";
+    die sprintf( "Decomposition of U+%04X too long", $cp )
+        if @canon > 255 || @compat > 255;
+    push @decomp_values, scalar @decomps;
+    push @decomps, scalar(@canon) | ( ( $same ? 0 : scalar(@compat) ) << 8 ),
+        @canon, ( $same ? () : @compat );
+
+    # Primary composites.
+    my $info = charinfo($cp);
+    my @mapping = split( ' ', $info->{decomposition} );
+    if ( @mapping == 2 && $mapping[0] !~ /^</ && !isComp_Ex($cp) ) {
+        push @compositions, [ hex( $mapping[0] ), hex( $mapping[1] ), $cp ];
+    }
+}
+
+# Check that code points beyond the limit have default properties.
+for my $cp ( $LIMIT .. 0x10FFFF ) {
+    my $char = chr($cp);
+    die sprintf( "U+%04X beyond limit has non-default properties", $cp )
+        if getCombinClass($cp)
+        || defined( getCanon($cp) )
+        || defined( getCompat($cp) )
+        || lc($char) ne $char
+        || fc($char) ne $char;
+}
+
+# Split a table into blocks, sharing identical blocks.
+sub two_stage {
+    my $values = shift;
+    my ( @stage1, @stage2, %block_index );
+    for ( my $i = 0; $i < @$values; $i += $BLOCK_SIZE ) {
+        my @block = @{$values}[ $i .. $i + $BLOCK_SIZE - 1 ];
+        my $key = join( ',', @block );
+        if ( !exists $block_index{$key} ) {
+            $block_index{$key} = @stage2 / $BLOCK_SIZE;
+            push @stage2, @block;
+        }
+        push @stage1, $block_index{$key};
+    }
+    return ( \@stage1, \@stage2 );
+}
+
+sub format_array {
+    my ( $type, $name, $values ) = @_;
+    my $output = "static const $type $name\[" . scalar(@$values) . "] = {\n";
+    my $line = '   ';
+    for my $value (@$values) {
+        my $item = " $value,";
+        if ( length($line) + length($item) > 78 ) {
+            $output .= "$line\n";
+            $line = '   ';
+        }
+        $line .= $item;
+    }
+    $output .= "$line\n};\n\n";
+    return $output;
+}
+
+my ( $props_stage1,  $props_stage2 )  = two_stage( \@props_values );
+my ( $decomp_stage1, $decomp_stage2 ) = two_stage( \@decomp_values );
+die "Too many sequences"  if @sequences >= $SEQ_FLAG;
+die "Too many decomps"    if @decomps > 0xFFFF;
+die "Too many records"    if @props_records > 0xFFFF;
+die "Too many blocks"     if @$props_stage2 / $BLOCK_SIZE > 0xFFFF
+                             || @$decomp_stage2 / $BLOCK_SIZE > 0xFFFF;
+
+@compositions = sort { $a->[0] <=> $b->[0] || $a->[1] <=> $b->[1] }
+                @compositions;
+
+my $version = Unicode::UCD::UnicodeVersion();
+my $output = <<"END_HEADER";
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* This file was generated by devel/bin/gen_unicode_tables.pl from the
+ * Unicode Character Database, version $version.  Don't edit it directly.
+ *
+ * Properties are looked up in two stages: the high bits of a code point
+ * select a block in stage 1, the low bits an entry in the shared stage 2
+ * blocks.
+ */
+
+#define UNICODE_VERSION       "$version"
+#define UNICODE_LIMIT         0x${\ sprintf('%X', $LIMIT)}
+#define UNICODE_SHIFT         $SHIFT
+#define UNICODE_NFC_QC_NO     0x${\ sprintf('%02X', $NFC_QC_NO)}
+#define UNICODE_NFC_QC_MAYBE  0x${\ sprintf('%02X', $NFC_QC_MAYBE)}
+#define UNICODE_NFKC_QC_NO    0x${\ sprintf('%02X', $NFKC_QC_NO)}
+#define UNICODE_NFKC_QC_MAYBE 0x${\ sprintf('%02X', $NFKC_QC_MAYBE)}
+#define UNICODE_SEQ_FLAG      0x${\ sprintf('%X', $SEQ_FLAG)}
+
+/* Case mappings are either a delta to the code point or, if not less than
+ * UNICODE_SEQ_FLAG, UNICODE_SEQ_FLAG plus an index into unicode_sequences.
+ */
+typedef struct {
+    uint8_t ccc;
+    uint8_t flags;
+    int32_t lower;
+    int32_t fold;
+} UnicodeProps;
+
+/* Composition of two code points into a primary composite. */
+typedef struct {
+    uint32_t first;
+    uint32_t second;
+    uint32_t composite;
+} UnicodeComposition;
+
+END_HEADER
+
+$output .= "static const UnicodeProps unicode_props["
+           . scalar(@props_records) . "] = {\n";
+for my $record (@props_records) {
+    $output .= sprintf( "    { %d, %d, %d, %d },\n", @$record );
+}
+$output .= "};\n\n";
+
+$output .= format_array( 'uint16_t', 'unicode_props_stage1', $props_stage1 );
+$output .= format_array( 'uint16_t', 'unicode_props_stage2', $props_stage2 );
+$output .= format_array( 'uint16_t', 'unicode_decomp_stage1',
+                         $decomp_stage1 );
+$output .= format_array( 'uint16_t', 'unicode_decomp_stage2',
+                         $decomp_stage2 );
+
+$output .= "/* Each decomposition starts with a header holding the size of the\n"
+           . " * canonical decomposition in the low byte and the size of a\n"
+           . " * differing compatibility decomposition in the second byte.\n"
+           . " */\n";
+$output .= format_array( 'uint32_t', 'unicode_decomps', \@decomps );
+$output .= "/* Each sequence starts with its size. */\n";
+$output .= format_array( 'uint32_t', 'unicode_sequences', \@sequences );
+
+$output .= "static const UnicodeComposition unicode_compositions["
+           . scalar(@compositions) . "] = {\n";
+for my $comp (@compositions) {
+    $output .= sprintf( "    { 0x%04X, 0x%04X, 0x%04X },\n", @$comp );
+}
+$output .= "};\n\n";
+
+open( my $fh, '>', $OUTPUT ) or die "Can't open $OUTPUT: $!";
+print $fh $output;
+close($fh) or die "Can't close $OUTPUT: $!";
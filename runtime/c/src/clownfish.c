@@ -38,6 +38,8 @@
 #include "Clownfish/Num.h"
 #include "Clownfish/String.h"
 #include "Clownfish/TestHarness/TestUtils.h"
+#include "Clownfish/Util/Audit.h"
+#include "Clownfish/Util/Instrument.h"
 #include "Clownfish/Util/Memory.h"
 #include "Clownfish/Vector.h"
 
@@ -62,6 +64,12 @@ SI_is_string_type(cfish_Class *klass) {
     return false;
 }
 
+static CFISH_INLINE bool
+SI_is_interned_string(cfish_Obj *obj) {
+    return SI_is_string_type(obj->klass)
+           && CFISH_Str_Is_Interned((cfish_String*)obj);
+}
+
 uint32_t
 cfish_get_refcount(void *vself) {
     cfish_Obj *self = (cfish_Obj*)vself;
@@ -71,13 +79,17 @@ cfish_get_refcount(void *vself) {
 Obj*
 cfish_inc_refcount(void *vself) {
     Obj *self = (Obj*)vself;
+    if (!AUDIT_CHECK_REFCOUNT(self, "INCREF")) { return self; }
 
     // Handle special cases.
     cfish_Class *const klass = self->klass;
     if (klass->flags & CFISH_fREFCOUNTSPECIAL) {
         if (SI_is_string_type(klass)) {
-            // Only copy-on-incref Strings get special-cased.  Ordinary
-            // strings fall through to the general case.
+            // Only copy-on-incref and interned Strings get special-cased.
+            // Ordinary strings fall through to the general case.
+            if (CFISH_Str_Is_Interned((cfish_String*)self)) {
+                return self;
+            }
             if (CFISH_Str_Is_Copy_On_IncRef((cfish_String*)self)) {
                 const char *utf8 = CFISH_Str_Get_Ptr8((cfish_String*)self);
                 size_t size = CFISH_Str_Get_Size((cfish_String*)self);
@@ -96,9 +108,10 @@ cfish_inc_refcount(void *vself) {
 uint32_t
 cfish_dec_refcount(void *vself) {
     cfish_Obj *self = (Obj*)vself;
+    if (!AUDIT_CHECK_REFCOUNT(self, "DECREF")) { return 0; }
     cfish_Class *klass = self->klass;
     if (klass->flags & CFISH_fREFCOUNTSPECIAL) {
-        if (SI_immortal(klass)) {
+        if (SI_immortal(klass) || SI_is_interned_string(self)) {
             return (uint32_t)self->refcount;
         }
     }
@@ -134,6 +147,22 @@ Class_Make_Obj_IMP(Class *self) {
     Obj *obj = (Obj*)Memory_wrapped_calloc(self->obj_alloc_size, 1);
     obj->klass = self;
     obj->refcount = 1;
+    INSTRUMENT_ALLOC(obj);
+    AUDIT_ALLOC(obj);
+    return obj;
+}
+
+Obj*
+Class_Make_Obj_Extra_IMP(Class *self, size_t extra) {
+    if (extra > SIZE_MAX - self->obj_alloc_size) {
+        THROW(ERR, "Object size overflow");
+    }
+    Obj *obj
+        = (Obj*)Memory_wrapped_calloc(self->obj_alloc_size + extra, 1);
+    obj->klass = self;
+    obj->refcount = 1;
+    INSTRUMENT_ALLOC(obj);
+    AUDIT_ALLOC(obj);
     return obj;
 }
 
@@ -143,6 +172,7 @@ Class_Init_Obj_IMP(Class *self, void *allocation) {
     Obj *obj = (Obj*)allocation;
     obj->klass = self;
     obj->refcount = 1;
+    AUDIT_INIT(obj);
     return obj;
 }
 
@@ -92,6 +92,51 @@ DllMain(HINSTANCE dll, DWORD reason, LPVOID reserved) {
     return TRUE;
 }
 
+/******************* Compiler-level TLS with pthreads **********************/
+#elif defined(CFISH_TLS_FAST_PATH)
+
+#include <pthread.h>
+
+CFISH_THREAD_LOCAL ErrContext *cfish_Tls_err_context;
+
+static pthread_key_t err_context_key;
+
+static void
+S_destroy_context(void *context);
+
+void
+Tls_init() {
+    int error = pthread_key_create(&err_context_key, S_destroy_context);
+    if (error) {
+        fprintf(stderr, "pthread_key_create failed: %d\n", error);
+        abort();
+    }
+}
+
+ErrContext*
+Tls_new_err_context() {
+    ErrContext *context = (ErrContext*)CALLOCATE(1, sizeof(ErrContext));
+
+    // The key value is never read. It only makes sure that the destructor
+    // runs when the thread exits.
+    int error = pthread_setspecific(err_context_key, context);
+    if (error) {
+        fprintf(stderr, "pthread_setspecific failed: %d\n", error);
+        abort();
+    }
+
+    cfish_Tls_err_context = context;
+    return context;
+}
+
+static void
+S_destroy_context(void *arg) {
+    ErrContext *context = (ErrContext*)arg;
+    cfish_Tls_err_context = NULL;
+    DECREF(context->current_error);
+    FREEMEM(context);
+}
+
 /******************************** pthreads *********************************/
 #elif defined(CHY_HAS_PTHREAD_H)
 
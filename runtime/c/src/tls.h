@@ -22,6 +22,7 @@
 #include <setjmp.h>
 
 #include "Clownfish/Err.h"
+#include "Clownfish/Util/ThreadLocal.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -36,13 +37,40 @@ typedef struct {
 void
 cfish_Tls_init(void);
 
+#if !defined(CFISH_NOTHREADS) \
+    && !defined(CHY_HAS_WINDOWS_H) \
+    && defined(CHY_HAS_PTHREAD_H) \
+    && defined(CFISH_HAS_THREAD_LOCAL)
+
+/* Fast path: The context is cached in a compiler-level thread-local
+ * variable. A pthread key is only used to free the context at thread exit.
+ */
+#define CFISH_TLS_FAST_PATH
+
+extern CFISH_THREAD_LOCAL cfish_ErrContext *cfish_Tls_err_context;
+
 cfish_ErrContext*
-cfish_Tls_get_err_context();
+cfish_Tls_new_err_context(void);
+
+static CFISH_INLINE cfish_ErrContext*
+cfish_Tls_get_err_context(void) {
+    return cfish_Tls_err_context
+           ? cfish_Tls_err_context
+           : cfish_Tls_new_err_context();
+}
+
+#else
+
+cfish_ErrContext*
+cfish_Tls_get_err_context(void);
+
+#endif
 
 #ifdef CFISH_USE_SHORT_NAMES
   #define ErrContext            cfish_ErrContext
   #define Tls_init              cfish_Tls_init
   #define Tls_get_err_context   cfish_Tls_get_err_context
+  #define Tls_new_err_context   cfish_Tls_new_err_context
 #endif
 
 #ifdef __cplusplus
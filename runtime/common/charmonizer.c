@@ -7994,6 +7994,12 @@ S_ends_with(const char *string, const char *postfix);
 static int
 S_need_libpthread(chaz_CLI *cli);
 
+static const char*
+S_thread_local_keyword(void);
+
+static int
+S_has_backtrace(void);
+
 int main(int argc, const char **argv) {
     chaz_CFlags *link_flags;
 
@@ -8004,6 +8010,12 @@ int main(int argc, const char **argv) {
                       CHAZ_CLI_ARG_REQUIRED);
     chaz_CLI_register(cli, "disable-threads", "whether to disable threads",
                       CHAZ_CLI_NO_ARG);
+    chaz_CLI_register(cli, "enable-instrumentation",
+                      "count allocations and method calls per class",
+                      CHAZ_CLI_NO_ARG);
+    chaz_CLI_register(cli, "enable-audit",
+                      "track live objects and report leaks at exit",
+                      CHAZ_CLI_NO_ARG);
     chaz_CLI_set_usage(cli, "Usage: charmonizer [OPTIONS] [-- [CFLAGS]]");
     if (!chaz_Probe_parse_cli_args(argc, argv, cli)) {
         chaz_Probe_die_usage();
@@ -8041,6 +8053,19 @@ int main(int argc, const char **argv) {
     if (chaz_HeadCheck_defines_symbol("__sync_bool_compare_and_swap", "")) {
         chaz_ConfWriter_add_def("HAS___SYNC_BOOL_COMPARE_AND_SWAP", NULL);
     }
+    {
+        const char *thread_local = S_thread_local_keyword();
+        if (thread_local) {
+            chaz_ConfWriter_add_def("HAS_THREAD_LOCAL", NULL);
+            chaz_ConfWriter_add_def("THREAD_LOCAL", thread_local);
+        }
+    }
+    if (S_has_backtrace()) {
+        chaz_ConfWriter_add_def("HAS_BACKTRACE", NULL);
+    }
+    if (chaz_HeadCheck_check_header("sys/uio.h")) {
+        chaz_ConfWriter_add_def("HAS_SYS_UIO_H", NULL);
+    }
     link_flags = S_link_flags(cli);
     chaz_ConfWriter_add_def("EXTRA_LDFLAGS",
                             chaz_CFlags_get_string(link_flags));
@@ -8137,6 +8162,12 @@ S_add_compiler_flags(struct chaz_CLI *cli) {
     if (chaz_CLI_defined(cli, "disable-threads")) {
         chaz_CFlags_append(extra_cflags, "-DCFISH_NOTHREADS");
     }
+    if (chaz_CLI_defined(cli, "enable-instrumentation")) {
+        chaz_CFlags_append(extra_cflags, "-DCFISH_INSTRUMENT");
+    }
+    if (chaz_CLI_defined(cli, "enable-audit")) {
+        chaz_CFlags_append(extra_cflags, "-DCFISH_AUDIT");
+    }
 }
 
 static chaz_CFlags*
@@ -8546,3 +8577,58 @@ S_need_libpthread(chaz_CLI *cli) {
     return 1;
 }
 
+/* Find a storage class specifier for thread-local variables. Prefer the GNU
+ * extension, which doesn't trigger warnings under -std=gnu99 -pedantic.
+ */
+static const char*
+S_thread_local_keyword(void) {
+    static const char *const keywords[] = {
+        "__thread",
+        "_Thread_local",
+        "__declspec(thread)",
+        NULL
+    };
+    static const char code[] =
+        "static %s int counter;\n"
+        "\n"
+        "int main() {\n"
+        "    counter++;\n"
+        "    return counter - 1;\n"
+        "}\n";
+    int i;
+
+    for (i = 0; keywords[i] != NULL; i++) {
+        size_t  size   = sizeof(code) + strlen(keywords[i]) + 10;
+        char   *source = (char*)malloc(size);
+        int     success;
+
+        sprintf(source, code, keywords[i]);
+        success = chaz_CC_test_link(source);
+        free(source);
+        if (success) {
+            return keywords[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* Check whether backtrace() from execinfo.h can be linked without extra
+ * libraries.  Only used to annotate leak reports in audit builds.
+ */
+static int
+S_has_backtrace(void) {
+    static const char source[] =
+        "#include <execinfo.h>\n"
+        "\n"
+        "int main() {\n"
+        "    void *frames[4];\n"
+        "    return backtrace(frames, 4) < 0;\n"
+        "}\n";
+
+    if (!chaz_HeadCheck_check_header("execinfo.h")) {
+        return 0;
+    }
+    return chaz_CC_test_link(source);
+}
+
@@ -15,15 +15,15 @@
  */
 
 #include "Clownfish/Boolean.h"
-#include "Clownfish/Hash.h"
-#include "Clownfish/HashIterator.h"
 #include "Clownfish/Err.h"
+#include "Clownfish/Util/Audit.h"
 
 void
 cfish_init_parcel() {
     cfish_Bool_init_class();
-    cfish_Hash_init_class();
-    cfish_HashIter_init_class();
     cfish_Err_init_class();
+
+    // Don't report the runtime's global objects as leaks.
+    cfish_Audit_set_baseline();
 }
 
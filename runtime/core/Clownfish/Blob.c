@@ -17,16 +17,31 @@
 #define C_CFISH_BLOB
 #define CFISH_USE_SHORT_NAMES
 
+#include "charmony.h"
+
+#include <errno.h>
+#include <stdio.h>
 #include <string.h>
 
+#if defined(CHY_HAS_SYS_MMAN_H) && defined(CHY_HAS_UNISTD_H) \
+    && defined(CHY_HAS_FCNTL_H) && defined(CHY_HAS_SYS_STAT_H)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+  #define BLOB_HAS_MMAP
+#endif
+
 #include "Clownfish/Class.h"
 #include "Clownfish/Blob.h"
 #include "Clownfish/Err.h"
+#include "Clownfish/String.h"
+#include "Clownfish/Util/Audit.h"
 #include "Clownfish/Util/Memory.h"
 
 Blob*
 Blob_new(const void *bytes, size_t size) {
-    Blob *self = (Blob*)Class_Make_Obj(BLOB);
+    Blob *self = (Blob*)MAKE_OBJ(BLOB);
     return Blob_init(self, bytes, size);
 }
 
@@ -39,14 +54,15 @@ Blob_init(Blob *self, const void *bytes, size_t size) {
 
     self->buf      = copy;
     self->size     = size;
-    self->owns_buf = true;
+    self->origin   = (Obj*)self;
+    self->mapped   = false;
 
     return self;
 }
 
 Blob*
 Blob_new_steal(void *bytes, size_t size) {
-    Blob *self = (Blob*)Class_Make_Obj(BLOB);
+    Blob *self = (Blob*)MAKE_OBJ(BLOB);
     return Blob_init_steal(self, bytes, size);
 }
 
@@ -54,14 +70,15 @@ Blob*
 Blob_init_steal(Blob *self, void *bytes, size_t size) {
     self->buf      = (char*)bytes;
     self->size     = size;
-    self->owns_buf = true;
+    self->origin   = (Obj*)self;
+    self->mapped   = false;
 
     return self;
 }
 
 Blob*
 Blob_new_wrap(const void *bytes, size_t size) {
-    Blob *self = (Blob*)Class_Make_Obj(BLOB);
+    Blob *self = (Blob*)MAKE_OBJ(BLOB);
     return Blob_init_wrap(self, bytes, size);
 }
 
@@ -69,17 +86,228 @@ Blob*
 Blob_init_wrap(Blob *self, const void *bytes, size_t size) {
     self->buf      = (char*)bytes;
     self->size     = size;
-    self->owns_buf = false;
+    self->origin   = NULL;
+    self->mapped   = false;
+
+    return self;
+}
+
+Blob*
+Blob_new_from_origin(Obj *origin, const void *bytes, size_t size) {
+    Blob *self = (Blob*)MAKE_OBJ(BLOB);
+    return Blob_init_from_origin(self, origin, bytes, size);
+}
+
+Blob*
+Blob_init_from_origin(Blob *self, Obj *origin, const void *bytes,
+                      size_t size) {
+    Obj *owner = INCREF(origin);
+    if (owner != origin) {
+        // Incrementing the refcount of a stack String or a String wrapping
+        // external memory creates a copy. Point into the copy, because the
+        // original memory may go away.
+        const char *ptr = Obj_is_a(origin, STRING)
+                          ? Str_Get_Ptr8((String*)origin)
+                          : NULL;
+        const char *start = (const char*)bytes;
+        if (ptr == NULL
+            || start < ptr
+            || size > Str_Get_Size((String*)origin)
+            || (size_t)(start - ptr) > Str_Get_Size((String*)origin) - size
+           ) {
+            DECREF(owner);
+            DECREF(self);
+            THROW(ERR, "Can't share memory of %o", Obj_get_class_name(origin));
+        }
+        bytes = Str_Get_Ptr8((String*)owner) + (start - ptr);
+    }
+
+    self->buf    = (char*)bytes;
+    self->size   = size;
+    self->origin = owner;
+    self->mapped = false;
 
     return self;
 }
 
+// Size of the chunks read from files which can't be mapped.
+#define READ_CHUNK_SIZE 65536
+
+#ifdef BLOB_HAS_MMAP
+
+static void
+S_advise(void *addr, size_t size, int32_t access_hint) {
+#ifdef MADV_SEQUENTIAL
+    if (access_hint & BLOB_ACCESS_SEQUENTIAL) {
+        madvise(addr, size, MADV_SEQUENTIAL);
+    }
+#endif
+#ifdef MADV_RANDOM
+    if (access_hint & BLOB_ACCESS_RANDOM) {
+        madvise(addr, size, MADV_RANDOM);
+    }
+#endif
+#ifdef MADV_WILLNEED
+    if (access_hint & BLOB_ACCESS_WILLNEED) {
+        madvise(addr, size, MADV_WILLNEED);
+    }
+#endif
+    (void)addr;
+    (void)size;
+    (void)access_hint;
+}
+
+// Read the rest of a file into a newly allocated buffer.  Return false on
+// error.
+static bool
+S_read_fd(int fd, char **buf_ptr, size_t *size_ptr) {
+    size_t  cap  = READ_CHUNK_SIZE;
+    size_t  size = 0;
+    char   *buf  = (char*)MALLOCATE(cap);
+
+    while (true) {
+        if (cap - size < READ_CHUNK_SIZE) {
+            cap *= 2;
+            buf = (char*)REALLOCATE(buf, cap);
+        }
+        ssize_t check = read(fd, buf + size, cap - size);
+        if (check == 0) { break; }
+        if (check < 0) {
+            if (errno == EINTR) { continue; }
+            FREEMEM(buf);
+            return false;
+        }
+        size += (size_t)check;
+    }
+
+    // Release unused capacity.
+    *buf_ptr  = (char*)REALLOCATE(buf, size + 1);
+    *size_ptr = size;
+    return true;
+}
+
+Blob*
+Blob_new_from_file(String *path, int32_t access_hint) {
+    char *path_c = Str_To_Utf8(path);
+    int   fd     = open(path_c, O_RDONLY);
+    int   error  = errno;
+    FREEMEM(path_c);
+    if (fd < 0) {
+        THROW(ERR, "Can't open '%o': %s", path, strerror(error));
+    }
+
+    struct stat stat_buf;
+    if (fstat(fd, &stat_buf) == 0
+        && S_ISREG(stat_buf.st_mode)
+        && stat_buf.st_size > 0
+        && (uint64_t)stat_buf.st_size <= SIZE_MAX
+       ) {
+        size_t size = (size_t)stat_buf.st_size;
+        void *addr = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+        if (addr != MAP_FAILED) {
+            close(fd);
+            S_advise(addr, size, access_hint);
+            Blob *self = (Blob*)MAKE_OBJ(BLOB);
+            self->buf    = (const char*)addr;
+            self->size   = size;
+            self->origin = (Obj*)self;
+            self->mapped = true;
+            return self;
+        }
+    }
+
+    // Fall back to reading files which can't be mapped.
+    char   *buf  = NULL;
+    size_t  size = 0;
+    if (!S_read_fd(fd, &buf, &size)) {
+        error = errno;
+        close(fd);
+        THROW(ERR, "Can't read '%o': %s", path, strerror(error));
+    }
+    close(fd);
+    return Blob_new_steal(buf, size);
+}
+
+#else // BLOB_HAS_MMAP
+
+Blob*
+Blob_new_from_file(String *path, int32_t access_hint) {
+    char *path_c = Str_To_Utf8(path);
+    FILE *file   = fopen(path_c, "rb");
+    int   error  = errno;
+    FREEMEM(path_c);
+    if (file == NULL) {
+        THROW(ERR, "Can't open '%o': %s", path, strerror(error));
+    }
+
+    size_t  cap  = READ_CHUNK_SIZE;
+    size_t  size = 0;
+    char   *buf  = (char*)MALLOCATE(cap);
+    while (true) {
+        if (cap - size < READ_CHUNK_SIZE) {
+            cap *= 2;
+            buf = (char*)REALLOCATE(buf, cap);
+        }
+        size_t check = fread(buf + size, 1, cap - size, file);
+        size += check;
+        if (check == 0) { break; }
+    }
+    if (ferror(file)) {
+        FREEMEM(buf);
+        fclose(file);
+        THROW(ERR, "Can't read '%o'", path);
+    }
+    fclose(file);
+
+    // Release unused capacity.
+    buf = (char*)REALLOCATE(buf, size + 1);
+    (void)access_hint;
+    return Blob_new_steal(buf, size);
+}
+
+#endif // BLOB_HAS_MMAP
+
 void
 Blob_Destroy_IMP(Blob *self) {
-    if (self->owns_buf) { FREEMEM((char*)self->buf); }
+    if (self->origin == (Obj*)self) {
+#ifdef BLOB_HAS_MMAP
+        if (self->mapped) {
+            munmap((void*)self->buf, self->size);
+        }
+        else {
+            FREEMEM((char*)self->buf);
+        }
+#else
+        FREEMEM((char*)self->buf);
+#endif
+    }
+    else {
+        DECREF(self->origin);
+    }
     SUPER_DESTROY(self, BLOB);
 }
 
+Blob*
+Blob_Slice_IMP(Blob *self, size_t offset, size_t length) {
+    // Adjust ranges if necessary.
+    if (offset >= self->size) {
+        offset = 0;
+        length = 0;
+    }
+    else if (length > self->size - offset) {
+        length = self->size - offset;
+    }
+
+    if (offset == 0 && length == self->size && self->origin != NULL) {
+        return (Blob*)INCREF(self);
+    }
+    if (self->origin == NULL) {
+        // Copy slices of wrapped buffers.
+        return Blob_new(self->buf + offset, length);
+    }
+    return Blob_new_from_origin(self->origin, self->buf + offset, length);
+}
+
 Blob*
 Blob_Clone_IMP(Blob *self) {
     return (Blob*)INCREF(self);
@@ -109,6 +337,17 @@ Blob_Equals_IMP(Blob *self, Obj *other) {
     return SI_equals_bytes(self, twin->buf, twin->size);
 }
 
+size_t
+Blob_Hash_Sum_IMP(Blob *self) {
+    const uint8_t *ptr   = (const uint8_t*)self->buf;
+    const uint8_t *limit = ptr + self->size;
+    size_t hashvalue = 5381;
+    for (; ptr < limit; ptr++) {
+        hashvalue = ((hashvalue << 5) + hashvalue) ^ *ptr;
+    }
+    return hashvalue;
+}
+
 bool
 Blob_Equals_Bytes_IMP(Blob *self, const void *bytes, size_t size) {
     return SI_equals_bytes(self, bytes, size);
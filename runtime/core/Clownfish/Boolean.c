@@ -22,6 +22,7 @@
 
 #include "Clownfish/Class.h"
 #include "Clownfish/String.h"
+#include "Clownfish/Util/Audit.h"
 #include "Clownfish/Util/Atomic.h"
 
 Boolean *Bool_true_singleton;
@@ -29,14 +30,14 @@ Boolean *Bool_false_singleton;
 
 void
 Bool_init_class() {
-    Boolean *true_obj = (Boolean*)Class_Make_Obj(BOOLEAN);
+    Boolean *true_obj = (Boolean*)MAKE_OBJ(BOOLEAN);
     true_obj->value   = true;
     true_obj->string  = Str_newf("true");
     if (!Atomic_cas_ptr((void**)&Bool_true_singleton, NULL, true_obj)) {
         Bool_Destroy(true_obj);
     }
 
-    Boolean *false_obj = (Boolean*)Class_Make_Obj(BOOLEAN);
+    Boolean *false_obj = (Boolean*)MAKE_OBJ(BOOLEAN);
     false_obj->value   = false;
     false_obj->string  = Str_newf("false");
     if (!Atomic_cas_ptr((void**)&Bool_false_singleton, NULL, false_obj)) {
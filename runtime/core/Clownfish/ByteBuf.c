@@ -27,8 +27,12 @@
 #include "Clownfish/Blob.h"
 #include "Clownfish/Err.h"
 #include "Clownfish/String.h"
+#include "Clownfish/Util/Audit.h"
 #include "Clownfish/Util/Memory.h"
 
+// Maximum size of content copied rather than transferred by Yield_Blob.
+#define YIELD_COPY_MAX 128
+
 // Ensure that the ByteBuf's capacity is at least (size + extra).
 // If the buffer must be grown, oversize the allocation.
 static CFISH_INLINE void
@@ -47,7 +51,7 @@ S_overflow_error();
 
 ByteBuf*
 BB_new(size_t capacity) {
-    ByteBuf *self = (ByteBuf*)Class_Make_Obj(BYTEBUF);
+    ByteBuf *self = (ByteBuf*)MAKE_OBJ(BYTEBUF);
     return BB_init(self, capacity);
 }
 
@@ -66,7 +70,7 @@ BB_init(ByteBuf *self, size_t min_cap) {
 
 ByteBuf*
 BB_new_bytes(const void *bytes, size_t size) {
-    ByteBuf *self = (ByteBuf*)Class_Make_Obj(BYTEBUF);
+    ByteBuf *self = (ByteBuf*)MAKE_OBJ(BYTEBUF);
     return BB_init_bytes(self, bytes, size);
 }
 
@@ -86,7 +90,7 @@ BB_init_bytes(ByteBuf *self, const void *bytes, size_t size) {
 
 ByteBuf*
 BB_new_steal_bytes(void *bytes, size_t size, size_t capacity) {
-    ByteBuf *self = (ByteBuf*)Class_Make_Obj(BYTEBUF);
+    ByteBuf *self = (ByteBuf*)MAKE_OBJ(BYTEBUF);
     return BB_init_steal_bytes(self, bytes, size, capacity);
 }
 
@@ -148,6 +152,18 @@ BB_Equals_IMP(ByteBuf *self, Obj *other) {
     return SI_equals_bytes(self, twin->buf, twin->size);
 }
 
+size_t
+BB_Hash_Sum_IMP(ByteBuf *self) {
+    // Same algorithm as Blob_Hash_Sum.
+    const uint8_t *ptr   = (const uint8_t*)self->buf;
+    const uint8_t *limit = ptr + self->size;
+    size_t hashvalue = 5381;
+    for (; ptr < limit; ptr++) {
+        hashvalue = ((hashvalue << 5) + hashvalue) ^ *ptr;
+    }
+    return hashvalue;
+}
+
 bool
 BB_Equals_Bytes_IMP(ByteBuf *self, const void *bytes, size_t size) {
     return SI_equals_bytes(self, bytes, size);
@@ -187,6 +203,18 @@ BB_Grow_IMP(ByteBuf *self, size_t min_cap) {
 
 Blob*
 BB_Yield_Blob_IMP(ByteBuf *self) {
+    // Short content is copied, so that the buffer can be reused.  Larger
+    // buffers are handed over to the Blob, after trimming them if most of
+    // their capacity would be wasted.
+    if (self->size <= YIELD_COPY_MAX) {
+        Blob *blob = Blob_new(self->buf, self->size);
+        self->size = 0;
+        return blob;
+    }
+    if (self->size < self->cap / 2) {
+        self->buf = (char*)REALLOCATE(self->buf, self->size);
+    }
+
     Blob *blob = Blob_new_steal(self->buf, self->size);
     self->buf  = NULL;
     self->size = 0;
@@ -29,10 +29,14 @@
 
 #include "Clownfish/Err.h"
 #include "Clownfish/String.h"
+#include "Clownfish/Util/Audit.h"
 #include "Clownfish/Util/Memory.h"
 #include "Clownfish/Util/StringHelper.h"
 #include "Clownfish/Class.h"
 
+// Maximum size of content copied rather than transferred by Yield_String.
+#define YIELD_COPY_MAX 128
+
 // Append trusted UTF-8 to the CharBuf.
 static void
 S_cat_utf8(CharBuf *self, const char* ptr, size_t size);
@@ -73,7 +77,7 @@ S_die_invalid_pattern(const char *pattern);
 
 CharBuf*
 CB_new(size_t size) {
-    CharBuf *self = (CharBuf*)Class_Make_Obj(CHARBUF);
+    CharBuf *self = (CharBuf*)MAKE_OBJ(CHARBUF);
     return CB_init(self, size);
 }
 
@@ -189,7 +193,7 @@ CB_VCatF_IMP(CharBuf *self, const char *pattern, va_list args) {
                         else {
                             S_die_invalid_pattern(pattern_start);
                         }
-                        size = sprintf(buf, "%" PRId64, val);
+                        size = StrHelp_format_i64(val, buf);
                         S_cat_utf8(self, buf, size);
                     }
                     break;
@@ -211,16 +215,15 @@ CB_VCatF_IMP(CharBuf *self, const char *pattern, va_list args) {
                         else {
                             S_die_invalid_pattern(pattern_start);
                         }
-                        size = sprintf(buf, "%" PRIu64, val);
+                        size = StrHelp_format_u64(val, buf);
                         S_cat_utf8(self, buf, size);
                     }
                     break;
                 case 'f': {
                         if (pattern[1] == '6' && pattern[2] == '4') {
                             double num  = va_arg(args, double);
-                            char bigbuf[512];
-                            size_t size = sprintf(bigbuf, "%g", num);
-                            S_cat_utf8(self, bigbuf, size);
+                            size_t size = StrHelp_format_f64_g(num, buf);
+                            S_cat_utf8(self, buf, size);
                             pattern += 2;
                         }
                         else {
@@ -274,6 +277,15 @@ CB_To_String_IMP(CharBuf *self) {
 
 String*
 CB_Yield_String_IMP(CharBuf *self) {
+    // Short content is copied into a single-allocation String, so that the
+    // buffer can be reused.  Larger buffers are handed over to the String
+    // unless most of their capacity would be wasted.
+    if (self->size <= YIELD_COPY_MAX || self->size < self->cap / 2) {
+        String *retval = Str_new_from_trusted_utf8(self->ptr, self->size);
+        self->size = 0;
+        return retval;
+    }
+
     String *retval
         = Str_new_steal_trusted_utf8(self->ptr, self->size);
     self->ptr  = NULL;
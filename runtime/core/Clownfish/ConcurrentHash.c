@@ -0,0 +1,299 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define C_CFISH_CONCURRENTHASH
+#define CFISH_USE_SHORT_NAMES
+
+#include "charmony.h"
+
+#include "Clownfish/ConcurrentHash.h"
+#include "Clownfish/Boolean.h"
+#include "Clownfish/Class.h"
+#include "Clownfish/Err.h"
+#include "Clownfish/Hash.h"
+#include "Clownfish/HashIterator.h"
+#include "Clownfish/String.h"
+#include "Clownfish/Vector.h"
+#include "Clownfish/Util/Audit.h"
+#include "Clownfish/Util/Memory.h"
+#include "Clownfish/Util/Mutex.h"
+
+#define DEFAULT_NUM_SHARDS 16
+#define MAX_NUM_SHARDS     (1 << 16)
+
+struct cfish_ConcurrentHashShard {
+    Mutex  mutex;
+    Hash  *hash;
+};
+
+typedef cfish_ConcurrentHashShard Shard;
+
+typedef struct {
+    ConcHash_Visit_t  visit;
+    void             *context;
+    Obj              *value;
+} VisitArgs;
+
+typedef struct {
+    ConcHash_Visit_Entry_t  visit;
+    void                   *context;
+    Hash                   *hash;
+} VisitEntriesArgs;
+
+static void
+S_visit(void *context) {
+    VisitArgs *args = (VisitArgs*)context;
+    args->visit(args->context, args->value);
+}
+
+static void
+S_visit_entries(void *context) {
+    VisitEntriesArgs *args = (VisitEntriesArgs*)context;
+    HashIterator *iter = HashIter_new(args->hash);
+    while (HashIter_Next(iter)) {
+        args->visit(args->context, HashIter_Get_Key(iter),
+                    HashIter_Get_Value(iter));
+    }
+    DECREF(iter);
+}
+
+// Refcounts aren't atomic, so the hash must hold the sole reference to its
+// values.  Immortal objects are exempt.
+static void
+S_check_value(Obj *value) {
+    if (value == NULL
+        || Obj_is_a(value, BOOLEAN)
+        || (Obj_is_a(value, STRING) && Str_Is_Interned((String*)value))
+       ) {
+        return;
+    }
+    if (REFCOUNT_NN(value) != 1) {
+        THROW(ERR, "Value is shared with other objects: %o",
+              Obj_get_class_name(value));
+    }
+}
+
+static CFISH_INLINE Shard*
+SI_shard(ConcurrentHash *self, String *key) {
+    if (self->num_shards == 1) { return self->shards; }
+
+    // Use the upper bits of a multiplicative hash. The Hash in a shard
+    // uses the lower bits of the original hash sum.
+    uint64_t hash_sum = (uint64_t)Str_Hash_Sum(key);
+    uint64_t mixed    = hash_sum * UINT64_C(0x9E3779B97F4A7C15);
+    return &self->shards[mixed >> self->shard_shift];
+}
+
+ConcurrentHash*
+ConcHash_new(size_t capacity, uint32_t num_shards) {
+    ConcurrentHash *self = (ConcurrentHash*)MAKE_OBJ(CONCURRENTHASH);
+    return ConcHash_init(self, capacity, num_shards);
+}
+
+ConcurrentHash*
+ConcHash_init(ConcurrentHash *self, size_t capacity, uint32_t num_shards) {
+    if (num_shards == 0) {
+        num_shards = DEFAULT_NUM_SHARDS;
+    }
+    else if (num_shards > MAX_NUM_SHARDS) {
+        num_shards = MAX_NUM_SHARDS;
+    }
+
+    uint32_t shard_bits = 0;
+    while (((uint32_t)1 << shard_bits) < num_shards) {
+        shard_bits++;
+    }
+    num_shards = (uint32_t)1 << shard_bits;
+
+    self->num_shards  = num_shards;
+    self->shard_shift = 64 - shard_bits;
+    self->shards      = (Shard*)CALLOCATE(num_shards, sizeof(Shard));
+
+    size_t shard_capacity = capacity / num_shards;
+    for (uint32_t i = 0; i < num_shards; i++) {
+        Mutex_init(&self->shards[i].mutex);
+        self->shards[i].hash = Hash_new(shard_capacity);
+    }
+
+    return self;
+}
+
+void
+ConcHash_Destroy_IMP(ConcurrentHash *self) {
+    if (self->shards) {
+        for (uint32_t i = 0; i < self->num_shards; i++) {
+            DECREF(self->shards[i].hash);
+            Mutex_destroy(&self->shards[i].mutex);
+        }
+        FREEMEM(self->shards);
+    }
+    SUPER_DESTROY(self, CONCURRENTHASH);
+}
+
+void
+ConcHash_Store_IMP(ConcurrentHash *self, String *key, Obj *value) {
+    Shard      *shard = SI_shard(self, key);
+    const char *utf8  = Str_Get_Ptr8(key);
+    size_t      size  = Str_Get_Size(key);
+
+    S_check_value(value);
+
+    Mutex_lock(&shard->mutex);
+    // Keep a replaced value alive until the lock is released, so that its
+    // destructor doesn't run in the critical section.
+    Obj *old_value = INCREF(Hash_Fetch_Utf8(shard->hash, utf8, size));
+    // Store_Utf8 makes a private copy of the key.
+    Hash_Store_Utf8(shard->hash, utf8, size, value);
+    Mutex_unlock(&shard->mutex);
+
+    DECREF(old_value);
+}
+
+bool
+ConcHash_Store_If_Absent_IMP(ConcurrentHash *self, String *key, Obj *value) {
+    Shard      *shard = SI_shard(self, key);
+    const char *utf8  = Str_Get_Ptr8(key);
+    size_t      size  = Str_Get_Size(key);
+    bool        absent;
+
+    S_check_value(value);
+
+    Mutex_lock(&shard->mutex);
+    absent = !Hash_Has_Key(shard->hash, key);
+    if (absent) {
+        Hash_Store_Utf8(shard->hash, utf8, size, value);
+    }
+    Mutex_unlock(&shard->mutex);
+
+    if (!absent) {
+        DECREF(value);
+    }
+    return absent;
+}
+
+bool
+ConcHash_Fetch_With_IMP(ConcurrentHash *self, String *key,
+                        ConcHash_Visit_t visit, void *context) {
+    Shard *shard = SI_shard(self, key);
+
+    // The value's refcount isn't touched, so threads fetching the same
+    // value don't race.  The callback is trapped so the lock is always
+    // released.
+    Mutex_lock(&shard->mutex);
+    Obj *value = Hash_Fetch(shard->hash, key);
+    Err *error = NULL;
+    if (value) {
+        VisitArgs args = { visit, context, value };
+        error = Err_trap(S_visit, &args);
+    }
+    Mutex_unlock(&shard->mutex);
+
+    if (error) {
+        RETHROW(error);
+    }
+    return value != NULL;
+}
+
+Obj*
+ConcHash_Delete_IMP(ConcurrentHash *self, String *key) {
+    Shard *shard = SI_shard(self, key);
+
+    Mutex_lock(&shard->mutex);
+    Obj *value = Hash_Delete(shard->hash, key);
+    Mutex_unlock(&shard->mutex);
+
+    return value;
+}
+
+bool
+ConcHash_Has_Key_IMP(ConcurrentHash *self, String *key) {
+    Shard *shard = SI_shard(self, key);
+
+    Mutex_lock(&shard->mutex);
+    bool has_key = Hash_Has_Key(shard->hash, key);
+    Mutex_unlock(&shard->mutex);
+
+    return has_key;
+}
+
+void
+ConcHash_Clear_IMP(ConcurrentHash *self) {
+    for (uint32_t i = 0; i < self->num_shards; i++) {
+        Shard *shard    = &self->shards[i];
+        Hash  *new_hash = Hash_new(0);
+
+        // Swap in an empty Hash and destroy the old contents outside of the
+        // critical section.
+        Mutex_lock(&shard->mutex);
+        Hash *old_hash = shard->hash;
+        shard->hash = new_hash;
+        Mutex_unlock(&shard->mutex);
+
+        DECREF(old_hash);
+    }
+}
+
+size_t
+ConcHash_Get_Size_IMP(ConcurrentHash *self) {
+    size_t size = 0;
+
+    for (uint32_t i = 0; i < self->num_shards; i++) {
+        Shard *shard = &self->shards[i];
+        Mutex_lock(&shard->mutex);
+        size += Hash_Get_Size(shard->hash);
+        Mutex_unlock(&shard->mutex);
+    }
+
+    return size;
+}
+
+void
+ConcHash_Iterate_With_IMP(ConcurrentHash *self, ConcHash_Visit_Entry_t visit,
+                          void *context) {
+    for (uint32_t i = 0; i < self->num_shards; i++) {
+        Shard *shard = &self->shards[i];
+
+        Mutex_lock(&shard->mutex);
+        VisitEntriesArgs args = { visit, context, shard->hash };
+        Err *error = Err_trap(S_visit_entries, &args);
+        Mutex_unlock(&shard->mutex);
+
+        if (error) {
+            RETHROW(error);
+        }
+    }
+}
+
+Vector*
+ConcHash_Keys_IMP(ConcurrentHash *self) {
+    Vector *keys = Vec_new(0);
+
+    for (uint32_t i = 0; i < self->num_shards; i++) {
+        Shard *shard = &self->shards[i];
+
+        Mutex_lock(&shard->mutex);
+        HashIterator *iter = HashIter_new(shard->hash);
+        while (HashIter_Next(iter)) {
+            String *key = HashIter_Get_Key(iter);
+            Vec_Push(keys, (Obj*)Str_new_from_trusted_utf8(
+                               Str_Get_Ptr8(key), Str_Get_Size(key)));
+        }
+        DECREF(iter);
+        Mutex_unlock(&shard->mutex);
+    }
+
+    return keys;
+}
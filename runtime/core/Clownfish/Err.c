@@ -30,11 +30,12 @@
 #include "Clownfish/CharBuf.h"
 #include "Clownfish/String.h"
 #include "Clownfish/Class.h"
+#include "Clownfish/Util/Audit.h"
 #include "Clownfish/Util/Memory.h"
 
 Err*
 Err_new(String *mess) {
-    Err *self = (Err*)Class_Make_Obj(ERR);
+    Err *self = (Err*)MAKE_OBJ(ERR);
     return Err_init(self, mess);
 }
 
@@ -80,7 +81,7 @@ THROW(Class *klass, char *pattern, ...) {
     String *message = S_str_vnewf(pattern, args);
     va_end(args);
 
-    Err *err = (Err*)Class_Make_Obj(klass);
+    Err *err = (Err*)MAKE_OBJ(klass);
     err = Err_init(err, message);
     Err_do_throw(err);
 }
@@ -188,7 +189,7 @@ Err_throw_at(Class *klass, const char *file, int line,
     String *message = S_vmake_mess(file, line, func, pattern, args);
     va_end(args);
 
-    Err *err = (Err*)Class_Make_Obj(klass);
+    Err *err = (Err*)MAKE_OBJ(klass);
     err = Err_init(err, message);
     Err_do_throw(err);
 }
@@ -26,40 +26,56 @@
 #include "Clownfish/String.h"
 #include "Clownfish/Err.h"
 #include "Clownfish/Vector.h"
-#include "Clownfish/Util/Atomic.h"
+#include "Clownfish/Util/Audit.h"
+#include "Clownfish/Util/HashMix.h"
 #include "Clownfish/Util/Memory.h"
 
-// TOMBSTONE is shared across threads, so it must never be incref'd or
-// decref'd.
-static String *TOMBSTONE;
-
 #define HashEntry cfish_HashEntry
 
+// Entries are kept in a dense array in insertion order.  Deleted entries
+// have a NULL key and are only reclaimed when the Hash is rebuilt.
 typedef struct HashEntry {
-    String *key;
+    Obj    *key;
     Obj    *value;
     size_t  hash_sum;
 } HashEntry;
 
-// Return the entry associated with the key, if any.
-static CFISH_INLINE HashEntry*
-SI_fetch_entry(Hash *self, String *key, size_t hash_sum);
+// The sparse index maps hash slots to entries.  Slots hold the entry number
+// plus INDEX_OFFSET, so that zeroed memory means empty.  Deleted slots must
+// be skipped rather than ending a probe sequence.
+#define INDEX_EMPTY    0
+#define INDEX_DELETED  1
+#define INDEX_OFFSET   2
+
+// Return the size in bytes of index slots, which is the smallest integer
+// type that can hold all entry numbers.
+static CFISH_INLINE size_t
+SI_index_width(size_t threshold);
+
+static CFISH_INLINE size_t
+SI_index_get(const void *index, size_t width, size_t slot);
+
+static CFISH_INLINE void
+SI_index_set(void *index, size_t width, size_t slot, size_t value);
 
-// Double the number of buckets and redistribute all entries.
+// Return the entry associated with the key, if any.  If `slot_ptr` isn't
+// NULL, it receives the index slot pointing to the entry.
 static CFISH_INLINE HashEntry*
-SI_rebuild_hash(Hash *self);
+SI_fetch_entry(Hash *self, Obj *key, size_t hash_sum, size_t *slot_ptr);
 
-void
-Hash_init_class() {
-    String *tombstone = Str_newf("[HASHTOMBSTONE]");
-    if (!Atomic_cas_ptr((void**)&TOMBSTONE, NULL, tombstone)) {
-        DECREF(tombstone);
-    }
-}
+// Add an entry for a new key to the index.
+static CFISH_INLINE void
+SI_index_entry(void *index, size_t width, size_t mask, size_t hash_sum,
+               size_t num);
+
+// Squeeze out deleted entries and double the number of index slots unless
+// enough room was reclaimed.
+static void
+S_rebuild_hash(Hash *self);
 
 Hash*
 Hash_new(size_t capacity) {
-    Hash *self = (Hash*)Class_Make_Obj(HASH);
+    Hash *self = (Hash*)MAKE_OBJ(HASH);
     return Hash_init(self, capacity);
 }
 
@@ -74,14 +90,20 @@ Hash_init(Hash *self, size_t min_threshold) {
         if (threshold > min_threshold) { break; }
         capacity *= 2;
     } while (capacity <= SIZE_MAX / 2);
+    if (threshold > SIZE_MAX / sizeof(HashEntry)) {
+        THROW(ERR, "Hash capacity too large: %u64", (uint64_t)min_threshold);
+    }
 
     // Init.
-    self->size      = 0;
+    self->size         = 0;
+    self->num_entries  = 0;
+    self->num_rebuilds = 0;
 
     // Derive.
     self->capacity  = capacity;
-    self->entries   = (HashEntry*)CALLOCATE(capacity, sizeof(HashEntry));
     self->threshold = threshold;
+    self->entries   = (HashEntry*)MALLOCATE(threshold * sizeof(HashEntry));
+    self->index     = CALLOCATE(capacity, SI_index_width(threshold));
 
     return self;
 }
@@ -91,6 +113,7 @@ Hash_Destroy_IMP(Hash *self) {
     if (self->entries) {
         Hash_Clear(self);
         FREEMEM(self->entries);
+        FREEMEM(self->index);
     }
     SUPER_DESTROY(self, HASH);
 }
@@ -98,72 +121,59 @@ Hash_Destroy_IMP(Hash *self) {
 void
 Hash_Clear_IMP(Hash *self) {
     HashEntry *entry       = (HashEntry*)self->entries;
-    HashEntry *const limit = entry + self->capacity;
+    HashEntry *const limit = entry + self->num_entries;
 
     // Iterate through all entries.
     for (; entry < limit; entry++) {
         if (!entry->key) { continue; }
-        if (entry->key == TOMBSTONE) {
-            entry->key = NULL;
-            continue;
-        }
         DECREF(entry->key);
         DECREF(entry->value);
-        entry->key       = NULL;
-        entry->value     = NULL;
-        entry->hash_sum  = 0;
     }
 
-    self->size = 0;
-    // All tombstones were removed, reset threshold.
-    self->threshold = (self->capacity / 3) * 2;
+    memset(self->index, 0,
+           self->capacity * SI_index_width(self->threshold));
+    self->size        = 0;
+    self->num_entries = 0;
 }
 
 static void
-S_do_store(Hash *self, String *key, Obj *value, size_t hash_sum,
+S_do_store(Hash *self, Obj *key, Obj *value, size_t hash_sum,
            bool incref_key) {
-    HashEntry *entry = SI_fetch_entry(self, key, hash_sum);
+    HashEntry *entry = SI_fetch_entry(self, key, hash_sum, NULL);
     if (entry) {
         DECREF(entry->value);
         entry->value = value;
         return;
     }
 
-    HashEntry *entries = self->size >= self->threshold
-                         ? SI_rebuild_hash(self)
-                         : (HashEntry*)self->entries;
-    size_t       tick = hash_sum;
-    const size_t mask = self->capacity - 1;
-
-    while (1) {
-        tick &= mask;
-        HashEntry *entry = entries + tick;
-        if (entry->key == TOMBSTONE || !entry->key) {
-            if (entry->key == TOMBSTONE) {
-                // Take note of diminished tombstone clutter.
-                self->threshold++;
-            }
-            entry->key       = incref_key
-                               ? (String*)INCREF(key)
-                               : key;
-            entry->value     = value;
-            entry->hash_sum  = hash_sum;
-            self->size++;
-            break;
-        }
-        tick++; // linear scan
+    if (self->num_entries >= self->threshold) {
+        S_rebuild_hash(self);
     }
+
+    size_t num = self->num_entries++;
+    entry = (HashEntry*)self->entries + num;
+    entry->key      = incref_key ? INCREF(key) : key;
+    entry->value    = value;
+    entry->hash_sum = hash_sum;
+    SI_index_entry(self->index, SI_index_width(self->threshold),
+                   self->capacity - 1, hash_sum, num);
+    self->size++;
 }
 
 void
 Hash_Store_IMP(Hash *self, String *key, Obj *value) {
-    S_do_store(self, key, value, Str_Hash_Sum(key), true);
+    S_do_store(self, (Obj*)key, value, Str_Hash_Sum(key), true);
 }
 
 void
 Hash_Store_Utf8_IMP(Hash *self, const char *key, size_t key_len, Obj *value) {
     String *key_buf = SSTR_WRAP_UTF8((char*)key, key_len);
-    S_do_store(self, key_buf, value, Str_Hash_Sum(key_buf), true);
+    S_do_store(self, (Obj*)key_buf, value, Str_Hash_Sum(key_buf), true);
+}
+
+void
+Hash_Store_Obj_IMP(Hash *self, Obj *key, Obj *value) {
+    S_do_store(self, key, value, Obj_Hash_Sum(key), true);
 }
 
 Obj*
@@ -172,46 +182,107 @@ Hash_Fetch_Utf8_IMP(Hash *self, const char *key, size_t key_len) {
     return Hash_Fetch_IMP(self, key_buf);
 }
 
+static CFISH_INLINE size_t
+SI_index_width(size_t threshold) {
+    size_t max_value = threshold + INDEX_OFFSET;
+    if (max_value <= UINT8_MAX)  { return 1; }
+    if (max_value <= UINT16_MAX) { return 2; }
+    if (max_value <= UINT32_MAX) { return 4; }
+    return 8;
+}
+
+static CFISH_INLINE size_t
+SI_index_get(const void *index, size_t width, size_t slot) {
+    switch (width) {
+        case 1:  return ((const uint8_t*)index)[slot];
+        case 2:  return ((const uint16_t*)index)[slot];
+        case 4:  return ((const uint32_t*)index)[slot];
+        default: return (size_t)((const uint64_t*)index)[slot];
+    }
+}
+
+static CFISH_INLINE void
+SI_index_set(void *index, size_t width, size_t slot, size_t value) {
+    switch (width) {
+        case 1:  ((uint8_t*)index)[slot]  = (uint8_t)value;  break;
+        case 2:  ((uint16_t*)index)[slot] = (uint16_t)value; break;
+        case 4:  ((uint32_t*)index)[slot] = (uint32_t)value; break;
+        default: ((uint64_t*)index)[slot] = (uint64_t)value; break;
+    }
+}
+
 static CFISH_INLINE HashEntry*
-SI_fetch_entry(Hash *self, String *key, size_t hash_sum) {
-    size_t tick = hash_sum;
+SI_fetch_entry(Hash *self, Obj *key, size_t hash_sum, size_t *slot_ptr) {
     HashEntry *const entries = (HashEntry*)self->entries;
-    HashEntry *entry;
+    const void  *index = self->index;
+    const size_t width = SI_index_width(self->threshold);
+    const size_t mask  = self->capacity - 1;
+    size_t       tick  = hash_sum;
 
     while (1) {
-        tick &= self->capacity - 1;
-        entry = entries + tick;
-        if (!entry->key) {
+        tick &= mask;
+        size_t value = SI_index_get(index, width, tick);
+        if (value == INDEX_EMPTY) {
             // Failed to find the key, so return NULL.
             return NULL;
         }
-        else if (entry->hash_sum == hash_sum
-                 && entry->key != TOMBSTONE
-                 && Str_Equals(key, (Obj*)entry->key)
-                ) {
-            return entry;
+        else if (value != INDEX_DELETED) {
+            HashEntry *entry = entries + (value - INDEX_OFFSET);
+            if (entry->key == key
+                // Pointer identity, common with interned keys.
+                || (entry->hash_sum == hash_sum
+                    && Obj_Equals(key, entry->key))
+               ) {
+                if (slot_ptr) { *slot_ptr = tick; }
+                return entry;
+            }
         }
-        tick++;
+        tick++; // linear scan
+    }
+}
+
+static CFISH_INLINE void
+SI_index_entry(void *index, size_t width, size_t mask, size_t hash_sum,
+               size_t num) {
+    size_t tick = hash_sum;
+
+    while (1) {
+        tick &= mask;
+        size_t value = SI_index_get(index, width, tick);
+        if (value == INDEX_EMPTY || value == INDEX_DELETED) {
+            SI_index_set(index, width, tick, num + INDEX_OFFSET);
+            return;
+        }
+        tick++; // linear scan
     }
 }
 
 Obj*
 Hash_Fetch_IMP(Hash *self, String *key) {
-    HashEntry *entry = SI_fetch_entry(self, key, Str_Hash_Sum(key));
+    HashEntry *entry
+        = SI_fetch_entry(self, (Obj*)key, Str_Hash_Sum(key), NULL);
     return entry ? entry->value : NULL;
 }
 
 Obj*
-Hash_Delete_IMP(Hash *self, String *key) {
-    HashEntry *entry = SI_fetch_entry(self, key, Str_Hash_Sum(key));
+Hash_Fetch_Obj_IMP(Hash *self, Obj *key) {
+    HashEntry *entry = SI_fetch_entry(self, key, Obj_Hash_Sum(key), NULL);
+    return entry ? entry->value : NULL;
+}
+
+static Obj*
+S_do_delete(Hash *self, Obj *key, size_t hash_sum) {
+    size_t     slot;
+    HashEntry *entry = SI_fetch_entry(self, key, hash_sum, &slot);
     if (entry) {
         Obj *value = entry->value;
         DECREF(entry->key);
-        entry->key       = TOMBSTONE;
-        entry->value     = NULL;
-        entry->hash_sum  = 0;
+        entry->key      = NULL;
+        entry->value    = NULL;
+        entry->hash_sum = 0;
+        SI_index_set(self->index, SI_index_width(self->threshold), slot,
+                     INDEX_DELETED);
         self->size--;
-        self->threshold--; // limit number of tombstones
         return value;
     }
     else {
@@ -219,15 +290,32 @@ Hash_Delete_IMP(Hash *self, String *key) {
     }
 }
 
+Obj*
+Hash_Delete_IMP(Hash *self, String *key) {
+    return S_do_delete(self, (Obj*)key, Str_Hash_Sum(key));
+}
+
 Obj*
 Hash_Delete_Utf8_IMP(Hash *self, const char *key, size_t key_len) {
     String *key_buf = SSTR_WRAP_UTF8(key, key_len);
-    return Hash_Delete_IMP(self, key_buf);
+    return S_do_delete(self, (Obj*)key_buf, Str_Hash_Sum(key_buf));
+}
+
+Obj*
+Hash_Delete_Obj_IMP(Hash *self, Obj *key) {
+    return S_do_delete(self, key, Obj_Hash_Sum(key));
 }
 
 bool
 Hash_Has_Key_IMP(Hash *self, String *key) {
-    HashEntry *entry = SI_fetch_entry(self, key, Str_Hash_Sum(key));
+    HashEntry *entry
+        = SI_fetch_entry(self, (Obj*)key, Str_Hash_Sum(key), NULL);
+    return entry ? true : false;
+}
+
+bool
+Hash_Has_Obj_Key_IMP(Hash *self, Obj *key) {
+    HashEntry *entry = SI_fetch_entry(self, key, Obj_Hash_Sum(key), NULL);
     return entry ? true : false;
 }
 
@@ -235,10 +323,10 @@ Vector*
 Hash_Keys_IMP(Hash *self) {
     Vector    *keys        = Vec_new(self->size);
     HashEntry *entry       = (HashEntry*)self->entries;
-    HashEntry *const limit = entry + self->capacity;
+    HashEntry *const limit = entry + self->num_entries;
 
     for (; entry < limit; entry++) {
-        if (entry->key && entry->key != TOMBSTONE) {
+        if (entry->key) {
             Vec_Push(keys, INCREF(entry->key));
         }
     }
@@ -250,10 +338,10 @@ Vector*
 Hash_Values_IMP(Hash *self) {
     Vector    *values      = Vec_new(self->size);
     HashEntry *entry       = (HashEntry*)self->entries;
-    HashEntry *const limit = entry + self->capacity;
+    HashEntry *const limit = entry + self->num_entries;
 
     for (; entry < limit; entry++) {
-        if (entry->key && entry->key != TOMBSTONE) {
+        if (entry->key) {
             Vec_Push(values, INCREF(entry->value));
         }
     }
@@ -270,11 +358,13 @@ Hash_Equals_IMP(Hash *self, Obj *other) {
     if (self->size != twin->size) { return false; }
 
     HashEntry *entry       = (HashEntry*)self->entries;
-    HashEntry *const limit = entry + self->capacity;
+    HashEntry *const limit = entry + self->num_entries;
 
     for (; entry < limit; entry++) {
-        if (entry->key && entry->key != TOMBSTONE) {
-            Obj *other_val = Hash_Fetch(twin, entry->key);
+        if (entry->key) {
+            HashEntry *other_entry
+                = SI_fetch_entry(twin, entry->key, entry->hash_sum, NULL);
+            Obj *other_val = other_entry ? other_entry->value : NULL;
             if (!other_val || !Obj_Equals(other_val, entry->value)) {
                 return false;
             }
@@ -284,6 +374,26 @@ Hash_Equals_IMP(Hash *self, Obj *other) {
     return true;
 }
 
+size_t
+Hash_Hash_Sum_IMP(Hash *self) {
+    HashEntry *entry       = (HashEntry*)self->entries;
+    HashEntry *const limit = entry + self->num_entries;
+    uint64_t   hash_sum    = self->size;
+
+    // Summing up the hash codes of the entries makes the result independent
+    // of the insertion order.
+    for (; entry < limit; entry++) {
+        if (entry->key) {
+            uint64_t value_sum
+                = entry->value ? (uint64_t)Obj_Hash_Sum(entry->value) : 0;
+            hash_sum += HashMix_u64((uint64_t)entry->hash_sum * 31
+                                    + value_sum);
+        }
+    }
+
+    return (size_t)hash_sum;
+}
+
 size_t
 Hash_Get_Capacity_IMP(Hash *self) {
     return self->capacity;
@@ -294,35 +404,43 @@ Hash_Get_Size_IMP(Hash *self) {
     return self->size;
 }
 
-static CFISH_INLINE HashEntry*
-SI_rebuild_hash(Hash *self) {
-    if (self->capacity > SIZE_MAX / 2) {
-        THROW(ERR, "Hash grew too large");
+static void
+S_rebuild_hash(Hash *self) {
+    HashEntry *entries = (HashEntry*)self->entries;
+
+    // Squeeze out deleted entries, preserving insertion order.
+    size_t num_entries = 0;
+    for (size_t i = 0; i < self->num_entries; i++) {
+        if (entries[i].key) {
+            entries[num_entries++] = entries[i];
+        }
     }
+    self->num_entries = num_entries;
+    self->num_rebuilds++;
 
-    HashEntry *old_entries = (HashEntry*)self->entries;
-    HashEntry *entry       = old_entries;
-    HashEntry *limit       = old_entries + self->capacity;
-
-    self->capacity *= 2;
-    self->threshold = (self->capacity / 3) * 2;
-    self->entries   = (HashEntry*)CALLOCATE(self->capacity, sizeof(HashEntry));
-    self->size      = 0;
-
-    for (; entry < limit; entry++) {
-        if (!entry->key || entry->key == TOMBSTONE) {
-            continue;
+    // Grow unless at least half of the entries were reclaimed.
+    if (num_entries < self->threshold / 2) {
+        memset(self->index, 0,
+               self->capacity * SI_index_width(self->threshold));
+    }
+    else {
+        if (self->capacity > SIZE_MAX / 2 / sizeof(HashEntry)) {
+            THROW(ERR, "Hash grew too large");
         }
-        S_do_store(self, entry->key, entry->value, entry->hash_sum, false);
+        self->capacity *= 2;
+        self->threshold = (self->capacity / 3) * 2;
+        self->entries   = REALLOCATE(entries,
+                                     self->threshold * sizeof(HashEntry));
+        FREEMEM(self->index);
+        self->index = CALLOCATE(self->capacity,
+                                SI_index_width(self->threshold));
+        entries = (HashEntry*)self->entries;
     }
 
-    FREEMEM(old_entries);
-
-    return (HashEntry*)self->entries;
-}
-
-String*
-Hash_get_tombstone() {
-    return TOMBSTONE;
+    const size_t width = SI_index_width(self->threshold);
+    const size_t mask  = self->capacity - 1;
+    for (size_t i = 0; i < num_entries; i++) {
+        SI_index_entry(self->index, width, mask, entries[i].hash_sum, i);
+    }
 }
 
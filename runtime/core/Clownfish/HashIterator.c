@@ -24,52 +24,43 @@
 
 #include "Clownfish/Hash.h"
 #include "Clownfish/HashIterator.h"
-
-static String *TOMBSTONE;
+#include "Clownfish/Util/Audit.h"
 
 typedef struct HashEntry {
-    String *key;
+    Obj    *key;
     Obj    *value;
     size_t  hash_sum;
 } HashEntry;
 
-void
-HashIter_init_class() {
-    TOMBSTONE = Hash_get_tombstone();
-    if (!TOMBSTONE) {
-        THROW(ERR, "Singleton tombstone not set in Hash.");
-    }
-}
-
 HashIterator*
 HashIter_new(Hash *hash) {
-    HashIterator *self = (HashIterator*)Class_Make_Obj(HASHITERATOR);
+    HashIterator *self = (HashIterator*)MAKE_OBJ(HASHITERATOR);
     return HashIter_init(self, hash);
 }
 
 HashIterator*
 HashIter_init(HashIterator *self, Hash *hash) {
-    self->hash     = (Hash*)INCREF(hash);
-    self->tick     = (size_t)-1;
-    self->capacity = hash->capacity;
+    self->hash         = (Hash*)INCREF(hash);
+    self->tick         = (size_t)-1;
+    self->num_rebuilds = hash->num_rebuilds;
     return self;
 }
 
 bool
 HashIter_Next_IMP(HashIterator *self) {
-    if (self->capacity != self->hash->capacity) {
+    if (self->num_rebuilds != self->hash->num_rebuilds) {
         THROW(ERR, "Hash modified during iteration.");
     }
     while (1) {
-        if (++self->tick >= self->capacity) {
-            // Iteration complete. Pin tick at capacity.
-            self->tick = self->capacity;
+        if (++self->tick >= self->hash->num_entries) {
+            // Iteration complete. Pin tick at number of entries.
+            self->tick = self->hash->num_entries;
             return false;
         }
         else {
             HashEntry *const entry
                 = (HashEntry*)self->hash->entries + self->tick;
-            if (entry->key && entry->key != TOMBSTONE) {
+            if (entry->key) {
                 // Success.
                 return true;
             }
@@ -79,10 +70,19 @@ HashIter_Next_IMP(HashIterator *self) {
 
 String*
 HashIter_Get_Key_IMP(HashIterator *self) {
-    if (self->capacity != self->hash->capacity) {
+    Obj *key = HashIter_Get_Obj_Key_IMP(self);
+    if (!Obj_is_a(key, STRING)) {
+        THROW(ERR, "Key is a %o, not a String", Obj_get_class_name(key));
+    }
+    return (String*)key;
+}
+
+Obj*
+HashIter_Get_Obj_Key_IMP(HashIterator *self) {
+    if (self->num_rebuilds != self->hash->num_rebuilds) {
         THROW(ERR, "Hash modified during iteration.");
     }
-    if (self->tick >= self->capacity) {
+    if (self->tick >= self->hash->num_entries) {
         THROW(ERR, "Invalid call to Get_Key after end of iteration.");
     }
     else if (self->tick == (size_t)-1) {
@@ -91,7 +91,7 @@ HashIter_Get_Key_IMP(HashIterator *self) {
 
     HashEntry *const entry
         = (HashEntry*)self->hash->entries + self->tick;
-    if (entry->key == TOMBSTONE) {
+    if (!entry->key) {
         THROW(ERR, "Hash modified during iteration.");
     }
     return entry->key;
@@ -99,10 +99,10 @@ HashIter_Get_Key_IMP(HashIterator *self) {
 
 Obj*
 HashIter_Get_Value_IMP(HashIterator *self) {
-    if (self->capacity != self->hash->capacity) {
+    if (self->num_rebuilds != self->hash->num_rebuilds) {
         THROW(ERR, "Hash modified during iteration.");
     }
-    if (self->tick >= self->capacity) {
+    if (self->tick >= self->hash->num_entries) {
         THROW(ERR, "Invalid call to Get_Value after end of iteration.");
     }
     else if (self->tick == (size_t)-1) {
@@ -0,0 +1,566 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define C_CFISH_IOBUF
+#define C_CFISH_IOBUFPOOL
+#define C_CFISH_BYTEBUF
+#define CFISH_USE_SHORT_NAMES
+
+#include "charmony.h"
+
+#include <errno.h>
+#include <string.h>
+
+#ifdef CHY_HAS_UNISTD_H
+  #include <unistd.h>
+  #define IOBUF_HAS_FD_IO
+  #ifdef CHY_HAS_SYS_UIO_H
+    #include <sys/uio.h>
+    #define IOBUF_HAS_IOVEC
+  #endif
+#endif
+
+#include "Clownfish/IOBuf.h"
+#include "Clownfish/Blob.h"
+#include "Clownfish/ByteBuf.h"
+#include "Clownfish/Class.h"
+#include "Clownfish/Err.h"
+#include "Clownfish/String.h"
+#include "Clownfish/Vector.h"
+#include "Clownfish/Util/Audit.h"
+#include "Clownfish/Util/Memory.h"
+
+#define MIN_CAPACITY  64
+
+// Maximum number of segments passed to a single readv or writev call.
+#define MAX_SEGMENTS  64
+
+// Released IOBufs which grew larger than this multiple of the pool's
+// capacity are freed rather than reused.
+#define MAX_POOL_GROWTH  4
+
+typedef struct {
+    char   *ptr;
+    size_t  size;
+} IOSegment;
+
+static void
+S_grow(IOBuf *self, size_t min_cap);
+
+static void
+S_overflow_error();
+
+IOBuf*
+IOBuf_new(size_t capacity) {
+    IOBuf *self = (IOBuf*)MAKE_OBJ(IOBUF);
+    return IOBuf_init(self, capacity);
+}
+
+IOBuf*
+IOBuf_init(IOBuf *self, size_t min_cap) {
+    if (min_cap < MIN_CAPACITY) { min_cap = MIN_CAPACITY; }
+    // Round up to next multiple of eight.
+    size_t capacity = (min_cap + 7) & ~7;
+    // Check for overflow.
+    if (capacity < min_cap) { capacity = SIZE_MAX; }
+
+    self->buf  = (char*)MALLOCATE(capacity);
+    self->cap  = capacity;
+    self->head = 0;
+    self->size = 0;
+    return self;
+}
+
+void
+IOBuf_Destroy_IMP(IOBuf *self) {
+    FREEMEM(self->buf);
+    SUPER_DESTROY(self, IOBUF);
+}
+
+size_t
+IOBuf_Get_Size_IMP(IOBuf *self) {
+    return self->size;
+}
+
+size_t
+IOBuf_Get_Capacity_IMP(IOBuf *self) {
+    return self->cap;
+}
+
+void
+IOBuf_Grow_IMP(IOBuf *self, size_t capacity) {
+    if (capacity > self->cap) {
+        S_grow(self, capacity);
+    }
+}
+
+// Move the content to a new allocation of at least `min_cap` bytes,
+// unwrapping it in the process.
+static void
+S_grow(IOBuf *self, size_t min_cap) {
+    size_t capacity = self->cap * 2;
+    if (capacity < self->cap) { capacity = SIZE_MAX; }
+    if (capacity < min_cap)   { capacity = min_cap; }
+    // Round up to next multiple of eight.
+    size_t rounded = (capacity + 7) & ~7;
+    // Check for overflow.
+    capacity = rounded < capacity ? SIZE_MAX : rounded;
+
+    if (self->head + self->size <= self->cap) {
+        // Content is contiguous.  Let realloc move it if needed.
+        if (self->head != 0) {
+            memmove(self->buf, self->buf + self->head, self->size);
+            self->head = 0;
+        }
+        self->buf = (char*)REALLOCATE(self->buf, capacity);
+    }
+    else {
+        char   *buf   = (char*)MALLOCATE(capacity);
+        size_t  first = self->cap - self->head;
+        memcpy(buf, self->buf + self->head, first);
+        memcpy(buf + first, self->buf, self->size - first);
+        FREEMEM(self->buf);
+        self->buf  = buf;
+        self->head = 0;
+    }
+    self->cap = capacity;
+}
+
+static void
+S_overflow_error() {
+    THROW(ERR, "IOBuf buffer overflow");
+}
+
+// Ensure that there's room for at least `extra` more bytes.
+static CFISH_INLINE void
+SI_reserve(IOBuf *self, size_t extra) {
+    if (extra > self->cap - self->size) {
+        size_t min_cap = self->size + extra;
+        if (min_cap < self->size) {
+            S_overflow_error();
+            return;
+        }
+        S_grow(self, min_cap);
+    }
+}
+
+static CFISH_INLINE size_t
+SI_tail(IOBuf *self) {
+    size_t tail = self->head + self->size;
+    return tail >= self->cap ? tail - self->cap : tail;
+}
+
+// Fill `segments` with the regions holding unread bytes.  Return the
+// number of non-empty regions.
+static int
+S_data_segments(IOBuf *self, IOSegment *segments) {
+    if (self->size == 0) { return 0; }
+    size_t first = self->cap - self->head;
+    if (first >= self->size) {
+        segments[0].ptr  = self->buf + self->head;
+        segments[0].size = self->size;
+        return 1;
+    }
+    segments[0].ptr  = self->buf + self->head;
+    segments[0].size = first;
+    segments[1].ptr  = self->buf;
+    segments[1].size = self->size - first;
+    return 2;
+}
+
+// Fill `segments` with the free regions.  Return the number of non-empty
+// regions.
+static int
+S_free_segments(IOBuf *self, IOSegment *segments) {
+    size_t free_space = self->cap - self->size;
+    if (free_space == 0) { return 0; }
+    size_t tail  = SI_tail(self);
+    size_t first = self->cap - tail;
+    if (first >= free_space) {
+        segments[0].ptr  = self->buf + tail;
+        segments[0].size = free_space;
+        return 1;
+    }
+    segments[0].ptr  = self->buf + tail;
+    segments[0].size = first;
+    segments[1].ptr  = self->buf;
+    segments[1].size = free_space - first;
+    return 2;
+}
+
+void
+IOBuf_Write_Bytes_IMP(IOBuf *self, const void *bytes, size_t size) {
+    SI_reserve(self, size);
+    size_t tail  = SI_tail(self);
+    size_t first = self->cap - tail;
+    if (first >= size) {
+        memcpy(self->buf + tail, bytes, size);
+    }
+    else {
+        memcpy(self->buf + tail, bytes, first);
+        memcpy(self->buf, (const char*)bytes + first, size - first);
+    }
+    self->size += size;
+}
+
+// Return the content of a Blob, String or ByteBuf.
+static void
+S_segment_content(Obj *segment, const char **ptr_ptr, size_t *size_ptr) {
+    if (Obj_is_a(segment, BLOB)) {
+        *ptr_ptr  = Blob_Get_Buf((Blob*)segment);
+        *size_ptr = Blob_Get_Size((Blob*)segment);
+    }
+    else if (Obj_is_a(segment, STRING)) {
+        *ptr_ptr  = Str_Get_Ptr8((String*)segment);
+        *size_ptr = Str_Get_Size((String*)segment);
+    }
+    else if (Obj_is_a(segment, BYTEBUF)) {
+        *ptr_ptr  = ((ByteBuf*)segment)->buf;
+        *size_ptr = ((ByteBuf*)segment)->size;
+    }
+    else {
+        THROW(ERR, "Can't write %o, expected Blob, String or ByteBuf",
+              Obj_get_class_name(segment));
+    }
+}
+
+void
+IOBuf_Write_IMP(IOBuf *self, Obj *segment) {
+    const char *ptr  = NULL;
+    size_t      size = 0;
+    S_segment_content(segment, &ptr, &size);
+    IOBuf_Write_Bytes_IMP(self, ptr, size);
+}
+
+void
+IOBuf_Consume_IMP(IOBuf *self, size_t size) {
+    if (size >= self->size) {
+        // Rewind the cursor to keep future content contiguous.
+        self->head = 0;
+        self->size = 0;
+        return;
+    }
+    self->head += size;
+    if (self->head >= self->cap) { self->head -= self->cap; }
+    self->size -= size;
+}
+
+void
+IOBuf_Clear_IMP(IOBuf *self) {
+    self->head = 0;
+    self->size = 0;
+}
+
+static void
+S_copy_out(IOBuf *self, char *bytes, size_t size) {
+    size_t first = self->cap - self->head;
+    if (first >= size) {
+        memcpy(bytes, self->buf + self->head, size);
+    }
+    else {
+        memcpy(bytes, self->buf + self->head, first);
+        memcpy(bytes + first, self->buf, size - first);
+    }
+}
+
+size_t
+IOBuf_Read_Bytes_IMP(IOBuf *self, void *bytes, size_t size) {
+    if (size > self->size) { size = self->size; }
+    S_copy_out(self, (char*)bytes, size);
+    IOBuf_Consume_IMP(self, size);
+    return size;
+}
+
+Blob*
+IOBuf_Read_Blob_IMP(IOBuf *self, size_t size) {
+    if (size > self->size) { size = self->size; }
+    char *bytes = (char*)MALLOCATE(size);
+    S_copy_out(self, bytes, size);
+    IOBuf_Consume_IMP(self, size);
+    return Blob_new_steal(bytes, size);
+}
+
+const char*
+IOBuf_Peek_IMP(IOBuf *self, size_t *size_ptr) {
+    size_t first = self->cap - self->head;
+    *size_ptr = first < self->size ? first : self->size;
+    return self->buf + self->head;
+}
+
+/******************************** POSIX I/O ********************************/
+#ifdef IOBUF_HAS_FD_IO
+
+static CFISH_INLINE bool
+SI_would_block(int error) {
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+    if (error == EWOULDBLOCK) { return true; }
+#endif
+    return error == EAGAIN;
+}
+
+static int64_t
+S_readv(int fd, IOSegment *segments, int num_segments) {
+    if (num_segments == 0) { return 0; }
+    ssize_t check;
+#ifdef IOBUF_HAS_IOVEC
+    struct iovec iov[MAX_SEGMENTS];
+    for (int i = 0; i < num_segments; i++) {
+        iov[i].iov_base = segments[i].ptr;
+        iov[i].iov_len  = segments[i].size;
+    }
+    do {
+        check = readv(fd, iov, num_segments);
+    } while (check < 0 && errno == EINTR);
+#else
+    do {
+        check = read(fd, segments[0].ptr, segments[0].size);
+    } while (check < 0 && errno == EINTR);
+#endif
+    if (check < 0) {
+        if (SI_would_block(errno)) { return -1; }
+        THROW(ERR, "Error reading from file descriptor %i32: %s",
+              (int32_t)fd, strerror(errno));
+    }
+    return (int64_t)check;
+}
+
+static int64_t
+S_writev(int fd, IOSegment *segments, int num_segments) {
+    if (num_segments == 0) { return 0; }
+    ssize_t check;
+#ifdef IOBUF_HAS_IOVEC
+    struct iovec iov[MAX_SEGMENTS];
+    for (int i = 0; i < num_segments; i++) {
+        iov[i].iov_base = segments[i].ptr;
+        iov[i].iov_len  = segments[i].size;
+    }
+    do {
+        check = writev(fd, iov, num_segments);
+    } while (check < 0 && errno == EINTR);
+#else
+    do {
+        check = write(fd, segments[0].ptr, segments[0].size);
+    } while (check < 0 && errno == EINTR);
+#endif
+    if (check < 0) {
+        if (SI_would_block(errno)) { return -1; }
+        THROW(ERR, "Error writing to file descriptor %i32: %s",
+              (int32_t)fd, strerror(errno));
+    }
+    return (int64_t)check;
+}
+
+int64_t
+IOBuf_Fill_From_Fd_IMP(IOBuf *self, int fd, size_t min_space) {
+    if (min_space == 0) { min_space = 1; }
+    SI_reserve(self, min_space);
+    IOSegment segments[2];
+    int num_segments = S_free_segments(self, segments);
+    int64_t num_read = S_readv(fd, segments, num_segments);
+    if (num_read > 0) { self->size += (size_t)num_read; }
+    return num_read;
+}
+
+int64_t
+IOBuf_Drain_To_Fd_IMP(IOBuf *self, int fd) {
+    IOSegment segments[2];
+    int num_segments = S_data_segments(self, segments);
+    int64_t num_written = S_writev(fd, segments, num_segments);
+    if (num_written > 0) { IOBuf_Consume_IMP(self, (size_t)num_written); }
+    return num_written;
+}
+
+int64_t
+IOBuf_write_segments(int fd, Vector *segments) {
+    size_t    num_elems = Vec_Get_Size(segments);
+    size_t    tick      = 0;
+    size_t    offset    = 0;  // Bytes of the current element already written.
+    int64_t   total     = 0;
+    IOSegment batch[MAX_SEGMENTS];
+
+    while (tick < num_elems) {
+        // Collect the next batch of non-empty segments.
+        int    num_batch  = 0;
+        size_t batch_size = 0;
+        for (size_t i = tick; i < num_elems && num_batch < MAX_SEGMENTS;
+             i++
+            ) {
+            const char *ptr  = NULL;
+            size_t      size = 0;
+            S_segment_content(Vec_Fetch(segments, i), &ptr, &size);
+            if (i == tick) {
+                ptr  += offset;
+                size -= offset;
+            }
+            if (size == 0) { continue; }
+            batch[num_batch].ptr  = (char*)ptr;
+            batch[num_batch].size = size;
+            batch_size += size;
+            num_batch++;
+        }
+        if (num_batch == 0) { break; }
+
+        int64_t num_written = S_writev(fd, batch, num_batch);
+        if (num_written <= 0) { break; }
+        total += num_written;
+
+        // Advance past the bytes written.
+        size_t remaining = (size_t)num_written;
+        while (tick < num_elems) {
+            const char *ptr  = NULL;
+            size_t      size = 0;
+            S_segment_content(Vec_Fetch(segments, tick), &ptr, &size);
+            size -= offset;
+            if (remaining < size) {
+                offset += remaining;
+                break;
+            }
+            remaining -= size;
+            offset = 0;
+            tick++;
+        }
+
+        // A short write means that the descriptor can't take more data.
+        if ((size_t)num_written < batch_size) { break; }
+    }
+
+    return total;
+}
+
+int64_t
+IOBuf_read_segments(int fd, Vector *byte_bufs) {
+    size_t    num_elems = Vec_Get_Size(byte_bufs);
+    int       num_batch = 0;
+    IOSegment batch[MAX_SEGMENTS];
+
+    for (size_t i = 0; i < num_elems && num_batch < MAX_SEGMENTS; i++) {
+        ByteBuf *byte_buf
+            = (ByteBuf*)CERTIFY(Vec_Fetch(byte_bufs, i), BYTEBUF);
+        if (byte_buf->cap == byte_buf->size) { continue; }
+        batch[num_batch].ptr  = byte_buf->buf + byte_buf->size;
+        batch[num_batch].size = byte_buf->cap - byte_buf->size;
+        num_batch++;
+    }
+
+    int64_t num_read = S_readv(fd, batch, num_batch);
+
+    // Distribute the bytes read over the ByteBufs.
+    size_t remaining = num_read > 0 ? (size_t)num_read : 0;
+    for (size_t i = 0; i < num_elems && remaining > 0; i++) {
+        ByteBuf *byte_buf = (ByteBuf*)Vec_Fetch(byte_bufs, i);
+        size_t   space    = byte_buf->cap - byte_buf->size;
+        size_t   amount   = remaining < space ? remaining : space;
+        byte_buf->size += amount;
+        remaining      -= amount;
+    }
+
+    return num_read;
+}
+
+/****************************** Other platforms *****************************/
+#else
+
+static void
+S_no_fd_io() {
+    THROW(ERR, "File descriptor I/O isn't supported on this platform");
+}
+
+int64_t
+IOBuf_Fill_From_Fd_IMP(IOBuf *self, int fd, size_t min_space) {
+    UNUSED_VAR(self);
+    UNUSED_VAR(fd);
+    UNUSED_VAR(min_space);
+    S_no_fd_io();
+    UNREACHABLE_RETURN(int64_t);
+}
+
+int64_t
+IOBuf_Drain_To_Fd_IMP(IOBuf *self, int fd) {
+    UNUSED_VAR(self);
+    UNUSED_VAR(fd);
+    S_no_fd_io();
+    UNREACHABLE_RETURN(int64_t);
+}
+
+int64_t
+IOBuf_write_segments(int fd, Vector *segments) {
+    UNUSED_VAR(fd);
+    UNUSED_VAR(segments);
+    S_no_fd_io();
+    UNREACHABLE_RETURN(int64_t);
+}
+
+int64_t
+IOBuf_read_segments(int fd, Vector *byte_bufs) {
+    UNUSED_VAR(fd);
+    UNUSED_VAR(byte_bufs);
+    S_no_fd_io();
+    UNREACHABLE_RETURN(int64_t);
+}
+
+#endif // IOBUF_HAS_FD_IO
+
+/*****************************************************************/
+
+IOBufPool*
+IOBufPool_new(size_t capacity, size_t max_free) {
+    IOBufPool *self = (IOBufPool*)MAKE_OBJ(IOBUFPOOL);
+    return IOBufPool_init(self, capacity, max_free);
+}
+
+IOBufPool*
+IOBufPool_init(IOBufPool *self, size_t capacity, size_t max_free) {
+    self->free_bufs = Vec_new(max_free);
+    self->capacity  = capacity;
+    self->max_free  = max_free;
+    return self;
+}
+
+void
+IOBufPool_Destroy_IMP(IOBufPool *self) {
+    DECREF(self->free_bufs);
+    SUPER_DESTROY(self, IOBUFPOOL);
+}
+
+IOBuf*
+IOBufPool_Acquire_IMP(IOBufPool *self) {
+    IOBuf *io_buf = (IOBuf*)Vec_Pop(self->free_bufs);
+    return io_buf ? io_buf : IOBuf_new(self->capacity);
+}
+
+void
+IOBufPool_Release_IMP(IOBufPool *self, IOBuf *io_buf) {
+    size_t max_cap = self->capacity * MAX_POOL_GROWTH;
+    if (max_cap < MIN_CAPACITY * MAX_POOL_GROWTH) {
+        max_cap = MIN_CAPACITY * MAX_POOL_GROWTH;
+    }
+    if (Vec_Get_Size(self->free_bufs) < self->max_free
+        && io_buf->cap <= max_cap
+        && REFCOUNT_NN(io_buf) == 1
+       ) {
+        IOBuf_Clear_IMP(io_buf);
+        Vec_Push(self->free_bufs, (Obj*)io_buf);
+    }
+    else {
+        DECREF(io_buf);
+    }
+}
+
+size_t
+IOBufPool_Get_Num_Free_IMP(IOBufPool *self) {
+    return Vec_Get_Size(self->free_bufs);
+}
+
@@ -0,0 +1,347 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define C_CFISH_INT64HASH
+#define C_CFISH_INT64SET
+#define CFISH_USE_SHORT_NAMES
+
+#include <string.h>
+
+#include "Clownfish/Class.h"
+#include "Clownfish/Int64Hash.h"
+#include "Clownfish/Err.h"
+#include "Clownfish/Util/Audit.h"
+#include "Clownfish/Util/HashMix.h"
+#include "Clownfish/Util/Memory.h"
+
+// Int64Hash and Int64Set share an open addressing scheme with linear
+// probing.  Keys live in a flat array next to an array of occupancy flags,
+// and deletions shift later entries of a probe sequence back instead of
+// leaving tombstones.
+
+// Return the number of slots needed to hold `min_threshold` elements without
+// a rebuild.
+static size_t
+S_capacity_for(size_t min_threshold, size_t *threshold_ptr);
+
+// Return the slot holding `key`, or the empty slot where it would go.
+static CFISH_INLINE size_t
+SI_find_slot(const int64_t *keys, const uint8_t *used, size_t mask,
+             int64_t key);
+
+// Empty a slot and move later entries of the probe sequence into the gap.
+// `values` may be NULL.
+static void
+S_remove_slot(int64_t *keys, Obj **values, uint8_t *used, size_t mask,
+              size_t slot);
+
+// Double the number of slots and redistribute all entries.  `values_ptr` may
+// be NULL.
+static void
+S_rebuild(int64_t **keys_ptr, Obj ***values_ptr, uint8_t **used_ptr,
+          size_t *capacity_ptr, size_t *threshold_ptr);
+
+Int64Hash*
+Int64Hash_new(size_t capacity) {
+    Int64Hash *self = (Int64Hash*)MAKE_OBJ(INT64HASH);
+    return Int64Hash_init(self, capacity);
+}
+
+Int64Hash*
+Int64Hash_init(Int64Hash *self, size_t min_threshold) {
+    self->capacity  = S_capacity_for(min_threshold, &self->threshold);
+    self->size      = 0;
+    self->keys      = (int64_t*)MALLOCATE(self->capacity * sizeof(int64_t));
+    self->values    = (Obj**)MALLOCATE(self->capacity * sizeof(Obj*));
+    self->used      = (uint8_t*)CALLOCATE(self->capacity, sizeof(uint8_t));
+    return self;
+}
+
+void
+Int64Hash_Destroy_IMP(Int64Hash *self) {
+    if (self->used) {
+        Int64Hash_Clear(self);
+        FREEMEM(self->keys);
+        FREEMEM(self->values);
+        FREEMEM(self->used);
+    }
+    SUPER_DESTROY(self, INT64HASH);
+}
+
+void
+Int64Hash_Clear_IMP(Int64Hash *self) {
+    for (size_t i = 0; i < self->capacity; i++) {
+        if (self->used[i]) {
+            DECREF(self->values[i]);
+        }
+    }
+    memset(self->used, 0, self->capacity);
+    self->size = 0;
+}
+
+void
+Int64Hash_Store_IMP(Int64Hash *self, int64_t key, Obj *value) {
+    size_t slot = SI_find_slot(self->keys, self->used, self->capacity - 1,
+                               key);
+    if (self->used[slot]) {
+        DECREF(self->values[slot]);
+        self->values[slot] = value;
+        return;
+    }
+
+    if (self->size >= self->threshold) {
+        S_rebuild(&self->keys, &self->values, &self->used, &self->capacity,
+                  &self->threshold);
+        slot = SI_find_slot(self->keys, self->used, self->capacity - 1, key);
+    }
+    self->keys[slot]   = key;
+    self->values[slot] = value;
+    self->used[slot]   = 1;
+    self->size++;
+}
+
+Obj*
+Int64Hash_Fetch_IMP(Int64Hash *self, int64_t key) {
+    size_t slot = SI_find_slot(self->keys, self->used, self->capacity - 1,
+                               key);
+    return self->used[slot] ? self->values[slot] : NULL;
+}
+
+Obj*
+Int64Hash_Delete_IMP(Int64Hash *self, int64_t key) {
+    const size_t mask = self->capacity - 1;
+    size_t slot = SI_find_slot(self->keys, self->used, mask, key);
+    if (!self->used[slot]) { return NULL; }
+
+    Obj *value = self->values[slot];
+    S_remove_slot(self->keys, self->values, self->used, mask, slot);
+    self->size--;
+    return value;
+}
+
+bool
+Int64Hash_Has_Key_IMP(Int64Hash *self, int64_t key) {
+    size_t slot = SI_find_slot(self->keys, self->used, self->capacity - 1,
+                               key);
+    return self->used[slot] ? true : false;
+}
+
+bool
+Int64Hash_Next_IMP(Int64Hash *self, size_t *tick_ptr, int64_t *key_ptr,
+                   Obj **value_ptr) {
+    for (size_t tick = *tick_ptr; tick < self->capacity; tick++) {
+        if (self->used[tick]) {
+            *key_ptr   = self->keys[tick];
+            *value_ptr = self->values[tick];
+            *tick_ptr  = tick + 1;
+            return true;
+        }
+    }
+    *tick_ptr = self->capacity;
+    return false;
+}
+
+size_t
+Int64Hash_Get_Capacity_IMP(Int64Hash *self) {
+    return self->capacity;
+}
+
+size_t
+Int64Hash_Get_Size_IMP(Int64Hash *self) {
+    return self->size;
+}
+
+/***************************************************************************/
+
+Int64Set*
+Int64Set_new(size_t capacity) {
+    Int64Set *self = (Int64Set*)MAKE_OBJ(INT64SET);
+    return Int64Set_init(self, capacity);
+}
+
+Int64Set*
+Int64Set_init(Int64Set *self, size_t min_threshold) {
+    self->capacity  = S_capacity_for(min_threshold, &self->threshold);
+    self->size      = 0;
+    self->keys      = (int64_t*)MALLOCATE(self->capacity * sizeof(int64_t));
+    self->used      = (uint8_t*)CALLOCATE(self->capacity, sizeof(uint8_t));
+    return self;
+}
+
+void
+Int64Set_Destroy_IMP(Int64Set *self) {
+    FREEMEM(self->keys);
+    FREEMEM(self->used);
+    SUPER_DESTROY(self, INT64SET);
+}
+
+void
+Int64Set_Clear_IMP(Int64Set *self) {
+    memset(self->used, 0, self->capacity);
+    self->size = 0;
+}
+
+bool
+Int64Set_Add_IMP(Int64Set *self, int64_t key) {
+    size_t slot = SI_find_slot(self->keys, self->used, self->capacity - 1,
+                               key);
+    if (self->used[slot]) { return false; }
+
+    if (self->size >= self->threshold) {
+        S_rebuild(&self->keys, NULL, &self->used, &self->capacity,
+                  &self->threshold);
+        slot = SI_find_slot(self->keys, self->used, self->capacity - 1, key);
+    }
+    self->keys[slot] = key;
+    self->used[slot] = 1;
+    self->size++;
+    return true;
+}
+
+bool
+Int64Set_Remove_IMP(Int64Set *self, int64_t key) {
+    const size_t mask = self->capacity - 1;
+    size_t slot = SI_find_slot(self->keys, self->used, mask, key);
+    if (!self->used[slot]) { return false; }
+
+    S_remove_slot(self->keys, NULL, self->used, mask, slot);
+    self->size--;
+    return true;
+}
+
+bool
+Int64Set_Contains_IMP(Int64Set *self, int64_t key) {
+    size_t slot = SI_find_slot(self->keys, self->used, self->capacity - 1,
+                               key);
+    return self->used[slot] ? true : false;
+}
+
+bool
+Int64Set_Next_IMP(Int64Set *self, size_t *tick_ptr, int64_t *key_ptr) {
+    for (size_t tick = *tick_ptr; tick < self->capacity; tick++) {
+        if (self->used[tick]) {
+            *key_ptr  = self->keys[tick];
+            *tick_ptr = tick + 1;
+            return true;
+        }
+    }
+    *tick_ptr = self->capacity;
+    return false;
+}
+
+size_t
+Int64Set_Get_Capacity_IMP(Int64Set *self) {
+    return self->capacity;
+}
+
+size_t
+Int64Set_Get_Size_IMP(Int64Set *self) {
+    return self->size;
+}
+
+/***************************************************************************/
+
+static size_t
+S_capacity_for(size_t min_threshold, size_t *threshold_ptr) {
+    size_t threshold;
+    size_t capacity = 16;
+    do {
+        threshold = (capacity / 3) * 2;
+        if (threshold > min_threshold) { break; }
+        capacity *= 2;
+    } while (capacity <= SIZE_MAX / 2 / sizeof(int64_t));
+    *threshold_ptr = threshold;
+    return capacity;
+}
+
+static CFISH_INLINE size_t
+SI_find_slot(const int64_t *keys, const uint8_t *used, size_t mask,
+             int64_t key) {
+    size_t tick = HashMix_u64((uint64_t)key);
+    while (1) {
+        tick &= mask;
+        if (!used[tick] || keys[tick] == key) {
+            return tick;
+        }
+        tick++; // linear scan
+    }
+}
+
+static void
+S_remove_slot(int64_t *keys, Obj **values, uint8_t *used, size_t mask,
+              size_t slot) {
+    size_t gap  = slot;
+    size_t tick = slot;
+
+    while (1) {
+        tick = (tick + 1) & mask;
+        if (!used[tick]) { break; }
+
+        // An entry can move into the gap unless its home slot lies
+        // cyclically between the gap and its current position.
+        size_t home = HashMix_u64((uint64_t)keys[tick]) & mask;
+        bool   stay = gap <= tick
+                      ? (gap < home && home <= tick)
+                      : (gap < home || home <= tick);
+        if (stay) { continue; }
+
+        keys[gap] = keys[tick];
+        if (values) { values[gap] = values[tick]; }
+        gap = tick;
+    }
+
+    used[gap] = 0;
+}
+
+static void
+S_rebuild(int64_t **keys_ptr, Obj ***values_ptr, uint8_t **used_ptr,
+          size_t *capacity_ptr, size_t *threshold_ptr) {
+    size_t old_capacity = *capacity_ptr;
+    if (old_capacity > SIZE_MAX / 2 / sizeof(int64_t)) {
+        THROW(ERR, "Hash grew too large");
+    }
+
+    int64_t *old_keys   = *keys_ptr;
+    Obj    **old_values = values_ptr ? *values_ptr : NULL;
+    uint8_t *old_used   = *used_ptr;
+
+    size_t   capacity = old_capacity * 2;
+    size_t   mask     = capacity - 1;
+    int64_t *keys     = (int64_t*)MALLOCATE(capacity * sizeof(int64_t));
+    Obj    **values   = old_values
+                        ? (Obj**)MALLOCATE(capacity * sizeof(Obj*))
+                        : NULL;
+    uint8_t *used     = (uint8_t*)CALLOCATE(capacity, sizeof(uint8_t));
+
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (!old_used[i]) { continue; }
+        size_t slot = SI_find_slot(keys, used, mask, old_keys[i]);
+        keys[slot] = old_keys[i];
+        if (values) { values[slot] = old_values[i]; }
+        used[slot] = 1;
+    }
+
+    FREEMEM(old_keys);
+    FREEMEM(old_values);
+    FREEMEM(old_used);
+
+    *keys_ptr      = keys;
+    *used_ptr      = used;
+    *capacity_ptr  = capacity;
+    *threshold_ptr = (capacity / 3) * 2;
+    if (values_ptr) { *values_ptr = values; }
+}
+
@@ -60,7 +60,10 @@ FIND_END_OF_LINKED_LIST:
     while (*slot) {
         LFRegEntry *entry = *slot;
         if (entry->hash_sum == hash_sum) {
-            if (Str_Equals(key, (Obj*)entry->key)) {
+            // Compare content because `key` may be a String which is about
+            // to be interned.
+            if (Str_Equals_Utf8(entry->key, Str_Get_Ptr8(key),
+                                Str_Get_Size(key))) {
                 if (new_entry) {
                     DECREF(new_entry->key);
                     DECREF(new_entry->value);
@@ -76,8 +79,11 @@ FIND_END_OF_LINKED_LIST:
     if (!new_entry) {
         new_entry = (LFRegEntry*)MALLOCATE(sizeof(LFRegEntry));
         new_entry->hash_sum  = hash_sum;
-        new_entry->key       = Str_new_from_trusted_utf8(Str_Get_Ptr8(key),
-                                                         Str_Get_Size(key));
+        // Interned strings never change, so there's no need for a copy.
+        new_entry->key       = Str_Is_Interned(key)
+                               ? (String*)INCREF(key)
+                               : Str_new_from_trusted_utf8(Str_Get_Ptr8(key),
+                                                           Str_Get_Size(key));
         new_entry->value     = INCREF(value);
         new_entry->next      = NULL;
     }
@@ -113,6 +119,9 @@ LFReg_fetch(LockFreeRegistry *self, String *key) {
     LFRegEntry  *entry     = entries[bucket];
 
     while (entry) {
+        if (entry->key == key) {
+            return entry->value;
+        }
         if (entry->hash_sum  == hash_sum) {
             if (Str_Equals(key, (Obj*)entry->key)) {
                 return entry->value;
@@ -24,10 +24,11 @@
 #include "Clownfish/Err.h"
 #include "Clownfish/Class.h"
 #include "Clownfish/CharBuf.h"
+#include "Clownfish/Util/Audit.h"
 
 Method*
 Method_new(String *name, cfish_method_t callback_func, uint32_t offset) {
-    Method *self = (Method*)Class_Make_Obj(METHOD);
+    Method *self = (Method*)MAKE_OBJ(METHOD);
     return Method_init(self, name, callback_func, offset);
 }
 
@@ -19,6 +19,7 @@
 #define CFISH_USE_SHORT_NAMES
 
 #include <float.h>
+#include <string.h>
 
 #include "charmony.h"
 
@@ -26,6 +27,9 @@
 #include "Clownfish/String.h"
 #include "Clownfish/Err.h"
 #include "Clownfish/Class.h"
+#include "Clownfish/Util/Audit.h"
+#include "Clownfish/Util/HashMix.h"
+#include "Clownfish/Util/StringHelper.h"
 
 #if FLT_RADIX != 2
   #error Unsupported FLT_RADIX
@@ -57,7 +61,7 @@ S_equals_i64_f64(int64_t i64, double f64);
 
 Float*
 Float_new(double value) {
-    Float *self = (Float*)Class_Make_Obj(FLOAT);
+    Float *self = (Float*)MAKE_OBJ(FLOAT);
     return Float_init(self, value);
 }
 
@@ -82,6 +86,22 @@ Float_Equals_IMP(Float *self, Obj *other) {
     }
 }
 
+size_t
+Float_Hash_Sum_IMP(Float *self) {
+    double value = self->value;
+
+    // Must be consistent with Float_Equals, which considers integral values
+    // equal to Integers.
+    if (value >= -POW_2_63 && value < POW_2_63) {
+        int64_t i64 = (int64_t)value;
+        if ((double)i64 == value) { return HashMix_u64((uint64_t)i64); }
+    }
+
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return HashMix_u64(bits);
+}
+
 int32_t
 Float_Compare_To_IMP(Float *self, Obj *other) {
     if (Obj_is_a(other, FLOAT)) {
@@ -113,7 +133,9 @@ Float_To_I64_IMP(Float *self) {
 
 String*
 Float_To_String_IMP(Float *self) {
-    return Str_newf("%f64", self->value);
+    char buf[StrHelp_MAX_F64_BYTES];
+    size_t size = StrHelp_format_f64(self->value, buf);
+    return Str_new_from_trusted_utf8(buf, size);
 }
 
 Float*
@@ -125,7 +147,7 @@ Float_Clone_IMP(Float *self) {
 
 Integer*
 Int_new(int64_t value) {
-    Integer *self = (Integer*)Class_Make_Obj(INTEGER);
+    Integer *self = (Integer*)MAKE_OBJ(INTEGER);
     return Int_init(self, value);
 }
 
@@ -150,6 +172,11 @@ Int_Equals_IMP(Integer *self, Obj *other) {
     }
 }
 
+size_t
+Int_Hash_Sum_IMP(Integer *self) {
+    return HashMix_u64((uint64_t)self->value);
+}
+
 int32_t
 Int_Compare_To_IMP(Integer *self, Obj *other) {
     if (Obj_is_a(other, INTEGER)) {
@@ -178,7 +205,9 @@ Int_To_F64_IMP(Integer *self) {
 
 String*
 Int_To_String_IMP(Integer *self) {
-    return Str_newf("%i64", self->value);
+    char buf[StrHelp_MAX_I64_BYTES];
+    size_t size = StrHelp_format_i64(self->value, buf);
+    return Str_new_from_trusted_utf8(buf, size);
 }
 
 Integer*
@@ -29,6 +29,8 @@
 #include "Clownfish/Err.h"
 #include "Clownfish/Hash.h"
 #include "Clownfish/Class.h"
+#include "Clownfish/Util/Audit.h"
+#include "Clownfish/Util/Instrument.h"
 #include "Clownfish/Util/Memory.h"
 
 Obj*
@@ -39,6 +41,8 @@ Obj_init(Obj *self) {
 
 void
 Obj_Destroy_IMP(Obj *self) {
+    INSTRUMENT_FREE(self);
+    AUDIT_FREE(self);
     FREEMEM(self);
 }
 
@@ -61,6 +65,13 @@ Obj_Equals_IMP(Obj *self, Obj *other) {
     return (self == other);
 }
 
+size_t
+Obj_Hash_Sum_IMP(Obj *self) {
+    // Objects are at least 8-byte aligned, so the low bits carry no
+    // information.
+    return (size_t)self >> 3;
+}
+
 String*
 Obj_To_String_IMP(Obj *self) {
 #if (CHY_SIZEOF_PTR == 4)
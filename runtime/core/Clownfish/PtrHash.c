@@ -167,6 +167,15 @@ PtrHash_Fetch(PtrHash *self, void *key) {
     return NULL;
 }
 
+void
+PtrHash_Iterate(PtrHash *self, PtrHash_Iter_t callback, void *context) {
+    for (PtrHashEntry *entry = self->entries; entry < self->end; ++entry) {
+        if (entry->key != NULL) {
+            callback(entry->key, &entry->value, context);
+        }
+    }
+}
+
 static void
 S_resize(PtrHash *self) {
     size_t old_size = self->end - self->entries;
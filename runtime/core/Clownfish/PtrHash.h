@@ -25,6 +25,12 @@ extern "C" {
 
 typedef struct cfish_PtrHash cfish_PtrHash;
 
+/** Callback for PtrHash_Iterate.  `value` points to the stored value which
+ * may be modified in place.
+ */
+typedef void
+(*cfish_PtrHash_Iter_t)(void *key, void **value, void *context);
+
 cfish_PtrHash*
 cfish_PtrHash_new(size_t min_cap);
 
@@ -37,12 +43,21 @@ CFISH_PtrHash_Store(cfish_PtrHash *self, void *key, void *value);
 void*
 CFISH_PtrHash_Fetch(cfish_PtrHash *self, void *key);
 
+/** Invoke `callback` for every entry in unspecified order.  The callback
+ * must not store new keys.
+ */
+void
+CFISH_PtrHash_Iterate(cfish_PtrHash *self, cfish_PtrHash_Iter_t callback,
+                      void *context);
+
 #ifdef CFISH_USE_SHORT_NAMES
   #define PtrHash           cfish_PtrHash
   #define PtrHash_new       cfish_PtrHash_new
   #define PtrHash_Destroy   CFISH_PtrHash_Destroy
   #define PtrHash_Store     CFISH_PtrHash_Store
   #define PtrHash_Fetch     CFISH_PtrHash_Fetch
+  #define PtrHash_Iterate   CFISH_PtrHash_Iterate
+  #define PtrHash_Iter_t    cfish_PtrHash_Iter_t
 #endif
 
 #ifdef __cplusplus
@@ -16,6 +16,7 @@
 
 #define C_CFISH_STRING
 #define C_CFISH_STRINGITERATOR
+#define C_CFISH_STRINGTOKENIZER
 #define CFISH_USE_SHORT_NAMES
 
 #include <string.h>
@@ -23,14 +24,44 @@
 #include <stdlib.h>
 #include <ctype.h>
 
+#ifdef __SSE2__
+  #include <emmintrin.h>
+#endif
+
 #include "Clownfish/Class.h"
 #include "Clownfish/String.h"
 
 #include "Clownfish/ByteBuf.h"
 #include "Clownfish/CharBuf.h"
 #include "Clownfish/Err.h"
+#include "Clownfish/LockFreeRegistry.h"
+#include "Clownfish/Util/Atomic.h"
+#include "Clownfish/Util/Audit.h"
 #include "Clownfish/Util/Memory.h"
+#include "Clownfish/Util/Mutex.h"
 #include "Clownfish/Util/StringHelper.h"
+#include "Clownfish/Util/Unicode.h"
+#include "Clownfish/Vector.h"
+
+// The character data is stored in the same allocation as the String.
+#define STR_fINLINE   0x1
+// The String is the canonical instance in the intern table.
+#define STR_fINTERNED 0x2
+
+#define INTERN_TABLE_CAPACITY 1024
+
+// Interned Strings are never freed, so the table is limited to `capacity`
+// entries.  This also keeps the average bucket chain of the registry, which
+// has `capacity` buckets, shorter than one entry.
+typedef struct {
+    LockFreeRegistry *registry;
+    Mutex             mutex;
+    size_t            capacity;
+    size_t            count;
+} InternTable;
+
+static InternTable *Str_intern_table;
+static size_t Str_intern_capacity = INTERN_TABLE_CAPACITY;
 
 #define STACK_ITER(string, byte_offset) \
     S_new_stack_iter(alloca(sizeof(StringIterator)), string, byte_offset)
@@ -46,24 +77,58 @@ S_die_invalid_utf8(const char *text, size_t size, const char *file, int line,
                    const char *func);
 
 static const char*
-S_memmem(String *self, const char *substring, size_t size);
+S_memmem(const char *ptr, size_t size, const char *substring,
+         size_t substring_size);
+
+static bool
+S_next_piece(const char *ptr, size_t size, const char *separator,
+             size_t separator_size, size_t *offset_ptr, size_t *start_ptr,
+             size_t *end_ptr);
+
+static bool
+S_next_word(const char *ptr, size_t size, size_t *offset_ptr,
+            size_t *start_ptr, size_t *end_ptr);
 
 static StringIterator*
 S_new_stack_iter(void *allocation, String *string, size_t byte_offset);
 
+static size_t
+S_decode(const char *utf8, size_t size, size_t *offset_ptr, int32_t *buf,
+         size_t max);
+
+// Allocate a String together with `size + 1` bytes for its content, which
+// directly follow the object.  The content is zeroed, so it's always
+// NULL-terminated.  The host allocates the object, because some hosts free
+// objects with their own allocator.
+static String*
+S_new_inline(size_t size) {
+    if (size > SIZE_MAX - sizeof(String) - 1) {
+        THROW(ERR, "String size overflow");
+    }
+    String *self = (String*)Class_Make_Obj_Extra(STRING, size + 1);
+
+    char *ptr = (char*)self + sizeof(String);
+    self->ptr      = ptr;
+    self->size     = size;
+    self->origin   = self;
+    self->flags    = STR_fINLINE;
+    self->hash_sum = 0;
+    return self;
+}
+
 String*
 Str_new_from_utf8(const char *utf8, size_t size) {
     if (!StrHelp_utf8_valid(utf8, size)) {
         DIE_INVALID_UTF8(utf8, size);
     }
-    String *self = (String*)Class_Make_Obj(STRING);
-    return Str_init_from_trusted_utf8(self, utf8, size);
+    return Str_new_from_trusted_utf8(utf8, size);
 }
 
 String*
 Str_new_from_trusted_utf8(const char *utf8, size_t size) {
-    String *self = (String*)Class_Make_Obj(STRING);
-    return Str_init_from_trusted_utf8(self, utf8, size);
+    String *self = S_new_inline(size);
+    memcpy((char*)self->ptr, utf8, size);
+    return self;
 }
 
 String*
@@ -76,9 +141,11 @@ Str_init_from_trusted_utf8(String *self, const char *utf8, size_t size) {
     ptr[size] = '\0'; // Null terminate.
 
     // Assign.
-    self->ptr    = ptr;
-    self->size   = size;
-    self->origin = self;
+    self->ptr      = ptr;
+    self->size     = size;
+    self->origin   = self;
+    self->flags    = 0;
+    self->hash_sum = 0;
 
     return self;
 }
@@ -88,21 +155,23 @@ Str_new_steal_utf8(char *utf8, size_t size) {
     if (!StrHelp_utf8_valid(utf8, size)) {
         DIE_INVALID_UTF8(utf8, size);
     }
-    String *self = (String*)Class_Make_Obj(STRING);
+    String *self = (String*)MAKE_OBJ(STRING);
     return Str_init_steal_trusted_utf8(self, utf8, size);
 }
 
 String*
 Str_new_steal_trusted_utf8(char *utf8, size_t size) {
-    String *self = (String*)Class_Make_Obj(STRING);
+    String *self = (String*)MAKE_OBJ(STRING);
     return Str_init_steal_trusted_utf8(self, utf8, size);
 }
 
 String*
 Str_init_steal_trusted_utf8(String *self, char *utf8, size_t size) {
-    self->ptr    = utf8;
-    self->size   = size;
-    self->origin = self;
+    self->ptr      = utf8;
+    self->size     = size;
+    self->origin   = self;
+    self->flags    = 0;
+    self->hash_sum = 0;
     return self;
 }
 
@@ -111,13 +180,13 @@ Str_new_wrap_utf8(const char *utf8, size_t size) {
     if (!StrHelp_utf8_valid(utf8, size)) {
         DIE_INVALID_UTF8(utf8, size);
     }
-    String *self = (String*)Class_Make_Obj(STRING);
+    String *self = (String*)MAKE_OBJ(STRING);
     return Str_init_wrap_trusted_utf8(self, utf8, size);
 }
 
 String*
 Str_new_wrap_trusted_utf8(const char *utf8, size_t size) {
-    String *self = (String*)Class_Make_Obj(STRING);
+    String *self = (String*)MAKE_OBJ(STRING);
     return Str_init_wrap_trusted_utf8(self, utf8, size);
 }
 
@@ -129,23 +198,155 @@ Str_init_stack_string(void *allocation, const char *utf8, size_t size) {
 
 String*
 Str_init_wrap_trusted_utf8(String *self, const char *ptr, size_t size) {
-    self->ptr    = ptr;
-    self->size   = size;
-    self->origin = NULL;
+    // The memory of stack Strings isn't necessarily zeroed, so every field
+    // must be set.
+    self->ptr      = ptr;
+    self->size     = size;
+    self->origin   = NULL;
+    self->flags    = 0;
+    self->hash_sum = 0;
     return self;
 }
 
 String*
 Str_new_from_char(int32_t code_point) {
-    const size_t MAX_UTF8_BYTES = 4;
-    char   *ptr  = (char*)MALLOCATE(MAX_UTF8_BYTES + 1);
-    size_t  size = StrHelp_encode_utf8_char(code_point, (uint8_t*)ptr);
-    ptr[size] = '\0';
-
-    String *self = (String*)Class_Make_Obj(STRING);
-    self->ptr    = ptr;
-    self->size   = size;
-    self->origin = self;
+    char   buf[4];
+    size_t size = StrHelp_encode_utf8_char(code_point, (uint8_t*)buf);
+    return Str_new_from_trusted_utf8(buf, size);
+}
+
+bool
+Str_set_intern_capacity(size_t capacity) {
+    // The registry can't be resized, so the capacity only applies to a
+    // table which doesn't exist yet.
+    if (Str_intern_table != NULL) {
+        return false;
+    }
+    Str_intern_capacity = capacity ? capacity : 1;
+    return true;
+}
+
+static InternTable*
+S_init_intern_table() {
+    InternTable *table = (InternTable*)MALLOCATE(sizeof(InternTable));
+    table->registry = LFReg_new(Str_intern_capacity);
+    table->capacity = Str_intern_capacity;
+    table->count    = 0;
+    Mutex_init(&table->mutex);
+    if (!Atomic_cas_ptr((void*volatile*)&Str_intern_table, NULL, table)) {
+        // Another thread beat us to it.
+        LFReg_destroy(table->registry);
+        Mutex_destroy(&table->mutex);
+        FREEMEM(table);
+    }
+    return Str_intern_table;
+}
+
+// Reserve a slot in the intern table.  Return false if the table is full.
+static bool
+S_reserve_intern_slot(InternTable *table) {
+    bool reserved = false;
+    Mutex_lock(&table->mutex);
+    if (table->count < table->capacity) {
+        table->count++;
+        reserved = true;
+    }
+    Mutex_unlock(&table->mutex);
+    return reserved;
+}
+
+static void
+S_release_intern_slot(InternTable *table) {
+    Mutex_lock(&table->mutex);
+    table->count--;
+    Mutex_unlock(&table->mutex);
+}
+
+String*
+Str_intern(String *string) {
+    if (string->flags & STR_fINTERNED) {
+        return (String*)INCREF(string);
+    }
+    return Str_intern_trusted_utf8(string->ptr, string->size);
+}
+
+String*
+Str_intern_trusted_utf8(const char *utf8, size_t size) {
+    InternTable *table = Str_intern_table;
+    if (table == NULL) {
+        table = S_init_intern_table();
+    }
+
+    String *key      = SSTR_WRAP_UTF8(utf8, size);
+    String *interned = (String*)LFReg_fetch(table->registry, key);
+    if (interned) {
+        return (String*)INCREF(interned);
+    }
+
+    String *candidate = Str_new_from_trusted_utf8(utf8, size);
+    if (!S_reserve_intern_slot(table)) {
+        // The table is full.  Return an ordinary String.
+        return candidate;
+    }
+
+    candidate->hash_sum = Str_Hash_Sum_IMP(candidate);
+    candidate->flags |= STR_fINTERNED;
+    if (LFReg_register(table->registry, candidate, (Obj*)candidate)) {
+        Audit_exclude((Obj*)candidate);
+        return candidate;
+    }
+
+    // Another thread registered the same content first.
+    S_release_intern_slot(table);
+    candidate->flags &= ~STR_fINTERNED;
+    DECREF(candidate);
+    return (String*)INCREF(LFReg_fetch(table->registry, key));
+}
+
+String*
+Str_encode_from(const int32_t *code_points, size_t num_code_points) {
+    // Compute the size of the encoded string first, so that it can be
+    // written directly into a single allocation.
+    size_t size = 0;
+    for (size_t i = 0; i < num_code_points; i++) {
+        int32_t code_point = code_points[i];
+        if (code_point < 0x80) {
+            if (code_point < 0) {
+                THROW(ERR, "Invalid code point: %i32", code_point);
+            }
+            size += 1;
+        }
+        else if (code_point < 0x800) {
+            size += 2;
+        }
+        else if (code_point < 0x10000) {
+            if (code_point >= 0xD800 && code_point <= 0xDFFF) {
+                THROW(ERR, "Invalid code point: %i32", code_point);
+            }
+            size += 3;
+        }
+        else if (code_point <= 0x10FFFF) {
+            size += 4;
+        }
+        else {
+            THROW(ERR, "Invalid code point: %i32", code_point);
+        }
+    }
+
+    String  *self = S_new_inline(size);
+    uint8_t *ptr  = (uint8_t*)self->ptr;
+    if (size == num_code_points) {
+        // All ASCII.
+        for (size_t i = 0; i < num_code_points; i++) {
+            ptr[i] = (uint8_t)code_points[i];
+        }
+    }
+    else {
+        for (size_t i = 0; i < num_code_points; i++) {
+            ptr += StrHelp_encode_utf8_char(code_points[i], ptr);
+        }
+    }
+
     return self;
 }
 
@@ -163,18 +364,17 @@ Str_newf(const char *pattern, ...) {
 
 static String*
 S_new_substring(String *string, size_t byte_offset, size_t size) {
-    String *self = (String*)Class_Make_Obj(STRING);
-
     if (string->origin == NULL) {
         // Copy substring of wrapped strings.
-        Str_init_from_trusted_utf8(self, string->ptr + byte_offset, size);
-    }
-    else {
-        self->ptr    = string->ptr + byte_offset;
-        self->size   = size;
-        self->origin = (String*)INCREF(string->origin);
+        return Str_new_from_trusted_utf8(string->ptr + byte_offset, size);
     }
 
+    String *self = (String*)MAKE_OBJ(STRING);
+    self->ptr      = string->ptr + byte_offset;
+    self->size     = size;
+    self->origin   = (String*)INCREF(string->origin);
+    self->flags    = 0;
+    self->hash_sum = 0;
     return self;
 }
 
@@ -183,10 +383,17 @@ Str_Is_Copy_On_IncRef_IMP(String *self) {
     return self->origin == NULL;
 }
 
+bool
+Str_Is_Interned_IMP(String *self) {
+    return !!(self->flags & STR_fINTERNED);
+}
+
 void
 Str_Destroy_IMP(String *self) {
     if (self->origin == self) {
-        FREEMEM((char*)self->ptr);
+        if (!(self->flags & STR_fINLINE)) {
+            FREEMEM((char*)self->ptr);
+        }
     }
     else {
         DECREF(self->origin);
@@ -196,13 +403,20 @@ Str_Destroy_IMP(String *self) {
 
 size_t
 Str_Hash_Sum_IMP(String *self) {
-    size_t hashvalue = 5381;
-    StringIterator *iter = STACK_ITER(self, 0);
+    if (self->flags & STR_fINTERNED) {
+        return self->hash_sum;
+    }
 
-    const StrIter_Next_t next = METHOD_PTR(STRINGITERATOR, CFISH_StrIter_Next);
-    int32_t code_point;
-    while (STR_OOB != (code_point = next(iter))) {
-        hashvalue = ((hashvalue << 5) + hashvalue) ^ code_point;
+    size_t  hashvalue = 5381;
+    size_t  offset    = 0;
+    int32_t code_points[64];
+    size_t  num;
+
+    while (0 != (num = S_decode(self->ptr, self->size, &offset, code_points,
+                                64))) {
+        for (size_t i = 0; i < num; i++) {
+            hashvalue = ((hashvalue << 5) + hashvalue) ^ code_points[i];
+        }
     }
 
     return hashvalue;
@@ -230,46 +444,12 @@ Str_To_I64_IMP(String *self) {
 
 int64_t
 Str_BaseX_To_I64_IMP(String *self, uint32_t base) {
-    StringIterator *iter = STACK_ITER(self, 0);
-    int64_t retval = 0;
-    bool is_negative = false;
-    int32_t code_point = StrIter_Next(iter);
-
-    // Advance past minus sign.
-    if (code_point == '-') {
-        code_point = StrIter_Next(iter);
-        is_negative = true;
-    }
-
-    // Accumulate.
-    while (code_point != STR_OOB) {
-        if (isalnum(code_point)) {
-            int32_t addend = isdigit(code_point)
-                             ? code_point - '0'
-                             : tolower(code_point) - 'a' + 10;
-            if (addend >= (int32_t)base) { break; }
-            retval *= base;
-            retval += addend;
-        }
-        else {
-            break;
-        }
-        code_point = StrIter_Next(iter);
-    }
-
-    // Apply minus sign.
-    if (is_negative) { retval = 0 - retval; }
-
-    return retval;
+    return StrHelp_parse_i64(self->ptr, self->size, base);
 }
 
 double
 Str_To_F64_IMP(String *self) {
-    size_t amount = self->size < 511 ? self->size : 511;
-    char buf[512];
-    memcpy(buf, self->ptr, amount);
-    buf[amount] = 0; // NULL-terminate.
-    return strtod(buf, NULL);
+    return StrHelp_parse_f64(self->ptr, self->size);
 }
 
 char*
@@ -305,13 +485,14 @@ Str_Cat_Utf8_IMP(String *self, const char* ptr, size_t size) {
 
 String*
 Str_Cat_Trusted_Utf8_IMP(String *self, const char* ptr, size_t size) {
-    size_t  result_size = self->size + size;
-    char   *result_ptr  = (char*)MALLOCATE(result_size + 1);
+    if (size > SIZE_MAX - self->size) {
+        THROW(ERR, "String size overflow");
+    }
+    String *result     = S_new_inline(self->size + size);
+    char   *result_ptr = (char*)result->ptr;
     memcpy(result_ptr, self->ptr, self->size);
     memcpy(result_ptr + self->size, ptr, size);
-    result_ptr[result_size] = '\0';
-    String *result = (String*)Class_Make_Obj(STRING);
-    return Str_init_steal_trusted_utf8(result, result_ptr, result_size);
+    return result;
 }
 
 bool
@@ -336,6 +517,8 @@ Str_Equals_IMP(String *self, Obj *other) {
     String *const twin = (String*)other;
     if (twin == self)              { return true; }
     if (!Obj_is_a(other, STRING)) { return false; }
+    // Distinct interned strings never have the same content.
+    if (self->flags & twin->flags & STR_fINTERNED) { return false; }
     return Str_Equals_Utf8_IMP(self, twin->ptr, twin->size);
 }
 
@@ -388,12 +571,12 @@ Str_Ends_With_Utf8_IMP(String *self, const char *suffix, size_t suffix_len) {
 
 bool
 Str_Contains_IMP(String *self, String *substring) {
-    return !!S_memmem(self, substring->ptr, substring->size);
+    return !!S_memmem(self->ptr, self->size, substring->ptr, substring->size);
 }
 
 bool
 Str_Contains_Utf8_IMP(String *self, const char *substring, size_t size) {
-    return !!S_memmem(self, substring, size);
+    return !!S_memmem(self->ptr, self->size, substring, size);
 }
 
 StringIterator*
@@ -403,28 +586,140 @@ Str_Find_IMP(String *self, String *substring) {
 
 StringIterator*
 Str_Find_Utf8_IMP(String *self, const char *substring, size_t size) {
-    const char *ptr = S_memmem(self, substring, size);
+    const char *ptr = S_memmem(self->ptr, self->size, substring, size);
     return ptr ? StrIter_new(self, ptr - self->ptr) : NULL;
 }
 
 static const char*
-S_memmem(String *self, const char *substring, size_t size) {
-    if (size == 0)         { return self->ptr; }
-    if (size > self->size) { return NULL;      }
+S_memmem(const char *ptr, size_t size, const char *substring,
+         size_t substring_size) {
+    if (substring_size == 0)   { return ptr;  }
+    if (substring_size > size) { return NULL; }
 
-    const char *ptr = self->ptr;
-    const char *end = ptr + self->size - size + 1;
+    const char *end = ptr + size - substring_size + 1;
     char first_char = substring[0];
 
     // Naive string search.
     while (NULL != (ptr = (const char*)memchr(ptr, first_char, end - ptr))) {
-        if (memcmp(ptr, substring, size) == 0) { break; }
+        if (memcmp(ptr, substring, substring_size) == 0) { break; }
         ptr++;
     }
 
     return ptr;
 }
 
+// Find the piece starting at `*offset_ptr` which ends before the next
+// separator or at the end of the buffer.  An offset beyond `size` marks the
+// end of iteration.
+static bool
+S_next_piece(const char *ptr, size_t size, const char *separator,
+             size_t separator_size, size_t *offset_ptr, size_t *start_ptr,
+             size_t *end_ptr) {
+    size_t offset = *offset_ptr;
+    if (offset > size) { return false; }
+
+    const char *found = separator_size == 1
+                        ? (const char*)memchr(ptr + offset, separator[0],
+                                              size - offset)
+                        : S_memmem(ptr + offset, size - offset, separator,
+                                   separator_size);
+    *start_ptr = offset;
+    if (found) {
+        *end_ptr    = (size_t)(found - ptr);
+        *offset_ptr = *end_ptr + separator_size;
+    }
+    else {
+        *end_ptr    = size;
+        *offset_ptr = size + 1;
+    }
+    return true;
+}
+
+// Return the size of the UTF-8 sequence at `ptr` if it encodes a whitespace
+// character, 0 otherwise.
+static CFISH_INLINE size_t
+SI_whitespace_size(const char *ptr) {
+    uint8_t byte = *(const uint8_t*)ptr;
+    if (byte < 0x80) {
+        return byte == ' ' || (byte >= '\t' && byte <= '\r') ? 1 : 0;
+    }
+    return StrHelp_is_whitespace(StrHelp_decode_utf8_char(ptr))
+           ? StrHelp_UTF8_COUNT[byte]
+           : 0;
+}
+
+// Find the next run of non-whitespace characters at or after `*offset_ptr`.
+static bool
+S_next_word(const char *ptr, size_t size, size_t *offset_ptr,
+            size_t *start_ptr, size_t *end_ptr) {
+    size_t offset = *offset_ptr;
+
+    while (offset < size) {
+        size_t ws_size = SI_whitespace_size(ptr + offset);
+        if (ws_size == 0) { break; }
+        offset += ws_size;
+    }
+    if (offset >= size) {
+        *offset_ptr = size;
+        return false;
+    }
+
+    *start_ptr = offset;
+    while (offset < size) {
+        if (SI_whitespace_size(ptr + offset) != 0) { break; }
+        offset += StrHelp_UTF8_COUNT[(uint8_t)ptr[offset]];
+    }
+    if (offset > size) { offset = size; }
+    *end_ptr    = offset;
+    *offset_ptr = offset;
+    return true;
+}
+
+static Vector*
+S_split(String *self, const char *separator, size_t separator_size) {
+    if (separator_size == 0) {
+        THROW(ERR, "Empty separator");
+    }
+
+    Vector *pieces = Vec_new(0);
+    size_t offset = 0;
+    size_t start, end;
+    while (S_next_piece(self->ptr, self->size, separator, separator_size,
+                        &offset, &start, &end)) {
+        Vec_Push(pieces, (Obj*)S_new_substring(self, start, end - start));
+    }
+    return pieces;
+}
+
+Vector*
+Str_Split_IMP(String *self, String *separator) {
+    return S_split(self, separator->ptr, separator->size);
+}
+
+Vector*
+Str_Split_Char_IMP(String *self, int32_t code_point) {
+    if (code_point < 0
+        || code_point > 0x10FFFF
+        || (code_point >= 0xD800 && code_point <= 0xDFFF)
+       ) {
+        THROW(ERR, "Invalid code point: %i32", code_point);
+    }
+    char   buf[4];
+    size_t size = StrHelp_encode_utf8_char(code_point, buf);
+    return S_split(self, buf, size);
+}
+
+Vector*
+Str_Split_Whitespace_IMP(String *self) {
+    Vector *pieces = Vec_new(0);
+    size_t offset = 0;
+    size_t start, end;
+    while (S_next_word(self->ptr, self->size, &offset, &start, &end)) {
+        Vec_Push(pieces, (Obj*)S_new_substring(self, start, end - start));
+    }
+    return pieces;
+}
+
 String*
 Str_Trim_IMP(String *self) {
     StringIterator *top = STACK_ITER(self, 0);
@@ -453,6 +748,30 @@ Str_Trim_Tail_IMP(String *self) {
     return StrIter_crop(NULL, (StringIterator*)tail);
 }
 
+String*
+Str_To_Lower_IMP(String *self) {
+    String *lower = Unicode_to_lower(self->ptr, self->size);
+    return lower ? lower : (String*)INCREF(self);
+}
+
+String*
+Str_Case_Fold_IMP(String *self) {
+    String *folded = Unicode_case_fold(self->ptr, self->size);
+    return folded ? folded : (String*)INCREF(self);
+}
+
+String*
+Str_To_NFC_IMP(String *self) {
+    String *normalized = Unicode_normalize(self->ptr, self->size, false);
+    return normalized ? normalized : (String*)INCREF(self);
+}
+
+String*
+Str_To_NFKC_IMP(String *self) {
+    String *normalized = Unicode_normalize(self->ptr, self->size, true);
+    return normalized ? normalized : (String*)INCREF(self);
+}
+
 size_t
 Str_Length_IMP(String *self) {
     StringIterator *iter = STACK_ITER(self, 0);
@@ -497,6 +816,12 @@ Str_Get_Ptr8_IMP(String *self) {
     return self->ptr;
 }
 
+size_t
+Str_Decode_Into_IMP(String *self, int32_t *buf, size_t max) {
+    size_t offset = 0;
+    return S_decode(self->ptr, self->size, &offset, buf, max);
+}
+
 StringIterator*
 Str_Top_IMP(String *self) {
     return StrIter_new(self, 0);
@@ -511,7 +836,7 @@ Str_Tail_IMP(String *self) {
 
 StringIterator*
 StrIter_new(String *string, size_t byte_offset) {
-    StringIterator *self = (StringIterator*)Class_Make_Obj(STRINGITERATOR);
+    StringIterator *self = (StringIterator*)MAKE_OBJ(STRINGITERATOR);
     self->string      = (String*)INCREF(string);
     self->byte_offset = byte_offset;
     return self;
@@ -666,6 +991,87 @@ StrIter_Next_IMP(StringIterator *self) {
     return retval;
 }
 
+// Decode up to `max` code points starting at `*offset_ptr`.  Runs of ASCII
+// characters are widened in blocks.
+static size_t
+S_decode(const char *utf8, size_t size, size_t *offset_ptr, int32_t *buf,
+         size_t max) {
+    const uint8_t *const ptr = (const uint8_t*)utf8;
+    size_t offset = *offset_ptr;
+    size_t num    = 0;
+
+    while (num < max && offset < size) {
+#ifdef __SSE2__
+        const __m128i zero = _mm_setzero_si128();
+        while (max - num >= 16 && size - offset >= 16) {
+            __m128i bytes = _mm_loadu_si128((const __m128i*)(ptr + offset));
+            if (_mm_movemask_epi8(bytes) != 0) { break; }
+            __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+            __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+            __m128i *out = (__m128i*)(buf + num);
+            _mm_storeu_si128(out,     _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi, zero));
+            offset += 16;
+            num    += 16;
+        }
+#else
+        while (max - num >= 8 && size - offset >= 8) {
+            uint64_t word;
+            memcpy(&word, ptr + offset, 8);
+            if (word & UINT64_C(0x8080808080808080)) { break; }
+            for (size_t i = 0; i < 8; i++) {
+                buf[num + i] = ptr[offset + i];
+            }
+            offset += 8;
+            num    += 8;
+        }
+#endif
+        if (num >= max || offset >= size) { break; }
+
+        int32_t code_point = ptr[offset];
+        if (code_point < 0x80) {
+            offset += 1;
+        }
+        else {
+            size_t len = StrHelp_UTF8_COUNT[code_point];
+            if (len == 0 || size - offset < len) {
+                THROW(ERR, "Invalid UTF-8");
+                UNREACHABLE_RETURN(size_t);
+            }
+            switch (len) {
+                case 2:
+                    code_point = ((code_point & 0x1F) << 6)
+                                 | (ptr[offset + 1] & 0x3F);
+                    break;
+                case 3:
+                    code_point = ((code_point & 0x0F) << 12)
+                                 | ((ptr[offset + 1] & 0x3F) << 6)
+                                 | (ptr[offset + 2] & 0x3F);
+                    break;
+                default:
+                    code_point = ((code_point & 0x07) << 18)
+                                 | ((ptr[offset + 1] & 0x3F) << 12)
+                                 | ((ptr[offset + 2] & 0x3F) << 6)
+                                 | (ptr[offset + 3] & 0x3F);
+                    break;
+            }
+            offset += len;
+        }
+        buf[num++] = code_point;
+    }
+
+    *offset_ptr = offset;
+    return num;
+}
+
+size_t
+StrIter_Next_Batch_IMP(StringIterator *self, int32_t *buf, size_t max) {
+    String *string = self->string;
+    return S_decode(string->ptr, string->size, &self->byte_offset, buf, max);
+}
+
 int32_t
 StrIter_Prev_IMP(StringIterator *self) {
     size_t byte_offset = self->byte_offset;
@@ -829,4 +1235,86 @@ StrIter_Destroy_IMP(StringIterator *self) {
     SUPER_DESTROY(self, STRINGITERATOR);
 }
 
+/*****************************************************************/
+
+StringTokenizer*
+StrTok_new(String *string, String *separator) {
+    StringTokenizer *self = (StringTokenizer*)MAKE_OBJ(STRINGTOKENIZER);
+    return StrTok_init(self, string, separator);
+}
+
+StringTokenizer*
+StrTok_init(StringTokenizer *self, String *string, String *separator) {
+    if (separator && separator->size == 0) {
+        DECREF(self);
+        THROW(ERR, "Empty separator");
+    }
+    self->string      = (String*)INCREF(string);
+    self->separator   = (String*)INCREF(separator);
+    self->view        = Str_new_wrap_trusted_utf8(string->ptr, 0);
+    self->byte_offset = 0;
+    self->borrowed    = false;
+    return self;
+}
+
+StringTokenizer*
+StrTok_init_stack(void *allocation, void *view_allocation, String *string,
+                  String *separator) {
+    if (separator && separator->size == 0) {
+        THROW(ERR, "Empty separator");
+    }
+    StringTokenizer *self
+        = (StringTokenizer*)Class_Init_Obj(STRINGTOKENIZER, allocation);
+    self->string      = string;
+    self->separator   = separator;
+    self->view        = Str_init_stack_string(view_allocation, string->ptr, 0);
+    self->byte_offset = 0;
+    self->borrowed    = true;
+    return self;
+}
 
+String*
+StrTok_Next_IMP(StringTokenizer *self) {
+    String *string = self->string;
+    size_t  start, end;
+    bool    found;
+
+    if (self->separator) {
+        found = S_next_piece(string->ptr, string->size, self->separator->ptr,
+                             self->separator->size, &self->byte_offset,
+                             &start, &end);
+    }
+    else {
+        found = S_next_word(string->ptr, string->size, &self->byte_offset,
+                            &start, &end);
+    }
+    if (!found) { return NULL; }
+
+    String *view = self->view;
+    view->ptr  = string->ptr + start;
+    view->size = end - start;
+    return view;
+}
+
+void
+StrTok_Reset_IMP(StringTokenizer *self, String *string) {
+    if (self->borrowed) {
+        self->string = string;
+    }
+    else {
+        String *old_string = self->string;
+        self->string = (String*)INCREF(string);
+        DECREF(old_string);
+    }
+    self->byte_offset = 0;
+    self->view->ptr   = self->string->ptr;
+    self->view->size  = 0;
+}
+
+void
+StrTok_Destroy_IMP(StringTokenizer *self) {
+    DECREF(self->view);
+    DECREF(self->separator);
+    DECREF(self->string);
+    SUPER_DESTROY(self, STRINGTOKENIZER);
+}
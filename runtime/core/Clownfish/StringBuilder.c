@@ -0,0 +1,211 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define C_CFISH_STRINGBUILDER
+#define CFISH_USE_SHORT_NAMES
+
+#include "charmony.h"
+
+#include <stdarg.h>
+#include <string.h>
+
+#include "Clownfish/StringBuilder.h"
+
+#include "Clownfish/CharBuf.h"
+#include "Clownfish/Class.h"
+#include "Clownfish/Err.h"
+#include "Clownfish/String.h"
+#include "Clownfish/Vector.h"
+#include "Clownfish/Util/Audit.h"
+#include "Clownfish/Util/Memory.h"
+
+#define DEFAULT_CHUNK_SIZE 4096
+
+// Strings shorter than chunk_size / COPY_DIVISOR are copied into the tail
+// buffer instead of being referenced, so that lots of small appends don't
+// result in lots of tiny chunks.
+#define COPY_DIVISOR 16
+
+// Turn the tail buffer into a chunk.
+static void
+S_flush_tail(StringBuilder *self);
+
+// Flush the tail if it reached the chunk size.
+static CFISH_INLINE void
+SI_maybe_flush_tail(StringBuilder *self);
+
+StringBuilder*
+SB_new(size_t chunk_size) {
+    StringBuilder *self = (StringBuilder*)MAKE_OBJ(STRINGBUILDER);
+    return SB_init(self, chunk_size);
+}
+
+StringBuilder*
+SB_init(StringBuilder *self, size_t chunk_size) {
+    self->chunk_size = chunk_size ? chunk_size : DEFAULT_CHUNK_SIZE;
+    self->chunks     = Vec_new(0);
+    self->tail       = CB_new(0);
+    self->size       = 0;
+    return self;
+}
+
+void
+SB_Destroy_IMP(StringBuilder *self) {
+    DECREF(self->chunks);
+    DECREF(self->tail);
+    SUPER_DESTROY(self, STRINGBUILDER);
+}
+
+static void
+S_flush_tail(StringBuilder *self) {
+    if (CB_Get_Size(self->tail) == 0) { return; }
+    Vec_Push(self->chunks, (Obj*)CB_Yield_String(self->tail));
+}
+
+static CFISH_INLINE void
+SI_maybe_flush_tail(StringBuilder *self) {
+    if (CB_Get_Size(self->tail) >= self->chunk_size) {
+        S_flush_tail(self);
+    }
+}
+
+void
+SB_Cat_IMP(StringBuilder *self, String *string) {
+    size_t size = Str_Get_Size(string);
+    if (size < self->chunk_size / COPY_DIVISOR) {
+        CB_Cat(self->tail, string);
+        SI_maybe_flush_tail(self);
+    }
+    else {
+        S_flush_tail(self);
+        // INCREF makes a copy of stack strings.
+        Vec_Push(self->chunks, INCREF(string));
+    }
+    self->size += size;
+}
+
+void
+SB_Cat_Utf8_IMP(StringBuilder *self, const char *utf8, size_t size) {
+    CB_Cat_Utf8(self->tail, utf8, size);
+    self->size += size;
+    SI_maybe_flush_tail(self);
+}
+
+void
+SB_Cat_Trusted_Utf8_IMP(StringBuilder *self, const char *utf8, size_t size) {
+    CB_Cat_Trusted_Utf8(self->tail, utf8, size);
+    self->size += size;
+    SI_maybe_flush_tail(self);
+}
+
+void
+SB_Cat_Char_IMP(StringBuilder *self, int32_t code_point) {
+    size_t old_size = CB_Get_Size(self->tail);
+    CB_Cat_Char(self->tail, code_point);
+    self->size += CB_Get_Size(self->tail) - old_size;
+    SI_maybe_flush_tail(self);
+}
+
+void
+SB_VCatF_IMP(StringBuilder *self, const char *pattern, va_list args) {
+    size_t old_size = CB_Get_Size(self->tail);
+    CB_VCatF(self->tail, pattern, args);
+    self->size += CB_Get_Size(self->tail) - old_size;
+    SI_maybe_flush_tail(self);
+}
+
+void
+SB_catf(StringBuilder *self, const char *pattern, ...) {
+    va_list args;
+    va_start(args, pattern);
+    SB_VCatF(self, pattern, args);
+    va_end(args);
+}
+
+size_t
+SB_Get_Size_IMP(StringBuilder *self) {
+    return self->size;
+}
+
+size_t
+SB_Get_Num_Chunks_IMP(StringBuilder *self) {
+    S_flush_tail(self);
+    return Vec_Get_Size(self->chunks);
+}
+
+String*
+SB_Fetch_Chunk_IMP(StringBuilder *self, size_t tick) {
+    return (String*)Vec_Fetch(self->chunks, tick);
+}
+
+void
+SB_Clear_IMP(StringBuilder *self) {
+    Vec_Clear(self->chunks);
+    CB_Clear(self->tail);
+    self->size = 0;
+}
+
+String*
+SB_To_String_IMP(StringBuilder *self) {
+    S_flush_tail(self);
+    size_t num_chunks = Vec_Get_Size(self->chunks);
+    if (num_chunks == 0) {
+        return Str_new_from_trusted_utf8("", 0);
+    }
+    if (num_chunks == 1) {
+        return (String*)INCREF(Vec_Fetch(self->chunks, 0));
+    }
+
+    char *buf = (char*)MALLOCATE(self->size + 1);
+    char *dest = buf;
+    for (size_t i = 0; i < num_chunks; i++) {
+        String *chunk = (String*)Vec_Fetch(self->chunks, i);
+        size_t  size  = Str_Get_Size(chunk);
+        memcpy(dest, Str_Get_Ptr8(chunk), size);
+        dest += size;
+    }
+    *dest = '\0';
+
+    return Str_new_steal_trusted_utf8(buf, self->size);
+}
+
+String*
+SB_Yield_String_IMP(StringBuilder *self) {
+    S_flush_tail(self);
+    size_t num_chunks = Vec_Get_Size(self->chunks);
+    String *retval;
+
+    if (num_chunks == 1) {
+        retval = (String*)Vec_Delete(self->chunks, 0);
+    }
+    else {
+        char *buf = (char*)MALLOCATE(self->size + 1);
+        char *dest = buf;
+        for (size_t i = 0; i < num_chunks; i++) {
+            String *chunk = (String*)Vec_Delete(self->chunks, i);
+            size_t  size  = Str_Get_Size(chunk);
+            memcpy(dest, Str_Get_Ptr8(chunk), size);
+            dest += size;
+            DECREF(chunk);
+        }
+        *dest = '\0';
+        retval = Str_new_steal_trusted_utf8(buf, self->size);
+    }
+
+    SB_Clear(self);
+    return retval;
+}
+
@@ -25,17 +25,24 @@
 #include "Clownfish/Test/TestBlob.h"
 #include "Clownfish/Test/TestByteBuf.h"
 #include "Clownfish/Test/TestString.h"
+#include "Clownfish/Test/TestStringBuilder.h"
 #include "Clownfish/Test/TestCharBuf.h"
 #include "Clownfish/Test/TestClass.h"
+#include "Clownfish/Test/TestConcurrentHash.h"
 #include "Clownfish/Test/TestErr.h"
 #include "Clownfish/Test/TestHash.h"
 #include "Clownfish/Test/TestHashIterator.h"
+#include "Clownfish/Test/TestIOBuf.h"
+#include "Clownfish/Test/TestInt64Hash.h"
 #include "Clownfish/Test/TestLockFreeRegistry.h"
 #include "Clownfish/Test/TestNum.h"
 #include "Clownfish/Test/TestObj.h"
 #include "Clownfish/Test/TestPtrHash.h"
+#include "Clownfish/Test/TestThreadPool.h"
 #include "Clownfish/Test/TestVector.h"
 #include "Clownfish/Test/Util/TestAtomic.h"
+#include "Clownfish/Test/Util/TestAudit.h"
+#include "Clownfish/Test/Util/TestInstrument.h"
 #include "Clownfish/Test/Util/TestMemory.h"
 #include "Clownfish/Test/Util/TestStringHelper.h"
 
@@ -47,18 +54,27 @@ Test_create_test_suite() {
     TestSuite_Add_Batch(suite, (TestBatch*)TestVector_new());
     TestSuite_Add_Batch(suite, (TestBatch*)TestHash_new());
     TestSuite_Add_Batch(suite, (TestBatch*)TestHashIterator_new());
+    TestSuite_Add_Batch(suite, (TestBatch*)TestInt64Hash_new());
+    TestSuite_Add_Batch(suite, (TestBatch*)TestConcHash_new());
     TestSuite_Add_Batch(suite, (TestBatch*)TestObj_new());
     TestSuite_Add_Batch(suite, (TestBatch*)TestErr_new());
     TestSuite_Add_Batch(suite, (TestBatch*)TestBlob_new());
     TestSuite_Add_Batch(suite, (TestBatch*)TestBB_new());
+    TestSuite_Add_Batch(suite, (TestBatch*)TestIOBuf_new());
+    // TestAudit interns a String, so it must run before TestStr fills the
+    // intern table.
+    TestSuite_Add_Batch(suite, (TestBatch*)TestAudit_new());
     TestSuite_Add_Batch(suite, (TestBatch*)TestStr_new());
     TestSuite_Add_Batch(suite, (TestBatch*)TestCB_new());
+    TestSuite_Add_Batch(suite, (TestBatch*)TestSB_new());
     TestSuite_Add_Batch(suite, (TestBatch*)TestNum_new());
     TestSuite_Add_Batch(suite, (TestBatch*)TestStrHelp_new());
     TestSuite_Add_Batch(suite, (TestBatch*)TestAtomic_new());
     TestSuite_Add_Batch(suite, (TestBatch*)TestLFReg_new());
     TestSuite_Add_Batch(suite, (TestBatch*)TestMemory_new());
+    TestSuite_Add_Batch(suite, (TestBatch*)TestInstrument_new());
     TestSuite_Add_Batch(suite, (TestBatch*)TestPtrHash_new());
+    TestSuite_Add_Batch(suite, (TestBatch*)TestThreadPool_new());
 
     return suite;
 }
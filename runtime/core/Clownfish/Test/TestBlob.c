@@ -17,9 +17,14 @@
 #define CFISH_USE_SHORT_NAMES
 #define TESTCFISH_USE_SHORT_NAMES
 
+#include <stdio.h>
+
 #include "Clownfish/Test/TestBlob.h"
 
 #include "Clownfish/Blob.h"
+#include "Clownfish/ByteBuf.h"
+#include "Clownfish/Err.h"
+#include "Clownfish/String.h"
 #include "Clownfish/Test.h"
 #include "Clownfish/TestHarness/TestBatchRunner.h"
 #include "Clownfish/TestHarness/TestUtils.h"
@@ -65,6 +70,16 @@ test_Equals(TestBatchRunner *runner) {
     DECREF(blob);
 }
 
+static void
+test_Hash_Sum(TestBatchRunner *runner) {
+    Blob *blob = Blob_new("foo", 3);
+    Blob *twin = Blob_new("foo", 3);
+    TEST_TRUE(runner, Blob_Hash_Sum(blob) == Blob_Hash_Sum(twin),
+              "Equal Blobs have same Hash_Sum");
+    DECREF(twin);
+    DECREF(blob);
+}
+
 static void
 test_Clone(TestBatchRunner *runner) {
     Blob *blob = Blob_new("foo", 3);
@@ -104,12 +119,138 @@ test_Compare_To(TestBatchRunner *runner) {
     }
 }
 
+static void
+test_Slice(TestBatchRunner *runner) {
+    Blob *blob = Blob_new("0123456789", 10);
+
+    {
+        Blob *slice = Blob_Slice(blob, 2, 3);
+        TEST_TRUE(runner, Blob_Equals_Bytes(slice, "234", 3), "Slice");
+        TEST_TRUE(runner, Blob_Get_Buf(slice) == Blob_Get_Buf(blob) + 2,
+                  "Slice shares buffer");
+        DECREF(slice);
+    }
+
+    {
+        Blob *slice = Blob_Slice(blob, 7, 100);
+        TEST_TRUE(runner, Blob_Equals_Bytes(slice, "789", 3),
+                  "Slice past end is truncated");
+        Blob *inner = Blob_Slice(slice, 1, 1);
+        DECREF(slice);
+        DECREF(blob);
+        TEST_TRUE(runner, Blob_Equals_Bytes(inner, "8", 1),
+                  "Slice of slice outlives parents");
+        blob = Blob_new("0123456789", 10);
+        DECREF(inner);
+    }
+
+    {
+        Blob *slice = Blob_Slice(blob, 10, 1);
+        TEST_INT_EQ(runner, Blob_Get_Size(slice), 0,
+                    "Slice out of bounds is empty");
+        DECREF(slice);
+    }
+
+    {
+        Blob *slice = Blob_Slice(blob, 0, SIZE_MAX);
+        TEST_TRUE(runner, slice == blob, "Slice of whole Blob returns self");
+        DECREF(slice);
+    }
+
+    {
+        char  bytes[] = "abcdef";
+        Blob *wrapped = Blob_new_wrap(bytes, 6);
+        Blob *slice   = Blob_Slice(wrapped, 1, 2);
+        DECREF(wrapped);
+        bytes[1] = 'x';
+        TEST_TRUE(runner, Blob_Equals_Bytes(slice, "bc", 2),
+                  "Slice of wrapped Blob is copied");
+        DECREF(slice);
+    }
+
+    {
+        char  bytes[] = "abc";
+        Blob *wrapped = Blob_new_wrap(bytes, 3);
+        Blob *slice   = Blob_Slice(wrapped, 0, 3);
+        DECREF(wrapped);
+        bytes[0] = 'x';
+        TEST_TRUE(runner, Blob_Equals_Bytes(slice, "abc", 3),
+                  "Slice of whole wrapped Blob is copied");
+        DECREF(slice);
+    }
+
+    DECREF(blob);
+}
+
+static void
+test_new_from_origin(TestBatchRunner *runner) {
+    ByteBuf *bb = BB_new_bytes("foobar", 6);
+    Blob *blob = Blob_new_from_origin((Obj*)bb, BB_Get_Buf(bb) + 3, 3);
+    DECREF(bb);
+    TEST_TRUE(runner, Blob_Equals_Bytes(blob, "bar", 3),
+              "new_from_origin keeps origin alive");
+    DECREF(blob);
+
+    char    bytes[] = "foobar";
+    String *wrapped = SSTR_WRAP_UTF8(bytes, 6);
+    blob = Blob_new_from_origin((Obj*)wrapped, bytes + 3, 3);
+    bytes[3] = 'x';
+    TEST_TRUE(runner, Blob_Equals_Bytes(blob, "bar", 3),
+              "new_from_origin with stack String points into its copy");
+    DECREF(blob);
+}
+
+static void
+S_new_from_missing_file(void *context) {
+    UNUSED_VAR(context);
+    String *path = SSTR_WRAP_C("_test_blob_missing.tmp");
+    DECREF(Blob_new_from_file(path, BLOB_ACCESS_NORMAL));
+}
+
+static void
+test_new_from_file(TestBatchRunner *runner) {
+    const char *path_c = "_test_blob_file.tmp";
+    String     *path   = SSTR_WRAP_C(path_c);
+    FILE       *file   = fopen(path_c, "wb");
+    if (file == NULL) {
+        SKIP(runner, 4, "can't create test file");
+        return;
+    }
+    fputs("foo bar baz", file);
+    fclose(file);
+
+    Blob *blob = Blob_new_from_file(path, BLOB_ACCESS_SEQUENTIAL
+                                          | BLOB_ACCESS_WILLNEED);
+    TEST_TRUE(runner, Blob_Equals_Bytes(blob, "foo bar baz", 11),
+              "new_from_file");
+    Blob *slice = Blob_Slice(blob, 4, 3);
+    DECREF(blob);
+    TEST_TRUE(runner, Blob_Equals_Bytes(slice, "bar", 3),
+              "Slice of file Blob outlives parent");
+    DECREF(slice);
+
+    file = fopen(path_c, "wb");
+    fclose(file);
+    blob = Blob_new_from_file(path, BLOB_ACCESS_RANDOM);
+    TEST_INT_EQ(runner, Blob_Get_Size(blob), 0, "new_from_file empty file");
+    DECREF(blob);
+    remove(path_c);
+
+    Err *error = Err_trap(S_new_from_missing_file, NULL);
+    TEST_TRUE(runner, error != NULL, "new_from_file missing file throws");
+    DECREF(error);
+}
+
 void
 TestBlob_Run_IMP(TestBlob *self, TestBatchRunner *runner) {
-    TestBatchRunner_Plan(runner, (TestBatch*)self, 11);
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 26);
     test_Equals(runner);
+    test_Hash_Sum(runner);
     test_Clone(runner);
     test_Compare_To(runner);
+    test_Slice(runner);
+    test_new_from_origin(runner);
+    test_new_from_file(runner);
 }
 
 
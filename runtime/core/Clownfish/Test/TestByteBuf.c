@@ -149,15 +149,49 @@ test_Utf8_To_String(TestBatchRunner *runner) {
     DECREF(bb);
 }
 
+static void
+test_Yield_Blob(TestBatchRunner *runner) {
+    ByteBuf *bb = BB_new(0);
+
+    BB_Cat_Bytes(bb, "foo", 3);
+    Blob *short_blob = BB_Yield_Blob(bb);
+    TEST_INT_EQ(runner, BB_Get_Size(bb), 0, "Yield_Blob clears ByteBuf");
+    TEST_TRUE(runner, BB_Get_Capacity(bb) > 0,
+              "Yield_Blob keeps buffer of short content");
+    BB_Cat_Bytes(bb, "bar", 3);
+    TEST_TRUE(runner, Blob_Equals_Bytes(short_blob, "foo", 3),
+              "Yield_Blob with short content");
+    DECREF(short_blob);
+    DECREF(BB_Yield_Blob(bb));
+
+    char long_bytes[1000];
+    memset(long_bytes, 'x', sizeof(long_bytes));
+    BB_Cat_Bytes(bb, long_bytes, sizeof(long_bytes));
+    const char *buf = BB_Get_Buf(bb);
+    Blob *long_blob = BB_Yield_Blob(bb);
+    TEST_TRUE(runner, Blob_Get_Buf(long_blob) == buf,
+              "Yield_Blob transfers long content");
+    TEST_INT_EQ(runner, BB_Get_Capacity(bb), 0,
+                "Yield_Blob takes buffer of long content");
+    BB_Cat_Bytes(bb, "bar", 3);
+    TEST_TRUE(runner,
+              Blob_Equals_Bytes(long_blob, long_bytes, sizeof(long_bytes)),
+              "Yield_Blob with long content");
+    DECREF(long_blob);
+
+    DECREF(bb);
+}
+
 void
 TestBB_Run_IMP(TestByteBuf *self, TestBatchRunner *runner) {
-    TestBatchRunner_Plan(runner, (TestBatch*)self, 17);
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 23);
     test_Equals(runner);
     test_Grow(runner);
     test_Clone(runner);
     test_Compare_To(runner);
     test_Utf8_To_String(runner);
     test_Cat(runner);
+    test_Yield_Blob(runner);
 }
 
 
@@ -271,9 +271,36 @@ test_Clear(TestBatchRunner *runner) {
     DECREF(cb);
 }
 
+static void
+test_Yield_String(TestBatchRunner *runner) {
+    CharBuf *cb = CB_new(0);
+
+    CB_Cat_Utf8(cb, "foo", 3);
+    String *short_str = CB_Yield_String(cb);
+    TEST_INT_EQ(runner, CB_Get_Size(cb), 0,
+                "Yield_String clears CharBuf");
+    CB_Cat_Utf8(cb, "bar", 3);
+    TEST_TRUE(runner, Str_Equals_Utf8(short_str, "foo", 3),
+              "Yield_String with short content");
+    DECREF(short_str);
+    DECREF(CB_Yield_String(cb));
+
+    char long_chars[1000];
+    memset(long_chars, 'x', sizeof(long_chars));
+    CB_Cat_Utf8(cb, long_chars, sizeof(long_chars));
+    String *long_str = CB_Yield_String(cb);
+    CB_Cat_Utf8(cb, "bar", 3);
+    TEST_TRUE(runner,
+              Str_Equals_Utf8(long_str, long_chars, sizeof(long_chars)),
+              "Yield_String with long content");
+    DECREF(long_str);
+
+    DECREF(cb);
+}
+
 void
 TestCB_Run_IMP(TestCharBuf *self, TestBatchRunner *runner) {
-    TestBatchRunner_Plan(runner, (TestBatch*)self, 20);
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 23);
     test_vcatf_percent(runner);
     test_vcatf_s(runner);
     test_vcatf_null_string(runner);
@@ -291,5 +318,6 @@ TestCB_Run_IMP(TestCharBuf *self, TestBatchRunner *runner) {
     test_Cat(runner);
     test_Clone(runner);
     test_Clear(runner);
+    test_Yield_String(runner);
 }
 
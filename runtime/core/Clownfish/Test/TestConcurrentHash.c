@@ -0,0 +1,293 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+
+#define CFISH_USE_SHORT_NAMES
+#define TESTCFISH_USE_SHORT_NAMES
+
+#include "Clownfish/Test/TestConcurrentHash.h"
+
+#include "Clownfish/Boolean.h"
+#include "Clownfish/Class.h"
+#include "Clownfish/ConcurrentHash.h"
+#include "Clownfish/Err.h"
+#include "Clownfish/Hash.h"
+#include "Clownfish/Num.h"
+#include "Clownfish/String.h"
+#include "Clownfish/Test.h"
+#include "Clownfish/TestHarness/TestBatchRunner.h"
+#include "Clownfish/TestHarness/TestUtils.h"
+#include "Clownfish/ThreadPool.h"
+#include "Clownfish/Vector.h"
+
+#define NUM_KEYS 10000
+
+TestConcurrentHash*
+TestConcHash_new() {
+    return (TestConcurrentHash*)Class_Make_Obj(TESTCONCURRENTHASH);
+}
+
+#define NUM_HOT_KEYS 16
+
+typedef struct {
+    ConcurrentHash *hash;
+    String         *key;
+    int64_t         sum; // Only modified while the shard is locked.
+} SharedFetch;
+
+static void
+S_add_value(void *context, Obj *value) {
+    SharedFetch *shared = (SharedFetch*)context;
+    shared->sum += Int_Get_Value((Integer*)value);
+}
+
+static void
+S_get_value(void *context, Obj *value) {
+    *(Obj**)context = value;
+}
+
+static void
+S_count_entry(void *context, String *key, Obj *value) {
+    UNUSED_VAR(key);
+    UNUSED_VAR(value);
+    (*(size_t*)context)++;
+}
+
+static Obj*
+S_fetch_value(ConcurrentHash *hash, String *key) {
+    Obj *value = NULL;
+    ConcHash_Fetch_With(hash, key, S_get_value, &value);
+    return value;
+}
+
+typedef struct {
+    ConcurrentHash *hash;
+    Obj            *value;
+} StoreArgs;
+
+static void
+S_store(void *context) {
+    StoreArgs *args = (StoreArgs*)context;
+    ConcHash_Store(args->hash, SSTR_WRAP_C("shared"), args->value);
+}
+
+static void
+test_basics(TestBatchRunner *runner) {
+    ConcurrentHash *hash = ConcHash_new(0, 3);
+    String *foo = Str_newf("foo");
+    String *bar = Str_newf("bar");
+
+    ConcHash_Store(hash, foo, (Obj*)Str_newf("a"));
+    ConcHash_Store(hash, bar, (Obj*)Str_newf("b"));
+    ConcHash_Store(hash, foo, (Obj*)Str_newf("c"));
+    TEST_INT_EQ(runner, ConcHash_Get_Size(hash), 2, "Store");
+
+    Obj *value = S_fetch_value(hash, foo);
+    TEST_TRUE(runner, value && Str_Equals_Utf8((String*)value, "c", 1),
+              "Fetch_With lends replaced value");
+
+    TEST_FALSE(runner,
+               ConcHash_Store_If_Absent(hash, foo, (Obj*)Str_newf("d")),
+               "Store_If_Absent with existing key");
+    TEST_TRUE(runner,
+              ConcHash_Store_If_Absent(hash, (String*)SSTR_WRAP_C("baz"),
+                                       (Obj*)Str_newf("e")),
+              "Store_If_Absent with new key");
+
+    Obj *shared_value = (Obj*)Str_newf("shared");
+    Obj *other_ref    = INCREF(shared_value);
+    StoreArgs args = { hash, shared_value };
+    Err *error = Err_trap(S_store, &args);
+    TEST_TRUE(runner, error != NULL, "Store of shared value throws");
+    DECREF(error);
+    DECREF(other_ref);
+    DECREF(shared_value);
+    ConcHash_Store(hash, (String*)SSTR_WRAP_C("true"), (Obj*)CFISH_TRUE);
+    TEST_TRUE(runner, S_fetch_value(hash, (String*)SSTR_WRAP_C("true"))
+                      == (Obj*)CFISH_TRUE,
+              "Store of immortal value");
+
+    size_t num_entries = 0;
+    ConcHash_Iterate_With(hash, S_count_entry, &num_entries);
+    TEST_INT_EQ(runner, num_entries, 4, "Iterate_With");
+
+    Vector *keys = ConcHash_Keys(hash);
+    Vec_Sort(keys);
+    TEST_TRUE(runner, Vec_Get_Size(keys) == 4
+                      && Str_Equals_Utf8((String*)Vec_Fetch(keys, 0), "bar", 3)
+                      && Str_Equals_Utf8((String*)Vec_Fetch(keys, 2), "foo", 3),
+              "Keys");
+    DECREF(keys);
+
+    value = ConcHash_Delete(hash, bar);
+    TEST_TRUE(runner, value && Str_Equals_Utf8((String*)value, "b", 1),
+              "Delete returns value");
+    TEST_INT_EQ(runner, REFCOUNT_NN(value), 1,
+                "Delete hands over the hash's reference");
+    DECREF(value);
+    TEST_FALSE(runner, ConcHash_Has_Key(hash, bar), "Delete removes key");
+    TEST_FALSE(runner, ConcHash_Fetch_With(hash, bar, S_add_value, NULL),
+               "Fetch_With of missing key");
+
+    ConcHash_Clear(hash);
+    TEST_INT_EQ(runner, ConcHash_Get_Size(hash), 0, "Clear");
+
+    DECREF(bar);
+    DECREF(foo);
+    DECREF(hash);
+}
+
+static void
+S_store_range(void *context, size_t start, size_t end) {
+    ConcurrentHash *hash = (ConcurrentHash*)context;
+    for (size_t i = start; i < end; i++) {
+        String *key = Str_newf("%u64", (uint64_t)i);
+        ConcHash_Store(hash, key, (Obj*)Int_new((int64_t)i));
+        DECREF(key);
+    }
+}
+
+static void
+S_check_entry(void *context, Obj *value) {
+    int64_t *expected = (int64_t*)context;
+    if (Int_Get_Value((Integer*)value) != *expected) { *expected = -1; }
+}
+
+static void
+S_fetch_and_delete_range(void *context, size_t start, size_t end) {
+    ConcurrentHash *hash = (ConcurrentHash*)context;
+    for (size_t i = start; i < end; i++) {
+        String *key = Str_newf("%u64", (uint64_t)i);
+        int64_t expected = (int64_t)i;
+        if (ConcHash_Fetch_With(hash, key, S_check_entry, &expected)
+            && expected == (int64_t)i
+            && (i & 1)
+           ) {
+            DECREF(ConcHash_Delete(hash, key));
+        }
+        DECREF(key);
+    }
+}
+
+static void
+S_fetch_shared(void *context, size_t start, size_t end) {
+    SharedFetch *shared = (SharedFetch*)context;
+    for (size_t i = start; i < end; i++) {
+        ConcHash_Fetch_With(shared->hash, shared->key, S_add_value, shared);
+    }
+}
+
+static void
+S_check_hot_value(void *context, Obj *value) {
+    // The hash holds the sole reference to every value.
+    if (REFCOUNT_NN(value) != 1 || Int_Get_Value((Integer*)value) < 0) {
+        (*(int64_t*)context)++;
+    }
+}
+
+// Fetch, store and delete a few hot keys from all threads at once.  Return
+// the number of bad values seen by Fetch_With.
+static Obj*
+S_churn_hot_keys(void *context, size_t start, size_t end) {
+    ConcurrentHash *hash       = (ConcurrentHash*)context;
+    int64_t         num_errors = 0;
+    for (size_t i = start; i < end; i++) {
+        char buf[16];
+        sprintf(buf, "hot%u", (unsigned)(i % NUM_HOT_KEYS));
+        String *key = SSTR_WRAP_C(buf);
+        switch (i % 3) {
+            case 0:
+                ConcHash_Store(hash, key, (Obj*)Int_new((int64_t)i));
+                break;
+            case 1: {
+                Obj *value = ConcHash_Delete(hash, key);
+                if (value && REFCOUNT_NN(value) != 1) { num_errors++; }
+                DECREF(value);
+                break;
+            }
+            default:
+                ConcHash_Fetch_With(hash, key, S_check_hot_value,
+                                    &num_errors);
+                break;
+        }
+    }
+    return (Obj*)Int_new(num_errors);
+}
+
+static Obj*
+S_add_errors(void *context, Obj *left, Obj *right) {
+    UNUSED_VAR(context);
+    return (Obj*)Int_new(Int_Get_Value((Integer*)left)
+                         + Int_Get_Value((Integer*)right));
+}
+
+static void
+S_check_refcount(void *context, String *key, Obj *value) {
+    UNUSED_VAR(key);
+    if (REFCOUNT_NN(value) != 1) { (*(int64_t*)context)++; }
+}
+
+static void
+test_threads(TestBatchRunner *runner) {
+    ConcurrentHash *hash = ConcHash_new(0, 0);
+    ThreadPool     *pool = ThreadPool_new(4);
+
+    ThreadPool_Parallel_For(pool, 0, NUM_KEYS, 100, S_store_range, hash);
+    TEST_INT_EQ(runner, ConcHash_Get_Size(hash), NUM_KEYS,
+                "Store from multiple threads");
+
+    ThreadPool_Parallel_For(pool, 0, NUM_KEYS, 100, S_fetch_and_delete_range,
+                            hash);
+    TEST_INT_EQ(runner, ConcHash_Get_Size(hash), NUM_KEYS / 2,
+                "Fetch_With and Delete from multiple threads");
+
+    String *key = Str_newf("shared");
+    ConcHash_Store(hash, key, (Obj*)Int_new(2));
+    SharedFetch shared = { hash, key, 0 };
+    ThreadPool_Parallel_For(pool, 0, NUM_KEYS, 10, S_fetch_shared, &shared);
+    TEST_INT_EQ(runner, shared.sum, 2 * NUM_KEYS,
+                "Fetch_With of the same key from multiple threads");
+    TEST_INT_EQ(runner, REFCOUNT_NN(S_fetch_value(hash, key)), 1,
+                "Fetch_With leaves refcount of shared value intact");
+    DECREF(key);
+    ConcHash_Clear(hash);
+
+    Integer *errors
+        = (Integer*)ThreadPool_Parallel_Reduce(pool, 0, 20 * NUM_KEYS, 50,
+                                               S_churn_hot_keys,
+                                               S_add_errors, hash);
+    TEST_INT_EQ(runner, Int_Get_Value(errors), 0,
+                "Fetch_With, Store and Delete of the same keys from multiple"
+                " threads");
+    DECREF(errors);
+    int64_t num_shared = 0;
+    ConcHash_Iterate_With(hash, S_check_refcount, &num_shared);
+    TEST_INT_EQ(runner, num_shared, 0,
+                "values are unshared after concurrent Store and Delete");
+
+    DECREF(pool);
+    DECREF(hash);
+}
+
+void
+TestConcHash_Run_IMP(TestConcurrentHash *self, TestBatchRunner *runner) {
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 19);
+    test_basics(runner);
+    test_threads(runner);
+}
+
+
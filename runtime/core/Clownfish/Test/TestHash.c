@@ -23,8 +23,11 @@
 #include "Clownfish/Test/TestHash.h"
 
 #include "Clownfish/String.h"
+#include "Clownfish/Blob.h"
 #include "Clownfish/Boolean.h"
+#include "Clownfish/ByteBuf.h"
 #include "Clownfish/Hash.h"
+#include "Clownfish/Num.h"
 #include "Clownfish/Test.h"
 #include "Clownfish/TestHarness/TestBatchRunner.h"
 #include "Clownfish/TestHarness/TestUtils.h"
@@ -212,6 +215,136 @@ test_stress(TestBatchRunner *runner) {
     DECREF(hash);
 }
 
+static void
+test_insertion_order(TestBatchRunner *runner) {
+    Hash   *hash     = Hash_new(0);
+    Vector *expected = Vec_new(100);
+
+    for (uint32_t i = 0; i < 100; i++) {
+        String *str = Str_newf("%u32", i);
+        Hash_Store(hash, str, (Obj*)str);
+    }
+    // Delete every other key and add more to trigger compaction.
+    for (uint32_t i = 0; i < 100; i += 2) {
+        String *str = Str_newf("%u32", i);
+        DECREF(Hash_Delete(hash, str));
+        DECREF(str);
+    }
+    for (uint32_t i = 1; i < 100; i += 2) {
+        Vec_Push(expected, (Obj*)Str_newf("%u32", i));
+    }
+    for (uint32_t i = 100; i < 200; i++) {
+        String *str = Str_newf("%u32", i);
+        Hash_Store(hash, str, INCREF(str));
+        Vec_Push(expected, (Obj*)str);
+    }
+    // Overwriting a value keeps the position of the key.
+    Hash_Store_Utf8(hash, "1", 1, (Obj*)Str_newf("1"));
+
+    Vector *keys = Hash_Keys(hash);
+    TEST_TRUE(runner, Vec_Equals(keys, (Obj*)expected),
+              "Keys in insertion order");
+    DECREF(keys);
+
+    Vector *values = Hash_Values(hash);
+    TEST_TRUE(runner, Vec_Equals(values, (Obj*)expected),
+              "Values in insertion order");
+    DECREF(values);
+
+    DECREF(expected);
+    DECREF(hash);
+}
+
+static void
+test_obj_keys(TestBatchRunner *runner) {
+    Hash    *hash    = Hash_new(0);
+    Integer *one     = Int_new(1);
+    Float   *one_f64 = Float_new(1.0);
+    Blob    *blob    = Blob_new("1", 1);
+    String  *str     = Str_newf("1");
+
+    Hash_Store_Obj(hash, (Obj*)one, (Obj*)Str_newf("integer"));
+    Hash_Store_Obj(hash, (Obj*)blob, (Obj*)Str_newf("blob"));
+    Hash_Store(hash, str, (Obj*)Str_newf("string"));
+    TEST_INT_EQ(runner, Hash_Get_Size(hash), 3,
+                "Equal content of different types makes distinct keys");
+
+    String *value = (String*)Hash_Fetch_Obj(hash, (Obj*)one_f64);
+    TEST_TRUE(runner, value && Str_Equals_Utf8(value, "integer", 7),
+              "Fetch_Obj with equal Float key");
+    value = (String*)Hash_Fetch_Obj(hash, (Obj*)str);
+    TEST_TRUE(runner, value && Str_Equals_Utf8(value, "string", 6),
+              "Fetch_Obj with String key");
+    TEST_TRUE(runner, Hash_Has_Obj_Key(hash, (Obj*)blob), "Has_Obj_Key");
+
+    Hash *dupe = Hash_new(0);
+    Hash_Store_Obj(dupe, (Obj*)blob, (Obj*)Str_newf("blob"));
+    Hash_Store_Utf8(dupe, "1", 1, (Obj*)Str_newf("string"));
+    Hash_Store_Obj(dupe, (Obj*)one_f64, (Obj*)Str_newf("integer"));
+    TEST_TRUE(runner, Hash_Equals(hash, (Obj*)dupe),
+              "Equals with non-String keys");
+    DECREF(dupe);
+
+    value = (String*)Hash_Delete_Obj(hash, (Obj*)one);
+    TEST_TRUE(runner, value && Str_Equals_Utf8(value, "integer", 7),
+              "Delete_Obj");
+    DECREF(value);
+    TEST_FALSE(runner, Hash_Has_Obj_Key(hash, (Obj*)one_f64),
+               "Has_Obj_Key after Delete_Obj");
+
+    DECREF(str);
+    DECREF(blob);
+    DECREF(one_f64);
+    DECREF(one);
+    DECREF(hash);
+}
+
+static void
+test_container_keys(TestBatchRunner *runner) {
+    Hash *hash = Hash_new(0);
+
+    ByteBuf *bb = BB_new_bytes("foo", 3);
+    Hash_Store_Obj(hash, (Obj*)bb, (Obj*)Str_newf("bytebuf"));
+    ByteBuf *bb_twin = BB_new_bytes("foo", 3);
+    String *value = (String*)Hash_Fetch_Obj(hash, (Obj*)bb_twin);
+    TEST_TRUE(runner, value && Str_Equals_Utf8(value, "bytebuf", 7),
+              "Fetch_Obj with equal ByteBuf key");
+
+    Vector *vec = Vec_new(3);
+    Vec_Push(vec, (Obj*)Int_new(1));
+    Vec_Push(vec, (Obj*)Str_newf("a"));
+    Vec_Push(vec, NULL);
+    Hash_Store_Obj(hash, (Obj*)vec, (Obj*)Str_newf("vector"));
+    Vector *vec_twin = Vec_new(3);
+    Vec_Push(vec_twin, (Obj*)Float_new(1.0));
+    Vec_Push(vec_twin, (Obj*)Str_newf("a"));
+    Vec_Push(vec_twin, NULL);
+    value = (String*)Hash_Fetch_Obj(hash, (Obj*)vec_twin);
+    TEST_TRUE(runner, value && Str_Equals_Utf8(value, "vector", 6),
+              "Fetch_Obj with equal Vector key");
+
+    Hash *key = Hash_new(0);
+    Hash_Store_Utf8(key, "a", 1, (Obj*)Int_new(1));
+    Hash_Store_Utf8(key, "b", 1, (Obj*)Int_new(2));
+    Hash_Store_Obj(hash, (Obj*)key, (Obj*)Str_newf("hash"));
+    Hash *key_twin = Hash_new(0);
+    Hash_Store_Utf8(key_twin, "b", 1, (Obj*)Int_new(2));
+    Hash_Store_Utf8(key_twin, "a", 1, (Obj*)Int_new(1));
+    TEST_INT_EQ(runner, Hash_Hash_Sum(key), Hash_Hash_Sum(key_twin),
+                "Hash_Sum of Hash doesn't depend on insertion order");
+    value = (String*)Hash_Fetch_Obj(hash, (Obj*)key_twin);
+    TEST_TRUE(runner, value && Str_Equals_Utf8(value, "hash", 4),
+              "Fetch_Obj with equal Hash key");
+
+    DECREF(key_twin);
+    DECREF(key);
+    DECREF(vec_twin);
+    DECREF(vec);
+    DECREF(bb_twin);
+    DECREF(bb);
+    DECREF(hash);
+}
+
 static void
 test_store_skips_tombstone(TestBatchRunner *runner) {
     Hash *hash = Hash_new(0);
@@ -245,12 +378,15 @@ test_store_skips_tombstone(TestBatchRunner *runner) {
 
 void
 TestHash_Run_IMP(TestHash *self, TestBatchRunner *runner) {
-    TestBatchRunner_Plan(runner, (TestBatch*)self, 30);
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 43);
     srand((unsigned int)time((time_t*)NULL));
     test_Equals(runner);
     test_Store_and_Fetch(runner);
     test_Keys_Values(runner);
     test_stress(runner);
+    test_insertion_order(runner);
+    test_obj_keys(runner);
+    test_container_keys(runner);
     test_store_skips_tombstone(runner);
 }
 
@@ -26,6 +26,7 @@
 #include "Clownfish/String.h"
 #include "Clownfish/Hash.h"
 #include "Clownfish/HashIterator.h"
+#include "Clownfish/Num.h"
 #include "Clownfish/Test.h"
 #include "Clownfish/Vector.h"
 #include "Clownfish/TestHarness/TestBatchRunner.h"
@@ -193,6 +194,27 @@ test_illegal_modification(TestBatchRunner *runner) {
     DECREF(iter);
 }
 
+static void
+test_obj_keys(TestBatchRunner *runner) {
+    Hash    *hash = Hash_new(0);
+    Integer *key  = Int_new(42);
+    Hash_Store_Obj(hash, (Obj*)key, NULL);
+
+    HashIterator *iter = HashIter_new(hash);
+    HashIter_Next(iter);
+    TEST_TRUE(runner, HashIter_Get_Obj_Key(iter) == (Obj*)key,
+              "Get_Obj_Key");
+
+    Err *get_key_error = Err_trap(S_invoke_Get_Key, iter);
+    TEST_TRUE(runner, get_key_error != NULL,
+              "Get_Key throws exception for non-String key.");
+    DECREF(get_key_error);
+
+    DECREF(iter);
+    DECREF(key);
+    DECREF(hash);
+}
+
 static void
 test_tombstone(TestBatchRunner *runner) {
     {
@@ -232,12 +254,13 @@ test_tombstone(TestBatchRunner *runner) {
 
 void
 TestHashIterator_Run_IMP(TestHashIterator *self, TestBatchRunner *runner) {
-    TestBatchRunner_Plan(runner, (TestBatch*)self, 17);
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 19);
     srand((unsigned int)time((time_t*)NULL));
     test_Next(runner);
     test_empty(runner);
     test_Get_Key_and_Get_Value(runner);
     test_illegal_modification(runner);
+    test_obj_keys(runner);
     test_tombstone(runner);
 }
 
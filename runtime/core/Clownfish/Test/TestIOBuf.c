@@ -0,0 +1,238 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "charmony.h"
+
+#include <string.h>
+
+#if defined(CHY_HAS_UNISTD_H) && defined(CHY_HAS_FCNTL_H)
+  #include <fcntl.h>
+  #include <unistd.h>
+  #define HAS_PIPES
+#endif
+
+#define CFISH_USE_SHORT_NAMES
+#define TESTCFISH_USE_SHORT_NAMES
+
+#include "Clownfish/Test/TestIOBuf.h"
+
+#include "Clownfish/IOBuf.h"
+#include "Clownfish/Blob.h"
+#include "Clownfish/ByteBuf.h"
+#include "Clownfish/Class.h"
+#include "Clownfish/Err.h"
+#include "Clownfish/Num.h"
+#include "Clownfish/String.h"
+#include "Clownfish/Test.h"
+#include "Clownfish/TestHarness/TestBatchRunner.h"
+#include "Clownfish/TestHarness/TestUtils.h"
+#include "Clownfish/Vector.h"
+
+TestIOBuf*
+TestIOBuf_new() {
+    return (TestIOBuf*)Class_Make_Obj(TESTIOBUF);
+}
+
+static void
+test_read_write(TestBatchRunner *runner) {
+    IOBuf *io_buf = IOBuf_new(0);
+    char   bytes[100];
+
+    IOBuf_Write_Bytes(io_buf, "hello world", 11);
+    TEST_INT_EQ(runner, IOBuf_Get_Size(io_buf), 11, "Write_Bytes");
+    TEST_INT_EQ(runner, IOBuf_Read_Bytes(io_buf, bytes, 5), 5,
+                "Read_Bytes");
+    TEST_TRUE(runner, memcmp(bytes, "hello", 5) == 0,
+              "Read_Bytes content");
+    IOBuf_Consume(io_buf, 1);
+    Blob *blob = IOBuf_Read_Blob(io_buf, 100);
+    TEST_TRUE(runner, Blob_Equals_Bytes(blob, "world", 5),
+              "Read_Blob after Consume");
+    TEST_INT_EQ(runner, IOBuf_Get_Size(io_buf), 0, "Read_Blob consumes");
+    DECREF(blob);
+
+    DECREF(io_buf);
+}
+
+static void
+test_ring(TestBatchRunner *runner) {
+    IOBuf *io_buf = IOBuf_new(64);
+    size_t capacity = IOBuf_Get_Capacity(io_buf);
+    char   bytes[200];
+    for (size_t i = 0; i < sizeof(bytes); i++) {
+        bytes[i] = (char)('a' + i % 26);
+    }
+
+    IOBuf_Write_Bytes(io_buf, bytes, capacity - 4);
+    IOBuf_Consume(io_buf, capacity - 14);
+    IOBuf_Write_Bytes(io_buf, bytes + capacity - 4, 30);
+    TEST_INT_EQ(runner, IOBuf_Get_Capacity(io_buf), capacity,
+                "content wraps without growing");
+
+    size_t      size;
+    const char *ptr = IOBuf_Peek(io_buf, &size);
+    TEST_TRUE(runner,
+              size == 14 && memcmp(ptr, bytes + capacity - 14, 14) == 0,
+              "Peek returns contiguous run");
+
+    IOBuf_Write_Bytes(io_buf, bytes + capacity + 26, 100);
+    TEST_TRUE(runner, IOBuf_Get_Capacity(io_buf) > capacity,
+              "Write_Bytes grows buffer");
+    Blob *blob = IOBuf_Read_Blob(io_buf, SIZE_MAX);
+    TEST_TRUE(runner, Blob_Equals_Bytes(blob, bytes + capacity - 14, 140),
+              "growing unwraps content");
+    DECREF(blob);
+
+    DECREF(io_buf);
+}
+
+static void
+S_write_integer(void *context) {
+    IOBuf   *io_buf  = (IOBuf*)context;
+    Integer *integer = Int_new(1);
+    IOBuf_Write(io_buf, (Obj*)integer);
+    DECREF(integer);
+}
+
+static void
+test_Write(TestBatchRunner *runner) {
+    IOBuf   *io_buf = IOBuf_new(0);
+    Blob    *blob   = Blob_new("foo", 3);
+    String  *string = Str_newf("bar");
+    ByteBuf *bb     = BB_new_bytes("baz", 3);
+
+    IOBuf_Write(io_buf, (Obj*)blob);
+    IOBuf_Write(io_buf, (Obj*)string);
+    IOBuf_Write(io_buf, (Obj*)bb);
+    Blob *content = IOBuf_Read_Blob(io_buf, SIZE_MAX);
+    TEST_TRUE(runner, Blob_Equals_Bytes(content, "foobarbaz", 9),
+              "Write Blob, String and ByteBuf");
+    DECREF(content);
+
+    Err *error = Err_trap(S_write_integer, io_buf);
+    TEST_TRUE(runner, error != NULL, "Write of other object throws");
+    DECREF(error);
+
+    DECREF(bb);
+    DECREF(string);
+    DECREF(blob);
+    DECREF(io_buf);
+}
+
+static void
+test_fd(TestBatchRunner *runner) {
+#ifdef HAS_PIPES
+    int fds[2];
+    if (pipe(fds) != 0) {
+        SKIP(runner, 9, "can't create pipe");
+        return;
+    }
+
+    // Make the content wrap to exercise vectored I/O.
+    IOBuf *out = IOBuf_new(64);
+    size_t capacity = IOBuf_Get_Capacity(out);
+    char   bytes[64];
+    memset(bytes, 'x', sizeof(bytes));
+    IOBuf_Write_Bytes(out, bytes, capacity - 4);
+    IOBuf_Consume(out, capacity - 6);
+    IOBuf_Write_Bytes(out, "0123456789", 10);
+    TEST_INT_EQ(runner, IOBuf_Drain_To_Fd(out, fds[1]), 12, "Drain_To_Fd");
+    TEST_INT_EQ(runner, IOBuf_Get_Size(out), 0, "Drain_To_Fd consumes");
+
+    IOBuf *in = IOBuf_new(64);
+    IOBuf_Write_Bytes(in, bytes, capacity - 4);
+    IOBuf_Consume(in, capacity - 6);
+    TEST_INT_EQ(runner, IOBuf_Fill_From_Fd(in, fds[0], 1), 12,
+                "Fill_From_Fd");
+    Blob *blob = IOBuf_Read_Blob(in, SIZE_MAX);
+    TEST_TRUE(runner, Blob_Equals_Bytes(blob, "xxxx0123456789", 14),
+              "Fill_From_Fd content");
+    DECREF(blob);
+
+    Vector *segments = Vec_new(3);
+    Vec_Push(segments, (Obj*)Blob_new("foo", 3));
+    Vec_Push(segments, (Obj*)Str_newf(""));
+    Vec_Push(segments, (Obj*)Str_newf("bar"));
+    Vec_Push(segments, (Obj*)BB_new_bytes("baz", 3));
+    TEST_INT_EQ(runner, IOBuf_write_segments(fds[1], segments), 9,
+                "write_segments");
+    DECREF(segments);
+
+    ByteBuf *first  = BB_new_bytes("-", 1);
+    ByteBuf *second = BB_new(8);
+    Vector  *bufs   = Vec_new(2);
+    Vec_Push(bufs, INCREF(first));
+    Vec_Push(bufs, INCREF(second));
+    size_t first_space = BB_Get_Capacity(first) - 1;
+    TEST_INT_EQ(runner, IOBuf_read_segments(fds[0], bufs), 9,
+                "read_segments");
+    TEST_TRUE(runner,
+              BB_Get_Size(first) == first_space + 1
+              && BB_Equals_Bytes(second, "foobarbaz" + first_space,
+                                 9 - first_space),
+              "read_segments fills ByteBufs in order");
+    DECREF(bufs);
+    DECREF(second);
+    DECREF(first);
+
+    fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+    TEST_INT_EQ(runner, IOBuf_Fill_From_Fd(in, fds[0], 1), -1,
+                "Fill_From_Fd would block");
+    close(fds[1]);
+    TEST_INT_EQ(runner, IOBuf_Fill_From_Fd(in, fds[0], 1), 0,
+                "Fill_From_Fd at end of file");
+    close(fds[0]);
+
+    DECREF(in);
+    DECREF(out);
+#else
+    SKIP(runner, 9, "no pipes");
+#endif
+}
+
+static void
+test_pool(TestBatchRunner *runner) {
+    IOBufPool *pool = IOBufPool_new(128, 2);
+
+    IOBuf *io_buf = IOBufPool_Acquire(pool);
+    TEST_TRUE(runner, IOBuf_Get_Capacity(io_buf) >= 128, "Acquire");
+    IOBuf_Write_Bytes(io_buf, "foo", 3);
+    IOBufPool_Release(pool, io_buf);
+    TEST_INT_EQ(runner, IOBufPool_Get_Num_Free(pool), 1, "Release");
+
+    IOBuf *reused = IOBufPool_Acquire(pool);
+    TEST_TRUE(runner, reused == io_buf && IOBuf_Get_Size(reused) == 0,
+              "Acquire reuses released IOBuf");
+
+    INCREF(reused);
+    IOBufPool_Release(pool, reused);
+    TEST_INT_EQ(runner, IOBufPool_Get_Num_Free(pool), 0,
+                "Release doesn't pool shared IOBuf");
+    DECREF(reused);
+
+    DECREF(pool);
+}
+
+void
+TestIOBuf_Run_IMP(TestIOBuf *self, TestBatchRunner *runner) {
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 24);
+    test_read_write(runner);
+    test_ring(runner);
+    test_Write(runner);
+    test_fd(runner);
+    test_pool(runner);
+}
+
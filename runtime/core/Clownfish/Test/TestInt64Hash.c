@@ -0,0 +1,149 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define CFISH_USE_SHORT_NAMES
+#define TESTCFISH_USE_SHORT_NAMES
+
+#include "Clownfish/Test/TestInt64Hash.h"
+
+#include "Clownfish/Int64Hash.h"
+#include "Clownfish/Class.h"
+#include "Clownfish/Num.h"
+#include "Clownfish/Test.h"
+#include "Clownfish/TestHarness/TestBatchRunner.h"
+#include "Clownfish/TestHarness/TestUtils.h"
+
+TestInt64Hash*
+TestInt64Hash_new() {
+    return (TestInt64Hash*)Class_Make_Obj(TESTINT64HASH);
+}
+
+static void
+test_Int64Hash(TestBatchRunner *runner) {
+    Int64Hash *hash = Int64Hash_new(0);
+    const size_t starting_cap = Int64Hash_Get_Capacity(hash);
+
+    Int64Hash_Store(hash, 0, (Obj*)Int_new(0));
+    Int64Hash_Store(hash, INT64_MIN, (Obj*)Int_new(1));
+    Int64Hash_Store(hash, -1, NULL);
+    TEST_INT_EQ(runner, Int64Hash_Get_Size(hash), 3, "Get_Size");
+    TEST_TRUE(runner, Int64Hash_Has_Key(hash, -1)
+                      && Int64Hash_Fetch(hash, -1) == NULL,
+              "Has_Key with NULL value");
+    TEST_FALSE(runner, Int64Hash_Has_Key(hash, 1), "Has_Key false");
+
+    Int64Hash_Store(hash, 0, (Obj*)Int_new(2));
+    Integer *value = (Integer*)Int64Hash_Fetch(hash, 0);
+    TEST_INT_EQ(runner, Int_Get_Value(value), 2, "Store replaces value");
+    TEST_INT_EQ(runner, Int64Hash_Get_Size(hash), 3,
+                "Store replacing value keeps size");
+
+    for (int64_t i = 1; i <= 1000; i++) {
+        Int64Hash_Store(hash, i * 7, (Obj*)Int_new(i));
+    }
+    TEST_TRUE(runner, Int64Hash_Get_Capacity(hash) > starting_cap,
+              "Store grows hash");
+
+    // Delete keys in an order that requires entries to be shifted back.
+    for (int64_t i = 1; i <= 1000; i += 2) {
+        DECREF(Int64Hash_Delete(hash, i * 7));
+    }
+    TEST_INT_EQ(runner, Int64Hash_Get_Size(hash), 503, "Delete");
+    TEST_TRUE(runner, Int64Hash_Delete(hash, 7) == NULL,
+              "Delete missing key returns NULL");
+
+    bool ok = true;
+    for (int64_t i = 1; i <= 1000; i++) {
+        Integer *value = (Integer*)Int64Hash_Fetch(hash, i * 7);
+        if (i % 2) {
+            if (value != NULL) { ok = false; }
+        }
+        else if (value == NULL || Int_Get_Value(value) != i) {
+            ok = false;
+        }
+    }
+    TEST_TRUE(runner, ok, "Fetch after Delete");
+
+    size_t  tick      = 0;
+    size_t  num_pairs = 0;
+    int64_t key;
+    Obj    *obj;
+    ok = true;
+    while (Int64Hash_Next(hash, &tick, &key, &obj)) {
+        if (obj != Int64Hash_Fetch(hash, key)) { ok = false; }
+        num_pairs++;
+    }
+    TEST_TRUE(runner, ok && num_pairs == 503, "Next visits all pairs");
+
+    Int64Hash_Clear(hash);
+    TEST_INT_EQ(runner, Int64Hash_Get_Size(hash), 0, "Clear");
+    TEST_TRUE(runner, Int64Hash_Fetch(hash, INT64_MIN) == NULL,
+              "Fetch after Clear");
+
+    DECREF(hash);
+}
+
+static void
+test_Int64Set(TestBatchRunner *runner) {
+    Int64Set *set = Int64Set_new(0);
+
+    TEST_TRUE(runner, Int64Set_Add(set, 42), "Add");
+    TEST_FALSE(runner, Int64Set_Add(set, 42), "Add existing element");
+    TEST_TRUE(runner, Int64Set_Contains(set, 42), "Contains");
+    TEST_FALSE(runner, Int64Set_Contains(set, 43), "Contains false");
+
+    for (int64_t i = 0; i < 1000; i++) {
+        Int64Set_Add(set, i << 32);
+    }
+    TEST_INT_EQ(runner, Int64Set_Get_Size(set), 1001, "Get_Size");
+
+    bool ok = true;
+    for (int64_t i = 0; i < 1000; i += 3) {
+        if (!Int64Set_Remove(set, i << 32)) { ok = false; }
+    }
+    TEST_TRUE(runner, ok, "Remove");
+    TEST_FALSE(runner, Int64Set_Remove(set, 0), "Remove missing element");
+
+    ok = Int64Set_Contains(set, 42);
+    for (int64_t i = 0; i < 1000; i++) {
+        if (Int64Set_Contains(set, i << 32) != (i % 3 != 0)) { ok = false; }
+    }
+    TEST_TRUE(runner, ok, "Contains after Remove");
+
+    size_t  tick         = 0;
+    size_t  num_elements = 0;
+    int64_t key;
+    ok = true;
+    while (Int64Set_Next(set, &tick, &key)) {
+        if (!Int64Set_Contains(set, key)) { ok = false; }
+        num_elements++;
+    }
+    TEST_TRUE(runner, ok && num_elements == 667, "Next visits all elements");
+
+    Int64Set_Clear(set);
+    TEST_INT_EQ(runner, Int64Set_Get_Size(set), 0, "Clear");
+    TEST_FALSE(runner, Int64Set_Contains(set, 42), "Contains after Clear");
+
+    DECREF(set);
+}
+
+void
+TestInt64Hash_Run_IMP(TestInt64Hash *self, TestBatchRunner *runner) {
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 23);
+    test_Int64Hash(runner);
+    test_Int64Set(runner);
+}
+
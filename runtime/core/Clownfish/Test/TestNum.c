@@ -206,13 +206,34 @@ test_Clone(TestBatchRunner *runner) {
     DECREF(f64);
 }
 
+static void
+test_Hash_Sum(TestBatchRunner *runner) {
+    Integer *i64      = Int_new(5);
+    Integer *i64_dupe = Int_new(5);
+    Integer *zero     = Int_new(0);
+    Float   *f64      = Float_new(5.0);
+    Float   *neg_zero = Float_new(-0.0);
+    TEST_TRUE(runner, Int_Hash_Sum(i64) == Int_Hash_Sum(i64_dupe),
+              "Equal Integers have same Hash_Sum");
+    TEST_TRUE(runner, Int_Hash_Sum(i64) == Float_Hash_Sum(f64),
+              "Equal Integer and Float have same Hash_Sum");
+    TEST_TRUE(runner, Int_Hash_Sum(zero) == Float_Hash_Sum(neg_zero),
+              "-0.0 has same Hash_Sum as 0");
+    DECREF(neg_zero);
+    DECREF(f64);
+    DECREF(zero);
+    DECREF(i64_dupe);
+    DECREF(i64);
+}
+
 void
 TestNum_Run_IMP(TestNum *self, TestBatchRunner *runner) {
-    TestBatchRunner_Plan(runner, (TestBatch*)self, 68);
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 71);
     test_To_String(runner);
     test_accessors(runner);
     test_Equals_and_Compare_To(runner);
     test_Clone(runner);
+    test_Hash_Sum(runner);
 }
 
 
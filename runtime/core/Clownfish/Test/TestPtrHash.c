@@ -63,6 +63,30 @@ test_Store_and_Fetch(TestBatchRunner *runner) {
     PtrHash_Destroy(hash);
 }
 
+static void
+S_count_and_replace(void *key, void **value, void *context) {
+    if (*value == key) { *(int*)context += 1; }
+    *value = NULL;
+}
+
+static void
+test_Iterate(TestBatchRunner *runner) {
+    PtrHash *hash = PtrHash_new(0);
+    char dummy[20];
+
+    for (int i = 0; i < 20; i++) {
+        PtrHash_Store(hash, &dummy[i], &dummy[i]);
+    }
+
+    int count = 0;
+    PtrHash_Iterate(hash, S_count_and_replace, &count);
+    TEST_INT_EQ(runner, count, 20, "Iterate visits every entry");
+    TEST_TRUE(runner, PtrHash_Fetch(hash, &dummy[7]) == NULL,
+              "Iterate can modify values");
+
+    PtrHash_Destroy(hash);
+}
+
 static void
 test_stress(TestBatchRunner *runner) {
     PtrHash *hash = PtrHash_new(0); // trigger multiple rebuilds.
@@ -99,9 +123,10 @@ test_stress(TestBatchRunner *runner) {
 
 void
 TestPtrHash_Run_IMP(TestPtrHash *self, TestBatchRunner *runner) {
-    TestBatchRunner_Plan(runner, (TestBatch*)self, 4);
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 6);
     srand((unsigned int)time(NULL));
     test_Store_and_Fetch(runner);
+    test_Iterate(runner);
     test_stress(runner);
 }
 
@@ -26,10 +26,15 @@
 #include "Clownfish/Boolean.h"
 #include "Clownfish/ByteBuf.h"
 #include "Clownfish/CharBuf.h"
+#include "Clownfish/Err.h"
+#include "Clownfish/Hash.h"
+#include "Clownfish/Num.h"
 #include "Clownfish/Test.h"
 #include "Clownfish/TestHarness/TestBatchRunner.h"
 #include "Clownfish/TestHarness/TestUtils.h"
 #include "Clownfish/Util/Memory.h"
+#include "Clownfish/Util/Unicode.h"
+#include "Clownfish/Vector.h"
 #include "Clownfish/Class.h"
 
 #define SMILEY "\xE2\x98\xBA"
@@ -107,6 +112,18 @@ test_new(TestBatchRunner *runner) {
         DECREF(wrapper);
     }
 
+    {
+        String *copy = Str_new_from_trusted_utf8(chars, sizeof(chars) - 1);
+        TEST_TRUE(runner, Str_Equals_Utf8(copy, chars, sizeof(chars) - 1)
+                          && Str_Get_Ptr8(copy)[sizeof(chars) - 1] == '\0',
+                  "Str_new_from_trusted_utf8");
+        String *substring = Str_SubString(copy, 2, 6);
+        DECREF(copy);
+        TEST_TRUE(runner, Str_Equals_Utf8(substring, "string", 6),
+                  "SubString outlives string with inline storage");
+        DECREF(substring);
+    }
+
     {
         String *smiley_str = Str_new_from_char(smiley_cp);
         TEST_TRUE(runner, Str_Equals_Utf8(smiley_str, smiley, smiley_len),
@@ -142,6 +159,120 @@ test_Cat(TestBatchRunner *runner) {
     DECREF(wanted);
 }
 
+static void
+test_intern(TestBatchRunner *runner) {
+    String *plain = Str_newf("intern_%s", "test");
+    TEST_FALSE(runner, Str_Is_Interned(plain), "plain String isn't interned");
+
+    String *interned = Str_intern(plain);
+    TEST_TRUE(runner, Str_Is_Interned(interned), "intern");
+    TEST_TRUE(runner, Str_Equals(interned, (Obj*)plain),
+              "interned String has same content");
+    TEST_INT_EQ(runner, Str_Hash_Sum(interned), Str_Hash_Sum(plain),
+                "interned String has same hash sum");
+
+    String *again = Str_intern_trusted_utf8("intern_test", 11);
+    TEST_TRUE(runner, again == interned,
+              "intern returns canonical instance");
+    String *self_interned = Str_intern(interned);
+    TEST_TRUE(runner, self_interned == interned,
+              "intern of interned String");
+
+    String *other = Str_intern_trusted_utf8("intern_other", 12);
+    TEST_FALSE(runner, Str_Equals(interned, (Obj*)other),
+               "distinct interned Strings aren't equal");
+    TEST_FALSE(runner, Str_set_intern_capacity(4096),
+               "intern capacity can't change after interning");
+
+    Hash *hash = Hash_new(0);
+    Hash_Store(hash, plain, (Obj*)Str_newf("value"));
+    String *value = (String*)Hash_Fetch(hash, interned);
+    TEST_TRUE(runner, value && Str_Equals_Utf8(value, "value", 5),
+              "Hash_Fetch with interned key");
+    DECREF(hash);
+
+    DECREF(other);
+    DECREF(self_interned);
+    DECREF(again);
+    DECREF(interned);
+    DECREF(plain);
+}
+
+static void
+test_intern_overflow(TestBatchRunner *runner) {
+    // Intern more Strings than the default capacity of the intern table.
+    size_t   num_strings  = 3000;
+    String **strings      = (String**)MALLOCATE(num_strings * sizeof(String*));
+    size_t   num_interned = 0;
+    bool     contents_ok  = true;
+    for (size_t i = 0; i < num_strings; i++) {
+        char buf[32];
+        size_t size = (size_t)sprintf(buf, "overflow_%u", (unsigned)i);
+        strings[i] = Str_intern_trusted_utf8(buf, size);
+        if (Str_Is_Interned(strings[i])) { num_interned++; }
+        if (!Str_Equals_Utf8(strings[i], buf, size)) { contents_ok = false; }
+    }
+    TEST_TRUE(runner, contents_ok, "intern past capacity keeps content");
+    TEST_TRUE(runner, num_interned > 0 && num_interned <= 1024,
+              "number of interned Strings is bounded");
+
+    String *first = Str_intern(strings[0]);
+    TEST_TRUE(runner, first == strings[0],
+              "Strings interned before the table filled up are canonical");
+    DECREF(first);
+
+    Hash *hash = Hash_new(0);
+    for (size_t i = 0; i < num_strings; i++) {
+        Hash_Store(hash, strings[i], (Obj*)Int_new((int64_t)i));
+    }
+    bool fetch_ok = true;
+    for (size_t i = 0; i < num_strings; i++) {
+        String  *key   = Str_newf("overflow_%u32", (uint32_t)i);
+        Integer *value = (Integer*)Hash_Fetch(hash, key);
+        if (!value || Int_Get_Value(value) != (int64_t)i) { fetch_ok = false; }
+        DECREF(key);
+    }
+    TEST_TRUE(runner, fetch_ok,
+              "Hash_Fetch with interned and overflowed keys");
+    DECREF(hash);
+
+    for (size_t i = 0; i < num_strings; i++) {
+        DECREF(strings[i]);
+    }
+    FREEMEM(strings);
+}
+
+static void
+test_init_on_dirty_memory(TestBatchRunner *runner) {
+    // Stack Strings may be initialized on memory that isn't zeroed.  Fill
+    // the memory with an interned String to make sure no stale flags or
+    // hash sums survive.
+    String *interned   = Str_intern_trusted_utf8("dirty_interned", 14);
+    size_t  alloc_size = Class_Get_Obj_Alloc_Size(STRING);
+    void   *allocation = MALLOCATE(alloc_size);
+    memcpy(allocation, interned, alloc_size);
+    String *wrapped
+        = Str_init_wrap_trusted_utf8((String*)allocation, "dirty_key", 9);
+
+    TEST_FALSE(runner, Str_Is_Interned(wrapped),
+               "init on dirty memory clears interned flag");
+    String *plain = Str_newf("dirty_key");
+    TEST_INT_EQ(runner, Str_Hash_Sum(wrapped), Str_Hash_Sum(plain),
+                "init on dirty memory computes hash sum");
+    TEST_TRUE(runner, Str_Equals(wrapped, (Obj*)plain),
+              "init on dirty memory Equals");
+
+    Hash *hash = Hash_new(0);
+    Hash_Store(hash, plain, (Obj*)Str_newf("value"));
+    TEST_TRUE(runner, Hash_Fetch(hash, wrapped) != NULL,
+              "Hash_Fetch with String initialized on dirty memory");
+    DECREF(hash);
+
+    DECREF(plain);
+    FREEMEM(allocation);
+    DECREF(interned);
+}
+
 static void
 test_Clone(TestBatchRunner *runner) {
     String *wanted = S_get_str("foo");
@@ -302,6 +433,296 @@ test_Trim(TestBatchRunner *runner) {
     DECREF(ws_smiley);
 }
 
+// Join the elements of a Vector of Strings with '|'.
+static String*
+S_join(Vector *strings) {
+    CharBuf *buf = CB_new(0);
+    for (size_t i = 0, max = Vec_Get_Size(strings); i < max; i++) {
+        if (i > 0) { CB_Cat_Char(buf, '|'); }
+        CB_Cat(buf, (String*)Vec_Fetch(strings, i));
+    }
+    String *retval = CB_Yield_String(buf);
+    DECREF(buf);
+    return retval;
+}
+
+static bool
+S_split_matches(Vector *pieces, const char *expected) {
+    String *joined = S_join(pieces);
+    bool    result = Str_Equals_Utf8(joined, expected, strlen(expected));
+    DECREF(joined);
+    DECREF(pieces);
+    return result;
+}
+
+static void
+S_split_empty_separator(void *context) {
+    String *string = (String*)context;
+    DECREF(Str_Split(string, SSTR_WRAP_C("")));
+}
+
+static void
+S_split_surrogate(void *context) {
+    DECREF(Str_Split_Char((String*)context, 0xD800));
+}
+
+static void
+S_split_out_of_range(void *context) {
+    DECREF(Str_Split_Char((String*)context, 0x110000));
+}
+
+static void
+test_Split(TestBatchRunner *runner) {
+    String *string    = Str_newf("a, b,, " SMILEY " c, ");
+    String *separator = Str_newf(", ");
+    TEST_TRUE(runner, S_split_matches(Str_Split(string, separator),
+                                      "a|b,|" SMILEY " c|"),
+              "Split");
+    TEST_TRUE(runner, S_split_matches(Str_Split_Char(string, ','),
+                                      "a| b|| " SMILEY " c| "),
+              "Split_Char");
+    TEST_TRUE(runner, S_split_matches(Str_Split_Char(string, smiley_cp),
+                                      "a, b,, | c, "),
+              "Split_Char with non-ASCII character");
+    DECREF(separator);
+    DECREF(string);
+
+    string = Str_newf(" \t foo\xE2\x80\x83" "bar  baz\n");
+    TEST_TRUE(runner, S_split_matches(Str_Split_Whitespace(string),
+                                      "foo|bar|baz"),
+              "Split_Whitespace");
+    DECREF(string);
+
+    string = Str_newf(" \n ");
+    TEST_TRUE(runner, S_split_matches(Str_Split_Whitespace(string), ""),
+              "Split_Whitespace of whitespace only");
+    DECREF(string);
+
+    string = Str_newf("x");
+    Err *error = Err_trap(S_split_empty_separator, string);
+    TEST_TRUE(runner, error != NULL, "Split with empty separator throws");
+    DECREF(error);
+    error = Err_trap(S_split_surrogate, string);
+    TEST_TRUE(runner, error != NULL, "Split_Char with surrogate throws");
+    DECREF(error);
+    error = Err_trap(S_split_out_of_range, string);
+    TEST_TRUE(runner, error != NULL,
+              "Split_Char with code point above U+10FFFF throws");
+    DECREF(error);
+    DECREF(string);
+}
+
+static void
+test_tokenizer(TestBatchRunner *runner) {
+    String *string = Str_newf("foo  bar\t" SMILEY);
+    StringTokenizer *tokenizer = StrTok_new(string, NULL);
+    CharBuf *buf = CB_new(0);
+    String  *piece;
+    while (NULL != (piece = StrTok_Next(tokenizer))) {
+        CB_catf(buf, "<%o>", piece);
+    }
+    String *got = CB_Yield_String(buf);
+    TEST_TRUE(runner, Str_Equals_Utf8(got, "<foo><bar><" SMILEY ">", 15),
+              "tokenize whitespace");
+    DECREF(got);
+
+    StrTok_Reset(tokenizer, string);
+    piece = StrTok_Next(tokenizer);
+    TEST_TRUE(runner, Str_Get_Ptr8(piece) == Str_Get_Ptr8(string),
+              "tokenizer view shares buffer");
+    String *copy = (String*)INCREF(piece);
+    StrTok_Next(tokenizer);
+    TEST_TRUE(runner, Str_Equals_Utf8(copy, "foo", 3),
+              "INCREF of view creates a copy");
+    DECREF(copy);
+    DECREF(tokenizer);
+
+    String *separator = SSTR_WRAP_C(",");
+    String *wrapped   = SSTR_WRAP_C("a,,b");
+    tokenizer = STRTOK_STACK(wrapped, separator);
+    while (NULL != (piece = StrTok_Next(tokenizer))) {
+        CB_catf(buf, "<%o>", piece);
+    }
+    got = CB_Yield_String(buf);
+    TEST_TRUE(runner, Str_Equals_Utf8(got, "<a><><b>", 8),
+              "tokenize with separator on the stack");
+    DECREF(got);
+
+    DECREF(buf);
+    DECREF(string);
+}
+
+static void
+S_encode_invalid(void *context) {
+    UNUSED_VAR(context);
+    int32_t code_points[] = { 'a', 0xD800 };
+    DECREF(Str_encode_from(code_points, 2));
+}
+
+static void
+test_Decode_Into_and_encode_from(TestBatchRunner *runner) {
+    String *string = Str_newf("0123456789abcdefghij" SMILEY
+                              "klmnopqrstuvwxyz0123456789\xC3\xA9!"
+                              "\xF0\x9F\x98\x80");
+    int32_t expected[64];
+    size_t  num_expected = 0;
+    StringIterator *iter = Str_Top(string);
+    int32_t code_point;
+    while (STR_OOB != (code_point = StrIter_Next(iter))) {
+        expected[num_expected++] = code_point;
+    }
+    DECREF(iter);
+
+    int32_t got[64];
+    size_t num = Str_Decode_Into(string, got, 64);
+    TEST_TRUE(runner,
+              num == num_expected
+              && memcmp(got, expected, num * sizeof(int32_t)) == 0,
+              "Decode_Into");
+    TEST_INT_EQ(runner, Str_Decode_Into(string, got, 10), 10,
+                "Decode_Into stops at max");
+
+    iter = Str_Top(string);
+    size_t total = 0;
+    while (0 != (num = StrIter_Next_Batch(iter, got + total, 7))) {
+        total += num;
+    }
+    DECREF(iter);
+    TEST_TRUE(runner,
+              total == num_expected
+              && memcmp(got, expected, total * sizeof(int32_t)) == 0,
+              "Next_Batch");
+
+    size_t hash_sum = 5381;
+    for (size_t i = 0; i < num_expected; i++) {
+        hash_sum = ((hash_sum << 5) + hash_sum) ^ expected[i];
+    }
+    TEST_TRUE(runner, Str_Hash_Sum(string) == hash_sum,
+              "Hash_Sum of decoded code points");
+
+    String *encoded = Str_encode_from(expected, num_expected);
+    TEST_TRUE(runner, Str_Equals(encoded, (Obj*)string), "encode_from");
+    DECREF(encoded);
+
+    encoded = Str_encode_from(expected, 20);
+    TEST_TRUE(runner, Str_Equals_Utf8(encoded, "0123456789abcdefghij", 20),
+              "encode_from ASCII");
+    DECREF(encoded);
+
+    Err *error = Err_trap(S_encode_invalid, NULL);
+    TEST_TRUE(runner, error != NULL,
+              "encode_from with invalid code point throws");
+    DECREF(error);
+
+    DECREF(string);
+}
+
+static void
+S_check_mapping(TestBatchRunner *runner, String *got, const char *expected,
+                const char *label) {
+    TEST_TRUE(runner, Str_Equals_Utf8(got, expected, strlen(expected)),
+              "%s", label);
+    DECREF(got);
+}
+
+static void
+S_check_unchanged(TestBatchRunner *runner, String *string, String *got,
+                  const char *label) {
+    TEST_TRUE(runner, got == string, "%s returns self", label);
+    DECREF(got);
+}
+
+static void
+test_case_mapping(TestBatchRunner *runner) {
+    String *string = Str_newf("Hello World, THIS is A long ASCII text!");
+    S_check_mapping(runner, Str_To_Lower(string),
+                    "hello world, this is a long ascii text!",
+                    "To_Lower ASCII");
+    DECREF(string);
+
+    string = Str_newf("ABCDEFGHIJKLMNOPQRSTUVWXYZ \xC3\x84\xC5\xB8 "
+                      "ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+    S_check_mapping(runner, Str_To_Lower(string),
+                    "abcdefghijklmnopqrstuvwxyz \xC3\xA4\xC3\xBF "
+                    "abcdefghijklmnopqrstuvwxyz",
+                    "To_Lower mixed");
+    DECREF(string);
+
+    string = Str_newf("already lowercase text \xC3\xA9t\xC3\xA9");
+    S_check_unchanged(runner, string, Str_To_Lower(string), "To_Lower");
+    S_check_unchanged(runner, string, Str_Case_Fold(string), "Case_Fold");
+    DECREF(string);
+
+    string = Str_newf("\xC4\xB0stanbul");
+    S_check_mapping(runner, Str_To_Lower(string), "i\xCC\x87stanbul",
+                    "To_Lower expands to multiple code points");
+    DECREF(string);
+
+    string = Str_newf("\xCE\xA3\xCE\x99\xCE\xA3");
+    S_check_mapping(runner, Str_To_Lower(string), "\xCF\x83\xCE\xB9\xCF\x83",
+                    "To_Lower Greek");
+    DECREF(string);
+
+    string = Str_newf("Stra\xC3\x9F" "E");
+    S_check_mapping(runner, Str_To_Lower(string), "stra\xC3\x9F" "e",
+                    "To_Lower keeps sharp s");
+    S_check_mapping(runner, Str_Case_Fold(string), "strasse",
+                    "Case_Fold expands sharp s");
+    DECREF(string);
+}
+
+static void
+test_normalization(TestBatchRunner *runner) {
+    String *string = Str_newf("plain ASCII text");
+    S_check_unchanged(runner, string, Str_To_NFC(string), "To_NFC ASCII");
+    S_check_unchanged(runner, string, Str_To_NFKC(string), "To_NFKC ASCII");
+    DECREF(string);
+
+    string = Str_newf("caf" "e\xCC\x81");
+    S_check_mapping(runner, Str_To_NFC(string), "caf\xC3\xA9",
+                    "To_NFC composes");
+    DECREF(string);
+
+    string = Str_newf("caf\xC3\xA9");
+    S_check_unchanged(runner, string, Str_To_NFC(string), "To_NFC composed");
+    DECREF(string);
+
+    string = Str_newf("\xE2\x84\xAB");
+    S_check_mapping(runner, Str_To_NFC(string), "\xC3\x85",
+                    "To_NFC maps singleton");
+    DECREF(string);
+
+    string = Str_newf("a\xCC\x81\xCC\xA3");
+    S_check_mapping(runner, Str_To_NFC(string), "\xE1\xBA\xA1\xCC\x81",
+                    "To_NFC reorders combining marks");
+    DECREF(string);
+
+    string = Str_newf("\xEF\xAC\x81");
+    S_check_unchanged(runner, string, Str_To_NFC(string),
+                      "To_NFC compatibility character");
+    S_check_mapping(runner, Str_To_NFKC(string), "fi",
+                    "To_NFKC decomposes compatibility character");
+    DECREF(string);
+
+    string = Str_newf("\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8");
+    S_check_mapping(runner, Str_To_NFC(string), "\xEA\xB0\x81",
+                    "To_NFC composes Hangul");
+    DECREF(string);
+
+    string = Str_newf("\xEA\xB0\x81");
+    S_check_unchanged(runner, string, Str_To_NFC(string),
+                      "To_NFC Hangul syllable");
+    DECREF(string);
+
+    string = Str_newf("\xE3\x89\xAE");
+    S_check_mapping(runner, Str_To_NFKC(string), "\xEA\xB0\x80",
+                    "To_NFKC composes decomposed Hangul");
+    DECREF(string);
+
+    TEST_INT_EQ(runner, Unicode_combining_class(0x0301), 230,
+                "combining_class");
+}
+
 static void
 test_To_F64(TestBatchRunner *runner) {
     String *string;
@@ -703,14 +1124,22 @@ test_iterator_substring(TestBatchRunner *runner) {
 
 void
 TestStr_Run_IMP(TestString *self, TestBatchRunner *runner) {
-    TestBatchRunner_Plan(runner, (TestBatch*)self, 139);
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 197);
     test_new(runner);
     test_Cat(runner);
+    test_intern(runner);
+    test_init_on_dirty_memory(runner);
+    test_intern_overflow(runner);
     test_Clone(runner);
     test_Code_Point_At_and_From(runner);
     test_Contains_and_Find(runner);
     test_SubString(runner);
     test_Trim(runner);
+    test_Split(runner);
+    test_tokenizer(runner);
+    test_Decode_Into_and_encode_from(runner);
+    test_case_mapping(runner);
+    test_normalization(runner);
     test_To_F64(runner);
     test_To_I64(runner);
     test_To_String(runner);
@@ -0,0 +1,115 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+
+#define CFISH_USE_SHORT_NAMES
+#define TESTCFISH_USE_SHORT_NAMES
+
+#include "charmony.h"
+
+#include "Clownfish/Test/TestStringBuilder.h"
+
+#include "Clownfish/String.h"
+#include "Clownfish/StringBuilder.h"
+#include "Clownfish/Test.h"
+#include "Clownfish/TestHarness/TestBatchRunner.h"
+#include "Clownfish/Class.h"
+
+TestStringBuilder*
+TestSB_new() {
+    return (TestStringBuilder*)Class_Make_Obj(TESTSTRINGBUILDER);
+}
+
+static void
+test_Cat(TestBatchRunner *runner) {
+    StringBuilder *sb = SB_new(32);
+
+    SB_Cat_Utf8(sb, "foo", 3);
+    SB_Cat_Trusted_Utf8(sb, "bar", 3);
+    SB_Cat_Char(sb, 0x263A);
+    SB_catf(sb, "%i32", (int32_t)42);
+    TEST_INT_EQ(runner, SB_Get_Size(sb), 11, "Get_Size");
+
+    String *big = Str_newf("%s", "0123456789abcdef0123456789abcdef!");
+    SB_Cat(sb, big);
+    SB_Cat(sb, big);
+    TEST_INT_EQ(runner, SB_Get_Num_Chunks(sb), 3,
+                "long Strings are separate chunks");
+    TEST_TRUE(runner, SB_Fetch_Chunk(sb, 1) == big,
+              "long Strings are appended by reference");
+    TEST_TRUE(runner, SB_Fetch_Chunk(sb, 3) == NULL,
+              "Fetch_Chunk out of bounds");
+
+    String *string = SB_To_String(sb);
+    const char expected[] = "foobar\xE2\x98\xBA" "42"
+                            "0123456789abcdef0123456789abcdef!"
+                            "0123456789abcdef0123456789abcdef!";
+    TEST_TRUE(runner, Str_Equals_Utf8(string, expected, sizeof(expected) - 1),
+              "To_String");
+    DECREF(string);
+
+    string = SB_Yield_String(sb);
+    TEST_TRUE(runner, Str_Equals_Utf8(string, expected, sizeof(expected) - 1),
+              "Yield_String");
+    TEST_INT_EQ(runner, SB_Get_Size(sb), 0, "Yield_String clears");
+    DECREF(string);
+
+    SB_Cat(sb, big);
+    string = SB_To_String(sb);
+    TEST_TRUE(runner, string == big, "To_String of single chunk doesn't copy");
+    DECREF(string);
+
+    DECREF(big);
+    DECREF(sb);
+}
+
+static void
+test_chunking(TestBatchRunner *runner) {
+    StringBuilder *sb = SB_new(16);
+
+    for (int i = 0; i < 100; i++) {
+        SB_Cat_Trusted_Utf8(sb, "abc", 3);
+    }
+    size_t num_chunks = SB_Get_Num_Chunks(sb);
+    TEST_TRUE(runner, num_chunks > 1 && num_chunks <= 20,
+              "short text is collected into chunks");
+
+    bool chunks_ok = true;
+    size_t total = 0;
+    for (size_t i = 0; i < num_chunks; i++) {
+        String *chunk = SB_Fetch_Chunk(sb, i);
+        total += Str_Get_Size(chunk);
+        if (Str_Get_Size(chunk) == 0) { chunks_ok = false; }
+    }
+    TEST_TRUE(runner, chunks_ok && total == 300, "chunks cover content");
+
+    SB_Clear(sb);
+    TEST_INT_EQ(runner, SB_Get_Num_Chunks(sb), 0, "Clear");
+    String *string = SB_Yield_String(sb);
+    TEST_INT_EQ(runner, Str_Get_Size(string), 0, "Yield_String when empty");
+    DECREF(string);
+
+    DECREF(sb);
+}
+
+void
+TestSB_Run_IMP(TestStringBuilder *self, TestBatchRunner *runner) {
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 12);
+    test_Cat(runner);
+    test_chunking(runner);
+}
+
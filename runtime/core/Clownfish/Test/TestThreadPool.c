@@ -0,0 +1,244 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define CFISH_USE_SHORT_NAMES
+#define TESTCFISH_USE_SHORT_NAMES
+
+#include "Clownfish/Test/TestThreadPool.h"
+
+#include "Clownfish/Class.h"
+#include "Clownfish/Err.h"
+#include "Clownfish/Num.h"
+#include "Clownfish/String.h"
+#include "Clownfish/Test.h"
+#include "Clownfish/TestHarness/TestBatchRunner.h"
+#include "Clownfish/TestHarness/TestUtils.h"
+#include "Clownfish/ThreadPool.h"
+#include "Clownfish/Util/Memory.h"
+
+#define NUM_THREADS 4
+
+TestThreadPool*
+TestThreadPool_new() {
+    return (TestThreadPool*)Class_Make_Obj(TESTTHREADPOOL);
+}
+
+static Obj*
+S_answer(void *context) {
+    UNUSED_VAR(context);
+    return (Obj*)Int_new(42);
+}
+
+static Obj*
+S_fail(void *context) {
+    UNUSED_VAR(context);
+    THROW(ERR, "task failed");
+    UNREACHABLE_RETURN(Obj*);
+}
+
+// Returns a second reference to an object owned by the submitting thread.
+static Obj*
+S_share(void *context) {
+    return INCREF((Obj*)context);
+}
+
+static void
+S_get_future(void *context) {
+    Obj *result = Future_Get((Future*)context);
+    DECREF(result);
+}
+
+static void
+test_Submit(TestBatchRunner *runner, ThreadPool *pool) {
+    Future *future = ThreadPool_Submit(pool, S_answer, NULL);
+    Obj *result = Future_Get(future);
+    TEST_TRUE(runner, Obj_is_a(result, INTEGER)
+                      && Int_Get_Value((Integer*)result) == 42,
+              "Future_Get returns result of task");
+    TEST_TRUE(runner, Future_Is_Done(future), "Is_Done after Get");
+    DECREF(result);
+    DECREF(future);
+
+    future = ThreadPool_Submit(pool, S_fail, NULL);
+    Err *error = Err_trap(S_get_future, future);
+    TEST_TRUE(runner, error != NULL
+                      && Str_Contains_Utf8(Err_Get_Mess(error), "task failed",
+                                           11),
+              "Future_Get rethrows error of task");
+    DECREF(error);
+    DECREF(future);
+
+    Integer *owned = Int_new(1);
+    future = ThreadPool_Submit(pool, S_share, owned);
+    error = Err_trap(S_get_future, future);
+    TEST_TRUE(runner, error != NULL
+                      && Str_Contains_Utf8(Err_Get_Mess(error), "shared", 6),
+              "shared result of task is rejected");
+    DECREF(error);
+    DECREF(future);
+    DECREF(owned);
+}
+
+static void
+S_square(void *context, size_t start, size_t end) {
+    int64_t *values = (int64_t*)context;
+    for (size_t i = start; i < end; i++) {
+        values[i] = (int64_t)i * (int64_t)i;
+    }
+}
+
+static void
+S_fail_range(void *context, size_t start, size_t end) {
+    UNUSED_VAR(context);
+    if (start <= 500 && 500 < end) {
+        THROW(ERR, "range failed");
+    }
+}
+
+typedef struct {
+    ThreadPool *pool;
+    size_t      start;
+    size_t      end;
+    int64_t    *values;
+} ForArgs;
+
+static void
+S_parallel_for(void *context) {
+    ForArgs *args = (ForArgs*)context;
+    ThreadPool_Parallel_For(args->pool, args->start, args->end,
+                            args->end - args->start, S_fail_range, NULL);
+}
+
+static void
+S_nested(void *context, size_t start, size_t end) {
+    ForArgs *args = (ForArgs*)context;
+    for (size_t i = start; i < end; i++) {
+        ThreadPool_Parallel_For(args->pool, i * 100, (i + 1) * 100, 7,
+                                S_square, args->values);
+    }
+}
+
+static void
+test_Parallel_For(TestBatchRunner *runner, ThreadPool *pool) {
+    size_t   num_values = 10000;
+    int64_t *values     = (int64_t*)CALLOCATE(num_values, sizeof(int64_t));
+
+    ThreadPool_Parallel_For(pool, 0, num_values, 0, S_square, values);
+    bool ok = true;
+    for (size_t i = 0; i < num_values; i++) {
+        if (values[i] != (int64_t)i * (int64_t)i) { ok = false; }
+    }
+    TEST_TRUE(runner, ok, "Parallel_For covers whole range");
+
+    memset(values, 0, num_values * sizeof(int64_t));
+    ForArgs args = { pool, 0, 0, values };
+    ThreadPool_Parallel_For(pool, 0, num_values / 100, 1, S_nested, &args);
+    ok = true;
+    for (size_t i = 0; i < num_values; i++) {
+        if (values[i] != (int64_t)i * (int64_t)i) { ok = false; }
+    }
+    TEST_TRUE(runner, ok, "nested Parallel_For");
+
+    args.start = 0;
+    args.end   = 1000;
+    Err *error = Err_trap(S_parallel_for, &args);
+    TEST_TRUE(runner, error != NULL
+                      && Str_Contains_Utf8(Err_Get_Mess(error), "range failed",
+                                           12),
+              "Parallel_For rethrows error");
+    DECREF(error);
+
+    FREEMEM(values);
+}
+
+static Obj*
+S_sum(void *context, size_t start, size_t end) {
+    UNUSED_VAR(context);
+    int64_t sum = 0;
+    for (size_t i = start; i < end; i++) {
+        sum += (int64_t)i;
+    }
+    return (Obj*)Int_new(sum);
+}
+
+static Obj*
+S_concat(void *context, size_t start, size_t end) {
+    UNUSED_VAR(context);
+    return (Obj*)Str_newf("[%u64,%u64)", (uint64_t)start, (uint64_t)end);
+}
+
+static Obj*
+S_add(void *context, Obj *left, Obj *right) {
+    UNUSED_VAR(context);
+    return (Obj*)Int_new(Int_Get_Value((Integer*)left)
+                         + Int_Get_Value((Integer*)right));
+}
+
+static Obj*
+S_join(void *context, Obj *left, Obj *right) {
+    UNUSED_VAR(context);
+    return (Obj*)Str_Cat((String*)left, (String*)right);
+}
+
+static void
+test_Parallel_Reduce(TestBatchRunner *runner, ThreadPool *pool) {
+    Obj *result = ThreadPool_Parallel_Reduce(pool, 1, 100001, 0, S_sum,
+                                             S_add, NULL);
+    TEST_INT_EQ(runner, Int_Get_Value((Integer*)result), 5000050000,
+                "Parallel_Reduce");
+    DECREF(result);
+
+    result = ThreadPool_Parallel_Reduce(pool, 0, 10, 3, S_concat, S_join,
+                                        NULL);
+    TEST_TRUE(runner, Str_Equals_Utf8((String*)result,
+                                      "[0,3)[3,6)[6,9)[9,10)", 21),
+              "Parallel_Reduce combines chunks in order");
+    DECREF(result);
+
+    result = ThreadPool_Parallel_Reduce(pool, 5, 5, 0, S_sum, S_add, NULL);
+    TEST_TRUE(runner, result == NULL, "Parallel_Reduce of empty range");
+}
+
+static void
+test_Shutdown(TestBatchRunner *runner, ThreadPool *pool) {
+    ThreadPool_Shutdown(pool);
+    TEST_INT_EQ(runner, ThreadPool_Get_Num_Threads(pool), 0,
+                "no threads after Shutdown");
+
+    Future *future = ThreadPool_Submit(pool, S_answer, NULL);
+    TEST_TRUE(runner, Future_Is_Done(future),
+              "task runs immediately after Shutdown");
+    DECREF(future);
+}
+
+void
+TestThreadPool_Run_IMP(TestThreadPool *self, TestBatchRunner *runner) {
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 13);
+
+    ThreadPool *pool = ThreadPool_new(NUM_THREADS);
+    TEST_INT_EQ(runner, ThreadPool_Get_Num_Threads(pool),
+                TestUtils_has_threads ? NUM_THREADS : 0,
+                "Get_Num_Threads");
+
+    test_Submit(runner, pool);
+    test_Parallel_For(runner, pool);
+    test_Parallel_Reduce(runner, pool);
+    test_Shutdown(runner, pool);
+
+    DECREF(pool);
+}
+
+
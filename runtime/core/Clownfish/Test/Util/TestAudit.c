@@ -0,0 +1,105 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define CFISH_USE_SHORT_NAMES
+#define TESTCFISH_USE_SHORT_NAMES
+
+#include "charmony.h"
+
+#include "Clownfish/Test/Util/TestAudit.h"
+
+#include "Clownfish/Class.h"
+#include "Clownfish/Num.h"
+#include "Clownfish/String.h"
+#include "Clownfish/Test.h"
+#include "Clownfish/TestHarness/TestBatchRunner.h"
+#include "Clownfish/Util/Audit.h"
+
+TestAudit*
+TestAudit_new() {
+    return (TestAudit*)Class_Make_Obj(TESTAUDIT);
+}
+
+static void
+test_disabled(TestBatchRunner *runner) {
+    TEST_FALSE(runner, Audit_enabled(), "not enabled");
+    TEST_INT_EQ(runner, Audit_num_leaked(), 0, "no leaks");
+    String *report = Audit_report();
+    TEST_INT_EQ(runner, Str_Get_Size(report), 0, "empty report");
+    DECREF(report);
+    Obj *obj = (Obj*)MAKE_OBJ(TESTAUDIT);
+    TEST_TRUE(runner, Audit_check_refcount(obj, "INCREF"),
+              "check_refcount");
+    DECREF(obj);
+    SKIP(runner, 7, "built without auditing");
+}
+
+static void
+test_enabled(TestBatchRunner *runner) {
+    TEST_TRUE(runner, Audit_enabled(), "enabled");
+
+    Audit_set_baseline();
+    TEST_INT_EQ(runner, Audit_num_leaked(), 0, "set_baseline");
+
+    Obj     *obj     = (Obj*)MAKE_OBJ(TESTAUDIT);
+    Integer *integer = Int_new(42);
+    TEST_INT_EQ(runner, Audit_num_leaked(), 2, "num_leaked");
+
+    String *report = Audit_report();
+    TEST_TRUE(runner,
+              Str_Contains_Utf8(report, "1 Clownfish::Test::Util::TestAudit",
+                                34),
+              "report groups by class");
+    TEST_TRUE(runner, Str_Contains_Utf8(report, "TestAudit.c:", 12),
+              "report contains allocation site");
+    TEST_TRUE(runner, Str_Contains_Utf8(report, "1 Clownfish::Integer", 20),
+              "report contains objects allocated by the runtime");
+    DECREF(report);
+
+    TEST_TRUE(runner, Audit_check_refcount(obj, "INCREF"),
+              "check_refcount on live object");
+
+    uint64_t num_errors = Audit_num_refcount_errors();
+    DECREF(obj);
+    // The object's memory is freed, but check_refcount doesn't access it.
+    bool ok = Audit_check_refcount(obj, "DECREF");
+    TEST_FALSE(runner, ok, "check_refcount on destroyed object");
+    TEST_INT_EQ(runner, Audit_num_refcount_errors(), num_errors + 1,
+                "num_refcount_errors");
+
+    DECREF(integer);
+    TEST_INT_EQ(runner, Audit_num_leaked(), 0, "no leaks after DECREF");
+
+    Obj *excluded = (Obj*)MAKE_OBJ(TESTAUDIT);
+    Audit_exclude(excluded);
+    String *interned = Str_intern_trusted_utf8("audit_interned", 14);
+    TEST_INT_EQ(runner, Audit_num_leaked(), 0,
+                "excluded and interned objects aren't leaks");
+    DECREF(interned);
+    DECREF(excluded);
+}
+
+void
+TestAudit_Run_IMP(TestAudit *self, TestBatchRunner *runner) {
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 11);
+    if (Audit_enabled()) {
+        test_enabled(runner);
+    }
+    else {
+        test_disabled(runner);
+    }
+}
+
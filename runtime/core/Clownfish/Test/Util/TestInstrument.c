@@ -0,0 +1,139 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define CFISH_USE_SHORT_NAMES
+#define TESTCFISH_USE_SHORT_NAMES
+
+#include <stdio.h>
+#include <string.h>
+
+#include "charmony.h"
+
+#include "Clownfish/Test/Util/TestInstrument.h"
+
+#include "Clownfish/Class.h"
+#include "Clownfish/Hash.h"
+#include "Clownfish/Num.h"
+#include "Clownfish/String.h"
+#include "Clownfish/Test.h"
+#include "Clownfish/TestHarness/TestBatchRunner.h"
+#include "Clownfish/Util/Instrument.h"
+
+TestInstrument*
+TestInstrument_new() {
+    return (TestInstrument*)Class_Make_Obj(TESTINSTRUMENT);
+}
+
+static int64_t
+S_class_stat(String *class_name, const char *key) {
+    Hash *stats = Instrument_stats();
+    Hash *class_stats = (Hash*)Hash_Fetch(stats, class_name);
+    int64_t value = 0;
+    if (class_stats) {
+        Integer *integer
+            = (Integer*)Hash_Fetch_Utf8(class_stats, key, strlen(key));
+        if (integer) { value = Int_Get_Value(integer); }
+    }
+    DECREF(stats);
+    return value;
+}
+
+static void
+test_disabled(TestBatchRunner *runner) {
+    TEST_FALSE(runner, Instrument_enabled(), "not enabled");
+    Hash *stats = Instrument_stats();
+    TEST_INT_EQ(runner, Hash_Get_Size(stats), 0, "no stats");
+    DECREF(stats);
+    SKIP(runner, 8, "built without instrumentation");
+}
+
+static void
+test_enabled(TestBatchRunner *runner, TestInstrument *self) {
+    String   *class_name = Class_Get_Name(TESTINSTRUMENT);
+    uint32_t  interval   = Instrument_get_sample_interval();
+
+    TEST_TRUE(runner, Instrument_enabled(), "enabled");
+
+    // Leave a countdown of a larger interval pending, which must not delay
+    // sampling after the interval is changed.
+    Instrument_set_sample_interval(64);
+    Obj_Equals((Obj*)self, (Obj*)self);
+
+    Instrument_reset();
+    Instrument_set_sample_interval(1);
+    int64_t live = S_class_stat(class_name, "live");
+
+    TestInstrument *objs[3];
+    for (int i = 0; i < 3; i++) {
+        objs[i] = TestInstrument_new();
+    }
+    DECREF(objs[0]);
+    TEST_INT_EQ(runner, S_class_stat(class_name, "allocs"), 3, "allocs");
+    TEST_INT_EQ(runner, S_class_stat(class_name, "frees"), 1, "frees");
+    TEST_INT_EQ(runner, S_class_stat(class_name, "live"), live + 2, "live");
+    TEST_INT_EQ(runner, S_class_stat(class_name, "peak_live"), live + 3,
+                "peak_live");
+    DECREF(objs[1]);
+    DECREF(objs[2]);
+
+    for (int i = 0; i < 10; i++) {
+        Obj_Equals((Obj*)self, (Obj*)self);
+    }
+    Hash *stats = Instrument_stats();
+    Hash *class_stats = (Hash*)Hash_Fetch(stats, class_name);
+    Hash *calls = (Hash*)Hash_Fetch_Utf8(class_stats, "calls", 5);
+    Integer *num_calls = (Integer*)Hash_Fetch_Utf8(calls, "Equals", 6);
+    TEST_INT_EQ(runner, num_calls ? Int_Get_Value(num_calls) : 0, 10,
+                "sampled method calls");
+    DECREF(stats);
+
+    String *json = Instrument_to_json();
+    TEST_TRUE(runner,
+              Str_Contains_Utf8(json, "\"Equals\": 10", 12),
+              "to_json");
+    DECREF(json);
+
+    String *profile = Instrument_method_profile();
+    const char expected[]
+        = "10 Clownfish::Test::Util::TestInstrument Equals\n";
+    TEST_TRUE(runner,
+              Str_Contains_Utf8(profile, expected, sizeof(expected) - 1),
+              "method_profile");
+    DECREF(profile);
+
+    const char *path = "_instrument_test.json";
+    TEST_TRUE(runner, Instrument_dump_json(path), "dump_json");
+    remove(path);
+
+    Instrument_reset();
+    TEST_INT_EQ(runner, S_class_stat(class_name, "allocs"), 0,
+                "reset allocs");
+
+    Instrument_set_sample_interval(interval);
+}
+
+void
+TestInstrument_Run_IMP(TestInstrument *self, TestBatchRunner *runner) {
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 10);
+    if (Instrument_enabled()) {
+        test_enabled(runner, self);
+    }
+    else {
+        test_disabled(runner);
+    }
+}
+
+
@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 
+#include <float.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #define CFISH_USE_SHORT_NAMES
@@ -25,6 +28,7 @@
 #include "Clownfish/Err.h"
 #include "Clownfish/Test.h"
 #include "Clownfish/TestHarness/TestBatchRunner.h"
+#include "Clownfish/TestHarness/TestUtils.h"
 #include "Clownfish/Util/StringHelper.h"
 #include "Clownfish/Class.h"
 
@@ -154,6 +158,179 @@ test_to_base36(TestBatchRunner *runner) {
     TEST_INT_EQ(runner, buffer[1], 0, "base36 NULL termination");
 }
 
+static void
+test_format_i64(TestBatchRunner *runner) {
+    char buffer[StrHelp_MAX_I64_BYTES];
+    StrHelp_format_i64(INT64_MIN, buffer);
+    TEST_STR_EQ(runner, "-9223372036854775808", buffer, "format_i64 INT64_MIN");
+    StrHelp_format_i64(INT64_MAX, buffer);
+    TEST_STR_EQ(runner, "9223372036854775807", buffer, "format_i64 INT64_MAX");
+    size_t size = StrHelp_format_i64(-7, buffer);
+    TEST_STR_EQ(runner, "-7", buffer, "format_i64 negative");
+    TEST_INT_EQ(runner, size, 2, "format_i64 returns size");
+    StrHelp_format_u64(UINT64_MAX, buffer);
+    TEST_STR_EQ(runner, "18446744073709551615", buffer,
+                "format_u64 UINT64_MAX");
+    StrHelp_format_u64(0, buffer);
+    TEST_STR_EQ(runner, "0", buffer, "format_u64 zero");
+}
+
+static void
+test_format_f64(TestBatchRunner *runner) {
+    char buffer[StrHelp_MAX_F64_BYTES];
+    StrHelp_format_f64(0.1, buffer);
+    TEST_STR_EQ(runner, "0.1", buffer, "format_f64 0.1");
+    StrHelp_format_f64(0.1 + 0.2, buffer);
+    TEST_STR_EQ(runner, "0.30000000000000004", buffer,
+                "format_f64 uses 17 digits when needed");
+    StrHelp_format_f64(-123.456, buffer);
+    TEST_STR_EQ(runner, "-123.456", buffer, "format_f64 negative");
+    StrHelp_format_f64(1e22, buffer);
+    TEST_STR_EQ(runner, "1e+22", buffer, "format_f64 large");
+    StrHelp_format_f64(1e-7, buffer);
+    TEST_STR_EQ(runner, "1e-07", buffer, "format_f64 small");
+    StrHelp_format_f64(1152921504606846976.0, buffer);
+    TEST_STR_EQ(runner, "1152921504606847000", buffer,
+                "format_f64 large integer");
+    StrHelp_format_f64(-0.0, buffer);
+    TEST_STR_EQ(runner, "-0", buffer, "format_f64 negative zero");
+
+    bool round_trip = true;
+    for (int i = 0; i < 10000; i++) {
+        uint64_t bits = TestUtils_random_u64();
+        double value;
+        if (i % 2) {
+            // Short decimals.
+            value = (double)(int64_t)(bits % 2000001 - 1000000)
+                    / (double)(1 << (bits >> 60));
+        }
+        else {
+            memcpy(&value, &bits, sizeof(value));
+            if (value != value || value - value != 0) { continue; }
+        }
+        size_t size = StrHelp_format_f64(value, buffer);
+        if (strtod(buffer, NULL) != value
+            || StrHelp_parse_f64(buffer, size) != value
+           ) {
+            round_trip = false;
+            break;
+        }
+    }
+    TEST_TRUE(runner, round_trip, "format_f64 round trips");
+}
+
+static void
+test_format_f64_shortest(TestBatchRunner *runner) {
+    char buffer[StrHelp_MAX_F64_BYTES];
+    StrHelp_format_f64(1e21, buffer);
+    TEST_STR_EQ(runner, "1e+21", buffer,
+                "format_f64 scientific above 21 integral digits");
+    StrHelp_format_f64(1e20, buffer);
+    TEST_STR_EQ(runner, "100000000000000000000", buffer,
+                "format_f64 fixed up to 21 integral digits");
+    StrHelp_format_f64(1e-6, buffer);
+    TEST_STR_EQ(runner, "0.000001", buffer,
+                "format_f64 fixed down to 1e-6");
+    StrHelp_format_f64(1.5e-7, buffer);
+    TEST_STR_EQ(runner, "1.5e-07", buffer,
+                "format_f64 scientific below 1e-6");
+    StrHelp_format_f64(5e-324, buffer);
+    TEST_STR_EQ(runner, "5e-324", buffer, "format_f64 smallest denormal");
+    StrHelp_format_f64(DBL_MAX, buffer);
+    TEST_STR_EQ(runner, "1.7976931348623157e+308", buffer,
+                "format_f64 DBL_MAX");
+
+    // Compare the number of significant digits with the lowest precision
+    // of %e which round trips.
+    bool shortest = true;
+    for (int i = 0; i < 10000; i++) {
+        uint64_t bits = TestUtils_random_u64();
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        if (value != value || value - value != 0 || value == 0) { continue; }
+
+        char expected[32];
+        int  precision;
+        for (precision = 1; precision < 17; precision++) {
+            sprintf(expected, "%.*e", precision - 1, value);
+            if (strtod(expected, NULL) == value) { break; }
+        }
+
+        StrHelp_format_f64(value, buffer);
+        int num_digits = 0;
+        int num_zeros  = 0;
+        for (const char *ptr = buffer; *ptr != '\0' && *ptr != 'e'; ptr++) {
+            if (*ptr == '0') {
+                if (num_digits > 0) { num_zeros++; }
+            }
+            else if (*ptr >= '1' && *ptr <= '9') {
+                num_digits += num_zeros + 1;
+                num_zeros = 0;
+            }
+        }
+        if (num_digits != precision) {
+            shortest = false;
+            break;
+        }
+    }
+    TEST_TRUE(runner, shortest, "format_f64 produces shortest digits");
+}
+
+static void
+test_format_f64_g(TestBatchRunner *runner) {
+    static const double values[] = {
+        0.5, 1.3f, 123456.0, 1234567.0, 0.0001, 0.00001, -2.5, 1e300, 100.0,
+        0.1 + 0.2, 999999.0, 0.000123456, 42.0, -0.0, 0.0
+    };
+    bool all_equal = true;
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        char got[StrHelp_MAX_F64_BYTES];
+        char wanted[64];
+        StrHelp_format_f64_g(values[i], got);
+        sprintf(wanted, "%g", values[i]);
+        if (strcmp(got, wanted) != 0) {
+            all_equal = false;
+            break;
+        }
+    }
+    TEST_TRUE(runner, all_equal, "format_f64_g matches %%g");
+}
+
+static void
+test_parse_f64(TestBatchRunner *runner) {
+    static const char *const strings[] = {
+        "1.5", "-1.5", "0.001", "1e10", "1e30", "123456789012345678901234",
+        "1.7976931348623157e308", "4.9e-324", " 1.5", "1.5abc", "inf",
+        "0x10", "-0", "2.2250738585072014e-308", ".5", "5.", "1e", "+3",
+        "9007199254740993", "0.000000000000000000000000001", ""
+    };
+    bool all_equal = true;
+    for (size_t i = 0; i < sizeof(strings) / sizeof(strings[0]); i++) {
+        double got    = StrHelp_parse_f64(strings[i], strlen(strings[i]));
+        double wanted = strtod(strings[i], NULL);
+        if (memcmp(&got, &wanted, sizeof(double)) != 0) {
+            all_equal = false;
+            break;
+        }
+    }
+    TEST_TRUE(runner, all_equal, "parse_f64 matches strtod");
+    TEST_TRUE(runner, StrHelp_parse_f64("1.59", 3) == 1.5,
+              "parse_f64 doesn't read past size");
+}
+
+static void
+test_parse_i64(TestBatchRunner *runner) {
+    TEST_TRUE(runner, StrHelp_parse_i64("-zz", 3, 36) == -1295,
+              "parse_i64 base 36");
+    TEST_TRUE(runner, StrHelp_parse_i64("FFg", 3, 16) == 255,
+              "parse_i64 stops at out-of-range digits");
+    TEST_TRUE(runner, StrHelp_parse_i64("12\xE2\x98\xBA", 5, 10) == 12,
+              "parse_i64 stops at non-ASCII");
+    TEST_TRUE(runner,
+              StrHelp_parse_i64("9223372036854775807", 19, 10) == INT64_MAX,
+              "parse_i64 INT64_MAX");
+}
+
 static void
 test_utf8_round_trip(TestBatchRunner *runner) {
     int32_t code_point;
@@ -285,9 +462,15 @@ test_back_utf8_char(TestBatchRunner *runner) {
 
 void
 TestStrHelp_Run_IMP(TestStringHelper *self, TestBatchRunner *runner) {
-    TestBatchRunner_Plan(runner, (TestBatch*)self, 39);
+    TestBatchRunner_Plan(runner, (TestBatch*)self, 67);
     test_overlap(runner);
     test_to_base36(runner);
+    test_format_i64(runner);
+    test_format_f64(runner);
+    test_format_f64_shortest(runner);
+    test_format_f64_g(runner);
+    test_parse_f64(runner);
+    test_parse_i64(runner);
     test_utf8_round_trip(runner);
     test_utf8_valid(runner);
     test_is_whitespace(runner);
@@ -0,0 +1,741 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define C_CFISH_THREADPOOL
+#define C_CFISH_FUTURE
+#define CFISH_USE_SHORT_NAMES
+
+#include <string.h>
+
+#include "charmony.h"
+
+#include "Clownfish/ThreadPool.h"
+#include "Clownfish/Boolean.h"
+#include "Clownfish/Class.h"
+#include "Clownfish/Err.h"
+#include "Clownfish/String.h"
+#include "Clownfish/TestHarness/TestUtils.h"
+#include "Clownfish/Util/Audit.h"
+#include "Clownfish/Util/Memory.h"
+#include "Clownfish/Util/Mutex.h"
+#include "Clownfish/Util/ThreadLocal.h"
+
+typedef struct Worker Worker;
+
+static void
+S_run_worker(Worker *worker);
+
+/********************************** Windows ********************************/
+#if !defined(CFISH_NOTHREADS) && defined(CHY_HAS_WINDOWS_H)
+
+#include <windows.h>
+
+#define POOL_HAS_THREADS
+
+typedef CONDITION_VARIABLE Cond;
+typedef HANDLE             ThreadHandle;
+
+static void
+S_cond_init(Cond *cond) { InitializeConditionVariable(cond); }
+static void
+S_cond_destroy(Cond *cond) { UNUSED_VAR(cond); }
+static void
+S_cond_wait(Cond *cond, Mutex *mutex) {
+    SleepConditionVariableSRW(cond, (PSRWLOCK)mutex, INFINITE, 0);
+}
+static void
+S_cond_signal(Cond *cond) { WakeConditionVariable(cond); }
+static void
+S_cond_broadcast(Cond *cond) { WakeAllConditionVariable(cond); }
+
+static DWORD __stdcall
+S_thread_main(void *arg) {
+    S_run_worker((Worker*)arg);
+    return 0;
+}
+
+static String*
+S_thread_start(ThreadHandle *handle, Worker *worker) {
+    *handle = CreateThread(NULL, 0, S_thread_main, worker, 0, NULL);
+    if (*handle == NULL) {
+        return Str_newf("CreateThread failed: %s", Err_win_error());
+    }
+    return NULL;
+}
+
+static void
+S_thread_join(ThreadHandle *handle) {
+    WaitForSingleObject(*handle, INFINITE);
+    CloseHandle(*handle);
+}
+
+static uint32_t
+S_num_cpus() {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? info.dwNumberOfProcessors : 1;
+}
+
+/******************************** pthreads *********************************/
+#elif !defined(CFISH_NOTHREADS) && defined(CHY_HAS_PTHREAD_H)
+
+#include <pthread.h>
+#ifdef CHY_HAS_UNISTD_H
+  #include <unistd.h>
+#endif
+
+#define POOL_HAS_THREADS
+
+typedef pthread_cond_t  Cond;
+typedef pthread_t       ThreadHandle;
+
+static void
+S_cond_init(Cond *cond) { pthread_cond_init(cond, NULL); }
+static void
+S_cond_destroy(Cond *cond) { pthread_cond_destroy(cond); }
+static void
+S_cond_wait(Cond *cond, Mutex *mutex) { pthread_cond_wait(cond, mutex); }
+static void
+S_cond_signal(Cond *cond) { pthread_cond_signal(cond); }
+static void
+S_cond_broadcast(Cond *cond) { pthread_cond_broadcast(cond); }
+
+static void*
+S_thread_main(void *arg) {
+    S_run_worker((Worker*)arg);
+    return NULL;
+}
+
+static String*
+S_thread_start(ThreadHandle *handle, Worker *worker) {
+    int err = pthread_create(handle, NULL, S_thread_main, worker);
+    if (err != 0) {
+        return Str_newf("pthread_create failed: %s", strerror(err));
+    }
+    return NULL;
+}
+
+static void
+S_thread_join(ThreadHandle *handle) {
+    pthread_join(*handle, NULL);
+}
+
+static uint32_t
+S_num_cpus() {
+#if defined(CHY_HAS_UNISTD_H) && defined(_SC_NPROCESSORS_ONLN)
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return num_cpus > 0 ? (uint32_t)num_cpus : 1;
+#else
+    return 1;
+#endif
+}
+
+/**************************** No thread support ****************************/
+#else
+
+// Tasks are run immediately, so none of the synchronization functions
+// are ever called.
+
+typedef int Cond;
+typedef int ThreadHandle;
+
+static void
+S_cond_init(Cond *cond) { UNUSED_VAR(cond); }
+static void
+S_cond_destroy(Cond *cond) { UNUSED_VAR(cond); }
+static void
+S_cond_wait(Cond *cond, Mutex *mutex) { UNUSED_VAR(cond); UNUSED_VAR(mutex); }
+static void
+S_cond_signal(Cond *cond) { UNUSED_VAR(cond); }
+static void
+S_cond_broadcast(Cond *cond) { UNUSED_VAR(cond); }
+
+static String*
+S_thread_start(ThreadHandle *handle, Worker *worker) {
+    UNUSED_VAR(handle);
+    UNUSED_VAR(worker);
+    return Str_newf("No thread support");
+}
+
+static void
+S_thread_join(ThreadHandle *handle) { UNUSED_VAR(handle); }
+
+static uint32_t
+S_num_cpus() {
+    return 0;
+}
+
+#endif
+
+/***************************************************************************/
+
+typedef struct Task {
+    Err_Attempt_t   routine;
+    void           *context;
+    size_t         *remaining;
+    Err           **error;
+} Task;
+
+// Double-ended queue of tasks. The owning worker pushes and pops at the
+// tail, other threads steal from the head.
+typedef struct Deque {
+    Mutex    mutex;
+    Task   **tasks;
+    size_t   head;
+    size_t   tail;
+    size_t   cap;
+} Deque;
+
+struct Worker {
+    ThreadPoolState *state;
+    uint32_t         index;
+    void            *runtime;
+    ThreadHandle     thread;
+};
+
+struct cfish_ThreadPoolState {
+    // The mutex protects all members except the deques which have their
+    // own locks.
+    Mutex     mutex;
+    Cond      work_cond;
+    Cond      done_cond;
+    uint64_t  epoch;
+    uint32_t  next_deque;
+    uint32_t  num_helpers;
+    bool      stopping;
+    uint32_t  num_deques;
+    uint32_t  num_started;
+    Deque    *deques;
+    Worker   *workers;
+};
+
+#if defined(POOL_HAS_THREADS) && defined(CFISH_HAS_THREAD_LOCAL)
+
+static CFISH_THREAD_LOCAL Worker *S_current_worker;
+
+static Worker*
+S_get_current_worker() {
+    return S_current_worker;
+}
+
+static void
+S_set_current_worker(Worker *worker) {
+    S_current_worker = worker;
+}
+
+#else
+
+// Without fast thread-local storage, tasks submitted from a worker are
+// distributed like tasks from other threads.
+
+static Worker*
+S_get_current_worker() {
+    return NULL;
+}
+
+static void
+S_set_current_worker(Worker *worker) {
+    UNUSED_VAR(worker);
+}
+
+#endif
+
+static void
+S_deque_push(Deque *deque, Task *task) {
+    Mutex_lock(&deque->mutex);
+    if (deque->tail == deque->cap) {
+        if (deque->head > 0) {
+            size_t size = deque->tail - deque->head;
+            memmove(deque->tasks, deque->tasks + deque->head,
+                    size * sizeof(Task*));
+            deque->head = 0;
+            deque->tail = size;
+        }
+        else {
+            deque->cap   = deque->cap ? deque->cap * 2 : 16;
+            deque->tasks = (Task**)REALLOCATE(deque->tasks,
+                                              deque->cap * sizeof(Task*));
+        }
+    }
+    deque->tasks[deque->tail++] = task;
+    Mutex_unlock(&deque->mutex);
+}
+
+static Task*
+S_deque_pop(Deque *deque) {
+    Task *task = NULL;
+    Mutex_lock(&deque->mutex);
+    if (deque->tail > deque->head) {
+        task = deque->tasks[--deque->tail];
+        if (deque->tail == deque->head) {
+            deque->head = deque->tail = 0;
+        }
+    }
+    Mutex_unlock(&deque->mutex);
+    return task;
+}
+
+static Task*
+S_deque_steal(Deque *deque) {
+    Task *task = NULL;
+    Mutex_lock(&deque->mutex);
+    if (deque->tail > deque->head) {
+        task = deque->tasks[deque->head++];
+        if (deque->tail == deque->head) {
+            deque->head = deque->tail = 0;
+        }
+    }
+    Mutex_unlock(&deque->mutex);
+    return task;
+}
+
+// Pop a task from the current worker's deque or steal one from another
+// deque.
+static Task*
+S_take_task(ThreadPoolState *state, Worker *worker) {
+    uint32_t num_deques = state->num_deques;
+    uint32_t first      = 0;
+
+    if (worker && worker->state == state) {
+        Task *task = S_deque_pop(&state->deques[worker->index]);
+        if (task) { return task; }
+        first = worker->index + 1;
+    }
+
+    for (uint32_t i = 0; i < num_deques; i++) {
+        Task *task = S_deque_steal(&state->deques[(first + i) % num_deques]);
+        if (task) { return task; }
+    }
+
+    return NULL;
+}
+
+static void
+S_finish(ThreadPoolState *state, size_t *remaining, Err **error_ptr,
+         Err *error) {
+    Mutex_lock(&state->mutex);
+    if (error && *error_ptr == NULL) {
+        *error_ptr = error;
+        error = NULL;
+    }
+    *remaining -= 1;
+    S_cond_broadcast(&state->done_cond);
+    Mutex_unlock(&state->mutex);
+
+    // Only the first error is reported.
+    DECREF(error);
+}
+
+static void
+S_run_task(ThreadPoolState *state, Task *task) {
+    Err *error = Err_trap(task->routine, task->context);
+    S_finish(state, task->remaining, task->error, error);
+    FREEMEM(task);
+}
+
+static void
+S_schedule(ThreadPoolState *state, Err_Attempt_t routine, void *context,
+           size_t *remaining, Err **error_ptr) {
+    Worker *worker = S_get_current_worker();
+
+    Mutex_lock(&state->mutex);
+    if (state->num_started == 0) {
+        Mutex_unlock(&state->mutex);
+        Err *error = Err_trap(routine, context);
+        S_finish(state, remaining, error_ptr, error);
+        return;
+    }
+
+    Task *task = (Task*)MALLOCATE(sizeof(Task));
+    task->routine   = routine;
+    task->context   = context;
+    task->remaining = remaining;
+    task->error     = error_ptr;
+
+    uint32_t index = worker && worker->state == state
+                     ? worker->index
+                     : state->next_deque++ % state->num_deques;
+    S_deque_push(&state->deques[index], task);
+    state->epoch++;
+    S_cond_signal(&state->work_cond);
+    if (state->num_helpers) {
+        S_cond_broadcast(&state->done_cond);
+    }
+    Mutex_unlock(&state->mutex);
+}
+
+// Wait until `*remaining` drops to zero, running pending tasks in the
+// meantime.
+static void
+S_wait(ThreadPoolState *state, size_t *remaining) {
+    Worker *worker = S_get_current_worker();
+
+    while (true) {
+        Mutex_lock(&state->mutex);
+        uint64_t epoch = state->epoch;
+        bool     done  = *remaining == 0;
+        Mutex_unlock(&state->mutex);
+        if (done) { return; }
+
+        Task *task = S_take_task(state, worker);
+        if (task) {
+            S_run_task(state, task);
+            continue;
+        }
+
+        Mutex_lock(&state->mutex);
+        state->num_helpers++;
+        while (*remaining != 0 && state->epoch == epoch) {
+            S_cond_wait(&state->done_cond, &state->mutex);
+        }
+        state->num_helpers--;
+        Mutex_unlock(&state->mutex);
+    }
+}
+
+static void
+S_run_worker(Worker *worker) {
+    ThreadPoolState *state = worker->state;
+
+    if (worker->runtime) {
+        TestUtils_set_host_runtime(worker->runtime);
+    }
+    S_set_current_worker(worker);
+
+    while (true) {
+        Mutex_lock(&state->mutex);
+        uint64_t epoch = state->epoch;
+        Mutex_unlock(&state->mutex);
+
+        Task *task = S_take_task(state, worker);
+        if (task) {
+            S_run_task(state, task);
+            continue;
+        }
+
+        Mutex_lock(&state->mutex);
+        while (state->epoch == epoch && !state->stopping) {
+            S_cond_wait(&state->work_cond, &state->mutex);
+        }
+        bool stop = state->stopping && state->epoch == epoch;
+        Mutex_unlock(&state->mutex);
+        if (stop) { break; }
+    }
+
+    S_set_current_worker(NULL);
+}
+
+/***************************************************************************/
+
+ThreadPool*
+ThreadPool_new(uint32_t num_threads) {
+    ThreadPool *self = (ThreadPool*)MAKE_OBJ(THREADPOOL);
+    return ThreadPool_init(self, num_threads);
+}
+
+ThreadPool*
+ThreadPool_init(ThreadPool *self, uint32_t num_threads) {
+    ThreadPoolState *state
+        = (ThreadPoolState*)CALLOCATE(1, sizeof(ThreadPoolState));
+    Mutex_init(&state->mutex);
+    S_cond_init(&state->work_cond);
+    S_cond_init(&state->done_cond);
+    self->state       = state;
+    self->num_threads = 0;
+
+#ifdef POOL_HAS_THREADS
+    if (num_threads == 0) {
+        num_threads = S_num_cpus();
+    }
+#else
+    num_threads = 0;
+#endif
+    if (num_threads == 0) {
+        return self;
+    }
+
+    state->num_deques = num_threads;
+    state->deques     = (Deque*)CALLOCATE(num_threads, sizeof(Deque));
+    state->workers    = (Worker*)CALLOCATE(num_threads, sizeof(Worker));
+    for (uint32_t i = 0; i < num_threads; i++) {
+        Mutex_init(&state->deques[i].mutex);
+    }
+
+    for (uint32_t i = 0; i < num_threads; i++) {
+        Worker *worker = &state->workers[i];
+        worker->state   = state;
+        worker->index   = i;
+        worker->runtime = TestUtils_clone_host_runtime();
+
+        String *mess = S_thread_start(&worker->thread, worker);
+        if (mess) {
+            if (worker->runtime) {
+                TestUtils_destroy_host_runtime(worker->runtime);
+            }
+            DECREF(self);
+            Err_throw_mess(ERR, mess);
+        }
+
+        Mutex_lock(&state->mutex);
+        state->num_started++;
+        Mutex_unlock(&state->mutex);
+        self->num_threads++;
+    }
+
+    return self;
+}
+
+uint32_t
+ThreadPool_Get_Num_Threads_IMP(ThreadPool *self) {
+    return self->num_threads;
+}
+
+Future*
+ThreadPool_Submit_IMP(ThreadPool *self, ThreadPool_Task_t task,
+                      void *context) {
+    return Future_new(self, task, context);
+}
+
+typedef struct {
+    ThreadPool_For_t  routine;
+    ThreadPool_Map_t  map;
+    void             *context;
+    size_t            start;
+    size_t            end;
+    Obj              *value;
+} Chunk;
+
+static void
+S_run_for_chunk(void *context) {
+    Chunk *chunk = (Chunk*)context;
+    chunk->routine(chunk->context, chunk->start, chunk->end);
+}
+
+// Results of tasks are handed over to the waiting thread.  Refcounts aren't
+// atomic, so this is only safe if the task holds the sole reference.
+// Immortal objects are exempt.
+static void
+S_check_result(Obj *result) {
+    if (result == NULL
+        || Obj_is_a(result, BOOLEAN)
+        || (Obj_is_a(result, STRING) && Str_Is_Interned((String*)result))
+       ) {
+        return;
+    }
+    if (REFCOUNT_NN(result) != 1) {
+        THROW(ERR, "Result of task is shared with other objects: %o",
+              Obj_get_class_name(result));
+    }
+}
+
+static void
+S_run_map_chunk(void *context) {
+    Chunk *chunk = (Chunk*)context;
+    chunk->value = chunk->map(chunk->context, chunk->start, chunk->end);
+    S_check_result(chunk->value);
+}
+
+// Split a range into chunks and run them in parallel.
+static Chunk*
+S_run_chunks(ThreadPool *self, size_t start, size_t end, size_t grain,
+             ThreadPool_For_t routine, ThreadPool_Map_t map, void *context,
+             size_t *num_chunks_ptr, Err **error_ptr) {
+    size_t size = end - start;
+    if (grain == 0) {
+        size_t target = self->num_threads ? self->num_threads * 4 : 1;
+        grain = (size - 1) / target + 1;
+    }
+    size_t num_chunks = (size - 1) / grain + 1;
+
+    Chunk *chunks = (Chunk*)CALLOCATE(num_chunks, sizeof(Chunk));
+    size_t remaining = num_chunks;
+    for (size_t i = 0; i < num_chunks; i++) {
+        Chunk *chunk = &chunks[i];
+        chunk->routine = routine;
+        chunk->map     = map;
+        chunk->context = context;
+        chunk->start   = start + i * grain;
+        chunk->end     = end - chunk->start > grain
+                         ? chunk->start + grain
+                         : end;
+        S_schedule(self->state, routine ? S_run_for_chunk : S_run_map_chunk,
+                   chunk, &remaining, error_ptr);
+    }
+    S_wait(self->state, &remaining);
+
+    *num_chunks_ptr = num_chunks;
+    return chunks;
+}
+
+void
+ThreadPool_Parallel_For_IMP(ThreadPool *self, size_t start, size_t end,
+                            size_t grain, ThreadPool_For_t routine,
+                            void *context) {
+    if (end <= start) { return; }
+
+    size_t  num_chunks = 0;
+    Err    *error      = NULL;
+    Chunk  *chunks     = S_run_chunks(self, start, end, grain, routine, NULL,
+                                      context, &num_chunks, &error);
+    FREEMEM(chunks);
+
+    if (error) {
+        RETHROW(error);
+    }
+}
+
+Obj*
+ThreadPool_Parallel_Reduce_IMP(ThreadPool *self, size_t start, size_t end,
+                               size_t grain, ThreadPool_Map_t map,
+                               ThreadPool_Reduce_t reduce, void *context) {
+    if (end <= start) { return NULL; }
+
+    size_t  num_chunks = 0;
+    Err    *error      = NULL;
+    Chunk  *chunks     = S_run_chunks(self, start, end, grain, NULL, map,
+                                      context, &num_chunks, &error);
+
+    Obj *result = NULL;
+    if (!error) {
+        result = chunks[0].value;
+        chunks[0].value = NULL;
+        for (size_t i = 1; i < num_chunks; i++) {
+            Obj *combined = reduce(context, result, chunks[i].value);
+            DECREF(result);
+            result = combined;
+        }
+    }
+
+    for (size_t i = 0; i < num_chunks; i++) {
+        DECREF(chunks[i].value);
+    }
+    FREEMEM(chunks);
+
+    if (error) {
+        RETHROW(error);
+    }
+    return result;
+}
+
+void
+ThreadPool_Shutdown_IMP(ThreadPool *self) {
+    ThreadPoolState *state = self->state;
+
+    // Tasks scheduled from now on run in the calling thread, so the deques
+    // can be released once the workers have drained them.
+    Mutex_lock(&state->mutex);
+    uint32_t num_started = state->num_started;
+    state->num_started = 0;
+    state->stopping    = num_started != 0;
+    S_cond_broadcast(&state->work_cond);
+    Mutex_unlock(&state->mutex);
+    if (num_started == 0) { return; }
+
+    for (uint32_t i = 0; i < num_started; i++) {
+        Worker *worker = &state->workers[i];
+        S_thread_join(&worker->thread);
+        if (worker->runtime) {
+            TestUtils_destroy_host_runtime(worker->runtime);
+        }
+    }
+
+    for (uint32_t i = 0; i < state->num_deques; i++) {
+        Mutex_destroy(&state->deques[i].mutex);
+        FREEMEM(state->deques[i].tasks);
+    }
+    FREEMEM(state->deques);
+    FREEMEM(state->workers);
+    Mutex_lock(&state->mutex);
+    state->deques     = NULL;
+    state->workers    = NULL;
+    state->num_deques = 0;
+    state->stopping   = false;
+    Mutex_unlock(&state->mutex);
+    self->num_threads = 0;
+}
+
+void
+ThreadPool_Destroy_IMP(ThreadPool *self) {
+    ThreadPoolState *state = self->state;
+    ThreadPool_Shutdown(self);
+    S_cond_destroy(&state->work_cond);
+    S_cond_destroy(&state->done_cond);
+    Mutex_destroy(&state->mutex);
+    FREEMEM(state);
+    SUPER_DESTROY(self, THREADPOOL);
+}
+
+/***************************************************************************/
+
+static void
+S_run_future(void *context) {
+    Future *self = (Future*)context;
+    self->result = self->task(self->context);
+    // A shared result is still released by the Future in its owning thread.
+    S_check_result(self->result);
+}
+
+Future*
+Future_new(ThreadPool *pool, ThreadPool_Task_t task, void *context) {
+    Future *self = (Future*)MAKE_OBJ(FUTURE);
+    return Future_init(self, pool, task, context);
+}
+
+Future*
+Future_init(Future *self, ThreadPool *pool, ThreadPool_Task_t task,
+            void *context) {
+    self->pool      = (ThreadPool*)INCREF(pool);
+    self->task      = task;
+    self->context   = context;
+    self->result    = NULL;
+    self->error     = NULL;
+    self->remaining = 1;
+    S_schedule(pool->state, S_run_future, self, &self->remaining,
+               &self->error);
+    return self;
+}
+
+bool
+Future_Is_Done_IMP(Future *self) {
+    ThreadPoolState *state = self->pool->state;
+    Mutex_lock(&state->mutex);
+    bool done = self->remaining == 0;
+    Mutex_unlock(&state->mutex);
+    return done;
+}
+
+void
+Future_Wait_IMP(Future *self) {
+    S_wait(self->pool->state, &self->remaining);
+}
+
+Obj*
+Future_Get_IMP(Future *self) {
+    S_wait(self->pool->state, &self->remaining);
+    if (self->error) {
+        RETHROW(INCREF(self->error));
+    }
+    return INCREF(self->result);
+}
+
+void
+Future_Destroy_IMP(Future *self) {
+    S_wait(self->pool->state, &self->remaining);
+    DECREF(self->result);
+    DECREF(self->error);
+    DECREF(self->pool);
+    SUPER_DESTROY(self, FUTURE);
+}
@@ -0,0 +1,515 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define C_CFISH_OBJ
+#define C_CFISH_CLASS
+#define CFISH_USE_SHORT_NAMES
+
+#include "charmony.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(CFISH_AUDIT) && defined(CHY_HAS_BACKTRACE)
+  #include <execinfo.h>
+  #define AUDIT_HAS_BACKTRACE
+#endif
+
+#include "Clownfish/Util/Audit.h"
+#include "Clownfish/CharBuf.h"
+#include "Clownfish/Class.h"
+#include "Clownfish/PtrHash.h"
+#include "Clownfish/String.h"
+#include "Clownfish/Util/Atomic.h"
+#include "Clownfish/Util/Memory.h"
+#include "Clownfish/Util/Mutex.h"
+
+#ifdef CFISH_AUDIT
+
+#define NUM_SHARDS        16
+#define NUM_SITE_BUCKETS  256
+#define MAX_FRAMES        8
+/* Frames of record_alloc and Class_Make_Obj which aren't worth reporting. */
+#define SKIP_FRAMES       2
+
+/* Values in the object tables are tagged pointers.  Live objects map to
+ * their AuditSite, destroyed objects to their Class with FLAG_DESTROYED
+ * set.  Both are at least pointer-aligned, leaving the low bits free.
+ */
+#define FLAG_DESTROYED  ((uintptr_t)1)
+#define FLAG_BASELINE   ((uintptr_t)2)
+#define FLAG_MASK       ((uintptr_t)3)
+
+typedef struct AuditSite {
+    struct AuditSite *next;
+    const char       *file;
+    int               line;
+    int               num_frames;
+    void             *frames[MAX_FRAMES];
+} AuditSite;
+
+/* Objects are distributed over several independently locked tables to
+ * reduce contention between threads.
+ */
+typedef struct AuditShard {
+    Mutex     mutex;
+    PtrHash  *objects;
+    uint64_t  num_refcount_errors;
+} AuditShard;
+
+typedef struct AuditState {
+    AuditShard  shards[NUM_SHARDS];
+    Mutex       site_mutex;
+    AuditSite  *sites[NUM_SITE_BUCKETS];
+    bool        capture_backtraces;
+} AuditState;
+
+typedef struct LeakEntry {
+    Class     *klass;
+    AuditSite *site;
+} LeakEntry;
+
+typedef struct LeakList {
+    LeakEntry *entries;
+    size_t     num_entries;
+    size_t     cap;
+} LeakList;
+
+static AuditState *volatile audit_state = NULL;
+
+/* Site of objects allocated without CFISH_MAKE_OBJ. */
+static AuditSite unknown_site;
+
+/* Marks addresses of destroyed objects which were reused by
+ * Class_Init_Obj.  Such entries are ignored.
+ */
+static AuditSite untracked_site;
+
+static void
+S_report_at_exit(void);
+
+static AuditState*
+S_create_state() {
+    AuditState *state = (AuditState*)CALLOCATE(1, sizeof(AuditState));
+    for (size_t i = 0; i < NUM_SHARDS; i++) {
+        Mutex_init(&state->shards[i].mutex);
+        state->shards[i].objects = PtrHash_new(0);
+    }
+    Mutex_init(&state->site_mutex);
+#ifdef AUDIT_HAS_BACKTRACE
+    state->capture_backtraces = getenv("CFISH_AUDIT_BACKTRACE") != NULL;
+#endif
+
+    if (!Atomic_cas_ptr((void*volatile*)&audit_state, NULL, state)) {
+        // Another thread won the race.
+        for (size_t i = 0; i < NUM_SHARDS; i++) {
+            Mutex_destroy(&state->shards[i].mutex);
+            PtrHash_Destroy(state->shards[i].objects);
+        }
+        Mutex_destroy(&state->site_mutex);
+        FREEMEM(state);
+        return audit_state;
+    }
+
+    atexit(S_report_at_exit);
+    return state;
+}
+
+static CFISH_INLINE AuditState*
+SI_get_state() {
+    AuditState *state = audit_state;
+    return state ? state : S_create_state();
+}
+
+static CFISH_INLINE AuditShard*
+SI_get_shard(AuditState *state, void *ptr) {
+    // Skip the low bits which are zero because of alignment.
+    size_t index = ((uintptr_t)ptr >> 4) & (NUM_SHARDS - 1);
+    return &state->shards[index];
+}
+
+static CFISH_INLINE AuditSite*
+SI_site_from_value(void *value) {
+    return (AuditSite*)((uintptr_t)value & ~FLAG_MASK);
+}
+
+static AuditSite*
+S_intern_site(AuditState *state, const char *file, int line,
+              void **frames, int num_frames) {
+    size_t hash = (size_t)line;
+    if (file) {
+        for (const char *ptr = file; *ptr; ptr++) {
+            hash = hash * 33 + (unsigned char)*ptr;
+        }
+    }
+    for (int i = 0; i < num_frames; i++) {
+        hash = hash * 31 + ((uintptr_t)frames[i] >> 2);
+    }
+    size_t bucket = hash % NUM_SITE_BUCKETS;
+    size_t frames_size = (size_t)num_frames * sizeof(void*);
+
+    Mutex_lock(&state->site_mutex);
+
+    AuditSite *site = state->sites[bucket];
+    for (; site; site = site->next) {
+        if (site->line == line
+            && site->num_frames == num_frames
+            && (site->file == file
+                || (site->file && file && strcmp(site->file, file) == 0))
+            && memcmp(site->frames, frames, frames_size) == 0
+           ) {
+            break;
+        }
+    }
+
+    if (!site) {
+        // Sites are never freed.
+        site = (AuditSite*)CALLOCATE(1, sizeof(AuditSite));
+        site->file       = file;
+        site->line       = line;
+        site->num_frames = num_frames;
+        memcpy(site->frames, frames, frames_size);
+        site->next = state->sites[bucket];
+        state->sites[bucket] = site;
+    }
+
+    Mutex_unlock(&state->site_mutex);
+
+    return site;
+}
+
+static AuditSite*
+S_capture_site(AuditState *state) {
+#ifdef AUDIT_HAS_BACKTRACE
+    if (state->capture_backtraces) {
+        void *frames[MAX_FRAMES + SKIP_FRAMES];
+        int num_frames = backtrace(frames, MAX_FRAMES + SKIP_FRAMES);
+        if (num_frames > SKIP_FRAMES) {
+            return S_intern_site(state, NULL, 0, frames + SKIP_FRAMES,
+                                 num_frames - SKIP_FRAMES);
+        }
+    }
+#else
+    UNUSED_VAR(state);
+#endif
+    return &unknown_site;
+}
+
+static void
+S_set_baseline(void *key, void **value, void *context) {
+    UNUSED_VAR(key);
+    UNUSED_VAR(context);
+    if (!((uintptr_t)*value & FLAG_DESTROYED)) {
+        *value = (void*)((uintptr_t)*value | FLAG_BASELINE);
+    }
+}
+
+static void
+S_collect_leak(void *key, void **value, void *context) {
+    if ((uintptr_t)*value & (FLAG_DESTROYED | FLAG_BASELINE)) { return; }
+    AuditSite *site = SI_site_from_value(*value);
+    if (site == &untracked_site) { return; }
+
+    // Only raw memory is allocated here, so no new objects are recorded
+    // while the shard is locked.
+    LeakList *list = (LeakList*)context;
+    if (list->num_entries == list->cap) {
+        list->cap = list->cap ? list->cap * 2 : 64;
+        list->entries = (LeakEntry*)REALLOCATE(
+                            list->entries, list->cap * sizeof(LeakEntry));
+    }
+    LeakEntry *entry = &list->entries[list->num_entries++];
+    entry->klass = ((Obj*)key)->klass;
+    entry->site  = site;
+}
+
+static void
+S_collect_leaks(AuditState *state, LeakList *list) {
+    list->entries     = NULL;
+    list->num_entries = 0;
+    list->cap         = 0;
+    for (size_t i = 0; i < NUM_SHARDS; i++) {
+        AuditShard *shard = &state->shards[i];
+        Mutex_lock(&shard->mutex);
+        PtrHash_Iterate(shard->objects, S_collect_leak, list);
+        Mutex_unlock(&shard->mutex);
+    }
+}
+
+static int
+S_compare_sites(AuditSite *a, AuditSite *b) {
+    if (a == b) { return 0; }
+    if (a->file != b->file) {
+        if (!a->file) { return -1; }
+        if (!b->file) { return 1; }
+        int comparison = strcmp(a->file, b->file);
+        if (comparison != 0) { return comparison; }
+    }
+    if (a->line != b->line) { return a->line < b->line ? -1 : 1; }
+    return (uintptr_t)a < (uintptr_t)b ? -1 : 1;
+}
+
+static int
+S_compare_leaks(const void *va, const void *vb) {
+    const LeakEntry *a = (const LeakEntry*)va;
+    const LeakEntry *b = (const LeakEntry*)vb;
+    if (a->klass != b->klass) {
+        int comparison = Str_Compare_To(a->klass->name, (Obj*)b->klass->name);
+        if (comparison != 0) { return comparison; }
+        return (uintptr_t)a->klass < (uintptr_t)b->klass ? -1 : 1;
+    }
+    return S_compare_sites(a->site, b->site);
+}
+
+static void
+S_cat_site(CharBuf *buf, AuditSite *site) {
+    if (site->file) {
+        CB_catf(buf, "%s:%i32\n", site->file, (int32_t)site->line);
+    }
+    else {
+        CB_catf(buf, "unknown site\n");
+    }
+#ifdef AUDIT_HAS_BACKTRACE
+    if (site->num_frames) {
+        char **symbols = backtrace_symbols(site->frames, site->num_frames);
+        if (symbols) {
+            for (int i = 0; i < site->num_frames; i++) {
+                CB_catf(buf, "            %s\n", symbols[i]);
+            }
+            free(symbols);
+        }
+    }
+#endif
+}
+
+static void
+S_report_at_exit() {
+    String *report = Audit_report();
+    size_t  size   = Str_Get_Size(report);
+    if (size) {
+        fwrite(Str_Get_Ptr8(report), 1, size, stderr);
+    }
+    DECREF(report);
+}
+
+#endif /* CFISH_AUDIT */
+
+bool
+Audit_enabled() {
+#ifdef CFISH_AUDIT
+    return true;
+#else
+    return false;
+#endif
+}
+
+void
+Audit_set_baseline() {
+#ifdef CFISH_AUDIT
+    AuditState *state = SI_get_state();
+    for (size_t i = 0; i < NUM_SHARDS; i++) {
+        AuditShard *shard = &state->shards[i];
+        Mutex_lock(&shard->mutex);
+        PtrHash_Iterate(shard->objects, S_set_baseline, NULL);
+        Mutex_unlock(&shard->mutex);
+    }
+#endif
+}
+
+void
+Audit_exclude(Obj *obj) {
+#ifdef CFISH_AUDIT
+    AuditShard *shard = SI_get_shard(SI_get_state(), obj);
+    Mutex_lock(&shard->mutex);
+    uintptr_t value = (uintptr_t)PtrHash_Fetch(shard->objects, obj);
+    if (value && !(value & FLAG_DESTROYED)) {
+        PtrHash_Store(shard->objects, obj, (void*)(value | FLAG_BASELINE));
+    }
+    Mutex_unlock(&shard->mutex);
+#else
+    UNUSED_VAR(obj);
+#endif
+}
+
+uint64_t
+Audit_num_leaked() {
+#ifdef CFISH_AUDIT
+    LeakList list;
+    S_collect_leaks(SI_get_state(), &list);
+    FREEMEM(list.entries);
+    return list.num_entries;
+#else
+    return 0;
+#endif
+}
+
+String*
+Audit_report() {
+#ifdef CFISH_AUDIT
+    LeakList list;
+    S_collect_leaks(SI_get_state(), &list);
+    if (list.num_entries == 0) {
+        FREEMEM(list.entries);
+        return Str_new_from_trusted_utf8("", 0);
+    }
+
+    qsort(list.entries, list.num_entries, sizeof(LeakEntry), S_compare_leaks);
+
+    CharBuf *buf = CB_new(0);
+    CB_catf(buf, "Clownfish audit: %u64 leaked objects\n",
+            (uint64_t)list.num_entries);
+
+    size_t i = 0;
+    while (i < list.num_entries) {
+        Class *klass = list.entries[i].klass;
+        size_t class_end = i;
+        while (class_end < list.num_entries
+               && list.entries[class_end].klass == klass
+              ) {
+            class_end++;
+        }
+        CB_catf(buf, "  %u64 %o\n", (uint64_t)(class_end - i), klass->name);
+
+        while (i < class_end) {
+            AuditSite *site = list.entries[i].site;
+            size_t site_end = i;
+            while (site_end < class_end && list.entries[site_end].site == site) {
+                site_end++;
+            }
+            CB_catf(buf, "    %u64 allocated at ", (uint64_t)(site_end - i));
+            S_cat_site(buf, site);
+            i = site_end;
+        }
+    }
+
+    FREEMEM(list.entries);
+    String *report = CB_Yield_String(buf);
+    DECREF(buf);
+    return report;
+#else
+    return Str_new_from_trusted_utf8("", 0);
+#endif
+}
+
+Obj*
+Audit_make_obj(Class *klass, const char *file, int line) {
+    Obj *obj = Class_Make_Obj(klass);
+#ifdef CFISH_AUDIT
+    AuditState *state = SI_get_state();
+    AuditShard *shard = SI_get_shard(state, obj);
+
+    Mutex_lock(&shard->mutex);
+    void *value = PtrHash_Fetch(shard->objects, obj);
+    Mutex_unlock(&shard->mutex);
+
+    // Keep the backtrace captured by record_alloc, if any.
+    AuditSite *old_site = value ? SI_site_from_value(value) : &unknown_site;
+    AuditSite *site = S_intern_site(state, file, line, old_site->frames,
+                                    old_site->num_frames);
+
+    Mutex_lock(&shard->mutex);
+    PtrHash_Store(shard->objects, obj, site);
+    Mutex_unlock(&shard->mutex);
+#else
+    UNUSED_VAR(file);
+    UNUSED_VAR(line);
+#endif
+    return obj;
+}
+
+void
+Audit_record_alloc(Obj *obj) {
+#ifdef CFISH_AUDIT
+    AuditState *state = SI_get_state();
+    AuditSite  *site  = S_capture_site(state);
+    AuditShard *shard = SI_get_shard(state, obj);
+    Mutex_lock(&shard->mutex);
+    PtrHash_Store(shard->objects, obj, site);
+    Mutex_unlock(&shard->mutex);
+#else
+    UNUSED_VAR(obj);
+#endif
+}
+
+void
+Audit_record_init(Obj *obj) {
+#ifdef CFISH_AUDIT
+    AuditShard *shard = SI_get_shard(SI_get_state(), obj);
+    Mutex_lock(&shard->mutex);
+    // Only addresses already in the table have to be overwritten.
+    if (PtrHash_Fetch(shard->objects, obj)) {
+        PtrHash_Store(shard->objects, obj, &untracked_site);
+    }
+    Mutex_unlock(&shard->mutex);
+#else
+    UNUSED_VAR(obj);
+#endif
+}
+
+void
+Audit_record_free(Obj *obj) {
+#ifdef CFISH_AUDIT
+    AuditShard *shard = SI_get_shard(SI_get_state(), obj);
+    void *value = (void*)((uintptr_t)obj->klass | FLAG_DESTROYED);
+    Mutex_lock(&shard->mutex);
+    PtrHash_Store(shard->objects, obj, value);
+    Mutex_unlock(&shard->mutex);
+#else
+    UNUSED_VAR(obj);
+#endif
+}
+
+bool
+Audit_check_refcount(Obj *obj, const char *op) {
+#ifdef CFISH_AUDIT
+    AuditShard *shard = SI_get_shard(SI_get_state(), obj);
+    Mutex_lock(&shard->mutex);
+    void *value = PtrHash_Fetch(shard->objects, obj);
+    bool destroyed = ((uintptr_t)value & FLAG_DESTROYED) != 0;
+    if (destroyed) { shard->num_refcount_errors++; }
+    Mutex_unlock(&shard->mutex);
+
+    if (destroyed) {
+        Class  *klass = (Class*)SI_site_from_value(value);
+        String *name  = klass->name;
+        fprintf(stderr, "Clownfish audit: %s on destroyed %.*s object %p\n",
+                op, (int)Str_Get_Size(name), Str_Get_Ptr8(name), (void*)obj);
+        return false;
+    }
+#else
+    UNUSED_VAR(obj);
+    UNUSED_VAR(op);
+#endif
+    return true;
+}
+
+uint64_t
+Audit_num_refcount_errors() {
+    uint64_t num_errors = 0;
+#ifdef CFISH_AUDIT
+    AuditState *state = SI_get_state();
+    for (size_t i = 0; i < NUM_SHARDS; i++) {
+        AuditShard *shard = &state->shards[i];
+        Mutex_lock(&shard->mutex);
+        num_errors += shard->num_refcount_errors;
+        Mutex_unlock(&shard->mutex);
+    }
+#endif
+    return num_errors;
+}
+
@@ -0,0 +1,49 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef H_CLOWNFISH_UTIL_HASHMIX
+#define H_CLOWNFISH_UTIL_HASHMIX 1
+
+#include "charmony.h"
+#include "cfish_parcel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Finalizer of MurmurHash3, which spreads all input bits to the low bits
+ * used by hash tables. Sequential keys like document IDs end up in
+ * different buckets.
+ */
+static CFISH_INLINE size_t
+cfish_HashMix_u64(uint64_t bits) {
+    bits ^= bits >> 33;
+    bits *= UINT64_C(0xFF51AFD7ED558CCD);
+    bits ^= bits >> 33;
+    bits *= UINT64_C(0xC4CEB9FE1A85EC53);
+    bits ^= bits >> 33;
+    return (size_t)bits;
+}
+
+#ifdef CFISH_USE_SHORT_NAMES
+  #define HashMix_u64           cfish_HashMix_u64
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H_CLOWNFISH_UTIL_HASHMIX */
@@ -0,0 +1,442 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define C_CFISH_OBJ
+#define C_CFISH_CLASS
+#define C_CFISH_METHOD
+#define CFISH_USE_SHORT_NAMES
+
+#include "charmony.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "Clownfish/Util/Instrument.h"
+#include "Clownfish/CharBuf.h"
+#include "Clownfish/Class.h"
+#include "Clownfish/Hash.h"
+#include "Clownfish/Method.h"
+#include "Clownfish/Num.h"
+#include "Clownfish/String.h"
+#include "Clownfish/Vector.h"
+#include "Clownfish/Util/Atomic.h"
+#include "Clownfish/Util/Memory.h"
+#include "Clownfish/Util/ThreadLocal.h"
+
+#ifdef CFISH_INSTRUMENT
+
+/* Atomic 64-bit counters. */
+#if defined(CFISH_NOTHREADS)
+
+static CFISH_INLINE int64_t
+SI_atomic_add(volatile int64_t *target, int64_t delta) {
+    return *target += delta;
+}
+
+static CFISH_INLINE bool
+SI_atomic_cas(volatile int64_t *target, int64_t old_value, int64_t new_value) {
+    if (*target != old_value) { return false; }
+    *target = new_value;
+    return true;
+}
+
+#elif defined(__GNUC__)
+
+static CFISH_INLINE int64_t
+SI_atomic_add(volatile int64_t *target, int64_t delta) {
+    return __sync_add_and_fetch(target, delta);
+}
+
+static CFISH_INLINE bool
+SI_atomic_cas(volatile int64_t *target, int64_t old_value, int64_t new_value) {
+    return __sync_bool_compare_and_swap(target, old_value, new_value);
+}
+
+#elif defined(CHY_HAS_WINDOWS_H)
+#include <windows.h>
+
+static CFISH_INLINE int64_t
+SI_atomic_add(volatile int64_t *target, int64_t delta) {
+    return InterlockedExchangeAdd64((volatile LONGLONG*)target, delta)
+           + delta;
+}
+
+static CFISH_INLINE bool
+SI_atomic_cas(volatile int64_t *target, int64_t old_value, int64_t new_value) {
+    return InterlockedCompareExchange64((volatile LONGLONG*)target,
+                                        new_value, old_value)
+           == old_value;
+}
+
+#elif defined(CHY_HAS_SYS_ATOMIC_H)
+#include <sys/atomic.h>
+
+static CFISH_INLINE int64_t
+SI_atomic_add(volatile int64_t *target, int64_t delta) {
+    return (int64_t)atomic_add_64_nv((volatile uint64_t*)target, delta);
+}
+
+static CFISH_INLINE bool
+SI_atomic_cas(volatile int64_t *target, int64_t old_value, int64_t new_value) {
+    return (int64_t)atomic_cas_64((volatile uint64_t*)target,
+                                  (uint64_t)old_value, (uint64_t)new_value)
+           == old_value;
+}
+
+#else
+
+#error "No support for atomic operations."
+
+#endif /* Big platform if-else chain. */
+
+typedef cfish_InstrumentStats InstrumentStats;
+
+struct cfish_InstrumentStats {
+    Class            *klass;
+    InstrumentStats  *next;
+    volatile int64_t  num_allocs;
+    volatile int64_t  num_frees;
+    volatile int64_t  num_live;
+    volatile int64_t  peak_live;
+    size_t            num_slots;
+    volatile int64_t  calls[1]; /* flexible array, one per vtable slot */
+};
+
+/* Linked list of all InstrumentStats, used for reporting.  Entries are only
+ * added, never removed, because Classes are immortal.
+ */
+static InstrumentStats *volatile all_stats = NULL;
+
+static uint32_t sample_interval = 64;
+
+#ifdef CFISH_HAS_THREAD_LOCAL
+static CFISH_THREAD_LOCAL uint32_t dispatch_countdown = 0;
+#else
+/* Without thread-local storage, threads share the countdown.  Races only
+ * affect which calls are sampled, not the consistency of the counters.
+ */
+static uint32_t dispatch_countdown = 0;
+#endif
+
+static InstrumentStats*
+S_create_stats(Class *klass) {
+    size_t num_slots = (klass->class_alloc_size - offsetof(Class, vtable))
+                       / sizeof(cfish_method_t);
+    size_t size = offsetof(InstrumentStats, calls)
+                  + (num_slots ? num_slots : 1) * sizeof(int64_t);
+    InstrumentStats *stats = (InstrumentStats*)CALLOCATE(1, size);
+    stats->klass     = klass;
+    stats->num_slots = num_slots;
+
+    if (!Atomic_cas_ptr((void*volatile*)&klass->instrument_stats, NULL,
+                        stats)) {
+        // Another thread won the race.
+        FREEMEM(stats);
+        return klass->instrument_stats;
+    }
+
+    // Publish for reporting.
+    do {
+        stats->next = all_stats;
+    } while (!Atomic_cas_ptr((void*volatile*)&all_stats, stats->next, stats));
+
+    return stats;
+}
+
+static CFISH_INLINE InstrumentStats*
+SI_get_stats(Class *klass) {
+    InstrumentStats *stats = klass->instrument_stats;
+    return stats ? stats : S_create_stats(klass);
+}
+
+static Method*
+S_find_method(Class *klass, uint32_t offset) {
+    for (Class *ancestor = klass; ancestor; ancestor = ancestor->parent) {
+        Method **methods = ancestor->methods;
+        if (!methods) { continue; }
+        for (size_t i = 0; methods[i]; i++) {
+            if (methods[i]->offset == offset) { return methods[i]; }
+        }
+    }
+    return NULL;
+}
+
+static Hash*
+S_class_stats(InstrumentStats *stats) {
+    Hash *calls = Hash_new(0);
+    for (size_t i = 0; i < stats->num_slots; i++) {
+        int64_t num_calls = stats->calls[i];
+        if (num_calls == 0) { continue; }
+        uint32_t offset = (uint32_t)(offsetof(Class, vtable)
+                                     + i * sizeof(cfish_method_t));
+        Method *method = S_find_method(stats->klass, offset);
+        if (!method) { continue; }
+        Hash_Store(calls, method->name, (Obj*)Int_new(num_calls));
+    }
+
+    Hash *hash = Hash_new(5);
+    Hash_Store_Utf8(hash, "allocs", 6, (Obj*)Int_new(stats->num_allocs));
+    Hash_Store_Utf8(hash, "frees", 5, (Obj*)Int_new(stats->num_frees));
+    Hash_Store_Utf8(hash, "live", 4, (Obj*)Int_new(stats->num_live));
+    Hash_Store_Utf8(hash, "peak_live", 9, (Obj*)Int_new(stats->peak_live));
+    Hash_Store_Utf8(hash, "calls", 5, (Obj*)calls);
+    return hash;
+}
+
+#endif /* CFISH_INSTRUMENT */
+
+bool
+Instrument_enabled() {
+#ifdef CFISH_INSTRUMENT
+    return true;
+#else
+    return false;
+#endif
+}
+
+void
+Instrument_set_sample_interval(uint32_t interval) {
+#ifdef CFISH_INSTRUMENT
+    sample_interval = interval ? interval : 1;
+    // Countdowns of other threads are clamped in
+    // Instrument_sample_dispatch.
+    dispatch_countdown = 0;
+#else
+    UNUSED_VAR(interval);
+#endif
+}
+
+uint32_t
+Instrument_get_sample_interval() {
+#ifdef CFISH_INSTRUMENT
+    return sample_interval;
+#else
+    return 0;
+#endif
+}
+
+void
+Instrument_record_alloc(Obj *obj) {
+#ifdef CFISH_INSTRUMENT
+    InstrumentStats *stats = SI_get_stats(obj->klass);
+    SI_atomic_add(&stats->num_allocs, 1);
+    int64_t live = SI_atomic_add(&stats->num_live, 1);
+    int64_t peak = stats->peak_live;
+    while (live > peak) {
+        if (SI_atomic_cas(&stats->peak_live, peak, live)) { break; }
+        peak = stats->peak_live;
+    }
+#else
+    UNUSED_VAR(obj);
+#endif
+}
+
+void
+Instrument_record_free(Obj *obj) {
+#ifdef CFISH_INSTRUMENT
+    InstrumentStats *stats = SI_get_stats(obj->klass);
+    SI_atomic_add(&stats->num_frees, 1);
+    SI_atomic_add(&stats->num_live, -1);
+#else
+    UNUSED_VAR(obj);
+#endif
+}
+
+void
+Instrument_sample_dispatch(Obj *obj, uint32_t offset) {
+#ifdef CFISH_INSTRUMENT
+    uint32_t interval = sample_interval;
+    // A countdown above the interval was started before the interval was
+    // lowered and restarts right away.
+    if (dispatch_countdown > 1 && dispatch_countdown <= interval) {
+        dispatch_countdown--;
+        return;
+    }
+    dispatch_countdown = interval;
+
+    InstrumentStats *stats = SI_get_stats(obj->klass);
+    size_t slot = (offset - offsetof(Class, vtable)) / sizeof(cfish_method_t);
+    if (slot < stats->num_slots) {
+        SI_atomic_add(&stats->calls[slot], (int64_t)interval);
+    }
+#else
+    UNUSED_VAR(obj);
+    UNUSED_VAR(offset);
+#endif
+}
+
+void
+Instrument_reset() {
+#ifdef CFISH_INSTRUMENT
+    for (InstrumentStats *stats = all_stats; stats; stats = stats->next) {
+        stats->num_allocs = 0;
+        stats->num_frees  = 0;
+        stats->peak_live  = stats->num_live;
+        for (size_t i = 0; i < stats->num_slots; i++) {
+            stats->calls[i] = 0;
+        }
+    }
+#endif
+}
+
+Hash*
+Instrument_stats() {
+    Hash *hash = Hash_new(0);
+#ifdef CFISH_INSTRUMENT
+    for (InstrumentStats *stats = all_stats; stats; stats = stats->next) {
+        Hash_Store(hash, stats->klass->name, (Obj*)S_class_stats(stats));
+    }
+#endif
+    return hash;
+}
+
+static void
+S_cat_json_string(CharBuf *buf, String *string) {
+    const char *ptr  = Str_Get_Ptr8(string);
+    size_t      size = Str_Get_Size(string);
+    size_t      run  = 0;
+
+    CB_Cat_Trusted_Utf8(buf, "\"", 1);
+    for (size_t i = 0; i < size; i++) {
+        unsigned char c = (unsigned char)ptr[i];
+        if (c == '"' || c == '\\' || c < 0x20) {
+            CB_Cat_Trusted_Utf8(buf, ptr + run, i - run);
+            if (c < 0x20) {
+                char escape[7];
+                sprintf(escape, "\\u%04x", (unsigned)c);
+                CB_Cat_Trusted_Utf8(buf, escape, 6);
+            }
+            else {
+                char escape[2] = { '\\', (char)c };
+                CB_Cat_Trusted_Utf8(buf, escape, 2);
+            }
+            run = i + 1;
+        }
+    }
+    CB_Cat_Trusted_Utf8(buf, ptr + run, size - run);
+    CB_Cat_Trusted_Utf8(buf, "\"", 1);
+}
+
+static int64_t
+S_fetch_i64(Hash *hash, const char *key) {
+    Integer *value = (Integer*)Hash_Fetch_Utf8(hash, key, strlen(key));
+    return value ? Int_Get_Value(value) : 0;
+}
+
+static Vector*
+S_sorted_keys(Hash *hash) {
+    Vector *keys = Hash_Keys(hash);
+    Vec_Sort(keys);
+    return keys;
+}
+
+String*
+Instrument_to_json() {
+    Hash    *stats       = Instrument_stats();
+    Vector  *class_names = S_sorted_keys(stats);
+    size_t   num_classes = Vec_Get_Size(class_names);
+    CharBuf *buf         = CB_new(0);
+
+    CB_catf(buf, "{\n  \"enabled\": %s,\n  \"sample_interval\": %u32,\n"
+            "  \"classes\": {",
+            Instrument_enabled() ? "true" : "false",
+            Instrument_get_sample_interval());
+
+    for (size_t i = 0; i < num_classes; i++) {
+        String *class_name  = (String*)Vec_Fetch(class_names, i);
+        Hash   *class_stats = (Hash*)Hash_Fetch(stats, class_name);
+
+        if (i > 0) { CB_Cat_Trusted_Utf8(buf, ",", 1); }
+        CB_Cat_Trusted_Utf8(buf, "\n    ", 5);
+        S_cat_json_string(buf, class_name);
+        CB_catf(buf, ": {\"allocs\": %i64, \"frees\": %i64, \"live\": %i64, "
+                "\"peak_live\": %i64, \"calls\": {",
+                S_fetch_i64(class_stats, "allocs"),
+                S_fetch_i64(class_stats, "frees"),
+                S_fetch_i64(class_stats, "live"),
+                S_fetch_i64(class_stats, "peak_live"));
+
+        Hash   *calls      = (Hash*)Hash_Fetch_Utf8(class_stats, "calls", 5);
+        Vector *meth_names = S_sorted_keys(calls);
+        size_t num_meths = Vec_Get_Size(meth_names);
+        for (size_t j = 0; j < num_meths; j++) {
+            String  *meth_name = (String*)Vec_Fetch(meth_names, j);
+            Integer *num_calls = (Integer*)Hash_Fetch(calls, meth_name);
+            if (j > 0) { CB_Cat_Trusted_Utf8(buf, ", ", 2); }
+            S_cat_json_string(buf, meth_name);
+            CB_catf(buf, ": %i64", Int_Get_Value(num_calls));
+        }
+        CB_Cat_Trusted_Utf8(buf, "}}", 2);
+        DECREF(meth_names);
+    }
+
+    CB_Cat_Trusted_Utf8(buf, num_classes ? "\n  }\n}\n" : "}\n}\n",
+                        num_classes ? 7 : 4);
+
+    String *json = CB_Yield_String(buf);
+    DECREF(buf);
+    DECREF(class_names);
+    DECREF(stats);
+    return json;
+}
+
+bool
+Instrument_dump_json(const char *path) {
+    String *json = Instrument_to_json();
+    size_t  size = Str_Get_Size(json);
+    bool    success = false;
+
+    FILE *file = fopen(path, "wb");
+    if (file) {
+        success = fwrite(Str_Get_Ptr8(json), 1, size, file) == size;
+        if (fclose(file) != 0) { success = false; }
+    }
+
+    DECREF(json);
+    return success;
+}
+
+String*
+Instrument_method_profile() {
+    Hash    *stats       = Instrument_stats();
+    Vector  *class_names = S_sorted_keys(stats);
+    CharBuf *buf         = CB_new(0);
+
+    CB_catf(buf, "# calls class method\n");
+    size_t num_classes = Vec_Get_Size(class_names);
+    for (size_t i = 0; i < num_classes; i++) {
+        String *class_name  = (String*)Vec_Fetch(class_names, i);
+        Hash   *class_stats = (Hash*)Hash_Fetch(stats, class_name);
+        Hash   *calls       = (Hash*)Hash_Fetch_Utf8(class_stats, "calls", 5);
+        Vector *meth_names  = S_sorted_keys(calls);
+        size_t num_meths = Vec_Get_Size(meth_names);
+        for (size_t j = 0; j < num_meths; j++) {
+            String  *meth_name = (String*)Vec_Fetch(meth_names, j);
+            Integer *num_calls = (Integer*)Hash_Fetch(calls, meth_name);
+            CB_catf(buf, "%i64 %o %o\n", Int_Get_Value(num_calls),
+                    class_name, meth_name);
+        }
+        DECREF(meth_names);
+    }
+
+    String *profile = CB_Yield_String(buf);
+    DECREF(buf);
+    DECREF(class_names);
+    DECREF(stats);
+    return profile;
+}
+
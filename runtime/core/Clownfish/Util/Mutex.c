@@ -0,0 +1,48 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define CFISH_USE_SHORT_NAMES
+
+#include "charmony.h"
+
+#include "Clownfish/Util/Mutex.h"
+
+/********************************** Windows ********************************/
+#if !defined(CFISH_NOTHREADS) && defined(CHY_HAS_WINDOWS_H)
+#include <windows.h>
+
+void
+cfish_Mutex_init(cfish_Mutex *mutex) {
+    InitializeSRWLock((PSRWLOCK)mutex);
+}
+
+void
+cfish_Mutex_destroy(cfish_Mutex *mutex) {
+    UNUSED_VAR(mutex);
+}
+
+void
+cfish_Mutex_lock(cfish_Mutex *mutex) {
+    AcquireSRWLockExclusive((PSRWLOCK)mutex);
+}
+
+void
+cfish_Mutex_unlock(cfish_Mutex *mutex) {
+    ReleaseSRWLockExclusive((PSRWLOCK)mutex);
+}
+
+#endif
+
@@ -0,0 +1,106 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef H_CLOWNFISH_UTIL_MUTEX
+#define H_CLOWNFISH_UTIL_MUTEX 1
+
+#include "charmony.h"
+#include "cfish_parcel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Plain, non-recursive mutex.  A mutex must be initialized with
+ * cfish_Mutex_init and released with cfish_Mutex_destroy.
+ */
+
+/************************** Single threaded *******************************/
+#ifdef CFISH_NOTHREADS
+
+typedef int cfish_Mutex;
+
+static CFISH_INLINE void
+cfish_Mutex_init(cfish_Mutex *mutex) { *mutex = 0; }
+
+static CFISH_INLINE void
+cfish_Mutex_destroy(cfish_Mutex *mutex) { CFISH_UNUSED_VAR(mutex); }
+
+static CFISH_INLINE void
+cfish_Mutex_lock(cfish_Mutex *mutex) { CFISH_UNUSED_VAR(mutex); }
+
+static CFISH_INLINE void
+cfish_Mutex_unlock(cfish_Mutex *mutex) { CFISH_UNUSED_VAR(mutex); }
+
+/********************************** Windows *******************************/
+#elif defined(CHY_HAS_WINDOWS_H)
+
+/* Same layout as SRWLOCK, so windows.h doesn't have to be included here.
+ */
+typedef struct {
+    void *ptr;
+} cfish_Mutex;
+
+void
+cfish_Mutex_init(cfish_Mutex *mutex);
+
+void
+cfish_Mutex_destroy(cfish_Mutex *mutex);
+
+void
+cfish_Mutex_lock(cfish_Mutex *mutex);
+
+void
+cfish_Mutex_unlock(cfish_Mutex *mutex);
+
+/******************************** pthreads ********************************/
+#elif defined(CHY_HAS_PTHREAD_H)
+#include <pthread.h>
+
+typedef pthread_mutex_t cfish_Mutex;
+
+static CFISH_INLINE void
+cfish_Mutex_init(cfish_Mutex *mutex) { pthread_mutex_init(mutex, NULL); }
+
+static CFISH_INLINE void
+cfish_Mutex_destroy(cfish_Mutex *mutex) { pthread_mutex_destroy(mutex); }
+
+static CFISH_INLINE void
+cfish_Mutex_lock(cfish_Mutex *mutex) { pthread_mutex_lock(mutex); }
+
+static CFISH_INLINE void
+cfish_Mutex_unlock(cfish_Mutex *mutex) { pthread_mutex_unlock(mutex); }
+
+/********************* No support for mutexes at all. **********************/
+#else
+
+#error "No support for mutexes."
+
+#endif /* Big platform if-else chain. */
+
+#ifdef CFISH_USE_SHORT_NAMES
+  #define Mutex                 cfish_Mutex
+  #define Mutex_init            cfish_Mutex_init
+  #define Mutex_destroy         cfish_Mutex_destroy
+  #define Mutex_lock            cfish_Mutex_lock
+  #define Mutex_unlock          cfish_Mutex_unlock
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H_CLOWNFISH_UTIL_MUTEX */
@@ -15,6 +15,9 @@
  */
 
 #define C_CFISH_STRINGHELPER
+#include <float.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #define CFISH_USE_SHORT_NAMES
@@ -75,6 +78,745 @@ StrHelp_to_base36(uint64_t num, void *buffer) {
     return size;
 }
 
+/* Exact double arithmetic is required to convert between decimal and binary
+ * without big number arithmetic.  Platforms which evaluate doubles with
+ * excess precision, like x87 without SSE, always take the slow path.
+ */
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD != 0
+  #define NO_EXACT_DOUBLES
+#endif
+
+#define MAX_EXACT_POW10 22
+#define TWO_POW_53      9007199254740992.0
+
+// Powers of ten which are exactly representable as doubles.
+static const double exact_pow10[MAX_EXACT_POW10 + 1] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const char digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Write the decimal digits of `value` so that they end right before `end`,
+// two digits at a time.  Return a pointer to the first digit.
+static char*
+S_write_digits_backwards(uint64_t value, char *end) {
+    char *ptr = end;
+    while (value >= 100) {
+        size_t pair = (size_t)(value % 100) * 2;
+        value /= 100;
+        ptr -= 2;
+        ptr[0] = digit_pairs[pair];
+        ptr[1] = digit_pairs[pair + 1];
+    }
+    if (value >= 10) {
+        size_t pair = (size_t)value * 2;
+        ptr -= 2;
+        ptr[0] = digit_pairs[pair];
+        ptr[1] = digit_pairs[pair + 1];
+    }
+    else {
+        *(--ptr) = (char)('0' + value);
+    }
+    return ptr;
+}
+
+size_t
+StrHelp_format_u64(uint64_t value, char *buffer) {
+    char  my_buf[StrHelp_MAX_I64_BYTES];
+    char *end = my_buf + StrHelp_MAX_I64_BYTES - 1;
+    *end = '\0';
+    char *start = S_write_digits_backwards(value, end);
+    size_t size = (size_t)(end - start);
+    memcpy(buffer, start, size + 1);
+    return size;
+}
+
+size_t
+StrHelp_format_i64(int64_t value, char *buffer) {
+    if (value < 0) {
+        // Negate as unsigned to handle INT64_MIN.
+        buffer[0] = '-';
+        return StrHelp_format_u64(0 - (uint64_t)value, buffer + 1) + 1;
+    }
+    return StrHelp_format_u64((uint64_t)value, buffer);
+}
+
+/* Find the decimal `mantissa * 10^exp10` with the fewest digits which
+ * converts back to `value`.  Only decimals which can be converted with a
+ * single exact multiplication or division are considered: the mantissa must
+ * not exceed 2^53 and the power of ten must be exactly representable.  The
+ * mantissa has no trailing zeros.  `value` must be positive and finite.
+ *
+ * Return false if no such decimal exists.
+ */
+static bool
+S_exact_decimal(double value, uint64_t *mantissa, int *exp10) {
+#ifdef NO_EXACT_DOUBLES
+    UNUSED_VAR(value);
+    UNUSED_VAR(mantissa);
+    UNUSED_VAR(exp10);
+    return false;
+#else
+    uint64_t m = 0;
+    int      e = 0;
+
+    if (value >= TWO_POW_53) {
+        // Large integers.  Fewer digits means a larger power of ten.
+        for (e = MAX_EXACT_POW10; e > 0; e--) {
+            double scaled = value / exact_pow10[e];
+            if (scaled < 1.0 || scaled >= TWO_POW_53) { continue; }
+            m = (uint64_t)scaled;
+            if ((double)m == scaled && (double)m * exact_pow10[e] == value) {
+                break;
+            }
+        }
+        if (e == 0) { return false; }
+    }
+    else {
+        // Fewer digits means fewer digits after the decimal point.
+        for (e = 0; e <= MAX_EXACT_POW10; e++) {
+            double scaled = value * exact_pow10[e];
+            if (scaled >= TWO_POW_53) { return false; }
+            m = (uint64_t)(scaled + 0.5);
+            if (m != 0 && (double)m / exact_pow10[e] == value) { break; }
+        }
+        if (e > MAX_EXACT_POW10) { return false; }
+        e = -e;
+    }
+
+    while (m % 10 == 0) {
+        m /= 10;
+        e += 1;
+    }
+    *mantissa = m;
+    *exp10    = e;
+    return true;
+#endif
+}
+
+// Encode `mantissa * 10^exp10` without an exponent.  Return the number of
+// characters written.
+static size_t
+S_encode_fixed(char *buffer, uint64_t mantissa, int exp10) {
+    char  digit_buf[StrHelp_MAX_I64_BYTES];
+    char *digits_end = digit_buf + sizeof(digit_buf);
+    char *digits     = S_write_digits_backwards(mantissa, digits_end);
+    int   num_digits = (int)(digits_end - digits);
+    int   point      = num_digits + exp10; // Digits before the point.
+    char *ptr        = buffer;
+
+    if (exp10 >= 0) {
+        memcpy(ptr, digits, (size_t)num_digits);
+        ptr += num_digits;
+        memset(ptr, '0', (size_t)exp10);
+        ptr += exp10;
+    }
+    else if (point > 0) {
+        memcpy(ptr, digits, (size_t)point);
+        ptr += point;
+        *ptr++ = '.';
+        memcpy(ptr, digits + point, (size_t)(num_digits - point));
+        ptr += num_digits - point;
+    }
+    else {
+        *ptr++ = '0';
+        *ptr++ = '.';
+        memset(ptr, '0', (size_t)-point);
+        ptr += -point;
+        memcpy(ptr, digits, (size_t)num_digits);
+        ptr += num_digits;
+    }
+
+    *ptr = '\0';
+    return (size_t)(ptr - buffer);
+}
+
+// Encode `mantissa * 10^exp10` with an exponent in the style of printf.
+// Return the number of characters written.
+static size_t
+S_encode_scientific(char *buffer, uint64_t mantissa, int exp10) {
+    char  digit_buf[StrHelp_MAX_I64_BYTES];
+    char *digits_end = digit_buf + sizeof(digit_buf);
+    char *digits     = S_write_digits_backwards(mantissa, digits_end);
+    int   num_digits = (int)(digits_end - digits);
+    int   exponent   = num_digits + exp10 - 1;
+    char *ptr        = buffer;
+
+    *ptr++ = digits[0];
+    if (num_digits > 1) {
+        *ptr++ = '.';
+        memcpy(ptr, digits + 1, (size_t)(num_digits - 1));
+        ptr += num_digits - 1;
+    }
+    *ptr++ = 'e';
+    *ptr++ = exponent < 0 ? '-' : '+';
+    if (exponent < 0) { exponent = -exponent; }
+    if (exponent < 10) { *ptr++ = '0'; }
+    ptr += StrHelp_format_u64((uint64_t)exponent, ptr);
+
+    return (size_t)(ptr - buffer);
+}
+
+static CFISH_INLINE bool
+SI_is_negative(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return (bits >> 63) != 0;
+}
+
+/* Shortest round-trip formatting of doubles with the Grisu3 algorithm by
+ * Florian Loitsch, "Printing Floating-Point Numbers Quickly and Accurately
+ * with Integers" (PLDI 2010).  Grisu3 uses 64-bit integer arithmetic only.
+ * For about 0.5% of all doubles it can't prove that its result is the
+ * shortest, correctly rounded one and reports failure.
+ */
+
+// A floating point number `f * 2^e` with a 64-bit significand.
+typedef struct {
+    uint64_t f;
+    int      e;
+} DiyFp;
+
+#define DIYFP_SIGNIFICAND_SIZE 64
+#define DOUBLE_SIGNIFICAND_MASK UINT64_C(0x000FFFFFFFFFFFFF)
+#define DOUBLE_EXPONENT_MASK    UINT64_C(0x7FF0000000000000)
+#define DOUBLE_HIDDEN_BIT       UINT64_C(0x0010000000000000)
+#define DOUBLE_EXPONENT_BIAS    (0x3FF + 52)
+
+// Range of the binary exponent of the scaled value, chosen so that its
+// integral part fits in 32 bits.
+#define GRISU_MIN_TARGET_EXP (-60)
+
+#define CACHED_POW10_MIN_EXP  (-348)
+#define CACHED_POW10_EXP_STEP 8
+
+// Normalized approximations of `10^dec_exp` as `fract * 2^bin_exp` for every
+// eighth power of ten.
+static const struct {
+    uint64_t fract;
+    int16_t  bin_exp;
+    int16_t  dec_exp;
+} cached_pow10[] = {
+    { UINT64_C(0xfa8fd5a0081c0288), -1220, -348 },
+    { UINT64_C(0xbaaee17fa23ebf76), -1193, -340 },
+    { UINT64_C(0x8b16fb203055ac76), -1166, -332 },
+    { UINT64_C(0xcf42894a5dce35ea), -1140, -324 },
+    { UINT64_C(0x9a6bb0aa55653b2d), -1113, -316 },
+    { UINT64_C(0xe61acf033d1a45df), -1087, -308 },
+    { UINT64_C(0xab70fe17c79ac6ca), -1060, -300 },
+    { UINT64_C(0xff77b1fcbebcdc4f), -1034, -292 },
+    { UINT64_C(0xbe5691ef416bd60c), -1007, -284 },
+    { UINT64_C(0x8dd01fad907ffc3c),  -980, -276 },
+    { UINT64_C(0xd3515c2831559a83),  -954, -268 },
+    { UINT64_C(0x9d71ac8fada6c9b5),  -927, -260 },
+    { UINT64_C(0xea9c227723ee8bcb),  -901, -252 },
+    { UINT64_C(0xaecc49914078536d),  -874, -244 },
+    { UINT64_C(0x823c12795db6ce57),  -847, -236 },
+    { UINT64_C(0xc21094364dfb5637),  -821, -228 },
+    { UINT64_C(0x9096ea6f3848984f),  -794, -220 },
+    { UINT64_C(0xd77485cb25823ac7),  -768, -212 },
+    { UINT64_C(0xa086cfcd97bf97f4),  -741, -204 },
+    { UINT64_C(0xef340a98172aace5),  -715, -196 },
+    { UINT64_C(0xb23867fb2a35b28e),  -688, -188 },
+    { UINT64_C(0x84c8d4dfd2c63f3b),  -661, -180 },
+    { UINT64_C(0xc5dd44271ad3cdba),  -635, -172 },
+    { UINT64_C(0x936b9fcebb25c996),  -608, -164 },
+    { UINT64_C(0xdbac6c247d62a584),  -582, -156 },
+    { UINT64_C(0xa3ab66580d5fdaf6),  -555, -148 },
+    { UINT64_C(0xf3e2f893dec3f126),  -529, -140 },
+    { UINT64_C(0xb5b5ada8aaff80b8),  -502, -132 },
+    { UINT64_C(0x87625f056c7c4a8b),  -475, -124 },
+    { UINT64_C(0xc9bcff6034c13053),  -449, -116 },
+    { UINT64_C(0x964e858c91ba2655),  -422, -108 },
+    { UINT64_C(0xdff9772470297ebd),  -396, -100 },
+    { UINT64_C(0xa6dfbd9fb8e5b88f),  -369,  -92 },
+    { UINT64_C(0xf8a95fcf88747d94),  -343,  -84 },
+    { UINT64_C(0xb94470938fa89bcf),  -316,  -76 },
+    { UINT64_C(0x8a08f0f8bf0f156b),  -289,  -68 },
+    { UINT64_C(0xcdb02555653131b6),  -263,  -60 },
+    { UINT64_C(0x993fe2c6d07b7fac),  -236,  -52 },
+    { UINT64_C(0xe45c10c42a2b3b06),  -210,  -44 },
+    { UINT64_C(0xaa242499697392d3),  -183,  -36 },
+    { UINT64_C(0xfd87b5f28300ca0e),  -157,  -28 },
+    { UINT64_C(0xbce5086492111aeb),  -130,  -20 },
+    { UINT64_C(0x8cbccc096f5088cc),  -103,  -12 },
+    { UINT64_C(0xd1b71758e219652c),   -77,   -4 },
+    { UINT64_C(0x9c40000000000000),   -50,    4 },
+    { UINT64_C(0xe8d4a51000000000),   -24,   12 },
+    { UINT64_C(0xad78ebc5ac620000),     3,   20 },
+    { UINT64_C(0x813f3978f8940984),    30,   28 },
+    { UINT64_C(0xc097ce7bc90715b3),    56,   36 },
+    { UINT64_C(0x8f7e32ce7bea5c70),    83,   44 },
+    { UINT64_C(0xd5d238a4abe98068),   109,   52 },
+    { UINT64_C(0x9f4f2726179a2245),   136,   60 },
+    { UINT64_C(0xed63a231d4c4fb27),   162,   68 },
+    { UINT64_C(0xb0de65388cc8ada8),   189,   76 },
+    { UINT64_C(0x83c7088e1aab65db),   216,   84 },
+    { UINT64_C(0xc45d1df942711d9a),   242,   92 },
+    { UINT64_C(0x924d692ca61be758),   269,  100 },
+    { UINT64_C(0xda01ee641a708dea),   295,  108 },
+    { UINT64_C(0xa26da3999aef774a),   322,  116 },
+    { UINT64_C(0xf209787bb47d6b85),   348,  124 },
+    { UINT64_C(0xb454e4a179dd1877),   375,  132 },
+    { UINT64_C(0x865b86925b9bc5c2),   402,  140 },
+    { UINT64_C(0xc83553c5c8965d3d),   428,  148 },
+    { UINT64_C(0x952ab45cfa97a0b3),   455,  156 },
+    { UINT64_C(0xde469fbd99a05fe3),   481,  164 },
+    { UINT64_C(0xa59bc234db398c25),   508,  172 },
+    { UINT64_C(0xf6c69a72a3989f5c),   534,  180 },
+    { UINT64_C(0xb7dcbf5354e9bece),   561,  188 },
+    { UINT64_C(0x88fcf317f22241e2),   588,  196 },
+    { UINT64_C(0xcc20ce9bd35c78a5),   614,  204 },
+    { UINT64_C(0x98165af37b2153df),   641,  212 },
+    { UINT64_C(0xe2a0b5dc971f303a),   667,  220 },
+    { UINT64_C(0xa8d9d1535ce3b396),   694,  228 },
+    { UINT64_C(0xfb9b7cd9a4a7443c),   720,  236 },
+    { UINT64_C(0xbb764c4ca7a44410),   747,  244 },
+    { UINT64_C(0x8bab8eefb6409c1a),   774,  252 },
+    { UINT64_C(0xd01fef10a657842c),   800,  260 },
+    { UINT64_C(0x9b10a4e5e9913129),   827,  268 },
+    { UINT64_C(0xe7109bfba19c0c9d),   853,  276 },
+    { UINT64_C(0xac2820d9623bf429),   880,  284 },
+    { UINT64_C(0x80444b5e7aa7cf85),   907,  292 },
+    { UINT64_C(0xbf21e44003acdd2d),   933,  300 },
+    { UINT64_C(0x8e679c2f5e44ff8f),   960,  308 },
+    { UINT64_C(0xd433179d9c8cb841),   986,  316 },
+    { UINT64_C(0x9e19db92b4e31ba9),  1013,  324 },
+    { UINT64_C(0xeb96bf6ebadf77d9),  1039,  332 },
+    { UINT64_C(0xaf87023b9bf0ee6b),  1066,  340 }
+};
+
+// Powers of ten which fit in 32 bits, offset by one.
+static const uint32_t small_pow10[] = {
+    0, 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+    1000000000
+};
+
+static CFISH_INLINE DiyFp
+SI_diy_fp(uint64_t f, int e) {
+    DiyFp fp;
+    fp.f = f;
+    fp.e = e;
+    return fp;
+}
+
+// Multiply and round to 64 bits.
+static DiyFp
+S_diy_fp_multiply(DiyFp x, DiyFp y) {
+    const uint64_t mask32 = UINT64_C(0xFFFFFFFF);
+    uint64_t a   = x.f >> 32;
+    uint64_t b   = x.f & mask32;
+    uint64_t c   = y.f >> 32;
+    uint64_t d   = y.f & mask32;
+    uint64_t ac  = a * c;
+    uint64_t bc  = b * c;
+    uint64_t ad  = a * d;
+    uint64_t bd  = b * d;
+    uint64_t tmp = (bd >> 32) + (ad & mask32) + (bc & mask32);
+    tmp += UINT64_C(1) << 31;
+    return SI_diy_fp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32),
+                     x.e + y.e + 64);
+}
+
+static DiyFp
+S_diy_fp_normalize(DiyFp x) {
+    while (!(x.f & UINT64_C(0xFFC0000000000000))) {
+        x.f <<= 10;
+        x.e -= 10;
+    }
+    while (!(x.f & UINT64_C(0x8000000000000000))) {
+        x.f <<= 1;
+        x.e -= 1;
+    }
+    return x;
+}
+
+// Find a cached power of ten which scales a number with binary exponent
+// `min_exp` into the target range.  Return its decimal exponent.
+static int
+S_cached_pow10(int min_exp, DiyFp *pow10) {
+    // k = ceil((min_exp + 63) * log10(2))
+    double dk = (min_exp + DIYFP_SIGNIFICAND_SIZE - 1) * 0.30102999566398114;
+    int    k  = (int)dk;
+    if (dk > k) { k++; }
+    int index = (k - CACHED_POW10_MIN_EXP - 1) / CACHED_POW10_EXP_STEP + 1;
+    *pow10 = SI_diy_fp(cached_pow10[index].fract,
+                       cached_pow10[index].bin_exp);
+    return cached_pow10[index].dec_exp;
+}
+
+// Move the last digit towards `w` while the result stays inside the safe
+// interval.  Return true if the result is guaranteed to be the closest
+// shortest representation.
+static bool
+S_round_weed(char *digits, int num_digits, uint64_t distance_high_w,
+             uint64_t unsafe_interval, uint64_t rest, uint64_t ten_kappa,
+             uint64_t unit) {
+    uint64_t small_distance = distance_high_w - unit;
+    uint64_t big_distance   = distance_high_w + unit;
+
+    while (rest < small_distance
+           && unsafe_interval - rest >= ten_kappa
+           && (rest + ten_kappa < small_distance
+               || small_distance - rest >= rest + ten_kappa - small_distance)
+          ) {
+        digits[num_digits - 1]--;
+        rest += ten_kappa;
+    }
+
+    if (rest < big_distance
+        && unsafe_interval - rest >= ten_kappa
+        && (rest + ten_kappa < big_distance
+            || big_distance - rest > rest + ten_kappa - big_distance)
+       ) {
+        return false;
+    }
+
+    return 2 * unit <= rest && rest <= unsafe_interval - 4 * unit;
+}
+
+// Generate the shortest digits of a number between `low` and `high`, which
+// share the exponent of `w`.
+static bool
+S_digit_gen(DiyFp low, DiyFp w, DiyFp high, char *digits, int *num_digits,
+            int *kappa) {
+    uint64_t unit            = 1;
+    DiyFp    too_low         = SI_diy_fp(low.f - unit, low.e);
+    DiyFp    too_high        = SI_diy_fp(high.f + unit, high.e);
+    uint64_t unsafe_interval = too_high.f - too_low.f;
+    int      shift           = -w.e;
+    uint64_t one             = UINT64_C(1) << shift;
+    uint32_t integrals       = (uint32_t)(too_high.f >> shift);
+    uint64_t fractionals     = too_high.f & (one - 1);
+
+    // Find the largest power of ten not greater than `integrals`.  1233/4096
+    // approximates log10(2).
+    int integral_bits = DIYFP_SIGNIFICAND_SIZE - shift;
+    int guess         = ((integral_bits + 1) * 1233 >> 12) + 1;
+    if (integrals < small_pow10[guess]) { guess--; }
+    uint32_t divisor = small_pow10[guess];
+    *kappa      = guess;
+    *num_digits = 0;
+
+    while (*kappa > 0) {
+        digits[(*num_digits)++] = (char)('0' + integrals / divisor);
+        integrals %= divisor;
+        (*kappa)--;
+        uint64_t rest = ((uint64_t)integrals << shift) + fractionals;
+        if (rest < unsafe_interval) {
+            return S_round_weed(digits, *num_digits, too_high.f - w.f,
+                                unsafe_interval, rest,
+                                (uint64_t)divisor << shift, unit);
+        }
+        divisor /= 10;
+    }
+
+    while (1) {
+        fractionals     *= 10;
+        unit            *= 10;
+        unsafe_interval *= 10;
+        digits[(*num_digits)++] = (char)('0' + (fractionals >> shift));
+        fractionals &= one - 1;
+        (*kappa)--;
+        if (fractionals < unsafe_interval) {
+            return S_round_weed(digits, *num_digits,
+                                (too_high.f - w.f) * unit, unsafe_interval,
+                                fractionals, one, unit);
+        }
+    }
+}
+
+/* Find the shortest digits `digits * 10^exp10` which convert back to
+ * `value`.  `value` must be positive and finite.  `digits` must hold at
+ * least 18 characters.  Return false if Grisu3 can't guarantee the result.
+ */
+static bool
+S_grisu3(double value, char *digits, int *num_digits, int *exp10) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    DiyFp v;
+    if (bits & DOUBLE_EXPONENT_MASK) {
+        v.f = (bits & DOUBLE_SIGNIFICAND_MASK) | DOUBLE_HIDDEN_BIT;
+        v.e = (int)((bits & DOUBLE_EXPONENT_MASK) >> 52)
+              - DOUBLE_EXPONENT_BIAS;
+    }
+    else {
+        v.f = bits & DOUBLE_SIGNIFICAND_MASK;
+        v.e = 1 - DOUBLE_EXPONENT_BIAS;
+    }
+
+    // The boundaries halfway to the neighboring doubles.  The lower
+    // boundary is closer if the significand is a power of two.
+    DiyFp high = S_diy_fp_normalize(SI_diy_fp((v.f << 1) + 1, v.e - 1));
+    DiyFp low;
+    if ((bits & DOUBLE_SIGNIFICAND_MASK) == 0
+        && (bits & DOUBLE_EXPONENT_MASK) != 0
+       ) {
+        low = SI_diy_fp((v.f << 2) - 1, v.e - 2);
+    }
+    else {
+        low = SI_diy_fp((v.f << 1) - 1, v.e - 1);
+    }
+    low.f <<= low.e - high.e;
+    low.e   = high.e;
+
+    DiyFp w = S_diy_fp_normalize(v);
+    DiyFp pow10;
+    int   mk = S_cached_pow10(GRISU_MIN_TARGET_EXP - DIYFP_SIGNIFICAND_SIZE
+                              - w.e, &pow10);
+    w    = S_diy_fp_multiply(w, pow10);
+    low  = S_diy_fp_multiply(low, pow10);
+    high = S_diy_fp_multiply(high, pow10);
+
+    int  kappa;
+    bool success = S_digit_gen(low, w, high, digits, num_digits, &kappa);
+    *exp10 = kappa - mk;
+    return success;
+}
+
+/* Fallback for values which Grisu3 can't handle: increase the precision
+ * until the value round-trips.
+ */
+static void
+S_shortest_digits_slow(double value, char *digits, int *num_digits,
+                       int *exp10) {
+    char buf[32];
+    for (int precision = 1; ; precision++) {
+        sprintf(buf, "%.*e", precision - 1, value);
+        if (precision == 17 || strtod(buf, NULL) == value) { break; }
+    }
+
+    // Parse the output of `%e`: a digit, optionally a point and more
+    // digits, then the exponent.
+    const char *ptr = buf;
+    int         n   = 0;
+    for (; *ptr != 'e'; ptr++) {
+        if (*ptr != '.') { digits[n++] = *ptr; }
+    }
+    *num_digits = n;
+    *exp10      = atoi(ptr + 1) - (n - 1);
+}
+
+size_t
+StrHelp_format_f64(double value, char *buffer) {
+    if (value != value) {
+        memcpy(buffer, "nan", 4);
+        return 3;
+    }
+
+    char *ptr = buffer;
+    if (SI_is_negative(value)) {
+        *ptr++ = '-';
+        value = -value;
+    }
+    if (value == 0) {
+        memcpy(ptr, "0", 2);
+        return (size_t)(ptr - buffer) + 1;
+    }
+    if (value - value != 0) {
+        memcpy(ptr, "inf", 4);
+        return (size_t)(ptr - buffer) + 3;
+    }
+
+    char digits[20];
+    int  num_digits;
+    int  exp10;
+    if (!S_grisu3(value, digits, &num_digits, &exp10)) {
+        S_shortest_digits_slow(value, digits, &num_digits, &exp10);
+    }
+
+    uint64_t mantissa = 0;
+    for (int i = 0; i < num_digits; i++) {
+        mantissa = mantissa * 10 + (uint64_t)(digits[i] - '0');
+    }
+    while (mantissa % 10 == 0) {
+        mantissa   /= 10;
+        num_digits -= 1;
+        exp10      += 1;
+    }
+
+    // Like JavaScript's Number.prototype.toString, use fixed notation if
+    // the decimal point is close enough to the digits.
+    size_t size;
+    int    point = num_digits + exp10;
+    if (point > -6 && point <= 21) {
+        size = S_encode_fixed(ptr, mantissa, exp10);
+    }
+    else {
+        size = S_encode_scientific(ptr, mantissa, exp10);
+    }
+
+    return (size_t)(ptr - buffer) + size;
+}
+
+size_t
+StrHelp_format_f64_g(double value, char *buffer) {
+    double   magnitude = value < 0 ? -value : value;
+    uint64_t mantissa;
+    int      exp10;
+
+    // Fast path for values with at most six significant digits which are
+    // printed without exponent.  They are printed exactly by `%g`.
+    if (magnitude > 0
+        && magnitude - magnitude == 0
+        && S_exact_decimal(magnitude, &mantissa, &exp10)
+        && mantissa < 1000000
+       ) {
+        int num_digits = mantissa < 10     ? 1
+                         : mantissa < 100    ? 2
+                         : mantissa < 1000   ? 3
+                         : mantissa < 10000  ? 4
+                         : mantissa < 100000 ? 5
+                         : 6;
+        int exponent = num_digits + exp10 - 1;
+        if (exponent >= -4 && exponent < 6) {
+            char *ptr = buffer;
+            if (value < 0) { *ptr++ = '-'; }
+            return (size_t)(ptr - buffer)
+                   + S_encode_fixed(ptr, mantissa, exp10);
+        }
+    }
+
+    return (size_t)sprintf(buffer, "%g", value);
+}
+
+double
+StrHelp_parse_f64(const char *ptr, size_t size) {
+#ifndef NO_EXACT_DOUBLES
+    // Fast path for plain decimals whose digits fit in a double and which
+    // can be scaled with a single exact power of ten.  Everything else,
+    // including leading whitespace and trailing garbage, goes to strtod.
+    const char *end        = ptr + size;
+    const char *p          = ptr;
+    bool        negative   = false;
+    bool        has_digits = false;
+    uint64_t    mantissa   = 0;
+    int         num_digits = 0;
+    int         exp10      = 0;
+
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+    while (p < end && (unsigned)(*p - '0') < 10) {
+        if (mantissa != 0 || *p != '0') {
+            if (++num_digits > 19) { goto slow_path; }
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+        }
+        has_digits = true;
+        p++;
+    }
+    if (p < end && *p == '.') {
+        p++;
+        while (p < end && (unsigned)(*p - '0') < 10) {
+            if (mantissa != 0 || *p != '0') {
+                if (++num_digits > 19) { goto slow_path; }
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            }
+            if (--exp10 < -MAX_EXACT_POW10) { goto slow_path; }
+            has_digits = true;
+            p++;
+        }
+    }
+    if (!has_digits) { goto slow_path; }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        bool exp_negative = false;
+        int  exp          = 0;
+        p++;
+        if (p < end && (*p == '-' || *p == '+')) {
+            exp_negative = *p == '-';
+            p++;
+        }
+        if (p == end || (unsigned)(*p - '0') >= 10) { goto slow_path; }
+        while (p < end && (unsigned)(*p - '0') < 10) {
+            if (exp < 10000) { exp = exp * 10 + (*p - '0'); }
+            p++;
+        }
+        exp10 += exp_negative ? -exp : exp;
+    }
+    if (p != end) { goto slow_path; }
+
+    if (mantissa == 0) {
+        return negative ? -0.0 : 0.0;
+    }
+    if (mantissa > (uint64_t)TWO_POW_53) { goto slow_path; }
+
+    double value = (double)mantissa;
+    if (exp10 < 0) {
+        if (exp10 < -MAX_EXACT_POW10) { goto slow_path; }
+        value /= exact_pow10[-exp10];
+    }
+    else if (exp10 > 0) {
+        if (exp10 > MAX_EXACT_POW10) {
+            // Move excess powers of ten into the mantissa if it stays exact.
+            if (exp10 > MAX_EXACT_POW10 + 15) { goto slow_path; }
+            value *= exact_pow10[exp10 - MAX_EXACT_POW10];
+            if (value >= TWO_POW_53) { goto slow_path; }
+            exp10 = MAX_EXACT_POW10;
+        }
+        value *= exact_pow10[exp10];
+    }
+    return negative ? -value : value;
+
+slow_path:
+#endif
+    {
+        char    stack_buf[512];
+        char   *buf = size < sizeof(stack_buf)
+                      ? stack_buf
+                      : (char*)MALLOCATE(size + 1);
+        memcpy(buf, ptr, size);
+        buf[size] = '\0';
+        double value = strtod(buf, NULL);
+        if (buf != stack_buf) { FREEMEM(buf); }
+        return value;
+    }
+}
+
+int64_t
+StrHelp_parse_i64(const char *ptr, size_t size, uint32_t base) {
+    const char *end         = ptr + size;
+    uint64_t    retval      = 0;
+    bool        is_negative = false;
+
+    if (ptr < end && *ptr == '-') {
+        is_negative = true;
+        ptr++;
+    }
+
+    // Only ASCII characters can be digits, so there's no need to decode
+    // UTF-8.
+    for (; ptr < end; ptr++) {
+        uint32_t c = (uint8_t)*ptr;
+        uint32_t addend;
+        if (c - '0' < 10) {
+            addend = c - '0';
+        }
+        else if ((c | 0x20) - 'a' < 26) {
+            addend = (c | 0x20) - 'a' + 10;
+        }
+        else {
+            break;
+        }
+        if (addend >= base) { break; }
+        retval = retval * base + addend;
+    }
+
+    return is_negative ? (int64_t)(0 - retval) : (int64_t)retval;
+}
+
 bool
 StrHelp_utf8_valid(const char *ptr, size_t size) {
     const uint8_t *string    = (const uint8_t*)ptr;
@@ -0,0 +1,65 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef H_CLOWNFISH_UTIL_THREADLOCAL
+#define H_CLOWNFISH_UTIL_THREADLOCAL 1
+
+#include "charmony.h"
+#include "cfish_parcel.h"
+
+/** Storage class specifier for thread-local variables.
+ *
+ * CFISH_HAS_THREAD_LOCAL is defined if the compiler supports a
+ * thread-local storage class like `__thread`, `_Thread_local` or
+ * `__declspec(thread)`.  In this case, a variable declared with
+ * CFISH_THREAD_LOCAL can be accessed without a library call, which makes it
+ * a lot faster than pthread keys or TlsAlloc.
+ *
+ * Without thread support, CFISH_THREAD_LOCAL expands to nothing and
+ * declares a plain static variable.
+ *
+ * If threads are enabled but the compiler has no thread-local storage
+ * class, CFISH_HAS_THREAD_LOCAL is left undefined.  Code must check it and
+ * fall back to pthread keys or TlsAlloc.  Using CFISH_THREAD_LOCAL anyway
+ * fails to compile with an error naming the missing support.
+ *
+ * Note that compiler-level thread-local variables aren't cleaned up when a
+ * thread exits.  If a thread-local variable owns a resource, a destructor
+ * must be registered separately, for example with a pthread key.
+ */
+
+/************************** Single threaded *******************************/
+#ifdef CFISH_NOTHREADS
+
+#define CFISH_HAS_THREAD_LOCAL
+#define CFISH_THREAD_LOCAL
+
+/************************ __thread or _Thread_local ***********************/
+#elif defined(CHY_HAS_THREAD_LOCAL)
+
+#define CFISH_HAS_THREAD_LOCAL
+#define CFISH_THREAD_LOCAL CHY_THREAD_LOCAL
+
+/********************* No thread-local storage class **********************/
+#else
+
+#define CFISH_THREAD_LOCAL \
+    _Pragma("GCC error \"CFISH_THREAD_LOCAL is unsupported\"") \
+    cfish_no_thread_local_storage_class
+
+#endif /* Big platform if-else chain. */
+
+#endif /* H_CLOWNFISH_UTIL_THREADLOCAL */
@@ -0,0 +1,447 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define C_CFISH_UNICODE
+#define CFISH_USE_SHORT_NAMES
+
+#include <string.h>
+
+#ifdef __SSE2__
+  #include <emmintrin.h>
+#endif
+
+#include "Clownfish/Util/Unicode.h"
+#include "Clownfish/Err.h"
+#include "Clownfish/String.h"
+#include "Clownfish/Util/Memory.h"
+#include "Clownfish/Util/StringHelper.h"
+#include "Clownfish/Util/UnicodeTables.h"
+
+// Hangul syllables are composed of leading consonants, vowels and optional
+// trailing consonants.
+#define HANGUL_S_BASE   0xAC00
+#define HANGUL_L_BASE   0x1100
+#define HANGUL_V_BASE   0x1161
+#define HANGUL_T_BASE   0x11A7
+#define HANGUL_L_COUNT  19
+#define HANGUL_V_COUNT  21
+#define HANGUL_T_COUNT  28
+#define HANGUL_N_COUNT  (HANGUL_V_COUNT * HANGUL_T_COUNT)
+#define HANGUL_S_COUNT  (HANGUL_L_COUNT * HANGUL_N_COUNT)
+
+#define BLOCK_MASK ((1 << UNICODE_SHIFT) - 1)
+
+// Growable buffer for UTF-8 output.
+typedef struct {
+    char   *ptr;
+    size_t  size;
+    size_t  cap;
+} OutBuf;
+
+// Growable buffer for code points.
+typedef struct {
+    int32_t *ptr;
+    size_t   size;
+    size_t   cap;
+} CodePointBuf;
+
+static CFISH_INLINE const UnicodeProps*
+SI_props(int32_t code_point) {
+    if ((uint32_t)code_point >= UNICODE_LIMIT) { return unicode_props; }
+    uint32_t block = unicode_props_stage1[code_point >> UNICODE_SHIFT];
+    uint32_t index = (block << UNICODE_SHIFT) | (code_point & BLOCK_MASK);
+    return unicode_props + unicode_props_stage2[index];
+}
+
+// Return the decomposition header of a code point or NULL.
+static CFISH_INLINE const uint32_t*
+SI_decomp(int32_t code_point) {
+    if ((uint32_t)code_point >= UNICODE_LIMIT) { return NULL; }
+    uint32_t block = unicode_decomp_stage1[code_point >> UNICODE_SHIFT];
+    uint32_t index = (block << UNICODE_SHIFT) | (code_point & BLOCK_MASK);
+    uint16_t decomp = unicode_decomp_stage2[index];
+    return decomp ? unicode_decomps + decomp : NULL;
+}
+
+static CFISH_INLINE void
+SI_out_grow(OutBuf *buf, size_t extra) {
+    if (buf->cap - buf->size < extra) {
+        size_t cap = buf->cap * 2;
+        if (cap < buf->size + extra) { cap = buf->size + extra; }
+        buf->ptr = (char*)REALLOCATE(buf->ptr, cap);
+        buf->cap = cap;
+    }
+}
+
+static CFISH_INLINE void
+SI_out_cat_char(OutBuf *buf, int32_t code_point) {
+    SI_out_grow(buf, 4);
+    buf->size += StrHelp_encode_utf8_char(code_point, buf->ptr + buf->size);
+}
+
+static CFISH_INLINE void
+SI_cp_push(CodePointBuf *buf, int32_t code_point) {
+    if (buf->size == buf->cap) {
+        buf->cap = buf->cap * 2 + 16;
+        buf->ptr = (int32_t*)REALLOCATE(buf->ptr, buf->cap * sizeof(int32_t));
+    }
+    buf->ptr[buf->size++] = code_point;
+}
+
+static CFISH_INLINE bool
+SI_is_ascii_upper(uint8_t byte) {
+    return (uint8_t)(byte - 'A') < 26;
+}
+
+// Return the offset of the first byte at or after `offset` which isn't
+// ASCII or, if `stop_at_upper` is true, is an uppercase ASCII letter.
+static size_t
+S_skip_ascii(const uint8_t *ptr, size_t size, size_t offset,
+             bool stop_at_upper) {
+#ifdef __SSE2__
+    const __m128i before_a = _mm_set1_epi8('A' - 1);
+    const __m128i after_z  = _mm_set1_epi8('Z' + 1);
+    while (size - offset >= 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(ptr + offset));
+        __m128i hits  = bytes;
+        if (stop_at_upper) {
+            // Bytes with the high bit set compare as negative numbers.
+            __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(bytes, before_a),
+                                          _mm_cmplt_epi8(bytes, after_z));
+            hits = _mm_or_si128(hits, upper);
+        }
+        if (_mm_movemask_epi8(hits) != 0) { break; }
+        offset += 16;
+    }
+#else
+    if (!stop_at_upper) {
+        while (size - offset >= 8) {
+            uint64_t word;
+            memcpy(&word, ptr + offset, 8);
+            if (word & UINT64_C(0x8080808080808080)) { break; }
+            offset += 8;
+        }
+    }
+#endif
+    while (offset < size) {
+        uint8_t byte = ptr[offset];
+        if (byte >= 0x80 || (stop_at_upper && SI_is_ascii_upper(byte))) {
+            break;
+        }
+        offset++;
+    }
+    return offset;
+}
+
+// Append a lowercased run of ASCII characters starting at `*offset_ptr`.
+static void
+S_lower_ascii(OutBuf *buf, const uint8_t *ptr, size_t size,
+              size_t *offset_ptr) {
+    size_t offset = *offset_ptr;
+#ifdef __SSE2__
+    const __m128i before_a = _mm_set1_epi8('A' - 1);
+    const __m128i after_z  = _mm_set1_epi8('Z' + 1);
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+    while (size - offset >= 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(ptr + offset));
+        if (_mm_movemask_epi8(bytes) != 0) { break; }
+        __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(bytes, before_a),
+                                      _mm_cmplt_epi8(bytes, after_z));
+        bytes = _mm_add_epi8(bytes, _mm_and_si128(upper, case_bit));
+        SI_out_grow(buf, 16);
+        _mm_storeu_si128((__m128i*)(buf->ptr + buf->size), bytes);
+        buf->size += 16;
+        offset    += 16;
+    }
+#endif
+    while (offset < size && ptr[offset] < 0x80) {
+        uint8_t byte = ptr[offset++];
+        SI_out_grow(buf, 1);
+        buf->ptr[buf->size++] = SI_is_ascii_upper(byte) ? byte + 0x20 : byte;
+    }
+    *offset_ptr = offset;
+}
+
+static String*
+S_map_case(const char *utf8, size_t size, bool fold) {
+    const uint8_t *ptr = (const uint8_t*)utf8;
+    size_t offset = 0;
+
+    // Quick check: find the first character which changes.
+    while (true) {
+        offset = S_skip_ascii(ptr, size, offset, true);
+        if (offset >= size)    { return NULL; }
+        if (ptr[offset] < 0x80) { break; }
+        const UnicodeProps *props
+            = SI_props(StrHelp_decode_utf8_char(utf8 + offset));
+        if ((fold ? props->fold : props->lower) != 0) { break; }
+        offset += StrHelp_UTF8_COUNT[ptr[offset]];
+    }
+
+    OutBuf buf;
+    buf.cap  = size + size / 8 + 16;
+    buf.ptr  = (char*)MALLOCATE(buf.cap);
+    buf.size = offset;
+    memcpy(buf.ptr, utf8, offset);
+
+    while (offset < size) {
+        if (ptr[offset] < 0x80) {
+            S_lower_ascii(&buf, ptr, size, &offset);
+            continue;
+        }
+
+        int32_t code_point = StrHelp_decode_utf8_char(utf8 + offset);
+        size_t  len        = StrHelp_UTF8_COUNT[ptr[offset]];
+        const UnicodeProps *props = SI_props(code_point);
+        int32_t mapping = fold ? props->fold : props->lower;
+
+        if (mapping == 0) {
+            SI_out_grow(&buf, len);
+            memcpy(buf.ptr + buf.size, utf8 + offset, len);
+            buf.size += len;
+        }
+        else if (mapping >= UNICODE_SEQ_FLAG) {
+            const uint32_t *seq = unicode_sequences
+                                  + (mapping - UNICODE_SEQ_FLAG);
+            for (uint32_t i = 1; i <= seq[0]; i++) {
+                SI_out_cat_char(&buf, (int32_t)seq[i]);
+            }
+        }
+        else {
+            SI_out_cat_char(&buf, code_point + mapping);
+        }
+        offset += len;
+    }
+
+    SI_out_grow(&buf, 1);
+    buf.ptr[buf.size] = '\0';
+    return Str_new_steal_trusted_utf8(buf.ptr, buf.size);
+}
+
+String*
+Unicode_to_lower(const char *utf8, size_t size) {
+    return S_map_case(utf8, size, false);
+}
+
+String*
+Unicode_case_fold(const char *utf8, size_t size) {
+    return S_map_case(utf8, size, true);
+}
+
+const char*
+Unicode_version() {
+    return UNICODE_VERSION;
+}
+
+uint8_t
+Unicode_combining_class(int32_t code_point) {
+    return SI_props(code_point)->ccc;
+}
+
+// Return true if the text is known to be normalized.  Set `*maybe_ptr` if
+// it contains characters which may or may not be normalized depending on
+// context.
+static bool
+S_quick_check(const char *utf8, size_t size, bool compat, bool *maybe_ptr) {
+    const uint8_t *ptr = (const uint8_t*)utf8;
+    const uint8_t no_flag    = compat
+                               ? UNICODE_NFKC_QC_NO : UNICODE_NFC_QC_NO;
+    const uint8_t maybe_flag = compat
+                               ? UNICODE_NFKC_QC_MAYBE : UNICODE_NFC_QC_MAYBE;
+    uint8_t last_ccc = 0;
+    size_t  offset   = 0;
+
+    *maybe_ptr = false;
+    while (true) {
+        size_t next = S_skip_ascii(ptr, size, offset, false);
+        if (next != offset) {
+            last_ccc = 0;
+            offset   = next;
+        }
+        if (offset >= size) { break; }
+
+        const UnicodeProps *props
+            = SI_props(StrHelp_decode_utf8_char(utf8 + offset));
+        if (props->ccc != 0 && last_ccc > props->ccc) { return false; }
+        if (props->flags & no_flag)                    { return false; }
+        if (props->flags & maybe_flag)                 { *maybe_ptr = true; }
+        last_ccc = props->ccc;
+        offset += StrHelp_UTF8_COUNT[ptr[offset]];
+    }
+
+    return true;
+}
+
+static void
+S_decompose(CodePointBuf *buf, int32_t code_point, bool compat) {
+    uint32_t s_index = (uint32_t)(code_point - HANGUL_S_BASE);
+    if (s_index < HANGUL_S_COUNT) {
+        SI_cp_push(buf, HANGUL_L_BASE + s_index / HANGUL_N_COUNT);
+        SI_cp_push(buf, HANGUL_V_BASE
+                        + (s_index % HANGUL_N_COUNT) / HANGUL_T_COUNT);
+        if (s_index % HANGUL_T_COUNT != 0) {
+            SI_cp_push(buf, HANGUL_T_BASE + s_index % HANGUL_T_COUNT);
+        }
+        return;
+    }
+
+    const uint32_t *header = SI_decomp(code_point);
+    if (header) {
+        uint32_t canon_len  = header[0] & 0xFF;
+        uint32_t compat_len = (header[0] >> 8) & 0xFF;
+        const uint32_t *seq = header + 1;
+        uint32_t len = canon_len;
+        if (compat && compat_len != 0) {
+            seq += canon_len;
+            len  = compat_len;
+        }
+        if (len != 0) {
+            for (uint32_t i = 0; i < len; i++) {
+                SI_cp_push(buf, (int32_t)seq[i]);
+            }
+            return;
+        }
+    }
+
+    SI_cp_push(buf, code_point);
+}
+
+// Sort runs of combining characters by combining class.  The sort must be
+// stable.
+static void
+S_reorder(int32_t *code_points, size_t num) {
+    for (size_t i = 1; i < num; i++) {
+        int32_t code_point = code_points[i];
+        uint8_t ccc        = SI_props(code_point)->ccc;
+        if (ccc == 0) { continue; }
+        size_t j = i;
+        while (j > 0 && SI_props(code_points[j - 1])->ccc > ccc) {
+            code_points[j] = code_points[j - 1];
+            j--;
+        }
+        code_points[j] = code_point;
+    }
+}
+
+// Return the primary composite of two code points or -1.
+static int32_t
+S_compose_pair(int32_t first, int32_t second) {
+    uint32_t l_index = (uint32_t)(first - HANGUL_L_BASE);
+    uint32_t v_index = (uint32_t)(second - HANGUL_V_BASE);
+    if (l_index < HANGUL_L_COUNT && v_index < HANGUL_V_COUNT) {
+        return HANGUL_S_BASE
+               + (l_index * HANGUL_V_COUNT + v_index) * HANGUL_T_COUNT;
+    }
+    uint32_t s_index = (uint32_t)(first - HANGUL_S_BASE);
+    uint32_t t_index = (uint32_t)(second - HANGUL_T_BASE);
+    if (s_index < HANGUL_S_COUNT && s_index % HANGUL_T_COUNT == 0
+        && t_index - 1 < HANGUL_T_COUNT - 1
+       ) {
+        return first + (int32_t)t_index;
+    }
+
+    size_t lo = 0;
+    size_t hi = sizeof(unicode_compositions) / sizeof(UnicodeComposition);
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        const UnicodeComposition *comp = &unicode_compositions[mid];
+        if (comp->first < (uint32_t)first
+            || (comp->first == (uint32_t)first
+                && comp->second < (uint32_t)second)
+           ) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    if (lo < sizeof(unicode_compositions) / sizeof(UnicodeComposition)) {
+        const UnicodeComposition *comp = &unicode_compositions[lo];
+        if (comp->first == (uint32_t)first
+            && comp->second == (uint32_t)second
+           ) {
+            return (int32_t)comp->composite;
+        }
+    }
+    return -1;
+}
+
+// Compose a canonically ordered decomposition in place and return the new
+// number of code points.
+static size_t
+S_compose(int32_t *code_points, size_t num) {
+    if (num == 0) { return 0; }
+
+    size_t starter = 0;
+    size_t out     = 1;
+    // A leading combining character blocks all compositions with it.
+    int last_ccc = SI_props(code_points[0])->ccc ? 256 : 0;
+
+    for (size_t i = 1; i < num; i++) {
+        int32_t code_point = code_points[i];
+        int     ccc        = SI_props(code_point)->ccc;
+        int32_t composite  = S_compose_pair(code_points[starter], code_point);
+        if (composite >= 0 && (last_ccc < ccc || last_ccc == 0)) {
+            code_points[starter] = composite;
+            continue;
+        }
+        if (ccc == 0) { starter = out; }
+        last_ccc = ccc;
+        code_points[out++] = code_point;
+    }
+
+    return out;
+}
+
+String*
+Unicode_normalize(const char *utf8, size_t size, bool compat) {
+    bool maybe;
+    if (S_quick_check(utf8, size, compat, &maybe) && !maybe) {
+        return NULL;
+    }
+
+    const uint8_t *ptr = (const uint8_t*)utf8;
+    CodePointBuf buf;
+    buf.cap  = size + 16;
+    buf.size = 0;
+    buf.ptr  = (int32_t*)MALLOCATE(buf.cap * sizeof(int32_t));
+
+    size_t offset = 0;
+    while (offset < size) {
+        uint8_t byte = ptr[offset];
+        if (byte < 0x80) {
+            SI_cp_push(&buf, byte);
+            offset++;
+        }
+        else {
+            S_decompose(&buf, StrHelp_decode_utf8_char(utf8 + offset),
+                        compat);
+            offset += StrHelp_UTF8_COUNT[byte];
+        }
+    }
+
+    S_reorder(buf.ptr, buf.size);
+    size_t num = S_compose(buf.ptr, buf.size);
+    String *result = Str_encode_from(buf.ptr, num);
+    FREEMEM(buf.ptr);
+
+    if (Str_Equals_Utf8(result, utf8, size)) {
+        DECREF(result);
+        return NULL;
+    }
+    return result;
+}
+
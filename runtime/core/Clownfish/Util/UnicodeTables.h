@@ -0,0 +1,3920 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* This file was generated by devel/bin/gen_unicode_tables.pl from the
+ * Unicode Character Database, version 14.0.0.  Don't edit it directly.
+ *
+ * Properties are looked up in two stages: the high bits of a code point
+ * select a block in stage 1, the low bits an entry in the shared stage 2
+ * blocks.
+ */
+
+#define UNICODE_VERSION       "14.0.0"
+#define UNICODE_LIMIT         0x30000
+#define UNICODE_SHIFT         5
+#define UNICODE_NFC_QC_NO     0x01
+#define UNICODE_NFC_QC_MAYBE  0x02
+#define UNICODE_NFKC_QC_NO    0x04
+#define UNICODE_NFKC_QC_MAYBE 0x08
+#define UNICODE_SEQ_FLAG      0x40000000
+
+/* Case mappings are either a delta to the code point or, if not less than
+ * UNICODE_SEQ_FLAG, UNICODE_SEQ_FLAG plus an index into unicode_sequences.
+ */
+typedef struct {
+    uint8_t ccc;
+    uint8_t flags;
+    int32_t lower;
+    int32_t fold;
+} UnicodeProps;
+
+/* Composition of two code points into a primary composite. */
+typedef struct {
+    uint32_t first;
+    uint32_t second;
+    uint32_t composite;
+} UnicodeComposition;
+
+static const UnicodeProps unicode_props[280] = {
+    { 0, 0, 0, 0 },
+    { 0, 0, 32, 32 },
+    { 0, 4, 0, 0 },
+    { 0, 4, 0, 775 },
+    { 0, 0, 0, 1073741825 },
+    { 0, 0, 1, 1 },
+    { 0, 0, 1073741828, 1073741828 },
+    { 0, 4, 1, 1 },
+    { 0, 4, 0, 1073741831 },
+    { 0, 0, -121, -121 },
+    { 0, 4, 0, -268 },
+    { 0, 0, 210, 210 },
+    { 0, 0, 206, 206 },
+    { 0, 0, 205, 205 },
+    { 0, 0, 79, 79 },
+    { 0, 0, 202, 202 },
+    { 0, 0, 203, 203 },
+    { 0, 0, 207, 207 },
+    { 0, 0, 211, 211 },
+    { 0, 0, 209, 209 },
+    { 0, 0, 213, 213 },
+    { 0, 0, 214, 214 },
+    { 0, 0, 218, 218 },
+    { 0, 0, 217, 217 },
+    { 0, 0, 219, 219 },
+    { 0, 4, 2, 2 },
+    { 0, 0, 0, 1073741834 },
+    { 0, 0, -97, -97 },
+    { 0, 0, -56, -56 },
+    { 0, 0, -130, -130 },
+    { 0, 0, 10795, 10795 },
+    { 0, 0, -163, -163 },
+    { 0, 0, 10792, 10792 },
+    { 0, 0, -195, -195 },
+    { 0, 0, 69, 69 },
+    { 0, 0, 71, 71 },
+    { 230, 10, 0, 0 },
+    { 230, 0, 0, 0 },
+    { 232, 0, 0, 0 },
+    { 220, 0, 0, 0 },
+    { 216, 10, 0, 0 },
+    { 202, 0, 0, 0 },
+    { 220, 10, 0, 0 },
+    { 202, 10, 0, 0 },
+    { 1, 0, 0, 0 },
+    { 1, 10, 0, 0 },
+    { 230, 5, 0, 0 },
+    { 240, 10, 0, 116 },
+    { 233, 0, 0, 0 },
+    { 234, 0, 0, 0 },
+    { 0, 5, 0, 0 },
+    { 0, 0, 116, 116 },
+    { 0, 0, 38, 38 },
+    { 0, 0, 37, 37 },
+    { 0, 0, 64, 64 },
+    { 0, 0, 63, 63 },
+    { 0, 0, 0, 1073741837 },
+    { 0, 0, 0, 1073741841 },
+    { 0, 0, 0, 1 },
+    { 0, 0, 8, 8 },
+    { 0, 4, 0, -30 },
+    { 0, 4, 0, -25 },
+    { 0, 4, 0, -15 },
+    { 0, 4, 0, -22 },
+    { 0, 4, 0, -54 },
+    { 0, 4, 0, -48 },
+    { 0, 4, -60, -60 },
+    { 0, 4, 0, -64 },
+    { 0, 4, -7, -7 },
+    { 0, 0, 80, 80 },
+    { 0, 0, 15, 15 },
+    { 0, 0, 48, 48 },
+    { 0, 4, 0, 1073741845 },
+    { 222, 0, 0, 0 },
+    { 228, 0, 0, 0 },
+    { 10, 0, 0, 0 },
+    { 11, 0, 0, 0 },
+    { 12, 0, 0, 0 },
+    { 13, 0, 0, 0 },
+    { 14, 0, 0, 0 },
+    { 15, 0, 0, 0 },
+    { 16, 0, 0, 0 },
+    { 17, 0, 0, 0 },
+    { 18, 0, 0, 0 },
+    { 19, 0, 0, 0 },
+    { 20, 0, 0, 0 },
+    { 21, 0, 0, 0 },
+    { 22, 0, 0, 0 },
+    { 23, 0, 0, 0 },
+    { 24, 0, 0, 0 },
+    { 25, 0, 0, 0 },
+    { 30, 0, 0, 0 },
+    { 31, 0, 0, 0 },
+    { 32, 0, 0, 0 },
+    { 27, 0, 0, 0 },
+    { 28, 0, 0, 0 },
+    { 29, 0, 0, 0 },
+    { 33, 0, 0, 0 },
+    { 34, 0, 0, 0 },
+    { 35, 0, 0, 0 },
+    { 36, 0, 0, 0 },
+    { 7, 10, 0, 0 },
+    { 9, 0, 0, 0 },
+    { 7, 0, 0, 0 },
+    { 0, 10, 0, 0 },
+    { 84, 0, 0, 0 },
+    { 91, 10, 0, 0 },
+    { 9, 10, 0, 0 },
+    { 103, 0, 0, 0 },
+    { 107, 0, 0, 0 },
+    { 118, 0, 0, 0 },
+    { 122, 0, 0, 0 },
+    { 216, 0, 0, 0 },
+    { 129, 0, 0, 0 },
+    { 130, 0, 0, 0 },
+    { 132, 0, 0, 0 },
+    { 0, 0, 7264, 7264 },
+    { 0, 0, 38864, 0 },
+    { 0, 0, 8, 0 },
+    { 0, 0, 0, -8 },
+    { 0, 0, 0, -6222 },
+    { 0, 0, 0, -6221 },
+    { 0, 0, 0, -6212 },
+    { 0, 0, 0, -6210 },
+    { 0, 0, 0, -6211 },
+    { 0, 0, 0, -6204 },
+    { 0, 0, 0, -6180 },
+    { 0, 0, 0, 35267 },
+    { 0, 0, -3008, -3008 },
+    { 214, 0, 0, 0 },
+    { 218, 0, 0, 0 },
+    { 0, 0, 0, 1073741848 },
+    { 0, 0, 0, 1073741851 },
+    { 0, 0, 0, 1073741854 },
+    { 0, 0, 0, 1073741857 },
+    { 0, 4, 0, 1073741860 },
+    { 0, 4, 0, -58 },
+    { 0, 0, -7615, 1073741825 },
+    { 0, 0, -8, -8 },
+    { 0, 0, 0, 1073741863 },
+    { 0, 0, 0, 1073741866 },
+    { 0, 0, 0, 1073741870 },
+    { 0, 0, 0, 1073741874 },
+    { 0, 0, 0, 1073741878 },
+    { 0, 0, 0, 1073741881 },
+    { 0, 0, 0, 1073741884 },
+    { 0, 0, 0, 1073741887 },
+    { 0, 0, 0, 1073741890 },
+    { 0, 0, 0, 1073741893 },
+    { 0, 0, 0, 1073741896 },
+    { 0, 0, 0, 1073741899 },
+    { 0, 0, -8, 1073741878 },
+    { 0, 0, -8, 1073741881 },
+    { 0, 0, -8, 1073741884 },
+    { 0, 0, -8, 1073741887 },
+    { 0, 0, -8, 1073741890 },
+    { 0, 0, -8, 1073741893 },
+    { 0, 0, -8, 1073741896 },
+    { 0, 0, -8, 1073741899 },
+    { 0, 0, 0, 1073741902 },
+    { 0, 0, 0, 1073741905 },
+    { 0, 0, 0, 1073741908 },
+    { 0, 0, 0, 1073741911 },
+    { 0, 0, 0, 1073741914 },
+    { 0, 0, 0, 1073741917 },
+    { 0, 0, 0, 1073741920 },
+    { 0, 0, 0, 1073741923 },
+    { 0, 0, -8, 1073741902 },
+    { 0, 0, -8, 1073741905 },
+    { 0, 0, -8, 1073741908 },
+    { 0, 0, -8, 1073741911 },
+    { 0, 0, -8, 1073741914 },
+    { 0, 0, -8, 1073741917 },
+    { 0, 0, -8, 1073741920 },
+    { 0, 0, -8, 1073741923 },
+    { 0, 0, 0, 1073741926 },
+    { 0, 0, 0, 1073741929 },
+    { 0, 0, 0, 1073741932 },
+    { 0, 0, 0, 1073741935 },
+    { 0, 0, 0, 1073741938 },
+    { 0, 0, 0, 1073741941 },
+    { 0, 0, 0, 1073741944 },
+    { 0, 0, 0, 1073741947 },
+    { 0, 0, -8, 1073741926 },
+    { 0, 0, -8, 1073741929 },
+    { 0, 0, -8, 1073741932 },
+    { 0, 0, -8, 1073741935 },
+    { 0, 0, -8, 1073741938 },
+    { 0, 0, -8, 1073741941 },
+    { 0, 0, -8, 1073741944 },
+    { 0, 0, -8, 1073741947 },
+    { 0, 0, 0, 1073741950 },
+    { 0, 0, 0, 1073741953 },
+    { 0, 0, 0, 1073741956 },
+    { 0, 0, 0, 1073741959 },
+    { 0, 0, 0, 1073741962 },
+    { 0, 0, -74, -74 },
+    { 0, 5, -74, -74 },
+    { 0, 0, -9, 1073741953 },
+    { 0, 5, 0, -7173 },
+    { 0, 0, 0, 1073741966 },
+    { 0, 0, 0, 1073741969 },
+    { 0, 0, 0, 1073741972 },
+    { 0, 0, 0, 1073741975 },
+    { 0, 0, 0, 1073741978 },
+    { 0, 0, -86, -86 },
+    { 0, 5, -86, -86 },
+    { 0, 0, -9, 1073741969 },
+    { 0, 0, 0, 1073741982 },
+    { 0, 5, 0, 1073741837 },
+    { 0, 0, 0, 1073741986 },
+    { 0, 0, 0, 1073741989 },
+    { 0, 0, -100, -100 },
+    { 0, 5, -100, -100 },
+    { 0, 0, 0, 1073741993 },
+    { 0, 5, 0, 1073741841 },
+    { 0, 0, 0, 1073741997 },
+    { 0, 0, 0, 1073742000 },
+    { 0, 0, 0, 1073742003 },
+    { 0, 0, -112, -112 },
+    { 0, 5, -112, -112 },
+    { 0, 0, -7, -7 },
+    { 0, 0, 0, 1073742007 },
+    { 0, 0, 0, 1073742010 },
+    { 0, 0, 0, 1073742013 },
+    { 0, 0, 0, 1073742016 },
+    { 0, 0, 0, 1073742019 },
+    { 0, 0, -128, -128 },
+    { 0, 5, -128, -128 },
+    { 0, 0, -126, -126 },
+    { 0, 5, -126, -126 },
+    { 0, 0, -9, 1073742010 },
+    { 0, 5, -7517, -7517 },
+    { 0, 5, -8383, -8383 },
+    { 0, 5, -8262, -8262 },
+    { 0, 0, 28, 28 },
+    { 0, 4, 16, 16 },
+    { 0, 4, 26, 26 },
+    { 0, 0, -10743, -10743 },
+    { 0, 0, -3814, -3814 },
+    { 0, 0, -10727, -10727 },
+    { 0, 0, -10780, -10780 },
+    { 0, 0, -10749, -10749 },
+    { 0, 0, -10783, -10783 },
+    { 0, 0, -10782, -10782 },
+    { 0, 0, -10815, -10815 },
+    { 224, 0, 0, 0 },
+    { 8, 10, 0, 0 },
+    { 0, 0, -35332, -35332 },
+    { 0, 0, -42280, -42280 },
+    { 0, 0, -42308, -42308 },
+    { 0, 0, -42319, -42319 },
+    { 0, 0, -42315, -42315 },
+    { 0, 0, -42305, -42305 },
+    { 0, 0, -42258, -42258 },
+    { 0, 0, -42282, -42282 },
+    { 0, 0, -42261, -42261 },
+    { 0, 0, 928, 928 },
+    { 0, 0, -48, -48 },
+    { 0, 0, -42307, -42307 },
+    { 0, 0, -35384, -35384 },
+    { 0, 0, 0, -38864 },
+    { 0, 4, 0, 1073742023 },
+    { 0, 4, 0, 1073742026 },
+    { 0, 4, 0, 1073742029 },
+    { 0, 4, 0, 1073742032 },
+    { 0, 4, 0, 1073742036 },
+    { 0, 4, 0, 1073742040 },
+    { 0, 4, 0, 1073742043 },
+    { 0, 4, 0, 1073742046 },
+    { 0, 4, 0, 1073742049 },
+    { 0, 4, 0, 1073742052 },
+    { 0, 4, 0, 1073742055 },
+    { 26, 0, 0, 0 },
+    { 0, 4, 32, 32 },
+    { 0, 0, 40, 40 },
+    { 0, 0, 39, 39 },
+    { 6, 0, 0, 0 },
+    { 226, 0, 0, 0 },
+    { 0, 0, 34, 34 },
+};
+
+static const uint16_t unicode_props_stage1[6144] = {
+    0, 0, 1, 0, 0, 2, 3, 0, 4, 5, 6, 7, 8, 9, 10, 11, 4, 12, 13, 0, 0, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 0, 4, 27, 4, 28, 4, 4, 29, 30,
+    0, 31, 32, 33, 0, 34, 0, 35, 36, 0, 0, 37, 38, 39, 40, 41, 0, 0, 0, 0, 42,
+    43, 44, 45, 0, 46, 0, 47, 48, 0, 49, 50, 0, 0, 51, 52, 53, 0, 54, 55, 0,
+    0, 56, 57, 0, 0, 51, 58, 0, 0, 59, 60, 0, 0, 56, 61, 0, 0, 56, 62, 0, 0,
+    63, 60, 0, 0, 0, 64, 0, 0, 65, 66, 0, 0, 67, 68, 0, 69, 70, 71, 72, 73,
+    74, 75, 0, 0, 76, 0, 0, 77, 78, 79, 80, 0, 0, 0, 81, 0, 82, 83, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 84, 0, 0, 85, 85, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 88, 0, 0, 0, 0, 89, 0, 0,
+    0, 0, 0, 0, 90, 0, 0, 0, 91, 0, 0, 0, 0, 0, 0, 92, 0, 0, 93, 0, 94, 95, 0,
+    0, 96, 97, 98, 0, 99, 0, 100, 0, 101, 0, 0, 102, 103, 104, 105, 0, 106,
+    107, 108, 109, 110, 111, 112, 4, 4, 4, 4, 113, 4, 4, 4, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+    132, 133, 134, 0, 0, 0, 0, 135, 0, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 110, 110, 137, 138, 139, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 140, 0, 0, 141, 0, 0, 142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 143, 144,
+    0, 145, 4, 4, 4, 146, 0, 0, 0, 147, 0, 0, 0, 148, 0, 0, 0, 0, 149, 0, 0,
+    150, 110, 110, 110, 110, 110, 110, 151, 0, 152, 153, 0, 0, 154, 0, 0, 149,
+    0, 155, 110, 110, 156, 0, 0, 0, 157, 110, 158, 157, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 159, 160, 0, 0, 161, 0, 162, 4, 163, 164, 165, 166, 167, 168,
+    169, 0, 0, 0, 0, 97, 170, 0, 171, 172, 0, 0, 173, 174, 0, 0, 0, 0, 0, 0,
+    175, 176, 177, 0, 0, 178, 179, 180, 180, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 181, 181, 181, 181, 181, 181, 181, 181, 182, 183,
+    181, 184, 181, 181, 185, 0, 186, 187, 188, 110, 110, 189, 190, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 191, 192, 110, 193, 110, 194, 195,
+    196, 197, 198, 199, 110, 110, 110, 200, 201, 202, 110, 110, 110, 157, 203,
+    204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 205, 0, 0, 0, 0, 0, 0,
+    0, 206, 0, 0, 0, 207, 0, 0, 0, 0, 208, 209, 0, 0, 0, 210, 211, 0, 0, 0, 0,
+    212, 213, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 214, 215, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 216, 217, 0, 0, 0, 0, 0, 218,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 219, 220, 0, 0, 0, 221, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 222, 0, 0, 0, 0, 223, 0, 224, 0, 0, 0, 0, 0, 168, 225,
+    0, 226, 0, 0, 227, 228, 0, 173, 0, 0, 229, 0, 0, 230, 0, 0, 0, 0, 0, 231,
+    0, 232, 60, 233, 0, 0, 0, 0, 0, 0, 234, 0, 0, 235, 236, 0, 0, 0, 0, 0, 0,
+    237, 238, 0, 0, 239, 0, 0, 0, 240, 0, 0, 0, 241, 0, 0, 0, 0, 0, 0, 0, 242,
+    0, 0, 0, 243, 0, 0, 0, 244, 245, 0, 0, 0, 0, 174, 0, 88, 246, 0, 247, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 239, 0, 0, 0, 0, 0, 0, 0, 0, 248, 0, 249,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 250, 0, 251, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 243, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 252, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 255, 256, 257,
+    258, 0, 0, 0, 259, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 110, 260,
+    110, 261, 262, 263, 110, 264, 265, 266, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 267, 110, 110, 110, 110, 110, 110, 110, 110, 268, 110, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 269, 270, 0, 0, 0, 0, 0, 0, 0, 251,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 271, 0, 272, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 0, 274, 275, 276, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 263, 277, 278, 279, 280, 281, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 282, 283, 284, 285, 286, 0, 0, 0, 287, 288,
+    289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 196, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 290,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t unicode_props_stage2[9312] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2,
+    0, 0, 0, 0, 2, 0, 0, 2, 2, 2, 3, 0, 0, 2, 2, 2, 0, 2, 2, 2, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+    1, 1, 4, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+    5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 6, 0, 7, 2, 5, 0, 5, 0, 0, 5, 0, 5, 0, 5, 0, 7, 2, 5, 0, 5, 0, 5, 0, 5,
+    0, 8, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 9, 5,
+    0, 5, 0, 5, 0, 10, 0, 11, 5, 0, 5, 0, 12, 5, 0, 13, 13, 5, 0, 0, 14, 15,
+    16, 5, 0, 13, 17, 0, 18, 19, 5, 0, 0, 0, 18, 20, 0, 21, 5, 0, 5, 0, 5, 0,
+    22, 5, 0, 22, 0, 0, 5, 0, 22, 5, 0, 23, 23, 5, 0, 5, 0, 24, 5, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 25, 7, 2, 25, 7, 2, 25, 7, 2, 5, 0, 5, 0, 5, 0, 5, 0,
+    5, 0, 5, 0, 5, 0, 5, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+    5, 0, 26, 25, 7, 2, 5, 0, 27, 28, 5, 0, 5, 0, 5, 0, 5, 0, 29, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 0, 0, 0, 0, 0, 0, 30, 5, 0,
+    31, 32, 0, 0, 5, 0, 33, 34, 35, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 0,
+    0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 36, 36, 36, 36, 36, 37, 36, 36, 36, 36, 36, 36,
+    36, 37, 37, 36, 37, 36, 37, 36, 36, 38, 39, 39, 39, 39, 38, 40, 39, 39,
+    39, 39, 39, 41, 41, 42, 42, 42, 42, 43, 43, 39, 39, 39, 39, 42, 42, 39,
+    42, 42, 39, 39, 44, 44, 44, 44, 45, 39, 39, 39, 39, 37, 37, 37, 46, 46,
+    36, 46, 46, 47, 37, 39, 39, 39, 37, 37, 37, 39, 39, 0, 37, 37, 37, 39, 39,
+    39, 39, 37, 38, 39, 39, 37, 48, 49, 49, 48, 49, 49, 48, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 5, 0, 5, 0, 50, 0, 5, 0, 0, 0, 2, 0,
+    0, 0, 50, 51, 0, 0, 0, 0, 2, 2, 52, 50, 53, 53, 53, 0, 54, 0, 55, 55, 56,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 60, 61, 2, 2, 2, 62, 63, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 64,
+    65, 2, 0, 66, 67, 0, 5, 0, 68, 5, 0, 0, 29, 29, 29, 69, 69, 69, 69, 69,
+    69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 37, 37, 37, 37, 37, 0, 0,
+    5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 70, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 0, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 39, 37, 37, 37, 37, 39, 37, 37, 37, 73, 39, 37, 37, 37, 37, 37, 37, 39,
+    39, 39, 39, 39, 39, 37, 37, 39, 37, 37, 73, 74, 37, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 84, 85, 86, 87, 0, 88, 0, 89, 90, 0, 37, 39, 0, 83, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37,
+    91, 92, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 95, 96,
+    91, 92, 93, 97, 98, 36, 36, 42, 39, 37, 37, 37, 37, 37, 39, 37, 37, 39, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 0, 0, 0, 0, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 0, 0, 37, 37, 37, 37, 39, 37, 0,
+    0, 37, 37, 0, 39, 37, 37, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 37, 39, 37, 37, 39, 37, 37, 39, 39, 39, 37, 39, 39, 37, 39, 37, 37,
+    37, 39, 37, 39, 37, 39, 37, 39, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37,
+    37, 37, 37, 37, 39, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 37, 37, 37, 0, 37, 37, 37, 37, 37,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 39, 39, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 39, 39, 39, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37,
+    37, 37, 39, 39, 39, 39, 39, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 0, 39, 37, 37, 39, 37, 37, 39, 37, 37, 37, 39, 39, 39, 94, 95,
+    96, 37, 37, 37, 39, 37, 37, 39, 39, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 37, 39, 37, 37,
+    0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 0, 104, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 0,
+    0, 0, 0, 50, 50, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 50, 0, 0, 0, 0, 0, 103, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 50, 50, 50, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0,
+    104, 104, 0, 0, 0, 0, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0,
+    0, 105, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 104, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    102, 102, 0, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107, 0, 0, 0, 0, 104,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 108, 108, 102, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 109, 109, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 110, 110, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 111, 111, 111, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 39, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 50, 0, 0, 0, 0, 50, 0, 0,
+    0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0,
+    113, 114, 50, 115, 50, 50, 2, 50, 2, 114, 114, 114, 114, 0, 0, 114, 50,
+    37, 37, 102, 0, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 50, 0, 0, 0, 0, 50, 0, 0, 0, 0, 50, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 0, 0, 0, 0, 0, 0, 0, 0,
+    103, 0, 102, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 116, 116, 116,
+    116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+    116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+    116, 116, 116, 116, 116, 0, 116, 0, 0, 0, 0, 0, 116, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 37, 37, 37, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+    117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+    117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+    117, 117, 117, 117, 117, 117, 117, 118, 118, 118, 118, 118, 118, 0, 0,
+    119, 119, 119, 119, 119, 119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 102, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 37, 39, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 37, 39, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 39, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 39, 39, 39, 39,
+    39, 39, 37, 37, 39, 0, 39, 39, 37, 37, 39, 39, 37, 37, 37, 37, 37, 39, 37,
+    37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 104, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 39, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 102, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 0, 0, 0, 0, 0, 0, 0,
+    0, 120, 121, 122, 123, 123, 124, 125, 126, 127, 0, 0, 0, 0, 0, 0, 0, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 0, 128,
+    128, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 0,
+    44, 39, 39, 39, 39, 39, 37, 37, 39, 39, 39, 39, 37, 0, 44, 44, 44, 44, 44,
+    44, 44, 0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 37, 37, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 37, 37, 39, 37, 37, 37, 37, 37, 37,
+    37, 39, 37, 37, 49, 129, 39, 41, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 74, 74, 39, 130, 37, 48, 39, 37,
+    39, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 131,
+    132, 133, 134, 135, 136, 0, 0, 137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 138, 138,
+    138, 138, 138, 138, 138, 138, 0, 0, 0, 0, 0, 0, 0, 0, 138, 138, 138, 138,
+    138, 138, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 138, 138, 138, 138, 138, 138, 138,
+    138, 0, 0, 0, 0, 0, 0, 0, 0, 138, 138, 138, 138, 138, 138, 138, 138, 0, 0,
+    0, 0, 0, 0, 0, 0, 138, 138, 138, 138, 138, 138, 0, 0, 139, 0, 140, 0, 141,
+    0, 142, 0, 0, 138, 0, 138, 0, 138, 0, 138, 0, 0, 0, 0, 0, 0, 0, 0, 138,
+    138, 138, 138, 138, 138, 138, 138, 0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 0,
+    50, 0, 50, 0, 0, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153,
+    154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168,
+    169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+    184, 185, 186, 187, 188, 189, 190, 0, 0, 191, 192, 193, 0, 194, 195, 138,
+    138, 196, 197, 198, 2, 199, 2, 2, 2, 200, 201, 202, 0, 203, 204, 205, 206,
+    205, 206, 207, 2, 2, 2, 0, 0, 208, 209, 0, 0, 210, 211, 138, 138, 212,
+    213, 0, 2, 2, 2, 0, 0, 214, 215, 216, 0, 217, 218, 138, 138, 219, 220,
+    221, 2, 50, 50, 0, 0, 222, 223, 224, 0, 225, 226, 227, 228, 229, 230, 231,
+    50, 2, 0, 50, 50, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 2, 2, 0, 2, 2, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 44, 44, 37, 37, 37, 37, 44,
+    44, 44, 37, 37, 0, 0, 0, 0, 37, 0, 0, 0, 44, 44, 37, 39, 37, 44, 44, 39,
+    39, 39, 39, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+    0, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 0, 0, 2, 2, 2, 2,
+    2, 0, 0, 2, 2, 2, 0, 2, 0, 232, 0, 2, 0, 233, 234, 2, 2, 0, 2, 2, 2, 235,
+    2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0,
+    0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 236, 236, 236,
+    236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 5, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+    237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+    237, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 5, 0, 238, 239, 240, 0, 0, 5, 0, 5, 0, 5, 0, 241, 242, 243,
+    244, 0, 5, 0, 0, 5, 0, 0, 0, 0, 0, 0, 2, 2, 245, 245, 5, 0, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 5, 0, 37, 37, 37, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 102, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 74, 38, 73, 246, 246,
+    0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 247, 247, 2, 2, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 0, 37, 0, 0, 0, 0, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 2, 2, 37, 37, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 0, 0, 5, 0,
+    5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0, 248, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 0, 0, 0, 5, 0, 249, 0, 0, 5, 0, 5, 0, 0, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 250, 251, 252, 253, 250, 0, 254,
+    255, 256, 257, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 258, 259,
+    260, 5, 0, 5, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 5, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 5, 0,
+    0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 37, 37, 39, 0, 0, 37, 37, 0,
+    0, 0, 0, 0, 37, 37, 0, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 261, 261, 261,
+    261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+    261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+    261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 50, 0, 50, 0, 0, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 0, 50, 0, 50, 0, 0, 50, 50, 0, 0, 0, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 262, 263, 264, 265, 266, 267, 267,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 268, 269, 270, 271, 272, 0, 0, 0, 0,
+    0, 50, 273, 50, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 0, 50, 0, 50, 50, 0, 50,
+    50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 39, 39,
+    39, 39, 39, 39, 39, 37, 37, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0, 0, 0, 0, 2,
+    2, 2, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+    274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 2,
+    2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2,
+    2, 2, 2, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0,
+    0, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 275, 275, 275, 275,
+    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+    275, 275, 275, 275, 275, 275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+    275, 275, 275, 275, 275, 275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 276, 276, 0, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 276, 276, 276, 0, 276, 276, 276, 276, 276, 276, 276, 0, 276,
+    276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 37, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 37, 44, 39, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 37,
+    39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 39, 39, 37, 37, 37, 39, 37, 39, 39, 39, 39, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 39, 37, 39, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 102, 101, 0, 0, 0, 0, 0, 37, 37, 37, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 102, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 103, 0, 104, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 0, 0, 104, 0, 0, 0,
+    0, 102, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 103, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 102, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    102, 103, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 102, 0,
+    0, 0, 0, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0,
+    0, 103, 0, 102, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37,
+    37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 277, 277, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 112, 112, 44, 44, 44,
+    0, 0, 0, 278, 112, 112, 112, 112, 112, 0, 0, 0, 0, 0, 0, 0, 0, 39, 39, 39,
+    39, 39, 39, 39, 39, 0, 0, 37, 37, 37, 37, 37, 39, 39, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37,
+    37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 2, 2, 0, 0, 2, 0, 0, 2, 2, 0, 0, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2,
+    2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 0, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 37, 37, 37, 37, 37, 37, 37, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 0, 37,
+    37, 0, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 39, 39, 39, 39, 39, 39, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279,
+    279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279,
+    279, 279, 279, 279, 279, 279, 279, 279, 279, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 2, 0, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 2, 2, 2, 2, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 0, 2,
+    0, 2, 2, 2, 0, 2, 2, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 2, 0, 2,
+    0, 0, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 0, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0,
+};
+
+static const uint16_t unicode_decomp_stage1[6144] = {
+    0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 0, 8, 9, 10, 11, 12, 0, 0, 0, 13, 14,
+    15, 0, 0, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 0, 26, 27, 0, 0, 0,
+    0, 28, 0, 0, 0, 0, 29, 0, 30, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 32, 33, 0, 0, 0, 34, 0, 0, 35, 36, 0, 0, 0, 0, 0, 0,
+    0, 37, 0, 38, 0, 39, 0, 0, 0, 40, 0, 0, 0, 41, 0, 0, 0, 42, 0, 0, 0, 43,
+    0, 0, 44, 0, 0, 0, 45, 46, 0, 47, 0, 48, 49, 50, 51, 0, 0, 0, 52, 0, 0, 0,
+    0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 55, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 57, 58, 59, 60, 61, 0, 0, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+    72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 0, 0, 84, 85, 86, 87, 88,
+    89, 90, 0, 91, 92, 93, 94, 95, 96, 0, 97, 0, 98, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 99, 100, 101, 102, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    104, 0, 0, 105, 0, 0, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107, 0, 0,
+    0, 0, 0, 0, 0, 108, 0, 0, 0, 0, 0, 0, 0, 0, 109, 0, 0, 110, 111, 112, 113,
+    114, 115, 116, 117, 0, 118, 119, 120, 121, 122, 123, 124, 125, 0, 126,
+    127, 128, 129, 0, 0, 0, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139,
+    140, 141, 142, 143, 144, 145, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 146, 0, 0, 0, 0, 0, 0, 147, 0, 0, 0, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 149, 150, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 152, 153, 154, 155, 156,
+    157, 158, 159, 160, 161, 162, 163, 164, 165, 0, 166, 167, 168, 169, 170,
+    171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185,
+    186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200,
+    201, 202, 203, 204, 205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 206, 207, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 209, 0, 0, 0,
+    210, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 211, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 212, 0, 0, 0, 0, 0, 0, 0, 213, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 214, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 215, 216, 0, 217, 218,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 219, 220, 221, 222,
+    223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 251,
+    252, 253, 254, 255, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 257, 258, 259, 260, 261, 0, 0, 0, 262, 263, 264, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 265, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 266, 267, 268, 269, 270, 271, 272,
+    273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t unicode_decomp_stage2[9056] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 6, 0, 0, 0, 0, 8, 0, 0,
+    11, 13, 15, 18, 0, 0, 20, 23, 25, 0, 27, 31, 35, 0, 39, 42, 45, 48, 51,
+    54, 0, 57, 60, 63, 66, 69, 72, 75, 78, 81, 0, 84, 87, 90, 93, 96, 99, 0,
+    0, 102, 105, 108, 111, 114, 0, 0, 117, 120, 123, 126, 129, 132, 0, 135,
+    138, 141, 144, 147, 150, 153, 156, 159, 0, 162, 165, 168, 171, 174, 177,
+    0, 0, 180, 183, 186, 189, 192, 0, 195, 198, 201, 204, 207, 210, 213, 216,
+    219, 222, 225, 228, 231, 234, 237, 240, 243, 0, 0, 246, 249, 252, 255,
+    258, 261, 264, 267, 270, 273, 276, 279, 282, 285, 288, 291, 294, 297, 300,
+    303, 0, 0, 306, 309, 312, 315, 318, 321, 324, 327, 330, 0, 333, 336, 339,
+    342, 345, 348, 0, 351, 354, 357, 360, 363, 366, 369, 372, 0, 0, 375, 378,
+    381, 384, 387, 390, 393, 0, 0, 396, 399, 402, 405, 408, 411, 0, 0, 414,
+    417, 420, 423, 426, 429, 432, 435, 438, 441, 444, 447, 450, 453, 456, 459,
+    462, 465, 0, 0, 468, 471, 474, 477, 480, 483, 486, 489, 492, 495, 498,
+    501, 504, 507, 510, 513, 516, 519, 522, 525, 528, 531, 534, 537, 539, 542,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 545, 548, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 551, 555, 559, 563, 566, 569, 572, 575,
+    578, 581, 584, 587, 590, 593, 596, 599, 602, 605, 609, 613, 617, 621, 625,
+    629, 633, 0, 637, 641, 645, 649, 653, 656, 0, 0, 659, 662, 665, 668, 671,
+    674, 677, 681, 685, 688, 691, 694, 697, 700, 703, 706, 0, 0, 709, 712,
+    715, 719, 723, 726, 729, 732, 735, 738, 741, 744, 747, 750, 753, 756, 759,
+    762, 765, 768, 771, 774, 777, 780, 783, 786, 789, 792, 795, 798, 801, 804,
+    807, 810, 813, 816, 0, 0, 819, 822, 0, 0, 0, 0, 0, 0, 825, 828, 831, 834,
+    837, 841, 845, 849, 853, 856, 859, 863, 867, 870, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 873, 875, 877,
+    879, 881, 883, 885, 887, 889, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 891, 894, 897, 900, 903,
+    906, 0, 0, 909, 911, 913, 915, 917, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 919, 921, 0, 923, 925, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 928, 0, 0, 0, 0,
+    0, 930, 0, 0, 0, 933, 0, 0, 0, 0, 0, 935, 938, 944, 947, 949, 952, 955, 0,
+    958, 0, 961, 964, 967, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 971, 974, 977, 980, 983, 986, 989, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 993, 996, 999,
+    1002, 1005, 0, 1008, 1010, 1012, 1014, 1019, 1024, 1026, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1028, 1030, 1032,
+    0, 1034, 1036, 0, 0, 0, 1038, 0, 0, 0, 0, 0, 0, 1040, 1043, 0, 1046, 0, 0,
+    0, 1049, 0, 0, 0, 0, 1052, 1055, 1058, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1061,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1064, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1067, 1070, 0, 1073, 0, 0, 0, 1076, 0, 0, 0, 0, 1079, 1082,
+    1085, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1088, 1091, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1094, 1097, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1100, 1103, 1106, 1109, 0, 0, 1112, 1115, 0, 0, 1118, 1121,
+    1124, 1127, 1130, 1133, 0, 0, 1136, 1139, 1142, 1145, 1148, 1151, 0, 0,
+    1154, 1157, 1160, 1163, 1166, 1169, 1172, 1175, 1178, 1181, 1184, 1187, 0,
+    0, 1190, 1193, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1196, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1199, 1202,
+    1205, 1208, 1211, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1214, 1217, 1220, 1223, 0, 0, 0, 0, 0, 0, 0, 1226, 0, 1229, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1232, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1235, 0, 0, 0, 0, 0, 0, 0, 1238, 0, 0,
+    1241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1244, 1247, 1250, 1253, 1256, 1259,
+    1262, 1265, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1268, 1271, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1274, 1277, 0, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1283, 0, 0, 1286, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1289, 1292, 1295, 0, 0, 1298, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1301, 0, 0, 1304,
+    1307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1310, 1313, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1316, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1319, 1322, 1325, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1328, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1331, 0, 0, 0, 0, 0, 0, 1334, 1337, 0, 1340, 1343, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1347,
+    1350, 1353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1356, 0, 1359, 1362, 1366, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1369, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1375, 1378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1381, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1383, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1386, 0, 0, 0, 0, 1389, 0, 0, 0, 0, 1392, 0, 0, 0, 0,
+    1395, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1398, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1401, 0, 1404, 1407, 1410, 1414, 1417, 0, 0, 0, 0, 0, 0, 0, 1421, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1424, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1427, 0, 0, 0, 0, 1430, 0, 0, 0, 0, 1433, 0, 0, 0, 0, 1436, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1439, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1447, 0, 1450, 0, 1453, 0, 1456, 0,
+    1459, 0, 0, 0, 1462, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1465, 0,
+    1468, 0, 0, 1471, 1474, 0, 1477, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1480, 1482, 1484, 0, 1486, 1488, 1490, 1492, 1494, 1496, 1498, 1500,
+    1502, 1504, 1506, 0, 1508, 1510, 1512, 1514, 1516, 1518, 1520, 1522, 1524,
+    1526, 1528, 1530, 1532, 1534, 1536, 1538, 1540, 1542, 0, 1544, 1546, 1548,
+    1550, 1552, 1554, 1556, 1558, 1560, 1562, 1564, 1566, 1568, 1570, 1572,
+    1574, 1576, 1578, 1580, 1582, 1584, 1586, 1588, 1590, 1592, 1594, 1596,
+    1598, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1600, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1602, 1604, 1606, 1608, 1610, 1612, 1614, 1616, 1618, 1620, 1622, 1624,
+    1626, 1628, 1630, 1632, 1634, 1636, 1638, 1640, 1642, 1644, 1646, 1648,
+    1650, 1652, 1654, 1656, 1658, 1660, 1662, 1664, 1666, 1668, 1670, 1672,
+    1674, 1676, 1679, 1682, 1685, 1688, 1691, 1694, 1697, 1700, 1704, 1708,
+    1711, 1714, 1717, 1720, 1723, 1726, 1729, 1732, 1735, 1738, 1742, 1746,
+    1750, 1754, 1757, 1760, 1763, 1766, 1770, 1774, 1777, 1780, 1783, 1786,
+    1789, 1792, 1795, 1798, 1801, 1804, 1807, 1810, 1813, 1816, 1819, 1822,
+    1826, 1830, 1833, 1836, 1839, 1842, 1845, 1848, 1851, 1854, 1858, 1862,
+    1865, 1868, 1871, 1874, 1877, 1880, 1883, 1886, 1889, 1892, 1895, 1898,
+    1901, 1904, 1907, 1910, 1913, 1916, 1920, 1924, 1928, 1932, 1936, 1940,
+    1944, 1948, 1951, 1954, 1957, 1960, 1963, 1966, 1969, 1972, 1976, 1980,
+    1983, 1986, 1989, 1992, 1995, 1998, 2002, 2006, 2010, 2014, 2018, 2022,
+    2025, 2028, 2031, 2034, 2037, 2040, 2043, 2046, 2049, 2052, 2055, 2058,
+    2061, 2064, 2068, 2072, 2076, 2080, 2083, 2086, 2089, 2092, 2095, 2098,
+    2101, 2104, 2107, 2110, 2113, 2116, 2119, 2122, 2125, 2128, 2131, 2134,
+    2137, 2140, 2143, 2146, 2149, 2152, 2155, 2158, 2161, 2164, 2167, 2170,
+    2173, 0, 0, 0, 0, 2178, 2181, 2184, 2187, 2190, 2194, 2198, 2202, 2206,
+    2210, 2214, 2218, 2222, 2226, 2230, 2234, 2238, 2242, 2246, 2250, 2254,
+    2258, 2262, 2266, 2270, 2273, 2276, 2279, 2282, 2285, 2288, 2292, 2296,
+    2300, 2304, 2308, 2312, 2316, 2320, 2324, 2328, 2331, 2334, 2337, 2340,
+    2343, 2346, 2349, 2352, 2356, 2360, 2364, 2368, 2372, 2376, 2380, 2384,
+    2388, 2392, 2396, 2400, 2404, 2408, 2412, 2416, 2420, 2424, 2428, 2432,
+    2435, 2438, 2441, 2444, 2448, 2452, 2456, 2460, 2464, 2468, 2472, 2476,
+    2480, 2484, 2487, 2490, 2493, 2496, 2499, 2502, 2505, 0, 0, 0, 0, 0, 0,
+    2508, 2511, 2514, 2518, 2522, 2526, 2530, 2534, 2538, 2541, 2544, 2548,
+    2552, 2556, 2560, 2564, 2568, 2571, 2574, 2578, 2582, 2586, 0, 0, 2590,
+    2593, 2596, 2600, 2604, 2608, 0, 0, 2612, 2615, 2618, 2622, 2626, 2630,
+    2634, 2638, 2642, 2645, 2648, 2652, 2656, 2660, 2664, 2668, 2672, 2675,
+    2678, 2682, 2686, 2690, 2694, 2698, 2702, 2705, 2708, 2712, 2716, 2720,
+    2724, 2728, 2732, 2735, 2738, 2742, 2746, 2750, 0, 0, 2754, 2757, 2760,
+    2764, 2768, 2772, 0, 0, 2776, 2779, 2782, 2786, 2790, 2794, 2798, 2802, 0,
+    2806, 0, 2809, 0, 2813, 0, 2817, 2821, 2824, 2827, 2831, 2835, 2839, 2843,
+    2847, 2851, 2854, 2857, 2861, 2865, 2869, 2873, 2877, 2881, 2884, 2887,
+    2890, 2893, 2896, 2899, 2902, 2905, 2908, 2911, 2914, 2917, 2920, 0, 0,
+    2923, 2927, 2931, 2936, 2941, 2946, 2951, 2956, 2961, 2965, 2969, 2974,
+    2979, 2984, 2989, 2994, 2999, 3003, 3007, 3012, 3017, 3022, 3027, 3032,
+    3037, 3041, 3045, 3050, 3055, 3060, 3065, 3070, 3075, 3079, 3083, 3088,
+    3093, 3098, 3103, 3108, 3113, 3117, 3121, 3126, 3131, 3136, 3141, 3146,
+    3151, 3154, 3157, 3161, 3164, 0, 3168, 3171, 3175, 3178, 3181, 3184, 3187,
+    3190, 3193, 3195, 3198, 3201, 3207, 3211, 3214, 0, 3218, 3221, 3225, 3228,
+    3231, 3234, 3237, 3240, 3246, 3252, 3258, 3261, 3264, 3268, 0, 0, 3272,
+    3275, 3279, 3282, 3285, 3288, 0, 3291, 3297, 3303, 3309, 3312, 3315, 3319,
+    3323, 3326, 3329, 3332, 3336, 3339, 3342, 3345, 3348, 3351, 3357, 3363, 0,
+    0, 3365, 3369, 3372, 0, 3376, 3379, 3383, 3386, 3389, 3392, 3395, 3398,
+    3402, 0, 3405, 3408, 3411, 3413, 3415, 3417, 3419, 3421, 3423, 3425, 3427,
+    0, 0, 0, 0, 0, 0, 3429, 0, 0, 0, 0, 0, 3431, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3434, 3436, 3439, 0, 0, 0, 0, 0, 0, 0, 0, 3443, 0, 0, 0, 3445, 3448,
+    0, 3452, 3455, 0, 0, 0, 0, 3459, 0, 3462, 0, 0, 0, 0, 0, 0, 0, 0, 3465,
+    3468, 3471, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3474, 0, 0, 0, 0, 0, 0,
+    0, 3479, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3481, 3483, 0, 0,
+    3485, 3487, 3489, 3491, 3493, 3495, 3497, 3499, 3501, 3503, 3505, 3507,
+    3509, 3511, 3513, 3515, 3517, 3519, 3521, 3523, 3525, 3527, 3529, 3531,
+    3533, 3535, 3537, 0, 3539, 3541, 3543, 3545, 3547, 3549, 3551, 3553, 3555,
+    3557, 3559, 3561, 3563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3565, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3568, 3572, 3576,
+    3578, 0, 3581, 3585, 3589, 0, 3591, 3594, 3596, 3598, 3600, 3602, 3604,
+    3606, 3608, 3610, 3612, 0, 3614, 3616, 0, 0, 3619, 3621, 3623, 3625, 3627,
+    0, 0, 3629, 3632, 3636, 0, 3639, 0, 3641, 0, 3643, 0, 3645, 3647, 3650,
+    3652, 0, 3654, 3656, 3658, 0, 3660, 3662, 3664, 3666, 3668, 3670, 3672, 0,
+    3674, 3678, 3680, 3682, 3684, 3686, 0, 0, 0, 0, 3688, 3690, 3692, 3694,
+    3696, 0, 0, 0, 0, 0, 0, 3698, 3702, 3706, 3711, 3715, 3719, 3723, 3727,
+    3731, 3735, 3739, 3743, 3747, 3751, 3755, 3759, 3762, 3764, 3767, 3771,
+    3774, 3776, 3779, 3783, 3788, 3791, 3793, 3796, 3800, 3802, 3804, 3806,
+    3808, 3810, 3813, 3817, 3820, 3822, 3825, 3829, 3834, 3837, 3839, 3842,
+    3846, 3848, 3850, 3852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3854, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3858, 3861, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3864, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3867, 3870, 3873, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3876, 0, 0, 0, 0, 3879, 0, 0,
+    3882, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3885, 0, 3888, 0, 0, 0, 0, 0, 3891, 3894, 0, 3898, 3901, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3905, 0, 0, 3908, 0, 0, 3911, 0, 3914, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3917, 0, 3920,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3923, 3926, 3929, 3932, 3935, 0, 0, 3938,
+    3941, 0, 0, 3944, 3947, 0, 0, 0, 0, 0, 0, 3950, 3953, 0, 0, 3956, 3959, 0,
+    0, 3962, 3965, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3968, 3971, 3974, 3977, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3980, 3983, 3986, 3989, 0, 0, 0, 0,
+    0, 0, 3992, 3995, 3998, 4001, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4004, 4006, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4008, 4010, 4012, 4014, 4016, 4018,
+    4020, 4022, 4024, 4026, 4029, 4032, 4035, 4038, 4041, 4044, 4047, 4050,
+    4053, 4056, 4059, 4063, 4067, 4071, 4075, 4079, 4083, 4087, 4091, 4095,
+    4100, 4105, 4110, 4115, 4120, 4125, 4130, 4135, 4140, 4145, 4150, 4153,
+    4156, 4159, 4162, 4165, 4168, 4171, 4174, 4177, 4181, 4185, 4189, 4193,
+    4197, 4201, 4205, 4209, 4213, 4217, 4221, 4225, 4229, 4233, 4237, 4241,
+    4245, 4249, 4253, 4257, 4261, 4265, 4269, 4273, 4277, 4281, 4285, 4289,
+    4293, 4297, 4301, 4305, 4309, 4313, 4317, 4321, 4325, 4327, 4329, 4331,
+    4333, 4335, 4337, 4339, 4341, 4343, 4345, 4347, 4349, 4351, 4353, 4355,
+    4357, 4359, 4361, 4363, 4365, 4367, 4369, 4371, 4373, 4375, 4377, 4379,
+    4381, 4383, 4385, 4387, 4389, 4391, 4393, 4395, 4397, 4399, 4401, 4403,
+    4405, 4407, 4409, 4411, 4413, 4415, 4417, 4419, 4421, 4423, 4425, 4427,
+    4429, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4431, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4436, 4440, 4443, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4447, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4450, 4452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4454,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4456, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4458, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4460, 4462, 4464, 4466, 4468, 4470, 4472, 4474, 4476,
+    4478, 4480, 4482, 4484, 4486, 4488, 4490, 4492, 4494, 4496, 4498, 4500,
+    4502, 4504, 4506, 4508, 4510, 4512, 4514, 4516, 4518, 4520, 4522, 4524,
+    4526, 4528, 4530, 4532, 4534, 4536, 4538, 4540, 4542, 4544, 4546, 4548,
+    4550, 4552, 4554, 4556, 4558, 4560, 4562, 4564, 4566, 4568, 4570, 4572,
+    4574, 4576, 4578, 4580, 4582, 4584, 4586, 4588, 4590, 4592, 4594, 4596,
+    4598, 4600, 4602, 4604, 4606, 4608, 4610, 4612, 4614, 4616, 4618, 4620,
+    4622, 4624, 4626, 4628, 4630, 4632, 4634, 4636, 4638, 4640, 4642, 4644,
+    4646, 4648, 4650, 4652, 4654, 4656, 4658, 4660, 4662, 4664, 4666, 4668,
+    4670, 4672, 4674, 4676, 4678, 4680, 4682, 4684, 4686, 4688, 4690, 4692,
+    4694, 4696, 4698, 4700, 4702, 4704, 4706, 4708, 4710, 4712, 4714, 4716,
+    4718, 4720, 4722, 4724, 4726, 4728, 4730, 4732, 4734, 4736, 4738, 4740,
+    4742, 4744, 4746, 4748, 4750, 4752, 4754, 4756, 4758, 4760, 4762, 4764,
+    4766, 4768, 4770, 4772, 4774, 4776, 4778, 4780, 4782, 4784, 4786, 4788,
+    4790, 4792, 4794, 4796, 4798, 4800, 4802, 4804, 4806, 4808, 4810, 4812,
+    4814, 4816, 4818, 4820, 4822, 4824, 4826, 4828, 4830, 4832, 4834, 4836,
+    4838, 4840, 4842, 4844, 4846, 4848, 4850, 4852, 4854, 4856, 4858, 4860,
+    4862, 4864, 4866, 4868, 4870, 4872, 4874, 4876, 4878, 4880, 4882, 4884,
+    4886, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4890, 0, 4892, 4894,
+    4896, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4898, 0, 4901, 0,
+    4904, 0, 4907, 0, 4910, 0, 4913, 0, 4916, 0, 4919, 0, 4922, 0, 4925, 0,
+    4928, 0, 4931, 0, 0, 4934, 0, 4937, 0, 4940, 0, 0, 0, 0, 0, 0, 4943, 4946,
+    0, 4949, 4952, 0, 4955, 4958, 0, 4961, 4964, 0, 4967, 4970, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4973, 0, 0, 0, 0, 0, 0,
+    4976, 4979, 0, 4982, 4985, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4988, 0,
+    4991, 0, 4994, 0, 4997, 0, 5000, 0, 5003, 0, 5006, 0, 5009, 0, 5012, 0,
+    5015, 0, 5018, 0, 5021, 0, 0, 5024, 0, 5027, 0, 5030, 0, 0, 0, 0, 0, 0,
+    5033, 5036, 0, 5039, 5042, 0, 5045, 5048, 0, 5051, 5054, 0, 5057, 5060, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5063, 0, 0,
+    5066, 5069, 5072, 5075, 0, 0, 0, 5078, 5081, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5084, 5086, 5088, 5090, 5092, 5094, 5096, 5098, 5100,
+    5102, 5104, 5106, 5108, 5110, 5112, 5114, 5116, 5118, 5120, 5122, 5124,
+    5126, 5128, 5130, 5132, 5134, 5136, 5138, 5140, 5142, 5144, 5146, 5148,
+    5150, 5152, 5154, 5156, 5158, 5160, 5162, 5164, 5166, 5168, 5170, 5172,
+    5174, 5176, 5178, 5180, 5182, 5184, 5186, 5188, 5190, 5192, 5194, 5196,
+    5198, 5200, 5202, 5204, 5206, 5208, 5210, 5212, 5214, 5216, 5218, 5220,
+    5222, 5224, 5226, 5228, 5230, 5232, 5234, 5236, 5238, 5240, 5242, 5244,
+    5246, 5248, 5250, 5252, 5254, 5256, 5258, 5260, 5262, 5264, 5266, 5268,
+    5270, 0, 0, 0, 5272, 5274, 5276, 5278, 5280, 5282, 5284, 5286, 5288, 5290,
+    5292, 5294, 5296, 5298, 5300, 5304, 5308, 5312, 5316, 5320, 5324, 5328,
+    5332, 5336, 5340, 5344, 5348, 5352, 5356, 5361, 5366, 5371, 5376, 5381,
+    5386, 5391, 5396, 5401, 5406, 5411, 5416, 5421, 5426, 5431, 5439, 0, 5446,
+    5450, 5454, 5458, 5462, 5466, 5470, 5474, 5478, 5482, 5486, 5490, 5494,
+    5498, 5502, 5506, 5510, 5514, 5518, 5522, 5526, 5530, 5534, 5538, 5542,
+    5546, 5550, 5554, 5558, 5562, 5566, 5570, 5574, 5578, 5582, 5586, 5590,
+    5592, 5594, 5596, 0, 0, 0, 0, 0, 0, 0, 0, 5598, 5602, 5605, 5608, 5611,
+    5614, 5617, 5620, 5623, 5626, 5629, 5632, 5635, 5638, 5641, 5644, 5647,
+    5649, 5651, 5653, 5655, 5657, 5659, 5661, 5663, 5665, 5667, 5669, 5671,
+    5673, 5675, 5678, 5681, 5684, 5687, 5690, 5693, 5696, 5699, 5702, 5705,
+    5708, 5711, 5714, 5717, 5723, 5728, 0, 5731, 5733, 5735, 5737, 5739, 5741,
+    5743, 5745, 5747, 5749, 5751, 5753, 5755, 5757, 5759, 5761, 5763, 5765,
+    5767, 5769, 5771, 5773, 5775, 5777, 5779, 5781, 5783, 5785, 5787, 5789,
+    5791, 5793, 5795, 5797, 5799, 5801, 5803, 5805, 5807, 5809, 5811, 5813,
+    5815, 5817, 5819, 5821, 5823, 5825, 5827, 5829, 5832, 5835, 5838, 5841,
+    5844, 5847, 5850, 5853, 5856, 5859, 5862, 5865, 5868, 5871, 5874, 5877,
+    5880, 5883, 5886, 5889, 5892, 5895, 5898, 5901, 5905, 5909, 5913, 5916,
+    5920, 5923, 5927, 5929, 5931, 5933, 5935, 5937, 5939, 5941, 5943, 5945,
+    5947, 5949, 5951, 5953, 5955, 5957, 5959, 5961, 5963, 5965, 5967, 5969,
+    5971, 5973, 5975, 5977, 5979, 5981, 5983, 5985, 5987, 5989, 5991, 5993,
+    5995, 5997, 5999, 6001, 6003, 6005, 6007, 6009, 6011, 6013, 6015, 6017,
+    6019, 6021, 6024, 6030, 6035, 6041, 6045, 6051, 6055, 6059, 6066, 6071,
+    6075, 6079, 6083, 6088, 6093, 6098, 6103, 6108, 6113, 6118, 6125, 6128,
+    6135, 6142, 6148, 6153, 6160, 6167, 6172, 6176, 6180, 6185, 6190, 6196,
+    6202, 6206, 6210, 6215, 6219, 6223, 6226, 6229, 6233, 6237, 6244, 6249,
+    6255, 6262, 6267, 6271, 6275, 6282, 6287, 6294, 6298, 6304, 6308, 6313,
+    6317, 6322, 6328, 6333, 6339, 6344, 6347, 6353, 6357, 6361, 6366, 6370,
+    6374, 6378, 6384, 6389, 6392, 6399, 6403, 6409, 6414, 6419, 6423, 6427,
+    6432, 6435, 6440, 6446, 6449, 6456, 6460, 6463, 6466, 6469, 6472, 6475,
+    6478, 6481, 6484, 6487, 6490, 6494, 6498, 6502, 6506, 6510, 6514, 6518,
+    6522, 6526, 6530, 6534, 6538, 6542, 6546, 6550, 6554, 6557, 6560, 6564,
+    6567, 6570, 6573, 6577, 6581, 6584, 6587, 6590, 6593, 6596, 6601, 6604,
+    6607, 6610, 6613, 6616, 6619, 6622, 6625, 6629, 6634, 6637, 6640, 6643,
+    6646, 6649, 6652, 6655, 6659, 6663, 6667, 6671, 6674, 6677, 6680, 6683,
+    6686, 6689, 6692, 6695, 6698, 6701, 6705, 6709, 6712, 6716, 6720, 6724,
+    6727, 6731, 6735, 6740, 6743, 6747, 6751, 6755, 6759, 6765, 6772, 6775,
+    6778, 6781, 6784, 6787, 6790, 6793, 6796, 6799, 6802, 6805, 6808, 6811,
+    6814, 6817, 6820, 6823, 6826, 6831, 6834, 6837, 6840, 6845, 6849, 6852,
+    6855, 6858, 6861, 6864, 6867, 6870, 6873, 6876, 6879, 6883, 6886, 6889,
+    6893, 6897, 6900, 6905, 6909, 6912, 6915, 6918, 6921, 6925, 6929, 6932,
+    6935, 6938, 6941, 6944, 6947, 6950, 6953, 6956, 6960, 6964, 6968, 6972,
+    6976, 6980, 6984, 6988, 6992, 6996, 7000, 7004, 7008, 7012, 7016, 7020,
+    7024, 7028, 7032, 7036, 7040, 7044, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7048, 7050, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7052, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7054,
+    7056, 7058, 0, 0, 0, 7060, 7062, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7064, 7066,
+    7068, 7070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7072, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7074, 7076, 7078, 7080, 7082, 7084,
+    7086, 7088, 7090, 7092, 7094, 7096, 7098, 7100, 7102, 7104, 7106, 7108,
+    7110, 7112, 7114, 7116, 7118, 7120, 7122, 7124, 7126, 7128, 7130, 7132,
+    7134, 7136, 7138, 7140, 7142, 7144, 7146, 7148, 7150, 7152, 7154, 7156,
+    7158, 7160, 7162, 7164, 7166, 7168, 7170, 7172, 7174, 7176, 7178, 7180,
+    7182, 7184, 7186, 7188, 7190, 7192, 7194, 7196, 7198, 7200, 7202, 7204,
+    7206, 7208, 7210, 7212, 7214, 7216, 7218, 7220, 7222, 7224, 7226, 7228,
+    7230, 7232, 7234, 7236, 7238, 7240, 7242, 7244, 7246, 7248, 7250, 7252,
+    7254, 7256, 7258, 7260, 7262, 7264, 7266, 7268, 7270, 7272, 7274, 7276,
+    7278, 7280, 7282, 7284, 7286, 7288, 7290, 7292, 7294, 7296, 7298, 7300,
+    7302, 7304, 7306, 7308, 7310, 7312, 7314, 7316, 7318, 7320, 7322, 7324,
+    7326, 7328, 7330, 7332, 7334, 7336, 7338, 7340, 7342, 7344, 7346, 7348,
+    7350, 7352, 7354, 7356, 7358, 7360, 7362, 7364, 7366, 7368, 7370, 7372,
+    7374, 7376, 7378, 7380, 7382, 7384, 7386, 7388, 7390, 7392, 7394, 7396,
+    7398, 7400, 7402, 7404, 7406, 7408, 7410, 7412, 7414, 7416, 7418, 7420,
+    7422, 7424, 7426, 7428, 7430, 7432, 7434, 7436, 7438, 7440, 7442, 7444,
+    7446, 7448, 7450, 7452, 7454, 7456, 7458, 7460, 7462, 7464, 7466, 7468,
+    7470, 7472, 7474, 7476, 7478, 7480, 7482, 7484, 7486, 7488, 7490, 7492,
+    7494, 7496, 7498, 7500, 7502, 7504, 7506, 7508, 7510, 7512, 7514, 7516,
+    7518, 7520, 7522, 7524, 7526, 7528, 7530, 7532, 7534, 7536, 7538, 7540,
+    7542, 7544, 7546, 7548, 7550, 7552, 7554, 7556, 7558, 7560, 7562, 7564,
+    7566, 7568, 7570, 7572, 7574, 7576, 7578, 7580, 7582, 7584, 7586, 7588,
+    7590, 7592, 7594, 7596, 7598, 7600, 7602, 7604, 7606, 7608, 7610, 7612, 0,
+    0, 7614, 0, 7616, 0, 0, 7618, 7620, 7622, 7624, 7626, 7628, 7630, 7632,
+    7634, 7636, 0, 7638, 0, 7640, 0, 0, 7642, 7644, 0, 0, 0, 7646, 7648, 7650,
+    7652, 7654, 7656, 7658, 7660, 7662, 7664, 7666, 7668, 7670, 7672, 7674,
+    7676, 7678, 7680, 7682, 7684, 7686, 7688, 7690, 7692, 7694, 7696, 7698,
+    7700, 7702, 7704, 7706, 7708, 7710, 7712, 7714, 7716, 7718, 7720, 7722,
+    7724, 7726, 7728, 7730, 7732, 7734, 7736, 7738, 7740, 7742, 7744, 7746,
+    7748, 7750, 7752, 7754, 7756, 7758, 7760, 7762, 7764, 7766, 7768, 7770,
+    7772, 7774, 7776, 7778, 7780, 0, 0, 7782, 7784, 7786, 7788, 7790, 7792,
+    7794, 7796, 7798, 7800, 7802, 7804, 7806, 7808, 7810, 7812, 7814, 7816,
+    7818, 7820, 7822, 7824, 7826, 7828, 7830, 7832, 7834, 7836, 7838, 7840,
+    7842, 7844, 7846, 7848, 7850, 7852, 7854, 7856, 7858, 7860, 7862, 7864,
+    7866, 7868, 7870, 7872, 7874, 7876, 7878, 7880, 7882, 7884, 7886, 7888,
+    7890, 7892, 7894, 7896, 7898, 7900, 7902, 7904, 7906, 7908, 7910, 7912,
+    7914, 7916, 7918, 7920, 7922, 7924, 7926, 7928, 7930, 7932, 7934, 7936,
+    7938, 7940, 7942, 7944, 7946, 7948, 7950, 7952, 7954, 7956, 7958, 7960,
+    7962, 7964, 7966, 7968, 7970, 7972, 7974, 7976, 7978, 7980, 7982, 7984,
+    7986, 7988, 7990, 7992, 0, 0, 0, 0, 0, 0, 7994, 7997, 8000, 8003, 8007,
+    8011, 8014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8017, 8020, 8023, 8026,
+    8029, 0, 0, 0, 0, 0, 8032, 0, 8035, 8038, 8040, 8042, 8044, 8046, 8048,
+    8050, 8052, 8054, 8056, 8058, 8061, 8064, 8068, 8072, 8075, 8078, 8081,
+    8084, 8087, 8090, 8093, 8096, 0, 8099, 8102, 8105, 8108, 8111, 0, 8114, 0,
+    8117, 8120, 0, 8123, 8126, 0, 8129, 8132, 8135, 8138, 8141, 8144, 8147,
+    8150, 8153, 8156, 8159, 8161, 8163, 8165, 8167, 8169, 8171, 8173, 8175,
+    8177, 8179, 8181, 8183, 8185, 8187, 8189, 8191, 8193, 8195, 8197, 8199,
+    8201, 8203, 8205, 8207, 8209, 8211, 8213, 8215, 8217, 8219, 8221, 8223,
+    8225, 8227, 8229, 8231, 8233, 8235, 8237, 8239, 8241, 8243, 8245, 8247,
+    8249, 8251, 8253, 8255, 8257, 8259, 8261, 8263, 8265, 8267, 8269, 8271,
+    8273, 8275, 8277, 8279, 8281, 8283, 8285, 8287, 8289, 8291, 8293, 8295,
+    8297, 8299, 8301, 8303, 8305, 8307, 8309, 8311, 8313, 8315, 8317, 8319,
+    8321, 8323, 8325, 8327, 8330, 8333, 8335, 8337, 8339, 8341, 8343, 8345,
+    8347, 8349, 8351, 8353, 8356, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8359, 8361, 8363,
+    8365, 8367, 8369, 8371, 8373, 8375, 8377, 8379, 8382, 8384, 8386, 8388,
+    8390, 8392, 8394, 8396, 8398, 8400, 8402, 8404, 8406, 8410, 8414, 8418,
+    8422, 8426, 8430, 8434, 8438, 8442, 8446, 8450, 8454, 8458, 8462, 8466,
+    8470, 8474, 8478, 8480, 8482, 8484, 8486, 8490, 8494, 8498, 8502, 8506,
+    8509, 8512, 8515, 8518, 8521, 8524, 8527, 8530, 8533, 8536, 8539, 8542,
+    8545, 8548, 8551, 8554, 8557, 8560, 8563, 8566, 8569, 8572, 8575, 8578,
+    8581, 8584, 8587, 8590, 8593, 8596, 8599, 8602, 8605, 8608, 8611, 8614,
+    8617, 8620, 8623, 8626, 8629, 8632, 8635, 8638, 8641, 8644, 8647, 8650,
+    8653, 8656, 8659, 8662, 8665, 8668, 8671, 8674, 8677, 8680, 8683, 8686,
+    8689, 8692, 8695, 8698, 8701, 8704, 8707, 8710, 8713, 8716, 8719, 8722,
+    8725, 8728, 8731, 8734, 8737, 8740, 8743, 8746, 8749, 8752, 8755, 8758,
+    8761, 8764, 8767, 8770, 8773, 8777, 8781, 8785, 8789, 8793, 8797, 8801,
+    8805, 8809, 8813, 8817, 8821, 8824, 8827, 8830, 8833, 8836, 8839, 8842,
+    8845, 8848, 8851, 8854, 8857, 8860, 8863, 8866, 8869, 8872, 8875, 8878,
+    8881, 8884, 8887, 8890, 8893, 8896, 8899, 8902, 8905, 8908, 8911, 8914,
+    8917, 8920, 8923, 8926, 8929, 8932, 8935, 8938, 8941, 8944, 8947, 8950,
+    8953, 8956, 8960, 8964, 8968, 8972, 8976, 8979, 8982, 8985, 8988, 8991,
+    8994, 8997, 9000, 9003, 9006, 9009, 9012, 9015, 9018, 9021, 9024, 9027,
+    9030, 9033, 9036, 9039, 9042, 9045, 9048, 9051, 9054, 9057, 9060, 9063,
+    9066, 9069, 9072, 9075, 9078, 9081, 9084, 9087, 9090, 9093, 9096, 9099,
+    9102, 9105, 9108, 9111, 9114, 9117, 9120, 9123, 9126, 9129, 9132, 9135,
+    9138, 9141, 9144, 9147, 9150, 9153, 9156, 9159, 9162, 9165, 9168, 9171,
+    9174, 9177, 9181, 9185, 9188, 9191, 9194, 9197, 9200, 9203, 9206, 9209,
+    9212, 9215, 9218, 9221, 9224, 9227, 9230, 9233, 9236, 9240, 9244, 9248,
+    9251, 9254, 9257, 9260, 9263, 9266, 9269, 9272, 9275, 9278, 9281, 9284,
+    9287, 9290, 9293, 9296, 9299, 9302, 9305, 9308, 9311, 9314, 9317, 9320,
+    9323, 9326, 9329, 9332, 9335, 9338, 9341, 9344, 9347, 9350, 9353, 9356,
+    9359, 9362, 9365, 9368, 9371, 9374, 9377, 9380, 9383, 9386, 9389, 9392,
+    9395, 9398, 9401, 9404, 9407, 9410, 9413, 9416, 9419, 9422, 9425, 9428,
+    9431, 9434, 9437, 9440, 9443, 9446, 9449, 9452, 9455, 9458, 9461, 9464, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9467, 9471, 9475, 9479,
+    9483, 9487, 9491, 9495, 9499, 9503, 9507, 9511, 9515, 9519, 9523, 9527,
+    9531, 9535, 9539, 9543, 9547, 9551, 9555, 9559, 9563, 9567, 9571, 9575,
+    9579, 9583, 9587, 9591, 9595, 9599, 9603, 9607, 9611, 9615, 9619, 9623,
+    9627, 9631, 9635, 9639, 9643, 9647, 9651, 9655, 9659, 9663, 9667, 9671,
+    9675, 9679, 9683, 9687, 9691, 9695, 9699, 9703, 9707, 9711, 9715, 9719, 0,
+    0, 9723, 9727, 9731, 9735, 9739, 9743, 9747, 9751, 9755, 9759, 9763, 9767,
+    9771, 9775, 9779, 9783, 9787, 9791, 9795, 9799, 9803, 9807, 9811, 9815,
+    9819, 9823, 9827, 9831, 9835, 9839, 9843, 9847, 9851, 9855, 9859, 9863,
+    9867, 9871, 9875, 9879, 9883, 9887, 9891, 9895, 9899, 9903, 9907, 9911,
+    9915, 9919, 9923, 9927, 9931, 9935, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9939, 9943, 9947, 9952, 9957, 9962, 9967, 9972, 9977, 9982, 9986,
+    10005, 10014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10019, 10021, 10023, 10025, 10027, 10029, 10031, 10033, 10035, 10037, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10041,
+    10044, 10046, 10048, 10050, 10052, 10054, 10056, 10058, 10060, 10062,
+    10064, 10066, 10068, 10070, 10072, 10074, 10076, 10078, 10080, 10082, 0,
+    0, 10084, 10086, 10088, 10091, 10094, 10097, 10100, 10102, 10104, 10106,
+    10108, 10110, 0, 10112, 10114, 10116, 10118, 10120, 10122, 10124, 10126,
+    10128, 10130, 10132, 10134, 10136, 10138, 10140, 10142, 10144, 10146,
+    10148, 0, 10150, 10152, 10154, 10156, 0, 0, 0, 0, 10158, 10161, 10164, 0,
+    10167, 0, 10170, 10173, 10176, 10179, 10182, 10185, 10188, 10191, 10194,
+    10197, 10200, 10202, 10205, 10208, 10211, 10214, 10217, 10220, 10223,
+    10226, 10229, 10232, 10235, 10238, 10240, 10242, 10244, 10246, 10248,
+    10250, 10252, 10254, 10256, 10258, 10260, 10262, 10264, 10266, 10268,
+    10270, 10272, 10274, 10276, 10278, 10280, 10282, 10284, 10286, 10288,
+    10290, 10292, 10294, 10296, 10298, 10300, 10302, 10304, 10306, 10308,
+    10310, 10312, 10314, 10316, 10318, 10320, 10322, 10324, 10326, 10328,
+    10330, 10332, 10334, 10336, 10338, 10340, 10342, 10344, 10346, 10348,
+    10350, 10352, 10354, 10356, 10358, 10360, 10362, 10364, 10366, 10368,
+    10370, 10372, 10374, 10376, 10378, 10380, 10382, 10384, 10386, 10388,
+    10390, 10392, 10394, 10396, 10398, 10400, 10402, 10404, 10406, 10408,
+    10410, 10412, 10414, 10416, 10418, 10420, 10422, 10424, 10426, 10428,
+    10430, 10432, 10434, 10436, 10438, 10440, 10442, 10444, 10446, 10450,
+    10454, 10458, 10462, 10466, 10470, 10473, 0, 0, 0, 0, 10476, 10478, 10480,
+    10482, 10484, 10486, 10488, 10490, 10492, 10494, 10496, 10498, 10500,
+    10502, 10504, 10506, 10508, 10510, 10512, 10514, 10516, 10518, 10520,
+    10522, 10524, 10526, 10528, 10530, 10532, 10534, 10536, 10538, 10540,
+    10542, 10544, 10546, 10548, 10550, 10552, 10554, 10556, 10558, 10560,
+    10562, 10564, 10566, 10568, 10570, 10572, 10574, 10576, 10578, 10580,
+    10582, 10584, 10586, 10588, 10590, 10592, 10594, 10596, 10598, 10600,
+    10602, 10604, 10606, 10608, 10610, 10612, 10614, 10616, 10618, 10620,
+    10622, 10624, 10626, 10628, 10630, 10632, 10634, 10636, 10638, 10640,
+    10642, 10644, 10646, 10648, 10650, 10652, 10654, 10656, 10658, 10660,
+    10662, 10664, 10666, 10668, 10670, 10672, 10674, 10676, 10678, 10680,
+    10682, 10684, 10686, 10688, 10690, 10692, 10694, 10696, 10698, 10700,
+    10702, 10704, 10706, 10708, 10710, 10712, 10714, 10716, 10718, 10720,
+    10722, 10724, 10726, 10728, 10730, 10732, 10734, 10736, 10738, 10740,
+    10742, 10744, 10746, 10748, 10750, 10752, 10754, 10756, 10758, 10760,
+    10762, 10764, 10766, 10768, 10770, 10772, 10774, 10776, 10778, 10780,
+    10782, 10784, 10786, 10788, 10790, 10792, 10794, 10796, 10798, 10800,
+    10802, 10804, 10806, 10808, 10810, 10812, 10814, 10816, 10818, 10820,
+    10822, 10824, 10826, 10828, 10830, 10832, 10834, 10836, 10838, 10840,
+    10842, 10844, 10846, 10848, 10850, 10852, 10854, 0, 0, 0, 10856, 10858,
+    10860, 10862, 10864, 10866, 0, 0, 10868, 10870, 10872, 10874, 10876,
+    10878, 0, 0, 10880, 10882, 10884, 10886, 10888, 10890, 0, 0, 10892, 10894,
+    10896, 0, 0, 0, 10898, 10900, 10902, 10904, 10907, 10909, 10911, 0, 10913,
+    10915, 10917, 10919, 10921, 10923, 10925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 10927, 10929, 10931, 10933, 10935, 0, 10937, 10939,
+    10941, 10943, 10945, 10947, 10949, 10951, 10953, 10955, 10957, 10959,
+    10961, 10963, 10965, 10967, 10969, 10971, 10973, 10975, 10977, 10979,
+    10981, 10983, 10985, 10987, 10989, 10991, 10993, 10995, 10997, 10999,
+    11001, 11003, 11005, 11007, 11009, 11011, 11013, 11015, 11017, 11019, 0,
+    11021, 11023, 11025, 11027, 11029, 11031, 11033, 11035, 11037, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 11039, 0, 11042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11045, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 11048, 11051, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11054, 11057, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11060, 11063, 0, 11066, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 11069, 11072, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 11075, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    11078, 11081, 11084, 11088, 11092, 11096, 11100, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11104,
+    11107, 11110, 11114, 11118, 11122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11126, 11128, 11130,
+    11132, 11134, 11136, 11138, 11140, 11142, 11144, 11146, 11148, 11150,
+    11152, 11154, 11156, 11158, 11160, 11162, 11164, 11166, 11168, 11170,
+    11172, 11174, 11176, 11178, 11180, 11182, 11184, 11186, 11188, 11190,
+    11192, 11194, 11196, 11198, 11200, 11202, 11204, 11206, 11208, 11210,
+    11212, 11214, 11216, 11218, 11220, 11222, 11224, 11226, 11228, 11230,
+    11232, 11234, 11236, 11238, 11240, 11242, 11244, 11246, 11248, 11250,
+    11252, 11254, 11256, 11258, 11260, 11262, 11264, 11266, 11268, 11270,
+    11272, 11274, 11276, 11278, 11280, 11282, 11284, 11286, 11288, 11290,
+    11292, 11294, 0, 11296, 11298, 11300, 11302, 11304, 11306, 11308, 11310,
+    11312, 11314, 11316, 11318, 11320, 11322, 11324, 11326, 11328, 11330,
+    11332, 11334, 11336, 11338, 11340, 11342, 11344, 11346, 11348, 11350,
+    11352, 11354, 11356, 11358, 11360, 11362, 11364, 11366, 11368, 11370,
+    11372, 11374, 11376, 11378, 11380, 11382, 11384, 11386, 11388, 11390,
+    11392, 11394, 11396, 11398, 11400, 11402, 11404, 11406, 11408, 11410,
+    11412, 11414, 11416, 11418, 11420, 11422, 11424, 11426, 11428, 11430,
+    11432, 11434, 11436, 0, 11438, 11440, 0, 0, 11442, 0, 0, 11444, 11446, 0,
+    0, 11448, 11450, 11452, 11454, 0, 11456, 11458, 11460, 11462, 11464,
+    11466, 11468, 11470, 11472, 11474, 11476, 11478, 0, 11480, 0, 11482,
+    11484, 11486, 11488, 11490, 11492, 11494, 0, 11496, 11498, 11500, 11502,
+    11504, 11506, 11508, 11510, 11512, 11514, 11516, 11518, 11520, 11522,
+    11524, 11526, 11528, 11530, 11532, 11534, 11536, 11538, 11540, 11542,
+    11544, 11546, 11548, 11550, 11552, 11554, 11556, 11558, 11560, 11562,
+    11564, 11566, 11568, 11570, 11572, 11574, 11576, 11578, 11580, 11582,
+    11584, 11586, 11588, 11590, 11592, 11594, 11596, 11598, 11600, 11602,
+    11604, 11606, 11608, 11610, 11612, 11614, 11616, 11618, 11620, 11622,
+    11624, 0, 11626, 11628, 11630, 11632, 0, 0, 11634, 11636, 11638, 11640,
+    11642, 11644, 11646, 11648, 0, 11650, 11652, 11654, 11656, 11658, 11660,
+    11662, 0, 11664, 11666, 11668, 11670, 11672, 11674, 11676, 11678, 11680,
+    11682, 11684, 11686, 11688, 11690, 11692, 11694, 11696, 11698, 11700,
+    11702, 11704, 11706, 11708, 11710, 11712, 11714, 11716, 11718, 0, 11720,
+    11722, 11724, 11726, 0, 11728, 11730, 11732, 11734, 11736, 0, 11738, 0, 0,
+    0, 11740, 11742, 11744, 11746, 11748, 11750, 11752, 0, 11754, 11756,
+    11758, 11760, 11762, 11764, 11766, 11768, 11770, 11772, 11774, 11776,
+    11778, 11780, 11782, 11784, 11786, 11788, 11790, 11792, 11794, 11796,
+    11798, 11800, 11802, 11804, 11806, 11808, 11810, 11812, 11814, 11816,
+    11818, 11820, 11822, 11824, 11826, 11828, 11830, 11832, 11834, 11836,
+    11838, 11840, 11842, 11844, 11846, 11848, 11850, 11852, 11854, 11856,
+    11858, 11860, 11862, 11864, 11866, 11868, 11870, 11872, 11874, 11876,
+    11878, 11880, 11882, 11884, 11886, 11888, 11890, 11892, 11894, 11896,
+    11898, 11900, 11902, 11904, 11906, 11908, 11910, 11912, 11914, 11916,
+    11918, 11920, 11922, 11924, 11926, 11928, 11930, 11932, 11934, 11936,
+    11938, 11940, 11942, 11944, 11946, 11948, 11950, 11952, 11954, 11956,
+    11958, 11960, 11962, 11964, 11966, 11968, 11970, 11972, 11974, 11976,
+    11978, 11980, 11982, 11984, 11986, 11988, 11990, 11992, 11994, 11996,
+    11998, 12000, 12002, 12004, 12006, 12008, 12010, 12012, 12014, 12016,
+    12018, 12020, 12022, 12024, 12026, 12028, 12030, 12032, 12034, 12036,
+    12038, 12040, 12042, 12044, 12046, 12048, 12050, 12052, 12054, 12056,
+    12058, 12060, 12062, 12064, 12066, 12068, 12070, 12072, 12074, 12076,
+    12078, 12080, 12082, 12084, 12086, 12088, 12090, 12092, 12094, 12096,
+    12098, 12100, 12102, 12104, 12106, 12108, 12110, 12112, 12114, 12116,
+    12118, 12120, 12122, 12124, 12126, 12128, 12130, 12132, 12134, 12136,
+    12138, 12140, 12142, 12144, 12146, 12148, 12150, 12152, 12154, 12156,
+    12158, 12160, 12162, 12164, 12166, 12168, 12170, 12172, 12174, 12176,
+    12178, 12180, 12182, 12184, 12186, 12188, 12190, 12192, 12194, 12196,
+    12198, 12200, 12202, 12204, 12206, 12208, 12210, 12212, 12214, 12216,
+    12218, 12220, 12222, 12224, 12226, 12228, 12230, 12232, 12234, 12236,
+    12238, 12240, 12242, 12244, 12246, 12248, 12250, 12252, 12254, 12256,
+    12258, 12260, 12262, 12264, 12266, 12268, 12270, 12272, 12274, 12276,
+    12278, 12280, 12282, 12284, 12286, 12288, 12290, 12292, 12294, 12296,
+    12298, 12300, 12302, 12304, 12306, 12308, 12310, 12312, 12314, 12316,
+    12318, 12320, 12322, 12324, 12326, 12328, 12330, 12332, 12334, 12336,
+    12338, 12340, 12342, 12344, 12346, 12348, 12350, 12352, 12354, 12356,
+    12358, 12360, 12362, 12364, 12366, 12368, 12370, 12372, 12374, 12376,
+    12378, 12380, 12382, 12384, 12386, 12388, 12390, 12392, 12394, 12396,
+    12398, 12400, 12402, 12404, 12406, 12408, 12410, 12412, 12414, 12416,
+    12418, 12420, 12422, 12424, 12426, 12428, 12430, 12432, 0, 0, 12434,
+    12436, 12438, 12440, 12442, 12444, 12446, 12448, 12450, 12452, 12454,
+    12456, 12458, 12460, 12462, 12464, 12466, 12468, 12470, 12472, 12474,
+    12476, 12478, 12480, 12482, 12484, 12486, 12488, 12490, 12492, 12494,
+    12496, 12498, 12500, 12502, 12504, 12506, 12508, 12510, 12512, 12514,
+    12516, 12518, 12520, 12522, 12524, 12526, 12528, 12530, 12532, 12534,
+    12536, 12538, 12540, 12542, 12544, 12546, 12548, 12550, 12552, 12554,
+    12556, 12558, 12560, 12562, 12564, 12566, 12568, 12570, 12572, 12574,
+    12576, 12578, 12580, 12582, 12584, 12586, 12588, 12590, 12592, 12594,
+    12596, 12598, 12600, 12602, 12604, 12606, 12608, 12610, 12612, 12614,
+    12616, 12618, 12620, 12622, 12624, 12626, 12628, 12630, 12632, 12634,
+    12636, 12638, 12640, 12642, 12644, 12646, 12648, 12650, 12652, 12654,
+    12656, 12658, 12660, 12662, 12664, 12666, 12668, 12670, 12672, 12674,
+    12676, 12678, 12680, 12682, 12684, 12686, 12688, 12690, 12692, 12694,
+    12696, 12698, 12700, 12702, 12704, 12706, 12708, 12710, 12712, 12714,
+    12716, 12718, 12720, 12722, 12724, 12726, 12728, 12730, 12732, 12734,
+    12736, 12738, 12740, 12742, 12744, 12746, 12748, 12750, 12752, 12754,
+    12756, 12758, 12760, 12762, 12764, 12766, 12768, 12770, 12772, 12774,
+    12776, 12778, 12780, 12782, 12784, 12786, 12788, 12790, 12792, 12794,
+    12796, 12798, 12800, 12802, 12804, 12806, 12808, 12810, 12812, 12814,
+    12816, 12818, 12820, 12822, 12824, 12826, 12828, 12830, 12832, 12834,
+    12836, 12838, 12840, 12842, 12844, 12846, 12848, 12850, 12852, 12854,
+    12856, 12858, 12860, 12862, 12864, 12866, 12868, 12870, 12872, 12874,
+    12876, 12878, 12880, 12882, 12884, 12886, 12888, 12890, 12892, 12894,
+    12896, 12898, 12900, 12902, 12904, 12906, 12908, 12910, 12912, 12914,
+    12916, 12918, 12920, 12922, 12924, 12926, 12928, 12930, 12932, 12934,
+    12936, 12938, 12940, 12942, 12944, 12946, 12948, 12950, 12952, 12954,
+    12956, 12958, 12960, 12962, 12964, 12966, 12968, 12970, 12972, 12974,
+    12976, 12978, 12980, 12982, 12984, 12986, 12988, 12990, 12992, 12994,
+    12996, 12998, 13000, 13002, 13004, 13006, 13008, 13010, 13012, 13014,
+    13016, 0, 0, 13018, 13020, 13022, 13024, 13026, 13028, 13030, 13032,
+    13034, 13036, 13038, 13040, 13042, 13044, 13046, 13048, 13050, 13052,
+    13054, 13056, 13058, 13060, 13062, 13064, 13066, 13068, 13070, 13072,
+    13074, 13076, 13078, 13080, 13082, 13084, 13086, 13088, 13090, 13092,
+    13094, 13096, 13098, 13100, 13102, 13104, 13106, 13108, 13110, 13112,
+    13114, 13116, 13118, 13120, 13122, 13124, 0, 13126, 13128, 13130, 13132,
+    13134, 13136, 13138, 13140, 13142, 13144, 13146, 13148, 13150, 13152,
+    13154, 13156, 13158, 13160, 13162, 13164, 13166, 13168, 13170, 13172,
+    13174, 13176, 13178, 0, 13180, 13182, 0, 13184, 0, 0, 13186, 0, 13188,
+    13190, 13192, 13194, 13196, 13198, 13200, 13202, 13204, 13206, 0, 13208,
+    13210, 13212, 13214, 0, 13216, 0, 13218, 0, 0, 0, 0, 0, 0, 13220, 0, 0, 0,
+    0, 13222, 0, 13224, 0, 13226, 0, 13228, 13230, 13232, 0, 13234, 13236, 0,
+    13238, 0, 0, 13240, 0, 13242, 0, 13244, 0, 13246, 0, 13248, 0, 13250,
+    13252, 0, 13254, 0, 0, 13256, 13258, 13260, 13262, 0, 13264, 13266, 13268,
+    13270, 13272, 13274, 13276, 0, 13278, 13280, 13282, 13284, 0, 13286,
+    13288, 13290, 13292, 0, 13294, 0, 13296, 13298, 13300, 13302, 13304,
+    13306, 13308, 13310, 13312, 13314, 0, 13316, 13318, 13320, 13322, 13324,
+    13326, 13328, 13330, 13332, 13334, 13336, 13338, 13340, 13342, 13344,
+    13346, 13348, 0, 0, 0, 0, 0, 13350, 13352, 13354, 0, 13356, 13358, 13360,
+    13362, 13364, 0, 13366, 13368, 13370, 13372, 13374, 13376, 13378, 13380,
+    13382, 13384, 13386, 13388, 13390, 13392, 13394, 13396, 13398, 0, 0, 0, 0,
+    13400, 13403, 13406, 13409, 13412, 13415, 13418, 13421, 13424, 13427,
+    13430, 0, 0, 0, 0, 0, 13433, 13437, 13441, 13445, 13449, 13453, 13457,
+    13461, 13465, 13469, 13473, 13477, 13481, 13485, 13489, 13493, 13497,
+    13501, 13505, 13509, 13513, 13517, 13521, 13525, 13529, 13533, 13537,
+    13541, 13543, 13545, 13548, 0, 13551, 13553, 13555, 13557, 13559, 13561,
+    13563, 13565, 13567, 13569, 13571, 13573, 13575, 13577, 13579, 13581,
+    13583, 13585, 13587, 13589, 13591, 13593, 13595, 13597, 13599, 13601,
+    13603, 13606, 13609, 13612, 13615, 13619, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13622, 13625, 13628, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13631, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13634, 13637, 13640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13642, 13644,
+    13646, 13648, 13651, 13653, 13655, 13657, 13659, 13661, 13663, 13665,
+    13667, 13669, 13671, 13673, 13675, 13677, 13679, 13681, 13683, 13685,
+    13687, 13689, 13691, 13693, 13695, 13697, 13699, 13701, 13703, 13705,
+    13707, 13709, 13711, 13713, 13715, 13717, 13719, 13721, 13723, 13725,
+    13727, 13729, 0, 0, 0, 0, 13731, 13735, 13739, 13743, 13747, 13751, 13755,
+    13759, 13763, 0, 0, 0, 0, 0, 0, 0, 13767, 13769, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13771,
+    13773, 13775, 13777, 13779, 13781, 13783, 13785, 13787, 13789, 0, 0, 0, 0,
+    0, 0, 13791, 13793, 13795, 13797, 13799, 13801, 13803, 13805, 13807,
+    13809, 13811, 13813, 13815, 13817, 13819, 13821, 13823, 13825, 13827,
+    13829, 13831, 13833, 13835, 13837, 13839, 13841, 13843, 13845, 13847,
+    13849, 13851, 13853, 13855, 13857, 13859, 13861, 13863, 13865, 13867,
+    13869, 13871, 13873, 13875, 13877, 13879, 13881, 13883, 13885, 13887,
+    13889, 13891, 13893, 13895, 13897, 13899, 13901, 13903, 13905, 13907,
+    13909, 13911, 13913, 13915, 13917, 13919, 13921, 13923, 13925, 13927,
+    13929, 13931, 13933, 13935, 13937, 13939, 13941, 13943, 13945, 13947,
+    13949, 13951, 13953, 13955, 13957, 13959, 13961, 13963, 13965, 13967,
+    13969, 13971, 13973, 13975, 13977, 13979, 13981, 13983, 13985, 13987,
+    13989, 13991, 13993, 13995, 13997, 13999, 14001, 14003, 14005, 14007,
+    14009, 14011, 14013, 14015, 14017, 14019, 14021, 14023, 14025, 14027,
+    14029, 14031, 14033, 14035, 14037, 14039, 14041, 14043, 14045, 14047,
+    14049, 14051, 14053, 14055, 14057, 14059, 14061, 14063, 14065, 14067,
+    14069, 14071, 14073, 14075, 14077, 14079, 14081, 14083, 14085, 14087,
+    14089, 14091, 14093, 14095, 14097, 14099, 14101, 14103, 14105, 14107,
+    14109, 14111, 14113, 14115, 14117, 14119, 14121, 14123, 14125, 14127,
+    14129, 14131, 14133, 14135, 14137, 14139, 14141, 14143, 14145, 14147,
+    14149, 14151, 14153, 14155, 14157, 14159, 14161, 14163, 14165, 14167,
+    14169, 14171, 14173, 14175, 14177, 14179, 14181, 14183, 14185, 14187,
+    14189, 14191, 14193, 14195, 14197, 14199, 14201, 14203, 14205, 14207,
+    14209, 14211, 14213, 14215, 14217, 14219, 14221, 14223, 14225, 14227,
+    14229, 14231, 14233, 14235, 14237, 14239, 14241, 14243, 14245, 14247,
+    14249, 14251, 14253, 14255, 14257, 14259, 14261, 14263, 14265, 14267,
+    14269, 14271, 14273, 14275, 14277, 14279, 14281, 14283, 14285, 14287,
+    14289, 14291, 14293, 14295, 14297, 14299, 14301, 14303, 14305, 14307,
+    14309, 14311, 14313, 14315, 14317, 14319, 14321, 14323, 14325, 14327,
+    14329, 14331, 14333, 14335, 14337, 14339, 14341, 14343, 14345, 14347,
+    14349, 14351, 14353, 14355, 14357, 14359, 14361, 14363, 14365, 14367,
+    14369, 14371, 14373, 14375, 14377, 14379, 14381, 14383, 14385, 14387,
+    14389, 14391, 14393, 14395, 14397, 14399, 14401, 14403, 14405, 14407,
+    14409, 14411, 14413, 14415, 14417, 14419, 14421, 14423, 14425, 14427,
+    14429, 14431, 14433, 14435, 14437, 14439, 14441, 14443, 14445, 14447,
+    14449, 14451, 14453, 14455, 14457, 14459, 14461, 14463, 14465, 14467,
+    14469, 14471, 14473, 14475, 14477, 14479, 14481, 14483, 14485, 14487,
+    14489, 14491, 14493, 14495, 14497, 14499, 14501, 14503, 14505, 14507,
+    14509, 14511, 14513, 14515, 14517, 14519, 14521, 14523, 14525, 14527,
+    14529, 14531, 14533, 14535, 14537, 14539, 14541, 14543, 14545, 14547,
+    14549, 14551, 14553, 14555, 14557, 14559, 14561, 14563, 14565, 14567,
+    14569, 14571, 14573, 14575, 14577, 14579, 14581, 14583, 14585, 14587,
+    14589, 14591, 14593, 14595, 14597, 14599, 14601, 14603, 14605, 14607,
+    14609, 14611, 14613, 14615, 14617, 14619, 14621, 14623, 14625, 14627,
+    14629, 14631, 14633, 14635, 14637, 14639, 14641, 14643, 14645, 14647,
+    14649, 14651, 14653, 14655, 14657, 14659, 14661, 14663, 14665, 14667,
+    14669, 14671, 14673, 14675, 14677, 14679, 14681, 14683, 14685, 14687,
+    14689, 14691, 14693, 14695, 14697, 14699, 14701, 14703, 14705, 14707,
+    14709, 14711, 14713, 14715, 14717, 14719, 14721, 14723, 14725, 14727,
+    14729, 14731, 14733, 14735, 14737, 14739, 14741, 14743, 14745, 14747,
+    14749, 14751, 14753, 14755, 14757, 14759, 14761, 14763, 14765, 14767,
+    14769, 14771, 14773, 14775, 14777, 14779, 14781, 14783, 14785, 14787,
+    14789, 14791, 14793, 14795, 14797, 14799, 14801, 14803, 14805, 14807,
+    14809, 14811, 14813, 14815, 14817, 14819, 14821, 14823, 14825, 14827,
+    14829, 14831, 14833, 14835, 14837, 14839, 14841, 14843, 14845, 14847,
+    14849, 14851, 14853, 14855, 14857, 14859, 14861, 14863, 14865, 14867,
+    14869, 14871, 14873, 0, 0,
+};
+
+/* Each decomposition starts with a header holding the size of the
+ * canonical decomposition in the low byte and the size of a
+ * differing compatibility decomposition in the second byte.
+ */
+static const uint32_t unicode_decomps[14875] = {
+    0, 256, 32, 512, 32, 776, 256, 97, 512, 32, 772, 256, 50, 256, 51, 512,
+    32, 769, 256, 956, 512, 32, 807, 256, 49, 256, 111, 768, 49, 8260, 52,
+    768, 49, 8260, 50, 768, 51, 8260, 52, 2, 65, 768, 2, 65, 769, 2, 65, 770,
+    2, 65, 771, 2, 65, 776, 2, 65, 778, 2, 67, 807, 2, 69, 768, 2, 69, 769, 2,
+    69, 770, 2, 69, 776, 2, 73, 768, 2, 73, 769, 2, 73, 770, 2, 73, 776, 2,
+    78, 771, 2, 79, 768, 2, 79, 769, 2, 79, 770, 2, 79, 771, 2, 79, 776, 2,
+    85, 768, 2, 85, 769, 2, 85, 770, 2, 85, 776, 2, 89, 769, 2, 97, 768, 2,
+    97, 769, 2, 97, 770, 2, 97, 771, 2, 97, 776, 2, 97, 778, 2, 99, 807, 2,
+    101, 768, 2, 101, 769, 2, 101, 770, 2, 101, 776, 2, 105, 768, 2, 105, 769,
+    2, 105, 770, 2, 105, 776, 2, 110, 771, 2, 111, 768, 2, 111, 769, 2, 111,
+    770, 2, 111, 771, 2, 111, 776, 2, 117, 768, 2, 117, 769, 2, 117, 770, 2,
+    117, 776, 2, 121, 769, 2, 121, 776, 2, 65, 772, 2, 97, 772, 2, 65, 774, 2,
+    97, 774, 2, 65, 808, 2, 97, 808, 2, 67, 769, 2, 99, 769, 2, 67, 770, 2,
+    99, 770, 2, 67, 775, 2, 99, 775, 2, 67, 780, 2, 99, 780, 2, 68, 780, 2,
+    100, 780, 2, 69, 772, 2, 101, 772, 2, 69, 774, 2, 101, 774, 2, 69, 775, 2,
+    101, 775, 2, 69, 808, 2, 101, 808, 2, 69, 780, 2, 101, 780, 2, 71, 770, 2,
+    103, 770, 2, 71, 774, 2, 103, 774, 2, 71, 775, 2, 103, 775, 2, 71, 807, 2,
+    103, 807, 2, 72, 770, 2, 104, 770, 2, 73, 771, 2, 105, 771, 2, 73, 772, 2,
+    105, 772, 2, 73, 774, 2, 105, 774, 2, 73, 808, 2, 105, 808, 2, 73, 775,
+    512, 73, 74, 512, 105, 106, 2, 74, 770, 2, 106, 770, 2, 75, 807, 2, 107,
+    807, 2, 76, 769, 2, 108, 769, 2, 76, 807, 2, 108, 807, 2, 76, 780, 2, 108,
+    780, 512, 76, 183, 512, 108, 183, 2, 78, 769, 2, 110, 769, 2, 78, 807, 2,
+    110, 807, 2, 78, 780, 2, 110, 780, 512, 700, 110, 2, 79, 772, 2, 111, 772,
+    2, 79, 774, 2, 111, 774, 2, 79, 779, 2, 111, 779, 2, 82, 769, 2, 114, 769,
+    2, 82, 807, 2, 114, 807, 2, 82, 780, 2, 114, 780, 2, 83, 769, 2, 115, 769,
+    2, 83, 770, 2, 115, 770, 2, 83, 807, 2, 115, 807, 2, 83, 780, 2, 115, 780,
+    2, 84, 807, 2, 116, 807, 2, 84, 780, 2, 116, 780, 2, 85, 771, 2, 117, 771,
+    2, 85, 772, 2, 117, 772, 2, 85, 774, 2, 117, 774, 2, 85, 778, 2, 117, 778,
+    2, 85, 779, 2, 117, 779, 2, 85, 808, 2, 117, 808, 2, 87, 770, 2, 119, 770,
+    2, 89, 770, 2, 121, 770, 2, 89, 776, 2, 90, 769, 2, 122, 769, 2, 90, 775,
+    2, 122, 775, 2, 90, 780, 2, 122, 780, 256, 115, 2, 79, 795, 2, 111, 795,
+    2, 85, 795, 2, 117, 795, 768, 68, 90, 780, 768, 68, 122, 780, 768, 100,
+    122, 780, 512, 76, 74, 512, 76, 106, 512, 108, 106, 512, 78, 74, 512, 78,
+    106, 512, 110, 106, 2, 65, 780, 2, 97, 780, 2, 73, 780, 2, 105, 780, 2,
+    79, 780, 2, 111, 780, 2, 85, 780, 2, 117, 780, 3, 85, 776, 772, 3, 117,
+    776, 772, 3, 85, 776, 769, 3, 117, 776, 769, 3, 85, 776, 780, 3, 117, 776,
+    780, 3, 85, 776, 768, 3, 117, 776, 768, 3, 65, 776, 772, 3, 97, 776, 772,
+    3, 65, 775, 772, 3, 97, 775, 772, 2, 198, 772, 2, 230, 772, 2, 71, 780, 2,
+    103, 780, 2, 75, 780, 2, 107, 780, 2, 79, 808, 2, 111, 808, 3, 79, 808,
+    772, 3, 111, 808, 772, 2, 439, 780, 2, 658, 780, 2, 106, 780, 512, 68, 90,
+    512, 68, 122, 512, 100, 122, 2, 71, 769, 2, 103, 769, 2, 78, 768, 2, 110,
+    768, 3, 65, 778, 769, 3, 97, 778, 769, 2, 198, 769, 2, 230, 769, 2, 216,
+    769, 2, 248, 769, 2, 65, 783, 2, 97, 783, 2, 65, 785, 2, 97, 785, 2, 69,
+    783, 2, 101, 783, 2, 69, 785, 2, 101, 785, 2, 73, 783, 2, 105, 783, 2, 73,
+    785, 2, 105, 785, 2, 79, 783, 2, 111, 783, 2, 79, 785, 2, 111, 785, 2, 82,
+    783, 2, 114, 783, 2, 82, 785, 2, 114, 785, 2, 85, 783, 2, 117, 783, 2, 85,
+    785, 2, 117, 785, 2, 83, 806, 2, 115, 806, 2, 84, 806, 2, 116, 806, 2, 72,
+    780, 2, 104, 780, 2, 65, 775, 2, 97, 775, 2, 69, 807, 2, 101, 807, 3, 79,
+    776, 772, 3, 111, 776, 772, 3, 79, 771, 772, 3, 111, 771, 772, 2, 79, 775,
+    2, 111, 775, 3, 79, 775, 772, 3, 111, 775, 772, 2, 89, 772, 2, 121, 772,
+    256, 104, 256, 614, 256, 106, 256, 114, 256, 633, 256, 635, 256, 641, 256,
+    119, 256, 121, 512, 32, 774, 512, 32, 775, 512, 32, 778, 512, 32, 808,
+    512, 32, 771, 512, 32, 779, 256, 611, 256, 108, 256, 115, 256, 120, 256,
+    661, 1, 768, 1, 769, 1, 787, 2, 776, 769, 1, 697, 512, 32, 837, 1, 59,
+    512, 32, 769, 770, 168, 769, 32, 776, 769, 2, 913, 769, 1, 183, 2, 917,
+    769, 2, 919, 769, 2, 921, 769, 2, 927, 769, 2, 933, 769, 2, 937, 769, 3,
+    953, 776, 769, 2, 921, 776, 2, 933, 776, 2, 945, 769, 2, 949, 769, 2, 951,
+    769, 2, 953, 769, 3, 965, 776, 769, 2, 953, 776, 2, 965, 776, 2, 959, 769,
+    2, 965, 769, 2, 969, 769, 256, 946, 256, 952, 256, 933, 514, 978, 769,
+    933, 769, 514, 978, 776, 933, 776, 256, 966, 256, 960, 256, 954, 256, 961,
+    256, 962, 256, 920, 256, 949, 256, 931, 2, 1045, 768, 2, 1045, 776, 2,
+    1043, 769, 2, 1030, 776, 2, 1050, 769, 2, 1048, 768, 2, 1059, 774, 2,
+    1048, 774, 2, 1080, 774, 2, 1077, 768, 2, 1077, 776, 2, 1075, 769, 2,
+    1110, 776, 2, 1082, 769, 2, 1080, 768, 2, 1091, 774, 2, 1140, 783, 2,
+    1141, 783, 2, 1046, 774, 2, 1078, 774, 2, 1040, 774, 2, 1072, 774, 2,
+    1040, 776, 2, 1072, 776, 2, 1045, 774, 2, 1077, 774, 2, 1240, 776, 2,
+    1241, 776, 2, 1046, 776, 2, 1078, 776, 2, 1047, 776, 2, 1079, 776, 2,
+    1048, 772, 2, 1080, 772, 2, 1048, 776, 2, 1080, 776, 2, 1054, 776, 2,
+    1086, 776, 2, 1256, 776, 2, 1257, 776, 2, 1069, 776, 2, 1101, 776, 2,
+    1059, 772, 2, 1091, 772, 2, 1059, 776, 2, 1091, 776, 2, 1059, 779, 2,
+    1091, 779, 2, 1063, 776, 2, 1095, 776, 2, 1067, 776, 2, 1099, 776, 512,
+    1381, 1410, 2, 1575, 1619, 2, 1575, 1620, 2, 1608, 1620, 2, 1575, 1621, 2,
+    1610, 1620, 512, 1575, 1652, 512, 1608, 1652, 512, 1735, 1652, 512, 1610,
+    1652, 2, 1749, 1620, 2, 1729, 1620, 2, 1746, 1620, 2, 2344, 2364, 2, 2352,
+    2364, 2, 2355, 2364, 2, 2325, 2364, 2, 2326, 2364, 2, 2327, 2364, 2, 2332,
+    2364, 2, 2337, 2364, 2, 2338, 2364, 2, 2347, 2364, 2, 2351, 2364, 2, 2503,
+    2494, 2, 2503, 2519, 2, 2465, 2492, 2, 2466, 2492, 2, 2479, 2492, 2, 2610,
+    2620, 2, 2616, 2620, 2, 2582, 2620, 2, 2583, 2620, 2, 2588, 2620, 2, 2603,
+    2620, 2, 2887, 2902, 2, 2887, 2878, 2, 2887, 2903, 2, 2849, 2876, 2, 2850,
+    2876, 2, 2962, 3031, 2, 3014, 3006, 2, 3015, 3006, 2, 3014, 3031, 2, 3142,
+    3158, 2, 3263, 3285, 2, 3270, 3285, 2, 3270, 3286, 2, 3270, 3266, 3, 3270,
+    3266, 3285, 2, 3398, 3390, 2, 3399, 3390, 2, 3398, 3415, 2, 3545, 3530, 2,
+    3545, 3535, 3, 3545, 3535, 3530, 2, 3545, 3551, 512, 3661, 3634, 512,
+    3789, 3762, 512, 3755, 3737, 512, 3755, 3745, 256, 3851, 2, 3906, 4023, 2,
+    3916, 4023, 2, 3921, 4023, 2, 3926, 4023, 2, 3931, 4023, 2, 3904, 4021, 2,
+    3953, 3954, 2, 3953, 3956, 2, 4018, 3968, 768, 4018, 3953, 3968, 2, 4019,
+    3968, 768, 4019, 3953, 3968, 2, 3953, 3968, 2, 3986, 4023, 2, 3996, 4023,
+    2, 4001, 4023, 2, 4006, 4023, 2, 4011, 4023, 2, 3984, 4021, 2, 4133, 4142,
+    256, 4316, 2, 6917, 6965, 2, 6919, 6965, 2, 6921, 6965, 2, 6923, 6965, 2,
+    6925, 6965, 2, 6929, 6965, 2, 6970, 6965, 2, 6972, 6965, 2, 6974, 6965, 2,
+    6975, 6965, 2, 6978, 6965, 256, 65, 256, 198, 256, 66, 256, 68, 256, 69,
+    256, 398, 256, 71, 256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77,
+    256, 78, 256, 79, 256, 546, 256, 80, 256, 82, 256, 84, 256, 85, 256, 87,
+    256, 97, 256, 592, 256, 593, 256, 7426, 256, 98, 256, 100, 256, 101, 256,
+    601, 256, 603, 256, 604, 256, 103, 256, 107, 256, 109, 256, 331, 256, 111,
+    256, 596, 256, 7446, 256, 7447, 256, 112, 256, 116, 256, 117, 256, 7453,
+    256, 623, 256, 118, 256, 7461, 256, 946, 256, 947, 256, 948, 256, 966,
+    256, 967, 256, 105, 256, 114, 256, 117, 256, 118, 256, 946, 256, 947, 256,
+    961, 256, 966, 256, 967, 256, 1085, 256, 594, 256, 99, 256, 597, 256, 240,
+    256, 604, 256, 102, 256, 607, 256, 609, 256, 613, 256, 616, 256, 617, 256,
+    618, 256, 7547, 256, 669, 256, 621, 256, 7557, 256, 671, 256, 625, 256,
+    624, 256, 626, 256, 627, 256, 628, 256, 629, 256, 632, 256, 642, 256, 643,
+    256, 427, 256, 649, 256, 650, 256, 7452, 256, 651, 256, 652, 256, 122,
+    256, 656, 256, 657, 256, 658, 256, 952, 2, 65, 805, 2, 97, 805, 2, 66,
+    775, 2, 98, 775, 2, 66, 803, 2, 98, 803, 2, 66, 817, 2, 98, 817, 3, 67,
+    807, 769, 3, 99, 807, 769, 2, 68, 775, 2, 100, 775, 2, 68, 803, 2, 100,
+    803, 2, 68, 817, 2, 100, 817, 2, 68, 807, 2, 100, 807, 2, 68, 813, 2, 100,
+    813, 3, 69, 772, 768, 3, 101, 772, 768, 3, 69, 772, 769, 3, 101, 772, 769,
+    2, 69, 813, 2, 101, 813, 2, 69, 816, 2, 101, 816, 3, 69, 807, 774, 3, 101,
+    807, 774, 2, 70, 775, 2, 102, 775, 2, 71, 772, 2, 103, 772, 2, 72, 775, 2,
+    104, 775, 2, 72, 803, 2, 104, 803, 2, 72, 776, 2, 104, 776, 2, 72, 807, 2,
+    104, 807, 2, 72, 814, 2, 104, 814, 2, 73, 816, 2, 105, 816, 3, 73, 776,
+    769, 3, 105, 776, 769, 2, 75, 769, 2, 107, 769, 2, 75, 803, 2, 107, 803,
+    2, 75, 817, 2, 107, 817, 2, 76, 803, 2, 108, 803, 3, 76, 803, 772, 3, 108,
+    803, 772, 2, 76, 817, 2, 108, 817, 2, 76, 813, 2, 108, 813, 2, 77, 769, 2,
+    109, 769, 2, 77, 775, 2, 109, 775, 2, 77, 803, 2, 109, 803, 2, 78, 775, 2,
+    110, 775, 2, 78, 803, 2, 110, 803, 2, 78, 817, 2, 110, 817, 2, 78, 813, 2,
+    110, 813, 3, 79, 771, 769, 3, 111, 771, 769, 3, 79, 771, 776, 3, 111, 771,
+    776, 3, 79, 772, 768, 3, 111, 772, 768, 3, 79, 772, 769, 3, 111, 772, 769,
+    2, 80, 769, 2, 112, 769, 2, 80, 775, 2, 112, 775, 2, 82, 775, 2, 114, 775,
+    2, 82, 803, 2, 114, 803, 3, 82, 803, 772, 3, 114, 803, 772, 2, 82, 817, 2,
+    114, 817, 2, 83, 775, 2, 115, 775, 2, 83, 803, 2, 115, 803, 3, 83, 769,
+    775, 3, 115, 769, 775, 3, 83, 780, 775, 3, 115, 780, 775, 3, 83, 803, 775,
+    3, 115, 803, 775, 2, 84, 775, 2, 116, 775, 2, 84, 803, 2, 116, 803, 2, 84,
+    817, 2, 116, 817, 2, 84, 813, 2, 116, 813, 2, 85, 804, 2, 117, 804, 2, 85,
+    816, 2, 117, 816, 2, 85, 813, 2, 117, 813, 3, 85, 771, 769, 3, 117, 771,
+    769, 3, 85, 772, 776, 3, 117, 772, 776, 2, 86, 771, 2, 118, 771, 2, 86,
+    803, 2, 118, 803, 2, 87, 768, 2, 119, 768, 2, 87, 769, 2, 119, 769, 2, 87,
+    776, 2, 119, 776, 2, 87, 775, 2, 119, 775, 2, 87, 803, 2, 119, 803, 2, 88,
+    775, 2, 120, 775, 2, 88, 776, 2, 120, 776, 2, 89, 775, 2, 121, 775, 2, 90,
+    770, 2, 122, 770, 2, 90, 803, 2, 122, 803, 2, 90, 817, 2, 122, 817, 2,
+    104, 817, 2, 116, 776, 2, 119, 778, 2, 121, 778, 512, 97, 702, 514, 383,
+    775, 115, 775, 2, 65, 803, 2, 97, 803, 2, 65, 777, 2, 97, 777, 3, 65, 770,
+    769, 3, 97, 770, 769, 3, 65, 770, 768, 3, 97, 770, 768, 3, 65, 770, 777,
+    3, 97, 770, 777, 3, 65, 770, 771, 3, 97, 770, 771, 3, 65, 803, 770, 3, 97,
+    803, 770, 3, 65, 774, 769, 3, 97, 774, 769, 3, 65, 774, 768, 3, 97, 774,
+    768, 3, 65, 774, 777, 3, 97, 774, 777, 3, 65, 774, 771, 3, 97, 774, 771,
+    3, 65, 803, 774, 3, 97, 803, 774, 2, 69, 803, 2, 101, 803, 2, 69, 777, 2,
+    101, 777, 2, 69, 771, 2, 101, 771, 3, 69, 770, 769, 3, 101, 770, 769, 3,
+    69, 770, 768, 3, 101, 770, 768, 3, 69, 770, 777, 3, 101, 770, 777, 3, 69,
+    770, 771, 3, 101, 770, 771, 3, 69, 803, 770, 3, 101, 803, 770, 2, 73, 777,
+    2, 105, 777, 2, 73, 803, 2, 105, 803, 2, 79, 803, 2, 111, 803, 2, 79, 777,
+    2, 111, 777, 3, 79, 770, 769, 3, 111, 770, 769, 3, 79, 770, 768, 3, 111,
+    770, 768, 3, 79, 770, 777, 3, 111, 770, 777, 3, 79, 770, 771, 3, 111, 770,
+    771, 3, 79, 803, 770, 3, 111, 803, 770, 3, 79, 795, 769, 3, 111, 795, 769,
+    3, 79, 795, 768, 3, 111, 795, 768, 3, 79, 795, 777, 3, 111, 795, 777, 3,
+    79, 795, 771, 3, 111, 795, 771, 3, 79, 795, 803, 3, 111, 795, 803, 2, 85,
+    803, 2, 117, 803, 2, 85, 777, 2, 117, 777, 3, 85, 795, 769, 3, 117, 795,
+    769, 3, 85, 795, 768, 3, 117, 795, 768, 3, 85, 795, 777, 3, 117, 795, 777,
+    3, 85, 795, 771, 3, 117, 795, 771, 3, 85, 795, 803, 3, 117, 795, 803, 2,
+    89, 768, 2, 121, 768, 2, 89, 803, 2, 121, 803, 2, 89, 777, 2, 121, 777, 2,
+    89, 771, 2, 121, 771, 2, 945, 787, 2, 945, 788, 3, 945, 787, 768, 3, 945,
+    788, 768, 3, 945, 787, 769, 3, 945, 788, 769, 3, 945, 787, 834, 3, 945,
+    788, 834, 2, 913, 787, 2, 913, 788, 3, 913, 787, 768, 3, 913, 788, 768, 3,
+    913, 787, 769, 3, 913, 788, 769, 3, 913, 787, 834, 3, 913, 788, 834, 2,
+    949, 787, 2, 949, 788, 3, 949, 787, 768, 3, 949, 788, 768, 3, 949, 787,
+    769, 3, 949, 788, 769, 2, 917, 787, 2, 917, 788, 3, 917, 787, 768, 3, 917,
+    788, 768, 3, 917, 787, 769, 3, 917, 788, 769, 2, 951, 787, 2, 951, 788, 3,
+    951, 787, 768, 3, 951, 788, 768, 3, 951, 787, 769, 3, 951, 788, 769, 3,
+    951, 787, 834, 3, 951, 788, 834, 2, 919, 787, 2, 919, 788, 3, 919, 787,
+    768, 3, 919, 788, 768, 3, 919, 787, 769, 3, 919, 788, 769, 3, 919, 787,
+    834, 3, 919, 788, 834, 2, 953, 787, 2, 953, 788, 3, 953, 787, 768, 3, 953,
+    788, 768, 3, 953, 787, 769, 3, 953, 788, 769, 3, 953, 787, 834, 3, 953,
+    788, 834, 2, 921, 787, 2, 921, 788, 3, 921, 787, 768, 3, 921, 788, 768, 3,
+    921, 787, 769, 3, 921, 788, 769, 3, 921, 787, 834, 3, 921, 788, 834, 2,
+    959, 787, 2, 959, 788, 3, 959, 787, 768, 3, 959, 788, 768, 3, 959, 787,
+    769, 3, 959, 788, 769, 2, 927, 787, 2, 927, 788, 3, 927, 787, 768, 3, 927,
+    788, 768, 3, 927, 787, 769, 3, 927, 788, 769, 2, 965, 787, 2, 965, 788, 3,
+    965, 787, 768, 3, 965, 788, 768, 3, 965, 787, 769, 3, 965, 788, 769, 3,
+    965, 787, 834, 3, 965, 788, 834, 2, 933, 788, 3, 933, 788, 768, 3, 933,
+    788, 769, 3, 933, 788, 834, 2, 969, 787, 2, 969, 788, 3, 969, 787, 768, 3,
+    969, 788, 768, 3, 969, 787, 769, 3, 969, 788, 769, 3, 969, 787, 834, 3,
+    969, 788, 834, 2, 937, 787, 2, 937, 788, 3, 937, 787, 768, 3, 937, 788,
+    768, 3, 937, 787, 769, 3, 937, 788, 769, 3, 937, 787, 834, 3, 937, 788,
+    834, 2, 945, 768, 2, 945, 769, 2, 949, 768, 2, 949, 769, 2, 951, 768, 2,
+    951, 769, 2, 953, 768, 2, 953, 769, 2, 959, 768, 2, 959, 769, 2, 965, 768,
+    2, 965, 769, 2, 969, 768, 2, 969, 769, 3, 945, 787, 837, 3, 945, 788, 837,
+    4, 945, 787, 768, 837, 4, 945, 788, 768, 837, 4, 945, 787, 769, 837, 4,
+    945, 788, 769, 837, 4, 945, 787, 834, 837, 4, 945, 788, 834, 837, 3, 913,
+    787, 837, 3, 913, 788, 837, 4, 913, 787, 768, 837, 4, 913, 788, 768, 837,
+    4, 913, 787, 769, 837, 4, 913, 788, 769, 837, 4, 913, 787, 834, 837, 4,
+    913, 788, 834, 837, 3, 951, 787, 837, 3, 951, 788, 837, 4, 951, 787, 768,
+    837, 4, 951, 788, 768, 837, 4, 951, 787, 769, 837, 4, 951, 788, 769, 837,
+    4, 951, 787, 834, 837, 4, 951, 788, 834, 837, 3, 919, 787, 837, 3, 919,
+    788, 837, 4, 919, 787, 768, 837, 4, 919, 788, 768, 837, 4, 919, 787, 769,
+    837, 4, 919, 788, 769, 837, 4, 919, 787, 834, 837, 4, 919, 788, 834, 837,
+    3, 969, 787, 837, 3, 969, 788, 837, 4, 969, 787, 768, 837, 4, 969, 788,
+    768, 837, 4, 969, 787, 769, 837, 4, 969, 788, 769, 837, 4, 969, 787, 834,
+    837, 4, 969, 788, 834, 837, 3, 937, 787, 837, 3, 937, 788, 837, 4, 937,
+    787, 768, 837, 4, 937, 788, 768, 837, 4, 937, 787, 769, 837, 4, 937, 788,
+    769, 837, 4, 937, 787, 834, 837, 4, 937, 788, 834, 837, 2, 945, 774, 2,
+    945, 772, 3, 945, 768, 837, 2, 945, 837, 3, 945, 769, 837, 2, 945, 834, 3,
+    945, 834, 837, 2, 913, 774, 2, 913, 772, 2, 913, 768, 2, 913, 769, 2, 913,
+    837, 512, 32, 787, 1, 953, 512, 32, 787, 512, 32, 834, 770, 168, 834, 32,
+    776, 834, 3, 951, 768, 837, 2, 951, 837, 3, 951, 769, 837, 2, 951, 834, 3,
+    951, 834, 837, 2, 917, 768, 2, 917, 769, 2, 919, 768, 2, 919, 769, 2, 919,
+    837, 770, 8127, 768, 32, 787, 768, 770, 8127, 769, 32, 787, 769, 770,
+    8127, 834, 32, 787, 834, 2, 953, 774, 2, 953, 772, 3, 953, 776, 768, 3,
+    953, 776, 769, 2, 953, 834, 3, 953, 776, 834, 2, 921, 774, 2, 921, 772, 2,
+    921, 768, 2, 921, 769, 770, 8190, 768, 32, 788, 768, 770, 8190, 769, 32,
+    788, 769, 770, 8190, 834, 32, 788, 834, 2, 965, 774, 2, 965, 772, 3, 965,
+    776, 768, 3, 965, 776, 769, 2, 961, 787, 2, 961, 788, 2, 965, 834, 3, 965,
+    776, 834, 2, 933, 774, 2, 933, 772, 2, 933, 768, 2, 933, 769, 2, 929, 788,
+    770, 168, 768, 32, 776, 768, 770, 168, 769, 32, 776, 769, 1, 96, 3, 969,
+    768, 837, 2, 969, 837, 3, 969, 769, 837, 2, 969, 834, 3, 969, 834, 837, 2,
+    927, 768, 2, 927, 769, 2, 937, 768, 2, 937, 769, 2, 937, 837, 513, 180,
+    32, 769, 512, 32, 788, 257, 8194, 32, 257, 8195, 32, 256, 32, 256, 32,
+    256, 32, 256, 32, 256, 32, 256, 32, 256, 32, 256, 32, 256, 32, 256, 8208,
+    512, 32, 819, 256, 46, 512, 46, 46, 768, 46, 46, 46, 256, 32, 512, 8242,
+    8242, 768, 8242, 8242, 8242, 512, 8245, 8245, 768, 8245, 8245, 8245, 512,
+    33, 33, 512, 32, 773, 512, 63, 63, 512, 63, 33, 512, 33, 63, 1024, 8242,
+    8242, 8242, 8242, 256, 32, 256, 48, 256, 105, 256, 52, 256, 53, 256, 54,
+    256, 55, 256, 56, 256, 57, 256, 43, 256, 8722, 256, 61, 256, 40, 256, 41,
+    256, 110, 256, 48, 256, 49, 256, 50, 256, 51, 256, 52, 256, 53, 256, 54,
+    256, 55, 256, 56, 256, 57, 256, 43, 256, 8722, 256, 61, 256, 40, 256, 41,
+    256, 97, 256, 101, 256, 111, 256, 120, 256, 601, 256, 104, 256, 107, 256,
+    108, 256, 109, 256, 110, 256, 112, 256, 115, 256, 116, 512, 82, 115, 768,
+    97, 47, 99, 768, 97, 47, 115, 256, 67, 512, 176, 67, 768, 99, 47, 111,
+    768, 99, 47, 117, 256, 400, 512, 176, 70, 256, 103, 256, 72, 256, 72, 256,
+    72, 256, 104, 256, 295, 256, 73, 256, 73, 256, 76, 256, 108, 256, 78, 512,
+    78, 111, 256, 80, 256, 81, 256, 82, 256, 82, 256, 82, 512, 83, 77, 768,
+    84, 69, 76, 512, 84, 77, 256, 90, 1, 937, 256, 90, 1, 75, 2, 65, 778, 256,
+    66, 256, 67, 256, 101, 256, 69, 256, 70, 256, 77, 256, 111, 256, 1488,
+    256, 1489, 256, 1490, 256, 1491, 256, 105, 768, 70, 65, 88, 256, 960, 256,
+    947, 256, 915, 256, 928, 256, 8721, 256, 68, 256, 100, 256, 101, 256, 105,
+    256, 106, 768, 49, 8260, 55, 768, 49, 8260, 57, 1024, 49, 8260, 49, 48,
+    768, 49, 8260, 51, 768, 50, 8260, 51, 768, 49, 8260, 53, 768, 50, 8260,
+    53, 768, 51, 8260, 53, 768, 52, 8260, 53, 768, 49, 8260, 54, 768, 53,
+    8260, 54, 768, 49, 8260, 56, 768, 51, 8260, 56, 768, 53, 8260, 56, 768,
+    55, 8260, 56, 512, 49, 8260, 256, 73, 512, 73, 73, 768, 73, 73, 73, 512,
+    73, 86, 256, 86, 512, 86, 73, 768, 86, 73, 73, 1024, 86, 73, 73, 73, 512,
+    73, 88, 256, 88, 512, 88, 73, 768, 88, 73, 73, 256, 76, 256, 67, 256, 68,
+    256, 77, 256, 105, 512, 105, 105, 768, 105, 105, 105, 512, 105, 118, 256,
+    118, 512, 118, 105, 768, 118, 105, 105, 1024, 118, 105, 105, 105, 512,
+    105, 120, 256, 120, 512, 120, 105, 768, 120, 105, 105, 256, 108, 256, 99,
+    256, 100, 256, 109, 768, 48, 8260, 51, 2, 8592, 824, 2, 8594, 824, 2,
+    8596, 824, 2, 8656, 824, 2, 8660, 824, 2, 8658, 824, 2, 8707, 824, 2,
+    8712, 824, 2, 8715, 824, 2, 8739, 824, 2, 8741, 824, 512, 8747, 8747, 768,
+    8747, 8747, 8747, 512, 8750, 8750, 768, 8750, 8750, 8750, 2, 8764, 824, 2,
+    8771, 824, 2, 8773, 824, 2, 8776, 824, 2, 61, 824, 2, 8801, 824, 2, 8781,
+    824, 2, 60, 824, 2, 62, 824, 2, 8804, 824, 2, 8805, 824, 2, 8818, 824, 2,
+    8819, 824, 2, 8822, 824, 2, 8823, 824, 2, 8826, 824, 2, 8827, 824, 2,
+    8834, 824, 2, 8835, 824, 2, 8838, 824, 2, 8839, 824, 2, 8866, 824, 2,
+    8872, 824, 2, 8873, 824, 2, 8875, 824, 2, 8828, 824, 2, 8829, 824, 2,
+    8849, 824, 2, 8850, 824, 2, 8882, 824, 2, 8883, 824, 2, 8884, 824, 2,
+    8885, 824, 1, 12296, 1, 12297, 256, 49, 256, 50, 256, 51, 256, 52, 256,
+    53, 256, 54, 256, 55, 256, 56, 256, 57, 512, 49, 48, 512, 49, 49, 512, 49,
+    50, 512, 49, 51, 512, 49, 52, 512, 49, 53, 512, 49, 54, 512, 49, 55, 512,
+    49, 56, 512, 49, 57, 512, 50, 48, 768, 40, 49, 41, 768, 40, 50, 41, 768,
+    40, 51, 41, 768, 40, 52, 41, 768, 40, 53, 41, 768, 40, 54, 41, 768, 40,
+    55, 41, 768, 40, 56, 41, 768, 40, 57, 41, 1024, 40, 49, 48, 41, 1024, 40,
+    49, 49, 41, 1024, 40, 49, 50, 41, 1024, 40, 49, 51, 41, 1024, 40, 49, 52,
+    41, 1024, 40, 49, 53, 41, 1024, 40, 49, 54, 41, 1024, 40, 49, 55, 41,
+    1024, 40, 49, 56, 41, 1024, 40, 49, 57, 41, 1024, 40, 50, 48, 41, 512, 49,
+    46, 512, 50, 46, 512, 51, 46, 512, 52, 46, 512, 53, 46, 512, 54, 46, 512,
+    55, 46, 512, 56, 46, 512, 57, 46, 768, 49, 48, 46, 768, 49, 49, 46, 768,
+    49, 50, 46, 768, 49, 51, 46, 768, 49, 52, 46, 768, 49, 53, 46, 768, 49,
+    54, 46, 768, 49, 55, 46, 768, 49, 56, 46, 768, 49, 57, 46, 768, 50, 48,
+    46, 768, 40, 97, 41, 768, 40, 98, 41, 768, 40, 99, 41, 768, 40, 100, 41,
+    768, 40, 101, 41, 768, 40, 102, 41, 768, 40, 103, 41, 768, 40, 104, 41,
+    768, 40, 105, 41, 768, 40, 106, 41, 768, 40, 107, 41, 768, 40, 108, 41,
+    768, 40, 109, 41, 768, 40, 110, 41, 768, 40, 111, 41, 768, 40, 112, 41,
+    768, 40, 113, 41, 768, 40, 114, 41, 768, 40, 115, 41, 768, 40, 116, 41,
+    768, 40, 117, 41, 768, 40, 118, 41, 768, 40, 119, 41, 768, 40, 120, 41,
+    768, 40, 121, 41, 768, 40, 122, 41, 256, 65, 256, 66, 256, 67, 256, 68,
+    256, 69, 256, 70, 256, 71, 256, 72, 256, 73, 256, 74, 256, 75, 256, 76,
+    256, 77, 256, 78, 256, 79, 256, 80, 256, 81, 256, 82, 256, 83, 256, 84,
+    256, 85, 256, 86, 256, 87, 256, 88, 256, 89, 256, 90, 256, 97, 256, 98,
+    256, 99, 256, 100, 256, 101, 256, 102, 256, 103, 256, 104, 256, 105, 256,
+    106, 256, 107, 256, 108, 256, 109, 256, 110, 256, 111, 256, 112, 256, 113,
+    256, 114, 256, 115, 256, 116, 256, 117, 256, 118, 256, 119, 256, 120, 256,
+    121, 256, 122, 256, 48, 1024, 8747, 8747, 8747, 8747, 768, 58, 58, 61,
+    512, 61, 61, 768, 61, 61, 61, 2, 10973, 824, 256, 106, 256, 86, 256,
+    11617, 256, 27597, 256, 40863, 256, 19968, 256, 20008, 256, 20022, 256,
+    20031, 256, 20057, 256, 20101, 256, 20108, 256, 20128, 256, 20154, 256,
+    20799, 256, 20837, 256, 20843, 256, 20866, 256, 20886, 256, 20907, 256,
+    20960, 256, 20981, 256, 20992, 256, 21147, 256, 21241, 256, 21269, 256,
+    21274, 256, 21304, 256, 21313, 256, 21340, 256, 21353, 256, 21378, 256,
+    21430, 256, 21448, 256, 21475, 256, 22231, 256, 22303, 256, 22763, 256,
+    22786, 256, 22794, 256, 22805, 256, 22823, 256, 22899, 256, 23376, 256,
+    23424, 256, 23544, 256, 23567, 256, 23586, 256, 23608, 256, 23662, 256,
+    23665, 256, 24027, 256, 24037, 256, 24049, 256, 24062, 256, 24178, 256,
+    24186, 256, 24191, 256, 24308, 256, 24318, 256, 24331, 256, 24339, 256,
+    24400, 256, 24417, 256, 24435, 256, 24515, 256, 25096, 256, 25142, 256,
+    25163, 256, 25903, 256, 25908, 256, 25991, 256, 26007, 256, 26020, 256,
+    26041, 256, 26080, 256, 26085, 256, 26352, 256, 26376, 256, 26408, 256,
+    27424, 256, 27490, 256, 27513, 256, 27571, 256, 27595, 256, 27604, 256,
+    27611, 256, 27663, 256, 27668, 256, 27700, 256, 28779, 256, 29226, 256,
+    29238, 256, 29243, 256, 29247, 256, 29255, 256, 29273, 256, 29275, 256,
+    29356, 256, 29572, 256, 29577, 256, 29916, 256, 29926, 256, 29976, 256,
+    29983, 256, 29992, 256, 30000, 256, 30091, 256, 30098, 256, 30326, 256,
+    30333, 256, 30382, 256, 30399, 256, 30446, 256, 30683, 256, 30690, 256,
+    30707, 256, 31034, 256, 31160, 256, 31166, 256, 31348, 256, 31435, 256,
+    31481, 256, 31859, 256, 31992, 256, 32566, 256, 32593, 256, 32650, 256,
+    32701, 256, 32769, 256, 32780, 256, 32786, 256, 32819, 256, 32895, 256,
+    32905, 256, 33251, 256, 33258, 256, 33267, 256, 33276, 256, 33292, 256,
+    33307, 256, 33311, 256, 33390, 256, 33394, 256, 33400, 256, 34381, 256,
+    34411, 256, 34880, 256, 34892, 256, 34915, 256, 35198, 256, 35211, 256,
+    35282, 256, 35328, 256, 35895, 256, 35910, 256, 35925, 256, 35960, 256,
+    35997, 256, 36196, 256, 36208, 256, 36275, 256, 36523, 256, 36554, 256,
+    36763, 256, 36784, 256, 36789, 256, 37009, 256, 37193, 256, 37318, 256,
+    37324, 256, 37329, 256, 38263, 256, 38272, 256, 38428, 256, 38582, 256,
+    38585, 256, 38632, 256, 38737, 256, 38750, 256, 38754, 256, 38761, 256,
+    38859, 256, 38893, 256, 38899, 256, 38913, 256, 39080, 256, 39131, 256,
+    39135, 256, 39318, 256, 39321, 256, 39340, 256, 39592, 256, 39640, 256,
+    39647, 256, 39717, 256, 39727, 256, 39730, 256, 39740, 256, 39770, 256,
+    40165, 256, 40565, 256, 40575, 256, 40613, 256, 40635, 256, 40643, 256,
+    40653, 256, 40657, 256, 40697, 256, 40701, 256, 40718, 256, 40723, 256,
+    40736, 256, 40763, 256, 40778, 256, 40786, 256, 40845, 256, 40860, 256,
+    40864, 256, 32, 256, 12306, 256, 21313, 256, 21316, 256, 21317, 2, 12363,
+    12441, 2, 12365, 12441, 2, 12367, 12441, 2, 12369, 12441, 2, 12371, 12441,
+    2, 12373, 12441, 2, 12375, 12441, 2, 12377, 12441, 2, 12379, 12441, 2,
+    12381, 12441, 2, 12383, 12441, 2, 12385, 12441, 2, 12388, 12441, 2, 12390,
+    12441, 2, 12392, 12441, 2, 12399, 12441, 2, 12399, 12442, 2, 12402, 12441,
+    2, 12402, 12442, 2, 12405, 12441, 2, 12405, 12442, 2, 12408, 12441, 2,
+    12408, 12442, 2, 12411, 12441, 2, 12411, 12442, 2, 12358, 12441, 512, 32,
+    12441, 512, 32, 12442, 2, 12445, 12441, 512, 12424, 12426, 2, 12459,
+    12441, 2, 12461, 12441, 2, 12463, 12441, 2, 12465, 12441, 2, 12467, 12441,
+    2, 12469, 12441, 2, 12471, 12441, 2, 12473, 12441, 2, 12475, 12441, 2,
+    12477, 12441, 2, 12479, 12441, 2, 12481, 12441, 2, 12484, 12441, 2, 12486,
+    12441, 2, 12488, 12441, 2, 12495, 12441, 2, 12495, 12442, 2, 12498, 12441,
+    2, 12498, 12442, 2, 12501, 12441, 2, 12501, 12442, 2, 12504, 12441, 2,
+    12504, 12442, 2, 12507, 12441, 2, 12507, 12442, 2, 12454, 12441, 2, 12527,
+    12441, 2, 12528, 12441, 2, 12529, 12441, 2, 12530, 12441, 2, 12541, 12441,
+    512, 12467, 12488, 256, 4352, 256, 4353, 256, 4522, 256, 4354, 256, 4524,
+    256, 4525, 256, 4355, 256, 4356, 256, 4357, 256, 4528, 256, 4529, 256,
+    4530, 256, 4531, 256, 4532, 256, 4533, 256, 4378, 256, 4358, 256, 4359,
+    256, 4360, 256, 4385, 256, 4361, 256, 4362, 256, 4363, 256, 4364, 256,
+    4365, 256, 4366, 256, 4367, 256, 4368, 256, 4369, 256, 4370, 256, 4449,
+    256, 4450, 256, 4451, 256, 4452, 256, 4453, 256, 4454, 256, 4455, 256,
+    4456, 256, 4457, 256, 4458, 256, 4459, 256, 4460, 256, 4461, 256, 4462,
+    256, 4463, 256, 4464, 256, 4465, 256, 4466, 256, 4467, 256, 4468, 256,
+    4469, 256, 4448, 256, 4372, 256, 4373, 256, 4551, 256, 4552, 256, 4556,
+    256, 4558, 256, 4563, 256, 4567, 256, 4569, 256, 4380, 256, 4573, 256,
+    4575, 256, 4381, 256, 4382, 256, 4384, 256, 4386, 256, 4387, 256, 4391,
+    256, 4393, 256, 4395, 256, 4396, 256, 4397, 256, 4398, 256, 4399, 256,
+    4402, 256, 4406, 256, 4416, 256, 4423, 256, 4428, 256, 4593, 256, 4594,
+    256, 4439, 256, 4440, 256, 4441, 256, 4484, 256, 4485, 256, 4488, 256,
+    4497, 256, 4498, 256, 4500, 256, 4510, 256, 4513, 256, 19968, 256, 20108,
+    256, 19977, 256, 22235, 256, 19978, 256, 20013, 256, 19979, 256, 30002,
+    256, 20057, 256, 19993, 256, 19969, 256, 22825, 256, 22320, 256, 20154,
+    768, 40, 4352, 41, 768, 40, 4354, 41, 768, 40, 4355, 41, 768, 40, 4357,
+    41, 768, 40, 4358, 41, 768, 40, 4359, 41, 768, 40, 4361, 41, 768, 40,
+    4363, 41, 768, 40, 4364, 41, 768, 40, 4366, 41, 768, 40, 4367, 41, 768,
+    40, 4368, 41, 768, 40, 4369, 41, 768, 40, 4370, 41, 1024, 40, 4352, 4449,
+    41, 1024, 40, 4354, 4449, 41, 1024, 40, 4355, 4449, 41, 1024, 40, 4357,
+    4449, 41, 1024, 40, 4358, 4449, 41, 1024, 40, 4359, 4449, 41, 1024, 40,
+    4361, 4449, 41, 1024, 40, 4363, 4449, 41, 1024, 40, 4364, 4449, 41, 1024,
+    40, 4366, 4449, 41, 1024, 40, 4367, 4449, 41, 1024, 40, 4368, 4449, 41,
+    1024, 40, 4369, 4449, 41, 1024, 40, 4370, 4449, 41, 1024, 40, 4364, 4462,
+    41, 1792, 40, 4363, 4457, 4364, 4453, 4523, 41, 1536, 40, 4363, 4457,
+    4370, 4462, 41, 768, 40, 19968, 41, 768, 40, 20108, 41, 768, 40, 19977,
+    41, 768, 40, 22235, 41, 768, 40, 20116, 41, 768, 40, 20845, 41, 768, 40,
+    19971, 41, 768, 40, 20843, 41, 768, 40, 20061, 41, 768, 40, 21313, 41,
+    768, 40, 26376, 41, 768, 40, 28779, 41, 768, 40, 27700, 41, 768, 40,
+    26408, 41, 768, 40, 37329, 41, 768, 40, 22303, 41, 768, 40, 26085, 41,
+    768, 40, 26666, 41, 768, 40, 26377, 41, 768, 40, 31038, 41, 768, 40,
+    21517, 41, 768, 40, 29305, 41, 768, 40, 36001, 41, 768, 40, 31069, 41,
+    768, 40, 21172, 41, 768, 40, 20195, 41, 768, 40, 21628, 41, 768, 40,
+    23398, 41, 768, 40, 30435, 41, 768, 40, 20225, 41, 768, 40, 36039, 41,
+    768, 40, 21332, 41, 768, 40, 31085, 41, 768, 40, 20241, 41, 768, 40,
+    33258, 41, 768, 40, 33267, 41, 256, 21839, 256, 24188, 256, 25991, 256,
+    31631, 768, 80, 84, 69, 512, 50, 49, 512, 50, 50, 512, 50, 51, 512, 50,
+    52, 512, 50, 53, 512, 50, 54, 512, 50, 55, 512, 50, 56, 512, 50, 57, 512,
+    51, 48, 512, 51, 49, 512, 51, 50, 512, 51, 51, 512, 51, 52, 512, 51, 53,
+    256, 4352, 256, 4354, 256, 4355, 256, 4357, 256, 4358, 256, 4359, 256,
+    4361, 256, 4363, 256, 4364, 256, 4366, 256, 4367, 256, 4368, 256, 4369,
+    256, 4370, 512, 4352, 4449, 512, 4354, 4449, 512, 4355, 4449, 512, 4357,
+    4449, 512, 4358, 4449, 512, 4359, 4449, 512, 4361, 4449, 512, 4363, 4449,
+    512, 4364, 4449, 512, 4366, 4449, 512, 4367, 4449, 512, 4368, 4449, 512,
+    4369, 4449, 512, 4370, 4449, 1280, 4366, 4449, 4535, 4352, 4457, 1024,
+    4364, 4462, 4363, 4468, 512, 4363, 4462, 256, 19968, 256, 20108, 256,
+    19977, 256, 22235, 256, 20116, 256, 20845, 256, 19971, 256, 20843, 256,
+    20061, 256, 21313, 256, 26376, 256, 28779, 256, 27700, 256, 26408, 256,
+    37329, 256, 22303, 256, 26085, 256, 26666, 256, 26377, 256, 31038, 256,
+    21517, 256, 29305, 256, 36001, 256, 31069, 256, 21172, 256, 31192, 256,
+    30007, 256, 22899, 256, 36969, 256, 20778, 256, 21360, 256, 27880, 256,
+    38917, 256, 20241, 256, 20889, 256, 27491, 256, 19978, 256, 20013, 256,
+    19979, 256, 24038, 256, 21491, 256, 21307, 256, 23447, 256, 23398, 256,
+    30435, 256, 20225, 256, 36039, 256, 21332, 256, 22812, 512, 51, 54, 512,
+    51, 55, 512, 51, 56, 512, 51, 57, 512, 52, 48, 512, 52, 49, 512, 52, 50,
+    512, 52, 51, 512, 52, 52, 512, 52, 53, 512, 52, 54, 512, 52, 55, 512, 52,
+    56, 512, 52, 57, 512, 53, 48, 512, 49, 26376, 512, 50, 26376, 512, 51,
+    26376, 512, 52, 26376, 512, 53, 26376, 512, 54, 26376, 512, 55, 26376,
+    512, 56, 26376, 512, 57, 26376, 768, 49, 48, 26376, 768, 49, 49, 26376,
+    768, 49, 50, 26376, 512, 72, 103, 768, 101, 114, 103, 512, 101, 86, 768,
+    76, 84, 68, 256, 12450, 256, 12452, 256, 12454, 256, 12456, 256, 12458,
+    256, 12459, 256, 12461, 256, 12463, 256, 12465, 256, 12467, 256, 12469,
+    256, 12471, 256, 12473, 256, 12475, 256, 12477, 256, 12479, 256, 12481,
+    256, 12484, 256, 12486, 256, 12488, 256, 12490, 256, 12491, 256, 12492,
+    256, 12493, 256, 12494, 256, 12495, 256, 12498, 256, 12501, 256, 12504,
+    256, 12507, 256, 12510, 256, 12511, 256, 12512, 256, 12513, 256, 12514,
+    256, 12516, 256, 12518, 256, 12520, 256, 12521, 256, 12522, 256, 12523,
+    256, 12524, 256, 12525, 256, 12527, 256, 12528, 256, 12529, 256, 12530,
+    512, 20196, 21644, 1280, 12450, 12495, 12442, 12540, 12488, 1024, 12450,
+    12523, 12501, 12449, 1280, 12450, 12531, 12504, 12442, 12450, 768, 12450,
+    12540, 12523, 1280, 12452, 12491, 12531, 12463, 12441, 768, 12452, 12531,
+    12481, 768, 12454, 12457, 12531, 1536, 12456, 12473, 12463, 12540, 12488,
+    12441, 1024, 12456, 12540, 12459, 12540, 768, 12458, 12531, 12473, 768,
+    12458, 12540, 12512, 768, 12459, 12452, 12522, 1024, 12459, 12521, 12483,
+    12488, 1024, 12459, 12525, 12522, 12540, 1024, 12459, 12441, 12525, 12531,
+    1024, 12459, 12441, 12531, 12510, 1024, 12461, 12441, 12459, 12441, 1024,
+    12461, 12441, 12491, 12540, 1024, 12461, 12517, 12522, 12540, 1536, 12461,
+    12441, 12523, 12479, 12441, 12540, 512, 12461, 12525, 1536, 12461, 12525,
+    12463, 12441, 12521, 12512, 1536, 12461, 12525, 12513, 12540, 12488,
+    12523, 1280, 12461, 12525, 12527, 12483, 12488, 1024, 12463, 12441, 12521,
+    12512, 1536, 12463, 12441, 12521, 12512, 12488, 12531, 1536, 12463, 12523,
+    12475, 12441, 12452, 12525, 1024, 12463, 12525, 12540, 12493, 768, 12465,
+    12540, 12473, 768, 12467, 12523, 12490, 1024, 12467, 12540, 12507, 12442,
+    1024, 12469, 12452, 12463, 12523, 1280, 12469, 12531, 12481, 12540, 12512,
+    1280, 12471, 12522, 12531, 12463, 12441, 768, 12475, 12531, 12481, 768,
+    12475, 12531, 12488, 1024, 12479, 12441, 12540, 12473, 768, 12486, 12441,
+    12471, 768, 12488, 12441, 12523, 512, 12488, 12531, 512, 12490, 12494,
+    768, 12494, 12483, 12488, 768, 12495, 12452, 12484, 1536, 12495, 12442,
+    12540, 12475, 12531, 12488, 1024, 12495, 12442, 12540, 12484, 1280, 12495,
+    12441, 12540, 12524, 12523, 1536, 12498, 12442, 12450, 12473, 12488,
+    12523, 1024, 12498, 12442, 12463, 12523, 768, 12498, 12442, 12467, 768,
+    12498, 12441, 12523, 1536, 12501, 12449, 12521, 12483, 12488, 12441, 1024,
+    12501, 12451, 12540, 12488, 1536, 12501, 12441, 12483, 12471, 12455,
+    12523, 768, 12501, 12521, 12531, 1280, 12504, 12463, 12479, 12540, 12523,
+    768, 12504, 12442, 12477, 1024, 12504, 12442, 12491, 12498, 768, 12504,
+    12523, 12484, 1024, 12504, 12442, 12531, 12473, 1280, 12504, 12442, 12540,
+    12471, 12441, 1024, 12504, 12441, 12540, 12479, 1280, 12507, 12442, 12452,
+    12531, 12488, 1024, 12507, 12441, 12523, 12488, 512, 12507, 12531, 1280,
+    12507, 12442, 12531, 12488, 12441, 768, 12507, 12540, 12523, 768, 12507,
+    12540, 12531, 1024, 12510, 12452, 12463, 12525, 768, 12510, 12452, 12523,
+    768, 12510, 12483, 12495, 768, 12510, 12523, 12463, 1280, 12510, 12531,
+    12471, 12519, 12531, 1024, 12511, 12463, 12525, 12531, 512, 12511, 12522,
+    1536, 12511, 12522, 12495, 12441, 12540, 12523, 768, 12513, 12459, 12441,
+    1280, 12513, 12459, 12441, 12488, 12531, 1024, 12513, 12540, 12488, 12523,
+    1024, 12516, 12540, 12488, 12441, 768, 12516, 12540, 12523, 768, 12518,
+    12450, 12531, 1024, 12522, 12483, 12488, 12523, 512, 12522, 12521, 1024,
+    12523, 12498, 12442, 12540, 1280, 12523, 12540, 12501, 12441, 12523, 512,
+    12524, 12512, 1536, 12524, 12531, 12488, 12465, 12441, 12531, 768, 12527,
+    12483, 12488, 512, 48, 28857, 512, 49, 28857, 512, 50, 28857, 512, 51,
+    28857, 512, 52, 28857, 512, 53, 28857, 512, 54, 28857, 512, 55, 28857,
+    512, 56, 28857, 512, 57, 28857, 768, 49, 48, 28857, 768, 49, 49, 28857,
+    768, 49, 50, 28857, 768, 49, 51, 28857, 768, 49, 52, 28857, 768, 49, 53,
+    28857, 768, 49, 54, 28857, 768, 49, 55, 28857, 768, 49, 56, 28857, 768,
+    49, 57, 28857, 768, 50, 48, 28857, 768, 50, 49, 28857, 768, 50, 50, 28857,
+    768, 50, 51, 28857, 768, 50, 52, 28857, 768, 104, 80, 97, 512, 100, 97,
+    512, 65, 85, 768, 98, 97, 114, 512, 111, 86, 512, 112, 99, 512, 100, 109,
+    768, 100, 109, 50, 768, 100, 109, 51, 512, 73, 85, 512, 24179, 25104, 512,
+    26157, 21644, 512, 22823, 27491, 512, 26126, 27835, 1024, 26666, 24335,
+    20250, 31038, 512, 112, 65, 512, 110, 65, 512, 956, 65, 512, 109, 65, 512,
+    107, 65, 512, 75, 66, 512, 77, 66, 512, 71, 66, 768, 99, 97, 108, 1024,
+    107, 99, 97, 108, 512, 112, 70, 512, 110, 70, 512, 956, 70, 512, 956, 103,
+    512, 109, 103, 512, 107, 103, 512, 72, 122, 768, 107, 72, 122, 768, 77,
+    72, 122, 768, 71, 72, 122, 768, 84, 72, 122, 512, 956, 108, 512, 109, 108,
+    512, 100, 108, 512, 107, 108, 512, 102, 109, 512, 110, 109, 512, 956, 109,
+    512, 109, 109, 512, 99, 109, 512, 107, 109, 768, 109, 109, 50, 768, 99,
+    109, 50, 512, 109, 50, 768, 107, 109, 50, 768, 109, 109, 51, 768, 99, 109,
+    51, 512, 109, 51, 768, 107, 109, 51, 768, 109, 8725, 115, 1024, 109, 8725,
+    115, 50, 512, 80, 97, 768, 107, 80, 97, 768, 77, 80, 97, 768, 71, 80, 97,
+    768, 114, 97, 100, 1280, 114, 97, 100, 8725, 115, 1536, 114, 97, 100,
+    8725, 115, 50, 512, 112, 115, 512, 110, 115, 512, 956, 115, 512, 109, 115,
+    512, 112, 86, 512, 110, 86, 512, 956, 86, 512, 109, 86, 512, 107, 86, 512,
+    77, 86, 512, 112, 87, 512, 110, 87, 512, 956, 87, 512, 109, 87, 512, 107,
+    87, 512, 77, 87, 512, 107, 937, 512, 77, 937, 1024, 97, 46, 109, 46, 512,
+    66, 113, 512, 99, 99, 512, 99, 100, 1024, 67, 8725, 107, 103, 768, 67,
+    111, 46, 512, 100, 66, 512, 71, 121, 512, 104, 97, 512, 72, 80, 512, 105,
+    110, 512, 75, 75, 512, 75, 77, 512, 107, 116, 512, 108, 109, 512, 108,
+    110, 768, 108, 111, 103, 512, 108, 120, 512, 109, 98, 768, 109, 105, 108,
+    768, 109, 111, 108, 512, 80, 72, 1024, 112, 46, 109, 46, 768, 80, 80, 77,
+    512, 80, 82, 512, 115, 114, 512, 83, 118, 512, 87, 98, 768, 86, 8725, 109,
+    768, 65, 8725, 109, 512, 49, 26085, 512, 50, 26085, 512, 51, 26085, 512,
+    52, 26085, 512, 53, 26085, 512, 54, 26085, 512, 55, 26085, 512, 56, 26085,
+    512, 57, 26085, 768, 49, 48, 26085, 768, 49, 49, 26085, 768, 49, 50,
+    26085, 768, 49, 51, 26085, 768, 49, 52, 26085, 768, 49, 53, 26085, 768,
+    49, 54, 26085, 768, 49, 55, 26085, 768, 49, 56, 26085, 768, 49, 57, 26085,
+    768, 50, 48, 26085, 768, 50, 49, 26085, 768, 50, 50, 26085, 768, 50, 51,
+    26085, 768, 50, 52, 26085, 768, 50, 53, 26085, 768, 50, 54, 26085, 768,
+    50, 55, 26085, 768, 50, 56, 26085, 768, 50, 57, 26085, 768, 51, 48, 26085,
+    768, 51, 49, 26085, 768, 103, 97, 108, 256, 1098, 256, 1100, 256, 42863,
+    256, 67, 256, 70, 256, 81, 256, 294, 256, 339, 256, 42791, 256, 43831,
+    256, 619, 256, 43858, 256, 653, 1, 35912, 1, 26356, 1, 36554, 1, 36040, 1,
+    28369, 1, 20018, 1, 21477, 1, 40860, 1, 40860, 1, 22865, 1, 37329, 1,
+    21895, 1, 22856, 1, 25078, 1, 30313, 1, 32645, 1, 34367, 1, 34746, 1,
+    35064, 1, 37007, 1, 27138, 1, 27931, 1, 28889, 1, 29662, 1, 33853, 1,
+    37226, 1, 39409, 1, 20098, 1, 21365, 1, 27396, 1, 29211, 1, 34349, 1,
+    40478, 1, 23888, 1, 28651, 1, 34253, 1, 35172, 1, 25289, 1, 33240, 1,
+    34847, 1, 24266, 1, 26391, 1, 28010, 1, 29436, 1, 37070, 1, 20358, 1,
+    20919, 1, 21214, 1, 25796, 1, 27347, 1, 29200, 1, 30439, 1, 32769, 1,
+    34310, 1, 34396, 1, 36335, 1, 38706, 1, 39791, 1, 40442, 1, 30860, 1,
+    31103, 1, 32160, 1, 33737, 1, 37636, 1, 40575, 1, 35542, 1, 22751, 1,
+    24324, 1, 31840, 1, 32894, 1, 29282, 1, 30922, 1, 36034, 1, 38647, 1,
+    22744, 1, 23650, 1, 27155, 1, 28122, 1, 28431, 1, 32047, 1, 32311, 1,
+    38475, 1, 21202, 1, 32907, 1, 20956, 1, 20940, 1, 31260, 1, 32190, 1,
+    33777, 1, 38517, 1, 35712, 1, 25295, 1, 27138, 1, 35582, 1, 20025, 1,
+    23527, 1, 24594, 1, 29575, 1, 30064, 1, 21271, 1, 30971, 1, 20415, 1,
+    24489, 1, 19981, 1, 27852, 1, 25976, 1, 32034, 1, 21443, 1, 22622, 1,
+    30465, 1, 33865, 1, 35498, 1, 27578, 1, 36784, 1, 27784, 1, 25342, 1,
+    33509, 1, 25504, 1, 30053, 1, 20142, 1, 20841, 1, 20937, 1, 26753, 1,
+    31975, 1, 33391, 1, 35538, 1, 37327, 1, 21237, 1, 21570, 1, 22899, 1,
+    24300, 1, 26053, 1, 28670, 1, 31018, 1, 38317, 1, 39530, 1, 40599, 1,
+    40654, 1, 21147, 1, 26310, 1, 27511, 1, 36706, 1, 24180, 1, 24976, 1,
+    25088, 1, 25754, 1, 28451, 1, 29001, 1, 29833, 1, 31178, 1, 32244, 1,
+    32879, 1, 36646, 1, 34030, 1, 36899, 1, 37706, 1, 21015, 1, 21155, 1,
+    21693, 1, 28872, 1, 35010, 1, 35498, 1, 24265, 1, 24565, 1, 25467, 1,
+    27566, 1, 31806, 1, 29557, 1, 20196, 1, 22265, 1, 23527, 1, 23994, 1,
+    24604, 1, 29618, 1, 29801, 1, 32666, 1, 32838, 1, 37428, 1, 38646, 1,
+    38728, 1, 38936, 1, 20363, 1, 31150, 1, 37300, 1, 38584, 1, 24801, 1,
+    20102, 1, 20698, 1, 23534, 1, 23615, 1, 26009, 1, 27138, 1, 29134, 1,
+    30274, 1, 34044, 1, 36988, 1, 40845, 1, 26248, 1, 38446, 1, 21129, 1,
+    26491, 1, 26611, 1, 27969, 1, 28316, 1, 29705, 1, 30041, 1, 30827, 1,
+    32016, 1, 39006, 1, 20845, 1, 25134, 1, 38520, 1, 20523, 1, 23833, 1,
+    28138, 1, 36650, 1, 24459, 1, 24900, 1, 26647, 1, 29575, 1, 38534, 1,
+    21033, 1, 21519, 1, 23653, 1, 26131, 1, 26446, 1, 26792, 1, 27877, 1,
+    29702, 1, 30178, 1, 32633, 1, 35023, 1, 35041, 1, 37324, 1, 38626, 1,
+    21311, 1, 28346, 1, 21533, 1, 29136, 1, 29848, 1, 34298, 1, 38563, 1,
+    40023, 1, 40607, 1, 26519, 1, 28107, 1, 33256, 1, 31435, 1, 31520, 1,
+    31890, 1, 29376, 1, 28825, 1, 35672, 1, 20160, 1, 33590, 1, 21050, 1,
+    20999, 1, 24230, 1, 25299, 1, 31958, 1, 23429, 1, 27934, 1, 26292, 1,
+    36667, 1, 34892, 1, 38477, 1, 35211, 1, 24275, 1, 20800, 1, 21952, 1,
+    22618, 1, 26228, 1, 20958, 1, 29482, 1, 30410, 1, 31036, 1, 31070, 1,
+    31077, 1, 31119, 1, 38742, 1, 31934, 1, 32701, 1, 34322, 1, 35576, 1,
+    36920, 1, 37117, 1, 39151, 1, 39164, 1, 39208, 1, 40372, 1, 37086, 1,
+    38583, 1, 20398, 1, 20711, 1, 20813, 1, 21193, 1, 21220, 1, 21329, 1,
+    21917, 1, 22022, 1, 22120, 1, 22592, 1, 22696, 1, 23652, 1, 23662, 1,
+    24724, 1, 24936, 1, 24974, 1, 25074, 1, 25935, 1, 26082, 1, 26257, 1,
+    26757, 1, 28023, 1, 28186, 1, 28450, 1, 29038, 1, 29227, 1, 29730, 1,
+    30865, 1, 31038, 1, 31049, 1, 31048, 1, 31056, 1, 31062, 1, 31069, 1,
+    31117, 1, 31118, 1, 31296, 1, 31361, 1, 31680, 1, 32244, 1, 32265, 1,
+    32321, 1, 32626, 1, 32773, 1, 33261, 1, 33401, 1, 33401, 1, 33879, 1,
+    35088, 1, 35222, 1, 35585, 1, 35641, 1, 36051, 1, 36104, 1, 36790, 1,
+    36920, 1, 38627, 1, 38911, 1, 38971, 1, 24693, 1, 148206, 1, 33304, 1,
+    20006, 1, 20917, 1, 20840, 1, 20352, 1, 20805, 1, 20864, 1, 21191, 1,
+    21242, 1, 21917, 1, 21845, 1, 21913, 1, 21986, 1, 22618, 1, 22707, 1,
+    22852, 1, 22868, 1, 23138, 1, 23336, 1, 24274, 1, 24281, 1, 24425, 1,
+    24493, 1, 24792, 1, 24910, 1, 24840, 1, 24974, 1, 24928, 1, 25074, 1,
+    25140, 1, 25540, 1, 25628, 1, 25682, 1, 25942, 1, 26228, 1, 26391, 1,
+    26395, 1, 26454, 1, 27513, 1, 27578, 1, 27969, 1, 28379, 1, 28363, 1,
+    28450, 1, 28702, 1, 29038, 1, 30631, 1, 29237, 1, 29359, 1, 29482, 1,
+    29809, 1, 29958, 1, 30011, 1, 30237, 1, 30239, 1, 30410, 1, 30427, 1,
+    30452, 1, 30538, 1, 30528, 1, 30924, 1, 31409, 1, 31680, 1, 31867, 1,
+    32091, 1, 32244, 1, 32574, 1, 32773, 1, 33618, 1, 33775, 1, 34681, 1,
+    35137, 1, 35206, 1, 35222, 1, 35519, 1, 35576, 1, 35531, 1, 35585, 1,
+    35582, 1, 35565, 1, 35641, 1, 35722, 1, 36104, 1, 36664, 1, 36978, 1,
+    37273, 1, 37494, 1, 38524, 1, 38627, 1, 38742, 1, 38875, 1, 38911, 1,
+    38923, 1, 38971, 1, 39698, 1, 40860, 1, 141386, 1, 141380, 1, 144341, 1,
+    15261, 1, 16408, 1, 16441, 1, 152137, 1, 154832, 1, 163539, 1, 40771, 1,
+    40846, 512, 102, 102, 512, 102, 105, 512, 102, 108, 768, 102, 102, 105,
+    768, 102, 102, 108, 512, 115, 116, 512, 115, 116, 512, 1396, 1398, 512,
+    1396, 1381, 512, 1396, 1387, 512, 1406, 1398, 512, 1396, 1389, 2, 1497,
+    1460, 2, 1522, 1463, 256, 1506, 256, 1488, 256, 1491, 256, 1492, 256,
+    1499, 256, 1500, 256, 1501, 256, 1512, 256, 1514, 256, 43, 2, 1513, 1473,
+    2, 1513, 1474, 3, 1513, 1468, 1473, 3, 1513, 1468, 1474, 2, 1488, 1463, 2,
+    1488, 1464, 2, 1488, 1468, 2, 1489, 1468, 2, 1490, 1468, 2, 1491, 1468, 2,
+    1492, 1468, 2, 1493, 1468, 2, 1494, 1468, 2, 1496, 1468, 2, 1497, 1468, 2,
+    1498, 1468, 2, 1499, 1468, 2, 1500, 1468, 2, 1502, 1468, 2, 1504, 1468, 2,
+    1505, 1468, 2, 1507, 1468, 2, 1508, 1468, 2, 1510, 1468, 2, 1511, 1468, 2,
+    1512, 1468, 2, 1513, 1468, 2, 1514, 1468, 2, 1493, 1465, 2, 1489, 1471, 2,
+    1499, 1471, 2, 1508, 1471, 512, 1488, 1500, 256, 1649, 256, 1649, 256,
+    1659, 256, 1659, 256, 1659, 256, 1659, 256, 1662, 256, 1662, 256, 1662,
+    256, 1662, 256, 1664, 256, 1664, 256, 1664, 256, 1664, 256, 1658, 256,
+    1658, 256, 1658, 256, 1658, 256, 1663, 256, 1663, 256, 1663, 256, 1663,
+    256, 1657, 256, 1657, 256, 1657, 256, 1657, 256, 1700, 256, 1700, 256,
+    1700, 256, 1700, 256, 1702, 256, 1702, 256, 1702, 256, 1702, 256, 1668,
+    256, 1668, 256, 1668, 256, 1668, 256, 1667, 256, 1667, 256, 1667, 256,
+    1667, 256, 1670, 256, 1670, 256, 1670, 256, 1670, 256, 1671, 256, 1671,
+    256, 1671, 256, 1671, 256, 1677, 256, 1677, 256, 1676, 256, 1676, 256,
+    1678, 256, 1678, 256, 1672, 256, 1672, 256, 1688, 256, 1688, 256, 1681,
+    256, 1681, 256, 1705, 256, 1705, 256, 1705, 256, 1705, 256, 1711, 256,
+    1711, 256, 1711, 256, 1711, 256, 1715, 256, 1715, 256, 1715, 256, 1715,
+    256, 1713, 256, 1713, 256, 1713, 256, 1713, 256, 1722, 256, 1722, 256,
+    1723, 256, 1723, 256, 1723, 256, 1723, 512, 1749, 1620, 512, 1749, 1620,
+    256, 1729, 256, 1729, 256, 1729, 256, 1729, 256, 1726, 256, 1726, 256,
+    1726, 256, 1726, 256, 1746, 256, 1746, 512, 1746, 1620, 512, 1746, 1620,
+    256, 1709, 256, 1709, 256, 1709, 256, 1709, 256, 1735, 256, 1735, 256,
+    1734, 256, 1734, 256, 1736, 256, 1736, 512, 1735, 1652, 256, 1739, 256,
+    1739, 256, 1733, 256, 1733, 256, 1737, 256, 1737, 256, 1744, 256, 1744,
+    256, 1744, 256, 1744, 256, 1609, 256, 1609, 768, 1610, 1620, 1575, 768,
+    1610, 1620, 1575, 768, 1610, 1620, 1749, 768, 1610, 1620, 1749, 768, 1610,
+    1620, 1608, 768, 1610, 1620, 1608, 768, 1610, 1620, 1735, 768, 1610, 1620,
+    1735, 768, 1610, 1620, 1734, 768, 1610, 1620, 1734, 768, 1610, 1620, 1736,
+    768, 1610, 1620, 1736, 768, 1610, 1620, 1744, 768, 1610, 1620, 1744, 768,
+    1610, 1620, 1744, 768, 1610, 1620, 1609, 768, 1610, 1620, 1609, 768, 1610,
+    1620, 1609, 256, 1740, 256, 1740, 256, 1740, 256, 1740, 768, 1610, 1620,
+    1580, 768, 1610, 1620, 1581, 768, 1610, 1620, 1605, 768, 1610, 1620, 1609,
+    768, 1610, 1620, 1610, 512, 1576, 1580, 512, 1576, 1581, 512, 1576, 1582,
+    512, 1576, 1605, 512, 1576, 1609, 512, 1576, 1610, 512, 1578, 1580, 512,
+    1578, 1581, 512, 1578, 1582, 512, 1578, 1605, 512, 1578, 1609, 512, 1578,
+    1610, 512, 1579, 1580, 512, 1579, 1605, 512, 1579, 1609, 512, 1579, 1610,
+    512, 1580, 1581, 512, 1580, 1605, 512, 1581, 1580, 512, 1581, 1605, 512,
+    1582, 1580, 512, 1582, 1581, 512, 1582, 1605, 512, 1587, 1580, 512, 1587,
+    1581, 512, 1587, 1582, 512, 1587, 1605, 512, 1589, 1581, 512, 1589, 1605,
+    512, 1590, 1580, 512, 1590, 1581, 512, 1590, 1582, 512, 1590, 1605, 512,
+    1591, 1581, 512, 1591, 1605, 512, 1592, 1605, 512, 1593, 1580, 512, 1593,
+    1605, 512, 1594, 1580, 512, 1594, 1605, 512, 1601, 1580, 512, 1601, 1581,
+    512, 1601, 1582, 512, 1601, 1605, 512, 1601, 1609, 512, 1601, 1610, 512,
+    1602, 1581, 512, 1602, 1605, 512, 1602, 1609, 512, 1602, 1610, 512, 1603,
+    1575, 512, 1603, 1580, 512, 1603, 1581, 512, 1603, 1582, 512, 1603, 1604,
+    512, 1603, 1605, 512, 1603, 1609, 512, 1603, 1610, 512, 1604, 1580, 512,
+    1604, 1581, 512, 1604, 1582, 512, 1604, 1605, 512, 1604, 1609, 512, 1604,
+    1610, 512, 1605, 1580, 512, 1605, 1581, 512, 1605, 1582, 512, 1605, 1605,
+    512, 1605, 1609, 512, 1605, 1610, 512, 1606, 1580, 512, 1606, 1581, 512,
+    1606, 1582, 512, 1606, 1605, 512, 1606, 1609, 512, 1606, 1610, 512, 1607,
+    1580, 512, 1607, 1605, 512, 1607, 1609, 512, 1607, 1610, 512, 1610, 1580,
+    512, 1610, 1581, 512, 1610, 1582, 512, 1610, 1605, 512, 1610, 1609, 512,
+    1610, 1610, 512, 1584, 1648, 512, 1585, 1648, 512, 1609, 1648, 768, 32,
+    1612, 1617, 768, 32, 1613, 1617, 768, 32, 1614, 1617, 768, 32, 1615, 1617,
+    768, 32, 1616, 1617, 768, 32, 1617, 1648, 768, 1610, 1620, 1585, 768,
+    1610, 1620, 1586, 768, 1610, 1620, 1605, 768, 1610, 1620, 1606, 768, 1610,
+    1620, 1609, 768, 1610, 1620, 1610, 512, 1576, 1585, 512, 1576, 1586, 512,
+    1576, 1605, 512, 1576, 1606, 512, 1576, 1609, 512, 1576, 1610, 512, 1578,
+    1585, 512, 1578, 1586, 512, 1578, 1605, 512, 1578, 1606, 512, 1578, 1609,
+    512, 1578, 1610, 512, 1579, 1585, 512, 1579, 1586, 512, 1579, 1605, 512,
+    1579, 1606, 512, 1579, 1609, 512, 1579, 1610, 512, 1601, 1609, 512, 1601,
+    1610, 512, 1602, 1609, 512, 1602, 1610, 512, 1603, 1575, 512, 1603, 1604,
+    512, 1603, 1605, 512, 1603, 1609, 512, 1603, 1610, 512, 1604, 1605, 512,
+    1604, 1609, 512, 1604, 1610, 512, 1605, 1575, 512, 1605, 1605, 512, 1606,
+    1585, 512, 1606, 1586, 512, 1606, 1605, 512, 1606, 1606, 512, 1606, 1609,
+    512, 1606, 1610, 512, 1609, 1648, 512, 1610, 1585, 512, 1610, 1586, 512,
+    1610, 1605, 512, 1610, 1606, 512, 1610, 1609, 512, 1610, 1610, 768, 1610,
+    1620, 1580, 768, 1610, 1620, 1581, 768, 1610, 1620, 1582, 768, 1610, 1620,
+    1605, 768, 1610, 1620, 1607, 512, 1576, 1580, 512, 1576, 1581, 512, 1576,
+    1582, 512, 1576, 1605, 512, 1576, 1607, 512, 1578, 1580, 512, 1578, 1581,
+    512, 1578, 1582, 512, 1578, 1605, 512, 1578, 1607, 512, 1579, 1605, 512,
+    1580, 1581, 512, 1580, 1605, 512, 1581, 1580, 512, 1581, 1605, 512, 1582,
+    1580, 512, 1582, 1605, 512, 1587, 1580, 512, 1587, 1581, 512, 1587, 1582,
+    512, 1587, 1605, 512, 1589, 1581, 512, 1589, 1582, 512, 1589, 1605, 512,
+    1590, 1580, 512, 1590, 1581, 512, 1590, 1582, 512, 1590, 1605, 512, 1591,
+    1581, 512, 1592, 1605, 512, 1593, 1580, 512, 1593, 1605, 512, 1594, 1580,
+    512, 1594, 1605, 512, 1601, 1580, 512, 1601, 1581, 512, 1601, 1582, 512,
+    1601, 1605, 512, 1602, 1581, 512, 1602, 1605, 512, 1603, 1580, 512, 1603,
+    1581, 512, 1603, 1582, 512, 1603, 1604, 512, 1603, 1605, 512, 1604, 1580,
+    512, 1604, 1581, 512, 1604, 1582, 512, 1604, 1605, 512, 1604, 1607, 512,
+    1605, 1580, 512, 1605, 1581, 512, 1605, 1582, 512, 1605, 1605, 512, 1606,
+    1580, 512, 1606, 1581, 512, 1606, 1582, 512, 1606, 1605, 512, 1606, 1607,
+    512, 1607, 1580, 512, 1607, 1605, 512, 1607, 1648, 512, 1610, 1580, 512,
+    1610, 1581, 512, 1610, 1582, 512, 1610, 1605, 512, 1610, 1607, 768, 1610,
+    1620, 1605, 768, 1610, 1620, 1607, 512, 1576, 1605, 512, 1576, 1607, 512,
+    1578, 1605, 512, 1578, 1607, 512, 1579, 1605, 512, 1579, 1607, 512, 1587,
+    1605, 512, 1587, 1607, 512, 1588, 1605, 512, 1588, 1607, 512, 1603, 1604,
+    512, 1603, 1605, 512, 1604, 1605, 512, 1606, 1605, 512, 1606, 1607, 512,
+    1610, 1605, 512, 1610, 1607, 768, 1600, 1614, 1617, 768, 1600, 1615, 1617,
+    768, 1600, 1616, 1617, 512, 1591, 1609, 512, 1591, 1610, 512, 1593, 1609,
+    512, 1593, 1610, 512, 1594, 1609, 512, 1594, 1610, 512, 1587, 1609, 512,
+    1587, 1610, 512, 1588, 1609, 512, 1588, 1610, 512, 1581, 1609, 512, 1581,
+    1610, 512, 1580, 1609, 512, 1580, 1610, 512, 1582, 1609, 512, 1582, 1610,
+    512, 1589, 1609, 512, 1589, 1610, 512, 1590, 1609, 512, 1590, 1610, 512,
+    1588, 1580, 512, 1588, 1581, 512, 1588, 1582, 512, 1588, 1605, 512, 1588,
+    1585, 512, 1587, 1585, 512, 1589, 1585, 512, 1590, 1585, 512, 1591, 1609,
+    512, 1591, 1610, 512, 1593, 1609, 512, 1593, 1610, 512, 1594, 1609, 512,
+    1594, 1610, 512, 1587, 1609, 512, 1587, 1610, 512, 1588, 1609, 512, 1588,
+    1610, 512, 1581, 1609, 512, 1581, 1610, 512, 1580, 1609, 512, 1580, 1610,
+    512, 1582, 1609, 512, 1582, 1610, 512, 1589, 1609, 512, 1589, 1610, 512,
+    1590, 1609, 512, 1590, 1610, 512, 1588, 1580, 512, 1588, 1581, 512, 1588,
+    1582, 512, 1588, 1605, 512, 1588, 1585, 512, 1587, 1585, 512, 1589, 1585,
+    512, 1590, 1585, 512, 1588, 1580, 512, 1588, 1581, 512, 1588, 1582, 512,
+    1588, 1605, 512, 1587, 1607, 512, 1588, 1607, 512, 1591, 1605, 512, 1587,
+    1580, 512, 1587, 1581, 512, 1587, 1582, 512, 1588, 1580, 512, 1588, 1581,
+    512, 1588, 1582, 512, 1591, 1605, 512, 1592, 1605, 512, 1575, 1611, 512,
+    1575, 1611, 768, 1578, 1580, 1605, 768, 1578, 1581, 1580, 768, 1578, 1581,
+    1580, 768, 1578, 1581, 1605, 768, 1578, 1582, 1605, 768, 1578, 1605, 1580,
+    768, 1578, 1605, 1581, 768, 1578, 1605, 1582, 768, 1580, 1605, 1581, 768,
+    1580, 1605, 1581, 768, 1581, 1605, 1610, 768, 1581, 1605, 1609, 768, 1587,
+    1581, 1580, 768, 1587, 1580, 1581, 768, 1587, 1580, 1609, 768, 1587, 1605,
+    1581, 768, 1587, 1605, 1581, 768, 1587, 1605, 1580, 768, 1587, 1605, 1605,
+    768, 1587, 1605, 1605, 768, 1589, 1581, 1581, 768, 1589, 1581, 1581, 768,
+    1589, 1605, 1605, 768, 1588, 1581, 1605, 768, 1588, 1581, 1605, 768, 1588,
+    1580, 1610, 768, 1588, 1605, 1582, 768, 1588, 1605, 1582, 768, 1588, 1605,
+    1605, 768, 1588, 1605, 1605, 768, 1590, 1581, 1609, 768, 1590, 1582, 1605,
+    768, 1590, 1582, 1605, 768, 1591, 1605, 1581, 768, 1591, 1605, 1581, 768,
+    1591, 1605, 1605, 768, 1591, 1605, 1610, 768, 1593, 1580, 1605, 768, 1593,
+    1605, 1605, 768, 1593, 1605, 1605, 768, 1593, 1605, 1609, 768, 1594, 1605,
+    1605, 768, 1594, 1605, 1610, 768, 1594, 1605, 1609, 768, 1601, 1582, 1605,
+    768, 1601, 1582, 1605, 768, 1602, 1605, 1581, 768, 1602, 1605, 1605, 768,
+    1604, 1581, 1605, 768, 1604, 1581, 1610, 768, 1604, 1581, 1609, 768, 1604,
+    1580, 1580, 768, 1604, 1580, 1580, 768, 1604, 1582, 1605, 768, 1604, 1582,
+    1605, 768, 1604, 1605, 1581, 768, 1604, 1605, 1581, 768, 1605, 1581, 1580,
+    768, 1605, 1581, 1605, 768, 1605, 1581, 1610, 768, 1605, 1580, 1581, 768,
+    1605, 1580, 1605, 768, 1605, 1582, 1580, 768, 1605, 1582, 1605, 768, 1605,
+    1580, 1582, 768, 1607, 1605, 1580, 768, 1607, 1605, 1605, 768, 1606, 1581,
+    1605, 768, 1606, 1581, 1609, 768, 1606, 1580, 1605, 768, 1606, 1580, 1605,
+    768, 1606, 1580, 1609, 768, 1606, 1605, 1610, 768, 1606, 1605, 1609, 768,
+    1610, 1605, 1605, 768, 1610, 1605, 1605, 768, 1576, 1582, 1610, 768, 1578,
+    1580, 1610, 768, 1578, 1580, 1609, 768, 1578, 1582, 1610, 768, 1578, 1582,
+    1609, 768, 1578, 1605, 1610, 768, 1578, 1605, 1609, 768, 1580, 1605, 1610,
+    768, 1580, 1581, 1609, 768, 1580, 1605, 1609, 768, 1587, 1582, 1609, 768,
+    1589, 1581, 1610, 768, 1588, 1581, 1610, 768, 1590, 1581, 1610, 768, 1604,
+    1580, 1610, 768, 1604, 1605, 1610, 768, 1610, 1581, 1610, 768, 1610, 1580,
+    1610, 768, 1610, 1605, 1610, 768, 1605, 1605, 1610, 768, 1602, 1605, 1610,
+    768, 1606, 1581, 1610, 768, 1602, 1605, 1581, 768, 1604, 1581, 1605, 768,
+    1593, 1605, 1610, 768, 1603, 1605, 1610, 768, 1606, 1580, 1581, 768, 1605,
+    1582, 1610, 768, 1604, 1580, 1605, 768, 1603, 1605, 1605, 768, 1604, 1580,
+    1605, 768, 1606, 1580, 1581, 768, 1580, 1581, 1610, 768, 1581, 1580, 1610,
+    768, 1605, 1580, 1610, 768, 1601, 1605, 1610, 768, 1576, 1581, 1610, 768,
+    1603, 1605, 1605, 768, 1593, 1580, 1605, 768, 1589, 1605, 1605, 768, 1587,
+    1582, 1610, 768, 1606, 1580, 1610, 768, 1589, 1604, 1746, 768, 1602, 1604,
+    1746, 1024, 1575, 1604, 1604, 1607, 1024, 1575, 1603, 1576, 1585, 1024,
+    1605, 1581, 1605, 1583, 1024, 1589, 1604, 1593, 1605, 1024, 1585, 1587,
+    1608, 1604, 1024, 1593, 1604, 1610, 1607, 1024, 1608, 1587, 1604, 1605,
+    768, 1589, 1604, 1609, 4608, 1589, 1604, 1609, 32, 1575, 1604, 1604, 1607,
+    32, 1593, 1604, 1610, 1607, 32, 1608, 1587, 1604, 1605, 2048, 1580, 1604,
+    32, 1580, 1604, 1575, 1604, 1607, 1024, 1585, 1740, 1575, 1604, 256, 44,
+    256, 12289, 256, 12290, 256, 58, 256, 59, 256, 33, 256, 63, 256, 12310,
+    256, 12311, 768, 46, 46, 46, 512, 46, 46, 256, 8212, 256, 8211, 256, 95,
+    256, 95, 256, 40, 256, 41, 256, 123, 256, 125, 256, 12308, 256, 12309,
+    256, 12304, 256, 12305, 256, 12298, 256, 12299, 256, 12296, 256, 12297,
+    256, 12300, 256, 12301, 256, 12302, 256, 12303, 256, 91, 256, 93, 512, 32,
+    773, 512, 32, 773, 512, 32, 773, 512, 32, 773, 256, 95, 256, 95, 256, 95,
+    256, 44, 256, 12289, 256, 46, 256, 59, 256, 58, 256, 63, 256, 33, 256,
+    8212, 256, 40, 256, 41, 256, 123, 256, 125, 256, 12308, 256, 12309, 256,
+    35, 256, 38, 256, 42, 256, 43, 256, 45, 256, 60, 256, 62, 256, 61, 256,
+    92, 256, 36, 256, 37, 256, 64, 512, 32, 1611, 512, 1600, 1611, 512, 32,
+    1612, 512, 32, 1613, 512, 32, 1614, 512, 1600, 1614, 512, 32, 1615, 512,
+    1600, 1615, 512, 32, 1616, 512, 1600, 1616, 512, 32, 1617, 512, 1600,
+    1617, 512, 32, 1618, 512, 1600, 1618, 256, 1569, 512, 1575, 1619, 512,
+    1575, 1619, 512, 1575, 1620, 512, 1575, 1620, 512, 1608, 1620, 512, 1608,
+    1620, 512, 1575, 1621, 512, 1575, 1621, 512, 1610, 1620, 512, 1610, 1620,
+    512, 1610, 1620, 512, 1610, 1620, 256, 1575, 256, 1575, 256, 1576, 256,
+    1576, 256, 1576, 256, 1576, 256, 1577, 256, 1577, 256, 1578, 256, 1578,
+    256, 1578, 256, 1578, 256, 1579, 256, 1579, 256, 1579, 256, 1579, 256,
+    1580, 256, 1580, 256, 1580, 256, 1580, 256, 1581, 256, 1581, 256, 1581,
+    256, 1581, 256, 1582, 256, 1582, 256, 1582, 256, 1582, 256, 1583, 256,
+    1583, 256, 1584, 256, 1584, 256, 1585, 256, 1585, 256, 1586, 256, 1586,
+    256, 1587, 256, 1587, 256, 1587, 256, 1587, 256, 1588, 256, 1588, 256,
+    1588, 256, 1588, 256, 1589, 256, 1589, 256, 1589, 256, 1589, 256, 1590,
+    256, 1590, 256, 1590, 256, 1590, 256, 1591, 256, 1591, 256, 1591, 256,
+    1591, 256, 1592, 256, 1592, 256, 1592, 256, 1592, 256, 1593, 256, 1593,
+    256, 1593, 256, 1593, 256, 1594, 256, 1594, 256, 1594, 256, 1594, 256,
+    1601, 256, 1601, 256, 1601, 256, 1601, 256, 1602, 256, 1602, 256, 1602,
+    256, 1602, 256, 1603, 256, 1603, 256, 1603, 256, 1603, 256, 1604, 256,
+    1604, 256, 1604, 256, 1604, 256, 1605, 256, 1605, 256, 1605, 256, 1605,
+    256, 1606, 256, 1606, 256, 1606, 256, 1606, 256, 1607, 256, 1607, 256,
+    1607, 256, 1607, 256, 1608, 256, 1608, 256, 1609, 256, 1609, 256, 1610,
+    256, 1610, 256, 1610, 256, 1610, 768, 1604, 1575, 1619, 768, 1604, 1575,
+    1619, 768, 1604, 1575, 1620, 768, 1604, 1575, 1620, 768, 1604, 1575, 1621,
+    768, 1604, 1575, 1621, 512, 1604, 1575, 512, 1604, 1575, 256, 33, 256, 34,
+    256, 35, 256, 36, 256, 37, 256, 38, 256, 39, 256, 40, 256, 41, 256, 42,
+    256, 43, 256, 44, 256, 45, 256, 46, 256, 47, 256, 48, 256, 49, 256, 50,
+    256, 51, 256, 52, 256, 53, 256, 54, 256, 55, 256, 56, 256, 57, 256, 58,
+    256, 59, 256, 60, 256, 61, 256, 62, 256, 63, 256, 64, 256, 65, 256, 66,
+    256, 67, 256, 68, 256, 69, 256, 70, 256, 71, 256, 72, 256, 73, 256, 74,
+    256, 75, 256, 76, 256, 77, 256, 78, 256, 79, 256, 80, 256, 81, 256, 82,
+    256, 83, 256, 84, 256, 85, 256, 86, 256, 87, 256, 88, 256, 89, 256, 90,
+    256, 91, 256, 92, 256, 93, 256, 94, 256, 95, 256, 96, 256, 97, 256, 98,
+    256, 99, 256, 100, 256, 101, 256, 102, 256, 103, 256, 104, 256, 105, 256,
+    106, 256, 107, 256, 108, 256, 109, 256, 110, 256, 111, 256, 112, 256, 113,
+    256, 114, 256, 115, 256, 116, 256, 117, 256, 118, 256, 119, 256, 120, 256,
+    121, 256, 122, 256, 123, 256, 124, 256, 125, 256, 126, 256, 10629, 256,
+    10630, 256, 12290, 256, 12300, 256, 12301, 256, 12289, 256, 12539, 256,
+    12530, 256, 12449, 256, 12451, 256, 12453, 256, 12455, 256, 12457, 256,
+    12515, 256, 12517, 256, 12519, 256, 12483, 256, 12540, 256, 12450, 256,
+    12452, 256, 12454, 256, 12456, 256, 12458, 256, 12459, 256, 12461, 256,
+    12463, 256, 12465, 256, 12467, 256, 12469, 256, 12471, 256, 12473, 256,
+    12475, 256, 12477, 256, 12479, 256, 12481, 256, 12484, 256, 12486, 256,
+    12488, 256, 12490, 256, 12491, 256, 12492, 256, 12493, 256, 12494, 256,
+    12495, 256, 12498, 256, 12501, 256, 12504, 256, 12507, 256, 12510, 256,
+    12511, 256, 12512, 256, 12513, 256, 12514, 256, 12516, 256, 12518, 256,
+    12520, 256, 12521, 256, 12522, 256, 12523, 256, 12524, 256, 12525, 256,
+    12527, 256, 12531, 256, 12441, 256, 12442, 256, 4448, 256, 4352, 256,
+    4353, 256, 4522, 256, 4354, 256, 4524, 256, 4525, 256, 4355, 256, 4356,
+    256, 4357, 256, 4528, 256, 4529, 256, 4530, 256, 4531, 256, 4532, 256,
+    4533, 256, 4378, 256, 4358, 256, 4359, 256, 4360, 256, 4385, 256, 4361,
+    256, 4362, 256, 4363, 256, 4364, 256, 4365, 256, 4366, 256, 4367, 256,
+    4368, 256, 4369, 256, 4370, 256, 4449, 256, 4450, 256, 4451, 256, 4452,
+    256, 4453, 256, 4454, 256, 4455, 256, 4456, 256, 4457, 256, 4458, 256,
+    4459, 256, 4460, 256, 4461, 256, 4462, 256, 4463, 256, 4464, 256, 4465,
+    256, 4466, 256, 4467, 256, 4468, 256, 4469, 256, 162, 256, 163, 256, 172,
+    512, 32, 772, 256, 166, 256, 165, 256, 8361, 256, 9474, 256, 8592, 256,
+    8593, 256, 8594, 256, 8595, 256, 9632, 256, 9675, 256, 720, 256, 721, 256,
+    230, 256, 665, 256, 595, 256, 675, 256, 43878, 256, 677, 256, 676, 256,
+    598, 256, 599, 256, 7569, 256, 600, 256, 606, 256, 681, 256, 612, 256,
+    610, 256, 608, 256, 667, 256, 295, 256, 668, 256, 615, 256, 644, 256, 682,
+    256, 683, 256, 620, 256, 122628, 256, 42894, 256, 622, 256, 122629, 256,
+    654, 256, 122630, 256, 248, 256, 630, 256, 631, 256, 113, 256, 634, 256,
+    122632, 256, 637, 256, 638, 256, 640, 256, 680, 256, 678, 256, 43879, 256,
+    679, 256, 648, 256, 11377, 256, 655, 256, 673, 256, 674, 256, 664, 256,
+    448, 256, 449, 256, 450, 256, 122634, 256, 122654, 2, 69785, 69818, 2,
+    69787, 69818, 2, 69797, 69818, 2, 69937, 69927, 2, 69938, 69927, 2, 70471,
+    70462, 2, 70471, 70487, 2, 70841, 70842, 2, 70841, 70832, 2, 70841, 70845,
+    2, 71096, 71087, 2, 71097, 71087, 2, 71989, 71984, 2, 119127, 119141, 2,
+    119128, 119141, 3, 119128, 119141, 119150, 3, 119128, 119141, 119151, 3,
+    119128, 119141, 119152, 3, 119128, 119141, 119153, 3, 119128, 119141,
+    119154, 2, 119225, 119141, 2, 119226, 119141, 3, 119225, 119141, 119150,
+    3, 119226, 119141, 119150, 3, 119225, 119141, 119151, 3, 119226, 119141,
+    119151, 256, 65, 256, 66, 256, 67, 256, 68, 256, 69, 256, 70, 256, 71,
+    256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77, 256, 78, 256, 79,
+    256, 80, 256, 81, 256, 82, 256, 83, 256, 84, 256, 85, 256, 86, 256, 87,
+    256, 88, 256, 89, 256, 90, 256, 97, 256, 98, 256, 99, 256, 100, 256, 101,
+    256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256, 107, 256, 108, 256,
+    109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114, 256, 115, 256, 116,
+    256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256, 122, 256, 65, 256,
+    66, 256, 67, 256, 68, 256, 69, 256, 70, 256, 71, 256, 72, 256, 73, 256,
+    74, 256, 75, 256, 76, 256, 77, 256, 78, 256, 79, 256, 80, 256, 81, 256,
+    82, 256, 83, 256, 84, 256, 85, 256, 86, 256, 87, 256, 88, 256, 89, 256,
+    90, 256, 97, 256, 98, 256, 99, 256, 100, 256, 101, 256, 102, 256, 103,
+    256, 105, 256, 106, 256, 107, 256, 108, 256, 109, 256, 110, 256, 111, 256,
+    112, 256, 113, 256, 114, 256, 115, 256, 116, 256, 117, 256, 118, 256, 119,
+    256, 120, 256, 121, 256, 122, 256, 65, 256, 66, 256, 67, 256, 68, 256, 69,
+    256, 70, 256, 71, 256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77,
+    256, 78, 256, 79, 256, 80, 256, 81, 256, 82, 256, 83, 256, 84, 256, 85,
+    256, 86, 256, 87, 256, 88, 256, 89, 256, 90, 256, 97, 256, 98, 256, 99,
+    256, 100, 256, 101, 256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256,
+    107, 256, 108, 256, 109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114,
+    256, 115, 256, 116, 256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256,
+    122, 256, 65, 256, 67, 256, 68, 256, 71, 256, 74, 256, 75, 256, 78, 256,
+    79, 256, 80, 256, 81, 256, 83, 256, 84, 256, 85, 256, 86, 256, 87, 256,
+    88, 256, 89, 256, 90, 256, 97, 256, 98, 256, 99, 256, 100, 256, 102, 256,
+    104, 256, 105, 256, 106, 256, 107, 256, 108, 256, 109, 256, 110, 256, 112,
+    256, 113, 256, 114, 256, 115, 256, 116, 256, 117, 256, 118, 256, 119, 256,
+    120, 256, 121, 256, 122, 256, 65, 256, 66, 256, 67, 256, 68, 256, 69, 256,
+    70, 256, 71, 256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77, 256,
+    78, 256, 79, 256, 80, 256, 81, 256, 82, 256, 83, 256, 84, 256, 85, 256,
+    86, 256, 87, 256, 88, 256, 89, 256, 90, 256, 97, 256, 98, 256, 99, 256,
+    100, 256, 101, 256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256, 107,
+    256, 108, 256, 109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114, 256,
+    115, 256, 116, 256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256, 122,
+    256, 65, 256, 66, 256, 68, 256, 69, 256, 70, 256, 71, 256, 74, 256, 75,
+    256, 76, 256, 77, 256, 78, 256, 79, 256, 80, 256, 81, 256, 83, 256, 84,
+    256, 85, 256, 86, 256, 87, 256, 88, 256, 89, 256, 97, 256, 98, 256, 99,
+    256, 100, 256, 101, 256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256,
+    107, 256, 108, 256, 109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114,
+    256, 115, 256, 116, 256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256,
+    122, 256, 65, 256, 66, 256, 68, 256, 69, 256, 70, 256, 71, 256, 73, 256,
+    74, 256, 75, 256, 76, 256, 77, 256, 79, 256, 83, 256, 84, 256, 85, 256,
+    86, 256, 87, 256, 88, 256, 89, 256, 97, 256, 98, 256, 99, 256, 100, 256,
+    101, 256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256, 107, 256, 108,
+    256, 109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114, 256, 115, 256,
+    116, 256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256, 122, 256, 65,
+    256, 66, 256, 67, 256, 68, 256, 69, 256, 70, 256, 71, 256, 72, 256, 73,
+    256, 74, 256, 75, 256, 76, 256, 77, 256, 78, 256, 79, 256, 80, 256, 81,
+    256, 82, 256, 83, 256, 84, 256, 85, 256, 86, 256, 87, 256, 88, 256, 89,
+    256, 90, 256, 97, 256, 98, 256, 99, 256, 100, 256, 101, 256, 102, 256,
+    103, 256, 104, 256, 105, 256, 106, 256, 107, 256, 108, 256, 109, 256, 110,
+    256, 111, 256, 112, 256, 113, 256, 114, 256, 115, 256, 116, 256, 117, 256,
+    118, 256, 119, 256, 120, 256, 121, 256, 122, 256, 65, 256, 66, 256, 67,
+    256, 68, 256, 69, 256, 70, 256, 71, 256, 72, 256, 73, 256, 74, 256, 75,
+    256, 76, 256, 77, 256, 78, 256, 79, 256, 80, 256, 81, 256, 82, 256, 83,
+    256, 84, 256, 85, 256, 86, 256, 87, 256, 88, 256, 89, 256, 90, 256, 97,
+    256, 98, 256, 99, 256, 100, 256, 101, 256, 102, 256, 103, 256, 104, 256,
+    105, 256, 106, 256, 107, 256, 108, 256, 109, 256, 110, 256, 111, 256, 112,
+    256, 113, 256, 114, 256, 115, 256, 116, 256, 117, 256, 118, 256, 119, 256,
+    120, 256, 121, 256, 122, 256, 65, 256, 66, 256, 67, 256, 68, 256, 69, 256,
+    70, 256, 71, 256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77, 256,
+    78, 256, 79, 256, 80, 256, 81, 256, 82, 256, 83, 256, 84, 256, 85, 256,
+    86, 256, 87, 256, 88, 256, 89, 256, 90, 256, 97, 256, 98, 256, 99, 256,
+    100, 256, 101, 256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256, 107,
+    256, 108, 256, 109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114, 256,
+    115, 256, 116, 256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256, 122,
+    256, 65, 256, 66, 256, 67, 256, 68, 256, 69, 256, 70, 256, 71, 256, 72,
+    256, 73, 256, 74, 256, 75, 256, 76, 256, 77, 256, 78, 256, 79, 256, 80,
+    256, 81, 256, 82, 256, 83, 256, 84, 256, 85, 256, 86, 256, 87, 256, 88,
+    256, 89, 256, 90, 256, 97, 256, 98, 256, 99, 256, 100, 256, 101, 256, 102,
+    256, 103, 256, 104, 256, 105, 256, 106, 256, 107, 256, 108, 256, 109, 256,
+    110, 256, 111, 256, 112, 256, 113, 256, 114, 256, 115, 256, 116, 256, 117,
+    256, 118, 256, 119, 256, 120, 256, 121, 256, 122, 256, 65, 256, 66, 256,
+    67, 256, 68, 256, 69, 256, 70, 256, 71, 256, 72, 256, 73, 256, 74, 256,
+    75, 256, 76, 256, 77, 256, 78, 256, 79, 256, 80, 256, 81, 256, 82, 256,
+    83, 256, 84, 256, 85, 256, 86, 256, 87, 256, 88, 256, 89, 256, 90, 256,
+    97, 256, 98, 256, 99, 256, 100, 256, 101, 256, 102, 256, 103, 256, 104,
+    256, 105, 256, 106, 256, 107, 256, 108, 256, 109, 256, 110, 256, 111, 256,
+    112, 256, 113, 256, 114, 256, 115, 256, 116, 256, 117, 256, 118, 256, 119,
+    256, 120, 256, 121, 256, 122, 256, 65, 256, 66, 256, 67, 256, 68, 256, 69,
+    256, 70, 256, 71, 256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77,
+    256, 78, 256, 79, 256, 80, 256, 81, 256, 82, 256, 83, 256, 84, 256, 85,
+    256, 86, 256, 87, 256, 88, 256, 89, 256, 90, 256, 97, 256, 98, 256, 99,
+    256, 100, 256, 101, 256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256,
+    107, 256, 108, 256, 109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114,
+    256, 115, 256, 116, 256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256,
+    122, 256, 305, 256, 567, 256, 913, 256, 914, 256, 915, 256, 916, 256, 917,
+    256, 918, 256, 919, 256, 920, 256, 921, 256, 922, 256, 923, 256, 924, 256,
+    925, 256, 926, 256, 927, 256, 928, 256, 929, 256, 920, 256, 931, 256, 932,
+    256, 933, 256, 934, 256, 935, 256, 936, 256, 937, 256, 8711, 256, 945,
+    256, 946, 256, 947, 256, 948, 256, 949, 256, 950, 256, 951, 256, 952, 256,
+    953, 256, 954, 256, 955, 256, 956, 256, 957, 256, 958, 256, 959, 256, 960,
+    256, 961, 256, 962, 256, 963, 256, 964, 256, 965, 256, 966, 256, 967, 256,
+    968, 256, 969, 256, 8706, 256, 949, 256, 952, 256, 954, 256, 966, 256,
+    961, 256, 960, 256, 913, 256, 914, 256, 915, 256, 916, 256, 917, 256, 918,
+    256, 919, 256, 920, 256, 921, 256, 922, 256, 923, 256, 924, 256, 925, 256,
+    926, 256, 927, 256, 928, 256, 929, 256, 920, 256, 931, 256, 932, 256, 933,
+    256, 934, 256, 935, 256, 936, 256, 937, 256, 8711, 256, 945, 256, 946,
+    256, 947, 256, 948, 256, 949, 256, 950, 256, 951, 256, 952, 256, 953, 256,
+    954, 256, 955, 256, 956, 256, 957, 256, 958, 256, 959, 256, 960, 256, 961,
+    256, 962, 256, 963, 256, 964, 256, 965, 256, 966, 256, 967, 256, 968, 256,
+    969, 256, 8706, 256, 949, 256, 952, 256, 954, 256, 966, 256, 961, 256,
+    960, 256, 913, 256, 914, 256, 915, 256, 916, 256, 917, 256, 918, 256, 919,
+    256, 920, 256, 921, 256, 922, 256, 923, 256, 924, 256, 925, 256, 926, 256,
+    927, 256, 928, 256, 929, 256, 920, 256, 931, 256, 932, 256, 933, 256, 934,
+    256, 935, 256, 936, 256, 937, 256, 8711, 256, 945, 256, 946, 256, 947,
+    256, 948, 256, 949, 256, 950, 256, 951, 256, 952, 256, 953, 256, 954, 256,
+    955, 256, 956, 256, 957, 256, 958, 256, 959, 256, 960, 256, 961, 256, 962,
+    256, 963, 256, 964, 256, 965, 256, 966, 256, 967, 256, 968, 256, 969, 256,
+    8706, 256, 949, 256, 952, 256, 954, 256, 966, 256, 961, 256, 960, 256,
+    913, 256, 914, 256, 915, 256, 916, 256, 917, 256, 918, 256, 919, 256, 920,
+    256, 921, 256, 922, 256, 923, 256, 924, 256, 925, 256, 926, 256, 927, 256,
+    928, 256, 929, 256, 920, 256, 931, 256, 932, 256, 933, 256, 934, 256, 935,
+    256, 936, 256, 937, 256, 8711, 256, 945, 256, 946, 256, 947, 256, 948,
+    256, 949, 256, 950, 256, 951, 256, 952, 256, 953, 256, 954, 256, 955, 256,
+    956, 256, 957, 256, 958, 256, 959, 256, 960, 256, 961, 256, 962, 256, 963,
+    256, 964, 256, 965, 256, 966, 256, 967, 256, 968, 256, 969, 256, 8706,
+    256, 949, 256, 952, 256, 954, 256, 966, 256, 961, 256, 960, 256, 913, 256,
+    914, 256, 915, 256, 916, 256, 917, 256, 918, 256, 919, 256, 920, 256, 921,
+    256, 922, 256, 923, 256, 924, 256, 925, 256, 926, 256, 927, 256, 928, 256,
+    929, 256, 920, 256, 931, 256, 932, 256, 933, 256, 934, 256, 935, 256, 936,
+    256, 937, 256, 8711, 256, 945, 256, 946, 256, 947, 256, 948, 256, 949,
+    256, 950, 256, 951, 256, 952, 256, 953, 256, 954, 256, 955, 256, 956, 256,
+    957, 256, 958, 256, 959, 256, 960, 256, 961, 256, 962, 256, 963, 256, 964,
+    256, 965, 256, 966, 256, 967, 256, 968, 256, 969, 256, 8706, 256, 949,
+    256, 952, 256, 954, 256, 966, 256, 961, 256, 960, 256, 988, 256, 989, 256,
+    48, 256, 49, 256, 50, 256, 51, 256, 52, 256, 53, 256, 54, 256, 55, 256,
+    56, 256, 57, 256, 48, 256, 49, 256, 50, 256, 51, 256, 52, 256, 53, 256,
+    54, 256, 55, 256, 56, 256, 57, 256, 48, 256, 49, 256, 50, 256, 51, 256,
+    52, 256, 53, 256, 54, 256, 55, 256, 56, 256, 57, 256, 48, 256, 49, 256,
+    50, 256, 51, 256, 52, 256, 53, 256, 54, 256, 55, 256, 56, 256, 57, 256,
+    48, 256, 49, 256, 50, 256, 51, 256, 52, 256, 53, 256, 54, 256, 55, 256,
+    56, 256, 57, 256, 1575, 256, 1576, 256, 1580, 256, 1583, 256, 1608, 256,
+    1586, 256, 1581, 256, 1591, 256, 1610, 256, 1603, 256, 1604, 256, 1605,
+    256, 1606, 256, 1587, 256, 1593, 256, 1601, 256, 1589, 256, 1602, 256,
+    1585, 256, 1588, 256, 1578, 256, 1579, 256, 1582, 256, 1584, 256, 1590,
+    256, 1592, 256, 1594, 256, 1646, 256, 1722, 256, 1697, 256, 1647, 256,
+    1576, 256, 1580, 256, 1607, 256, 1581, 256, 1610, 256, 1603, 256, 1604,
+    256, 1605, 256, 1606, 256, 1587, 256, 1593, 256, 1601, 256, 1589, 256,
+    1602, 256, 1588, 256, 1578, 256, 1579, 256, 1582, 256, 1590, 256, 1594,
+    256, 1580, 256, 1581, 256, 1610, 256, 1604, 256, 1606, 256, 1587, 256,
+    1593, 256, 1589, 256, 1602, 256, 1588, 256, 1582, 256, 1590, 256, 1594,
+    256, 1722, 256, 1647, 256, 1576, 256, 1580, 256, 1607, 256, 1581, 256,
+    1591, 256, 1610, 256, 1603, 256, 1605, 256, 1606, 256, 1587, 256, 1593,
+    256, 1601, 256, 1589, 256, 1602, 256, 1588, 256, 1578, 256, 1579, 256,
+    1582, 256, 1590, 256, 1592, 256, 1594, 256, 1646, 256, 1697, 256, 1575,
+    256, 1576, 256, 1580, 256, 1583, 256, 1607, 256, 1608, 256, 1586, 256,
+    1581, 256, 1591, 256, 1610, 256, 1604, 256, 1605, 256, 1606, 256, 1587,
+    256, 1593, 256, 1601, 256, 1589, 256, 1602, 256, 1585, 256, 1588, 256,
+    1578, 256, 1579, 256, 1582, 256, 1584, 256, 1590, 256, 1592, 256, 1594,
+    256, 1576, 256, 1580, 256, 1583, 256, 1608, 256, 1586, 256, 1581, 256,
+    1591, 256, 1610, 256, 1604, 256, 1605, 256, 1606, 256, 1587, 256, 1593,
+    256, 1601, 256, 1589, 256, 1602, 256, 1585, 256, 1588, 256, 1578, 256,
+    1579, 256, 1582, 256, 1584, 256, 1590, 256, 1592, 256, 1594, 512, 48, 46,
+    512, 48, 44, 512, 49, 44, 512, 50, 44, 512, 51, 44, 512, 52, 44, 512, 53,
+    44, 512, 54, 44, 512, 55, 44, 512, 56, 44, 512, 57, 44, 768, 40, 65, 41,
+    768, 40, 66, 41, 768, 40, 67, 41, 768, 40, 68, 41, 768, 40, 69, 41, 768,
+    40, 70, 41, 768, 40, 71, 41, 768, 40, 72, 41, 768, 40, 73, 41, 768, 40,
+    74, 41, 768, 40, 75, 41, 768, 40, 76, 41, 768, 40, 77, 41, 768, 40, 78,
+    41, 768, 40, 79, 41, 768, 40, 80, 41, 768, 40, 81, 41, 768, 40, 82, 41,
+    768, 40, 83, 41, 768, 40, 84, 41, 768, 40, 85, 41, 768, 40, 86, 41, 768,
+    40, 87, 41, 768, 40, 88, 41, 768, 40, 89, 41, 768, 40, 90, 41, 768, 12308,
+    83, 12309, 256, 67, 256, 82, 512, 67, 68, 512, 87, 90, 256, 65, 256, 66,
+    256, 67, 256, 68, 256, 69, 256, 70, 256, 71, 256, 72, 256, 73, 256, 74,
+    256, 75, 256, 76, 256, 77, 256, 78, 256, 79, 256, 80, 256, 81, 256, 82,
+    256, 83, 256, 84, 256, 85, 256, 86, 256, 87, 256, 88, 256, 89, 256, 90,
+    512, 72, 86, 512, 77, 86, 512, 83, 68, 512, 83, 83, 768, 80, 80, 86, 512,
+    87, 67, 512, 77, 67, 512, 77, 68, 512, 77, 82, 512, 68, 74, 512, 12411,
+    12363, 512, 12467, 12467, 256, 12469, 256, 25163, 256, 23383, 256, 21452,
+    512, 12486, 12441, 256, 20108, 256, 22810, 256, 35299, 256, 22825, 256,
+    20132, 256, 26144, 256, 28961, 256, 26009, 256, 21069, 256, 24460, 256,
+    20877, 256, 26032, 256, 21021, 256, 32066, 256, 29983, 256, 36009, 256,
+    22768, 256, 21561, 256, 28436, 256, 25237, 256, 25429, 256, 19968, 256,
+    19977, 256, 36938, 256, 24038, 256, 20013, 256, 21491, 256, 25351, 256,
+    36208, 256, 25171, 256, 31105, 256, 31354, 256, 21512, 256, 28288, 256,
+    26377, 256, 26376, 256, 30003, 256, 21106, 256, 21942, 256, 37197, 768,
+    12308, 26412, 12309, 768, 12308, 19977, 12309, 768, 12308, 20108, 12309,
+    768, 12308, 23433, 12309, 768, 12308, 28857, 12309, 768, 12308, 25171,
+    12309, 768, 12308, 30423, 12309, 768, 12308, 21213, 12309, 768, 12308,
+    25943, 12309, 256, 24471, 256, 21487, 256, 48, 256, 49, 256, 50, 256, 51,
+    256, 52, 256, 53, 256, 54, 256, 55, 256, 56, 256, 57, 1, 20029, 1, 20024,
+    1, 20033, 1, 131362, 1, 20320, 1, 20398, 1, 20411, 1, 20482, 1, 20602, 1,
+    20633, 1, 20711, 1, 20687, 1, 13470, 1, 132666, 1, 20813, 1, 20820, 1,
+    20836, 1, 20855, 1, 132380, 1, 13497, 1, 20839, 1, 20877, 1, 132427, 1,
+    20887, 1, 20900, 1, 20172, 1, 20908, 1, 20917, 1, 168415, 1, 20981, 1,
+    20995, 1, 13535, 1, 21051, 1, 21062, 1, 21106, 1, 21111, 1, 13589, 1,
+    21191, 1, 21193, 1, 21220, 1, 21242, 1, 21253, 1, 21254, 1, 21271, 1,
+    21321, 1, 21329, 1, 21338, 1, 21363, 1, 21373, 1, 21375, 1, 21375, 1,
+    21375, 1, 133676, 1, 28784, 1, 21450, 1, 21471, 1, 133987, 1, 21483, 1,
+    21489, 1, 21510, 1, 21662, 1, 21560, 1, 21576, 1, 21608, 1, 21666, 1,
+    21750, 1, 21776, 1, 21843, 1, 21859, 1, 21892, 1, 21892, 1, 21913, 1,
+    21931, 1, 21939, 1, 21954, 1, 22294, 1, 22022, 1, 22295, 1, 22097, 1,
+    22132, 1, 20999, 1, 22766, 1, 22478, 1, 22516, 1, 22541, 1, 22411, 1,
+    22578, 1, 22577, 1, 22700, 1, 136420, 1, 22770, 1, 22775, 1, 22790, 1,
+    22810, 1, 22818, 1, 22882, 1, 136872, 1, 136938, 1, 23020, 1, 23067, 1,
+    23079, 1, 23000, 1, 23142, 1, 14062, 1, 14076, 1, 23304, 1, 23358, 1,
+    23358, 1, 137672, 1, 23491, 1, 23512, 1, 23527, 1, 23539, 1, 138008, 1,
+    23551, 1, 23558, 1, 24403, 1, 23586, 1, 14209, 1, 23648, 1, 23662, 1,
+    23744, 1, 23693, 1, 138724, 1, 23875, 1, 138726, 1, 23918, 1, 23915, 1,
+    23932, 1, 24033, 1, 24034, 1, 14383, 1, 24061, 1, 24104, 1, 24125, 1,
+    24169, 1, 14434, 1, 139651, 1, 14460, 1, 24240, 1, 24243, 1, 24246, 1,
+    24266, 1, 172946, 1, 24318, 1, 140081, 1, 140081, 1, 33281, 1, 24354, 1,
+    24354, 1, 14535, 1, 144056, 1, 156122, 1, 24418, 1, 24427, 1, 14563, 1,
+    24474, 1, 24525, 1, 24535, 1, 24569, 1, 24705, 1, 14650, 1, 14620, 1,
+    24724, 1, 141012, 1, 24775, 1, 24904, 1, 24908, 1, 24910, 1, 24908, 1,
+    24954, 1, 24974, 1, 25010, 1, 24996, 1, 25007, 1, 25054, 1, 25074, 1,
+    25078, 1, 25104, 1, 25115, 1, 25181, 1, 25265, 1, 25300, 1, 25424, 1,
+    142092, 1, 25405, 1, 25340, 1, 25448, 1, 25475, 1, 25572, 1, 142321, 1,
+    25634, 1, 25541, 1, 25513, 1, 14894, 1, 25705, 1, 25726, 1, 25757, 1,
+    25719, 1, 14956, 1, 25935, 1, 25964, 1, 143370, 1, 26083, 1, 26360, 1,
+    26185, 1, 15129, 1, 26257, 1, 15112, 1, 15076, 1, 20882, 1, 20885, 1,
+    26368, 1, 26268, 1, 32941, 1, 17369, 1, 26391, 1, 26395, 1, 26401, 1,
+    26462, 1, 26451, 1, 144323, 1, 15177, 1, 26618, 1, 26501, 1, 26706, 1,
+    26757, 1, 144493, 1, 26766, 1, 26655, 1, 26900, 1, 15261, 1, 26946, 1,
+    27043, 1, 27114, 1, 27304, 1, 145059, 1, 27355, 1, 15384, 1, 27425, 1,
+    145575, 1, 27476, 1, 15438, 1, 27506, 1, 27551, 1, 27578, 1, 27579, 1,
+    146061, 1, 138507, 1, 146170, 1, 27726, 1, 146620, 1, 27839, 1, 27853, 1,
+    27751, 1, 27926, 1, 27966, 1, 28023, 1, 27969, 1, 28009, 1, 28024, 1,
+    28037, 1, 146718, 1, 27956, 1, 28207, 1, 28270, 1, 15667, 1, 28363, 1,
+    28359, 1, 147153, 1, 28153, 1, 28526, 1, 147294, 1, 147342, 1, 28614, 1,
+    28729, 1, 28702, 1, 28699, 1, 15766, 1, 28746, 1, 28797, 1, 28791, 1,
+    28845, 1, 132389, 1, 28997, 1, 148067, 1, 29084, 1, 148395, 1, 29224, 1,
+    29237, 1, 29264, 1, 149000, 1, 29312, 1, 29333, 1, 149301, 1, 149524, 1,
+    29562, 1, 29579, 1, 16044, 1, 29605, 1, 16056, 1, 16056, 1, 29767, 1,
+    29788, 1, 29809, 1, 29829, 1, 29898, 1, 16155, 1, 29988, 1, 150582, 1,
+    30014, 1, 150674, 1, 30064, 1, 139679, 1, 30224, 1, 151457, 1, 151480, 1,
+    151620, 1, 16380, 1, 16392, 1, 30452, 1, 151795, 1, 151794, 1, 151833, 1,
+    151859, 1, 30494, 1, 30495, 1, 30495, 1, 30538, 1, 16441, 1, 30603, 1,
+    16454, 1, 16534, 1, 152605, 1, 30798, 1, 30860, 1, 30924, 1, 16611, 1,
+    153126, 1, 31062, 1, 153242, 1, 153285, 1, 31119, 1, 31211, 1, 16687, 1,
+    31296, 1, 31306, 1, 31311, 1, 153980, 1, 154279, 1, 154279, 1, 31470, 1,
+    16898, 1, 154539, 1, 31686, 1, 31689, 1, 16935, 1, 154752, 1, 31954, 1,
+    17056, 1, 31976, 1, 31971, 1, 32000, 1, 155526, 1, 32099, 1, 17153, 1,
+    32199, 1, 32258, 1, 32325, 1, 17204, 1, 156200, 1, 156231, 1, 17241, 1,
+    156377, 1, 32634, 1, 156478, 1, 32661, 1, 32762, 1, 32773, 1, 156890, 1,
+    156963, 1, 32864, 1, 157096, 1, 32880, 1, 144223, 1, 17365, 1, 32946, 1,
+    33027, 1, 17419, 1, 33086, 1, 23221, 1, 157607, 1, 157621, 1, 144275, 1,
+    144284, 1, 33281, 1, 33284, 1, 36766, 1, 17515, 1, 33425, 1, 33419, 1,
+    33437, 1, 21171, 1, 33457, 1, 33459, 1, 33469, 1, 33510, 1, 158524, 1,
+    33509, 1, 33565, 1, 33635, 1, 33709, 1, 33571, 1, 33725, 1, 33767, 1,
+    33879, 1, 33619, 1, 33738, 1, 33740, 1, 33756, 1, 158774, 1, 159083, 1,
+    158933, 1, 17707, 1, 34033, 1, 34035, 1, 34070, 1, 160714, 1, 34148, 1,
+    159532, 1, 17757, 1, 17761, 1, 159665, 1, 159954, 1, 17771, 1, 34384, 1,
+    34396, 1, 34407, 1, 34409, 1, 34473, 1, 34440, 1, 34574, 1, 34530, 1,
+    34681, 1, 34600, 1, 34667, 1, 34694, 1, 17879, 1, 34785, 1, 34817, 1,
+    17913, 1, 34912, 1, 34915, 1, 161383, 1, 35031, 1, 35038, 1, 17973, 1,
+    35066, 1, 13499, 1, 161966, 1, 162150, 1, 18110, 1, 18119, 1, 35488, 1,
+    35565, 1, 35722, 1, 35925, 1, 162984, 1, 36011, 1, 36033, 1, 36123, 1,
+    36215, 1, 163631, 1, 133124, 1, 36299, 1, 36284, 1, 36336, 1, 133342, 1,
+    36564, 1, 36664, 1, 165330, 1, 165357, 1, 37012, 1, 37105, 1, 37137, 1,
+    165678, 1, 37147, 1, 37432, 1, 37591, 1, 37592, 1, 37500, 1, 37881, 1,
+    37909, 1, 166906, 1, 38283, 1, 18837, 1, 38327, 1, 167287, 1, 18918, 1,
+    38595, 1, 23986, 1, 38691, 1, 168261, 1, 168474, 1, 19054, 1, 19062, 1,
+    38880, 1, 168970, 1, 19122, 1, 169110, 1, 38923, 1, 38923, 1, 38953, 1,
+    169398, 1, 39138, 1, 19251, 1, 39209, 1, 39335, 1, 39362, 1, 39422, 1,
+    19406, 1, 170800, 1, 39698, 1, 40000, 1, 40189, 1, 19662, 1, 19693, 1,
+    40295, 1, 172238, 1, 19704, 1, 172293, 1, 172558, 1, 172689, 1, 40635, 1,
+    19798, 1, 40697, 1, 40702, 1, 40709, 1, 40719, 1, 40726, 1, 40763, 1,
+    173568,
+};
+
+/* Each sequence starts with its size. */
+static const uint32_t unicode_sequences[234] = {
+    0, 2, 115, 115, 2, 105, 775, 2, 700, 110, 2, 106, 780, 3, 953, 776, 769,
+    3, 965, 776, 769, 2, 1381, 1410, 2, 104, 817, 2, 116, 776, 2, 119, 778, 2,
+    121, 778, 2, 97, 702, 2, 965, 787, 3, 965, 787, 768, 3, 965, 787, 769, 3,
+    965, 787, 834, 2, 7936, 953, 2, 7937, 953, 2, 7938, 953, 2, 7939, 953, 2,
+    7940, 953, 2, 7941, 953, 2, 7942, 953, 2, 7943, 953, 2, 7968, 953, 2,
+    7969, 953, 2, 7970, 953, 2, 7971, 953, 2, 7972, 953, 2, 7973, 953, 2,
+    7974, 953, 2, 7975, 953, 2, 8032, 953, 2, 8033, 953, 2, 8034, 953, 2,
+    8035, 953, 2, 8036, 953, 2, 8037, 953, 2, 8038, 953, 2, 8039, 953, 2,
+    8048, 953, 2, 945, 953, 2, 940, 953, 2, 945, 834, 3, 945, 834, 953, 2,
+    8052, 953, 2, 951, 953, 2, 942, 953, 2, 951, 834, 3, 951, 834, 953, 3,
+    953, 776, 768, 2, 953, 834, 3, 953, 776, 834, 3, 965, 776, 768, 2, 961,
+    787, 2, 965, 834, 3, 965, 776, 834, 2, 8060, 953, 2, 969, 953, 2, 974,
+    953, 2, 969, 834, 3, 969, 834, 953, 2, 102, 102, 2, 102, 105, 2, 102, 108,
+    3, 102, 102, 105, 3, 102, 102, 108, 2, 115, 116, 2, 1396, 1398, 2, 1396,
+    1381, 2, 1396, 1387, 2, 1406, 1398, 2, 1396, 1389,
+};
+
+static const UnicodeComposition unicode_compositions[941] = {
+    { 0x003C, 0x0338, 0x226E },
+    { 0x003D, 0x0338, 0x2260 },
+    { 0x003E, 0x0338, 0x226F },
+    { 0x0041, 0x0300, 0x00C0 },
+    { 0x0041, 0x0301, 0x00C1 },
+    { 0x0041, 0x0302, 0x00C2 },
+    { 0x0041, 0x0303, 0x00C3 },
+    { 0x0041, 0x0304, 0x0100 },
+    { 0x0041, 0x0306, 0x0102 },
+    { 0x0041, 0x0307, 0x0226 },
+    { 0x0041, 0x0308, 0x00C4 },
+    { 0x0041, 0x0309, 0x1EA2 },
+    { 0x0041, 0x030A, 0x00C5 },
+    { 0x0041, 0x030C, 0x01CD },
+    { 0x0041, 0x030F, 0x0200 },
+    { 0x0041, 0x0311, 0x0202 },
+    { 0x0041, 0x0323, 0x1EA0 },
+    { 0x0041, 0x0325, 0x1E00 },
+    { 0x0041, 0x0328, 0x0104 },
+    { 0x0042, 0x0307, 0x1E02 },
+    { 0x0042, 0x0323, 0x1E04 },
+    { 0x0042, 0x0331, 0x1E06 },
+    { 0x0043, 0x0301, 0x0106 },
+    { 0x0043, 0x0302, 0x0108 },
+    { 0x0043, 0x0307, 0x010A },
+    { 0x0043, 0x030C, 0x010C },
+    { 0x0043, 0x0327, 0x00C7 },
+    { 0x0044, 0x0307, 0x1E0A },
+    { 0x0044, 0x030C, 0x010E },
+    { 0x0044, 0x0323, 0x1E0C },
+    { 0x0044, 0x0327, 0x1E10 },
+    { 0x0044, 0x032D, 0x1E12 },
+    { 0x0044, 0x0331, 0x1E0E },
+    { 0x0045, 0x0300, 0x00C8 },
+    { 0x0045, 0x0301, 0x00C9 },
+    { 0x0045, 0x0302, 0x00CA },
+    { 0x0045, 0x0303, 0x1EBC },
+    { 0x0045, 0x0304, 0x0112 },
+    { 0x0045, 0x0306, 0x0114 },
+    { 0x0045, 0x0307, 0x0116 },
+    { 0x0045, 0x0308, 0x00CB },
+    { 0x0045, 0x0309, 0x1EBA },
+    { 0x0045, 0x030C, 0x011A },
+    { 0x0045, 0x030F, 0x0204 },
+    { 0x0045, 0x0311, 0x0206 },
+    { 0x0045, 0x0323, 0x1EB8 },
+    { 0x0045, 0x0327, 0x0228 },
+    { 0x0045, 0x0328, 0x0118 },
+    { 0x0045, 0x032D, 0x1E18 },
+    { 0x0045, 0x0330, 0x1E1A },
+    { 0x0046, 0x0307, 0x1E1E },
+    { 0x0047, 0x0301, 0x01F4 },
+    { 0x0047, 0x0302, 0x011C },
+    { 0x0047, 0x0304, 0x1E20 },
+    { 0x0047, 0x0306, 0x011E },
+    { 0x0047, 0x0307, 0x0120 },
+    { 0x0047, 0x030C, 0x01E6 },
+    { 0x0047, 0x0327, 0x0122 },
+    { 0x0048, 0x0302, 0x0124 },
+    { 0x0048, 0x0307, 0x1E22 },
+    { 0x0048, 0x0308, 0x1E26 },
+    { 0x0048, 0x030C, 0x021E },
+    { 0x0048, 0x0323, 0x1E24 },
+    { 0x0048, 0x0327, 0x1E28 },
+    { 0x0048, 0x032E, 0x1E2A },
+    { 0x0049, 0x0300, 0x00CC },
+    { 0x0049, 0x0301, 0x00CD },
+    { 0x0049, 0x0302, 0x00CE },
+    { 0x0049, 0x0303, 0x0128 },
+    { 0x0049, 0x0304, 0x012A },
+    { 0x0049, 0x0306, 0x012C },
+    { 0x0049, 0x0307, 0x0130 },
+    { 0x0049, 0x0308, 0x00CF },
+    { 0x0049, 0x0309, 0x1EC8 },
+    { 0x0049, 0x030C, 0x01CF },
+    { 0x0049, 0x030F, 0x0208 },
+    { 0x0049, 0x0311, 0x020A },
+    { 0x0049, 0x0323, 0x1ECA },
+    { 0x0049, 0x0328, 0x012E },
+    { 0x0049, 0x0330, 0x1E2C },
+    { 0x004A, 0x0302, 0x0134 },
+    { 0x004B, 0x0301, 0x1E30 },
+    { 0x004B, 0x030C, 0x01E8 },
+    { 0x004B, 0x0323, 0x1E32 },
+    { 0x004B, 0x0327, 0x0136 },
+    { 0x004B, 0x0331, 0x1E34 },
+    { 0x004C, 0x0301, 0x0139 },
+    { 0x004C, 0x030C, 0x013D },
+    { 0x004C, 0x0323, 0x1E36 },
+    { 0x004C, 0x0327, 0x013B },
+    { 0x004C, 0x032D, 0x1E3C },
+    { 0x004C, 0x0331, 0x1E3A },
+    { 0x004D, 0x0301, 0x1E3E },
+    { 0x004D, 0x0307, 0x1E40 },
+    { 0x004D, 0x0323, 0x1E42 },
+    { 0x004E, 0x0300, 0x01F8 },
+    { 0x004E, 0x0301, 0x0143 },
+    { 0x004E, 0x0303, 0x00D1 },
+    { 0x004E, 0x0307, 0x1E44 },
+    { 0x004E, 0x030C, 0x0147 },
+    { 0x004E, 0x0323, 0x1E46 },
+    { 0x004E, 0x0327, 0x0145 },
+    { 0x004E, 0x032D, 0x1E4A },
+    { 0x004E, 0x0331, 0x1E48 },
+    { 0x004F, 0x0300, 0x00D2 },
+    { 0x004F, 0x0301, 0x00D3 },
+    { 0x004F, 0x0302, 0x00D4 },
+    { 0x004F, 0x0303, 0x00D5 },
+    { 0x004F, 0x0304, 0x014C },
+    { 0x004F, 0x0306, 0x014E },
+    { 0x004F, 0x0307, 0x022E },
+    { 0x004F, 0x0308, 0x00D6 },
+    { 0x004F, 0x0309, 0x1ECE },
+    { 0x004F, 0x030B, 0x0150 },
+    { 0x004F, 0x030C, 0x01D1 },
+    { 0x004F, 0x030F, 0x020C },
+    { 0x004F, 0x0311, 0x020E },
+    { 0x004F, 0x031B, 0x01A0 },
+    { 0x004F, 0x0323, 0x1ECC },
+    { 0x004F, 0x0328, 0x01EA },
+    { 0x0050, 0x0301, 0x1E54 },
+    { 0x0050, 0x0307, 0x1E56 },
+    { 0x0052, 0x0301, 0x0154 },
+    { 0x0052, 0x0307, 0x1E58 },
+    { 0x0052, 0x030C, 0x0158 },
+    { 0x0052, 0x030F, 0x0210 },
+    { 0x0052, 0x0311, 0x0212 },
+    { 0x0052, 0x0323, 0x1E5A },
+    { 0x0052, 0x0327, 0x0156 },
+    { 0x0052, 0x0331, 0x1E5E },
+    { 0x0053, 0x0301, 0x015A },
+    { 0x0053, 0x0302, 0x015C },
+    { 0x0053, 0x0307, 0x1E60 },
+    { 0x0053, 0x030C, 0x0160 },
+    { 0x0053, 0x0323, 0x1E62 },
+    { 0x0053, 0x0326, 0x0218 },
+    { 0x0053, 0x0327, 0x015E },
+    { 0x0054, 0x0307, 0x1E6A },
+    { 0x0054, 0x030C, 0x0164 },
+    { 0x0054, 0x0323, 0x1E6C },
+    { 0x0054, 0x0326, 0x021A },
+    { 0x0054, 0x0327, 0x0162 },
+    { 0x0054, 0x032D, 0x1E70 },
+    { 0x0054, 0x0331, 0x1E6E },
+    { 0x0055, 0x0300, 0x00D9 },
+    { 0x0055, 0x0301, 0x00DA },
+    { 0x0055, 0x0302, 0x00DB },
+    { 0x0055, 0x0303, 0x0168 },
+    { 0x0055, 0x0304, 0x016A },
+    { 0x0055, 0x0306, 0x016C },
+    { 0x0055, 0x0308, 0x00DC },
+    { 0x0055, 0x0309, 0x1EE6 },
+    { 0x0055, 0x030A, 0x016E },
+    { 0x0055, 0x030B, 0x0170 },
+    { 0x0055, 0x030C, 0x01D3 },
+    { 0x0055, 0x030F, 0x0214 },
+    { 0x0055, 0x0311, 0x0216 },
+    { 0x0055, 0x031B, 0x01AF },
+    { 0x0055, 0x0323, 0x1EE4 },
+    { 0x0055, 0x0324, 0x1E72 },
+    { 0x0055, 0x0328, 0x0172 },
+    { 0x0055, 0x032D, 0x1E76 },
+    { 0x0055, 0x0330, 0x1E74 },
+    { 0x0056, 0x0303, 0x1E7C },
+    { 0x0056, 0x0323, 0x1E7E },
+    { 0x0057, 0x0300, 0x1E80 },
+    { 0x0057, 0x0301, 0x1E82 },
+    { 0x0057, 0x0302, 0x0174 },
+    { 0x0057, 0x0307, 0x1E86 },
+    { 0x0057, 0x0308, 0x1E84 },
+    { 0x0057, 0x0323, 0x1E88 },
+    { 0x0058, 0x0307, 0x1E8A },
+    { 0x0058, 0x0308, 0x1E8C },
+    { 0x0059, 0x0300, 0x1EF2 },
+    { 0x0059, 0x0301, 0x00DD },
+    { 0x0059, 0x0302, 0x0176 },
+    { 0x0059, 0x0303, 0x1EF8 },
+    { 0x0059, 0x0304, 0x0232 },
+    { 0x0059, 0x0307, 0x1E8E },
+    { 0x0059, 0x0308, 0x0178 },
+    { 0x0059, 0x0309, 0x1EF6 },
+    { 0x0059, 0x0323, 0x1EF4 },
+    { 0x005A, 0x0301, 0x0179 },
+    { 0x005A, 0x0302, 0x1E90 },
+    { 0x005A, 0x0307, 0x017B },
+    { 0x005A, 0x030C, 0x017D },
+    { 0x005A, 0x0323, 0x1E92 },
+    { 0x005A, 0x0331, 0x1E94 },
+    { 0x0061, 0x0300, 0x00E0 },
+    { 0x0061, 0x0301, 0x00E1 },
+    { 0x0061, 0x0302, 0x00E2 },
+    { 0x0061, 0x0303, 0x00E3 },
+    { 0x0061, 0x0304, 0x0101 },
+    { 0x0061, 0x0306, 0x0103 },
+    { 0x0061, 0x0307, 0x0227 },
+    { 0x0061, 0x0308, 0x00E4 },
+    { 0x0061, 0x0309, 0x1EA3 },
+    { 0x0061, 0x030A, 0x00E5 },
+    { 0x0061, 0x030C, 0x01CE },
+    { 0x0061, 0x030F, 0x0201 },
+    { 0x0061, 0x0311, 0x0203 },
+    { 0x0061, 0x0323, 0x1EA1 },
+    { 0x0061, 0x0325, 0x1E01 },
+    { 0x0061, 0x0328, 0x0105 },
+    { 0x0062, 0x0307, 0x1E03 },
+    { 0x0062, 0x0323, 0x1E05 },
+    { 0x0062, 0x0331, 0x1E07 },
+    { 0x0063, 0x0301, 0x0107 },
+    { 0x0063, 0x0302, 0x0109 },
+    { 0x0063, 0x0307, 0x010B },
+    { 0x0063, 0x030C, 0x010D },
+    { 0x0063, 0x0327, 0x00E7 },
+    { 0x0064, 0x0307, 0x1E0B },
+    { 0x0064, 0x030C, 0x010F },
+    { 0x0064, 0x0323, 0x1E0D },
+    { 0x0064, 0x0327, 0x1E11 },
+    { 0x0064, 0x032D, 0x1E13 },
+    { 0x0064, 0x0331, 0x1E0F },
+    { 0x0065, 0x0300, 0x00E8 },
+    { 0x0065, 0x0301, 0x00E9 },
+    { 0x0065, 0x0302, 0x00EA },
+    { 0x0065, 0x0303, 0x1EBD },
+    { 0x0065, 0x0304, 0x0113 },
+    { 0x0065, 0x0306, 0x0115 },
+    { 0x0065, 0x0307, 0x0117 },
+    { 0x0065, 0x0308, 0x00EB },
+    { 0x0065, 0x0309, 0x1EBB },
+    { 0x0065, 0x030C, 0x011B },
+    { 0x0065, 0x030F, 0x0205 },
+    { 0x0065, 0x0311, 0x0207 },
+    { 0x0065, 0x0323, 0x1EB9 },
+    { 0x0065, 0x0327, 0x0229 },
+    { 0x0065, 0x0328, 0x0119 },
+    { 0x0065, 0x032D, 0x1E19 },
+    { 0x0065, 0x0330, 0x1E1B },
+    { 0x0066, 0x0307, 0x1E1F },
+    { 0x0067, 0x0301, 0x01F5 },
+    { 0x0067, 0x0302, 0x011D },
+    { 0x0067, 0x0304, 0x1E21 },
+    { 0x0067, 0x0306, 0x011F },
+    { 0x0067, 0x0307, 0x0121 },
+    { 0x0067, 0x030C, 0x01E7 },
+    { 0x0067, 0x0327, 0x0123 },
+    { 0x0068, 0x0302, 0x0125 },
+    { 0x0068, 0x0307, 0x1E23 },
+    { 0x0068, 0x0308, 0x1E27 },
+    { 0x0068, 0x030C, 0x021F },
+    { 0x0068, 0x0323, 0x1E25 },
+    { 0x0068, 0x0327, 0x1E29 },
+    { 0x0068, 0x032E, 0x1E2B },
+    { 0x0068, 0x0331, 0x1E96 },
+    { 0x0069, 0x0300, 0x00EC },
+    { 0x0069, 0x0301, 0x00ED },
+    { 0x0069, 0x0302, 0x00EE },
+    { 0x0069, 0x0303, 0x0129 },
+    { 0x0069, 0x0304, 0x012B },
+    { 0x0069, 0x0306, 0x012D },
+    { 0x0069, 0x0308, 0x00EF },
+    { 0x0069, 0x0309, 0x1EC9 },
+    { 0x0069, 0x030C, 0x01D0 },
+    { 0x0069, 0x030F, 0x0209 },
+    { 0x0069, 0x0311, 0x020B },
+    { 0x0069, 0x0323, 0x1ECB },
+    { 0x0069, 0x0328, 0x012F },
+    { 0x0069, 0x0330, 0x1E2D },
+    { 0x006A, 0x0302, 0x0135 },
+    { 0x006A, 0x030C, 0x01F0 },
+    { 0x006B, 0x0301, 0x1E31 },
+    { 0x006B, 0x030C, 0x01E9 },
+    { 0x006B, 0x0323, 0x1E33 },
+    { 0x006B, 0x0327, 0x0137 },
+    { 0x006B, 0x0331, 0x1E35 },
+    { 0x006C, 0x0301, 0x013A },
+    { 0x006C, 0x030C, 0x013E },
+    { 0x006C, 0x0323, 0x1E37 },
+    { 0x006C, 0x0327, 0x013C },
+    { 0x006C, 0x032D, 0x1E3D },
+    { 0x006C, 0x0331, 0x1E3B },
+    { 0x006D, 0x0301, 0x1E3F },
+    { 0x006D, 0x0307, 0x1E41 },
+    { 0x006D, 0x0323, 0x1E43 },
+    { 0x006E, 0x0300, 0x01F9 },
+    { 0x006E, 0x0301, 0x0144 },
+    { 0x006E, 0x0303, 0x00F1 },
+    { 0x006E, 0x0307, 0x1E45 },
+    { 0x006E, 0x030C, 0x0148 },
+    { 0x006E, 0x0323, 0x1E47 },
+    { 0x006E, 0x0327, 0x0146 },
+    { 0x006E, 0x032D, 0x1E4B },
+    { 0x006E, 0x0331, 0x1E49 },
+    { 0x006F, 0x0300, 0x00F2 },
+    { 0x006F, 0x0301, 0x00F3 },
+    { 0x006F, 0x0302, 0x00F4 },
+    { 0x006F, 0x0303, 0x00F5 },
+    { 0x006F, 0x0304, 0x014D },
+    { 0x006F, 0x0306, 0x014F },
+    { 0x006F, 0x0307, 0x022F },
+    { 0x006F, 0x0308, 0x00F6 },
+    { 0x006F, 0x0309, 0x1ECF },
+    { 0x006F, 0x030B, 0x0151 },
+    { 0x006F, 0x030C, 0x01D2 },
+    { 0x006F, 0x030F, 0x020D },
+    { 0x006F, 0x0311, 0x020F },
+    { 0x006F, 0x031B, 0x01A1 },
+    { 0x006F, 0x0323, 0x1ECD },
+    { 0x006F, 0x0328, 0x01EB },
+    { 0x0070, 0x0301, 0x1E55 },
+    { 0x0070, 0x0307, 0x1E57 },
+    { 0x0072, 0x0301, 0x0155 },
+    { 0x0072, 0x0307, 0x1E59 },
+    { 0x0072, 0x030C, 0x0159 },
+    { 0x0072, 0x030F, 0x0211 },
+    { 0x0072, 0x0311, 0x0213 },
+    { 0x0072, 0x0323, 0x1E5B },
+    { 0x0072, 0x0327, 0x0157 },
+    { 0x0072, 0x0331, 0x1E5F },
+    { 0x0073, 0x0301, 0x015B },
+    { 0x0073, 0x0302, 0x015D },
+    { 0x0073, 0x0307, 0x1E61 },
+    { 0x0073, 0x030C, 0x0161 },
+    { 0x0073, 0x0323, 0x1E63 },
+    { 0x0073, 0x0326, 0x0219 },
+    { 0x0073, 0x0327, 0x015F },
+    { 0x0074, 0x0307, 0x1E6B },
+    { 0x0074, 0x0308, 0x1E97 },
+    { 0x0074, 0x030C, 0x0165 },
+    { 0x0074, 0x0323, 0x1E6D },
+    { 0x0074, 0x0326, 0x021B },
+    { 0x0074, 0x0327, 0x0163 },
+    { 0x0074, 0x032D, 0x1E71 },
+    { 0x0074, 0x0331, 0x1E6F },
+    { 0x0075, 0x0300, 0x00F9 },
+    { 0x0075, 0x0301, 0x00FA },
+    { 0x0075, 0x0302, 0x00FB },
+    { 0x0075, 0x0303, 0x0169 },
+    { 0x0075, 0x0304, 0x016B },
+    { 0x0075, 0x0306, 0x016D },
+    { 0x0075, 0x0308, 0x00FC },
+    { 0x0075, 0x0309, 0x1EE7 },
+    { 0x0075, 0x030A, 0x016F },
+    { 0x0075, 0x030B, 0x0171 },
+    { 0x0075, 0x030C, 0x01D4 },
+    { 0x0075, 0x030F, 0x0215 },
+    { 0x0075, 0x0311, 0x0217 },
+    { 0x0075, 0x031B, 0x01B0 },
+    { 0x0075, 0x0323, 0x1EE5 },
+    { 0x0075, 0x0324, 0x1E73 },
+    { 0x0075, 0x0328, 0x0173 },
+    { 0x0075, 0x032D, 0x1E77 },
+    { 0x0075, 0x0330, 0x1E75 },
+    { 0x0076, 0x0303, 0x1E7D },
+    { 0x0076, 0x0323, 0x1E7F },
+    { 0x0077, 0x0300, 0x1E81 },
+    { 0x0077, 0x0301, 0x1E83 },
+    { 0x0077, 0x0302, 0x0175 },
+    { 0x0077, 0x0307, 0x1E87 },
+    { 0x0077, 0x0308, 0x1E85 },
+    { 0x0077, 0x030A, 0x1E98 },
+    { 0x0077, 0x0323, 0x1E89 },
+    { 0x0078, 0x0307, 0x1E8B },
+    { 0x0078, 0x0308, 0x1E8D },
+    { 0x0079, 0x0300, 0x1EF3 },
+    { 0x0079, 0x0301, 0x00FD },
+    { 0x0079, 0x0302, 0x0177 },
+    { 0x0079, 0x0303, 0x1EF9 },
+    { 0x0079, 0x0304, 0x0233 },
+    { 0x0079, 0x0307, 0x1E8F },
+    { 0x0079, 0x0308, 0x00FF },
+    { 0x0079, 0x0309, 0x1EF7 },
+    { 0x0079, 0x030A, 0x1E99 },
+    { 0x0079, 0x0323, 0x1EF5 },
+    { 0x007A, 0x0301, 0x017A },
+    { 0x007A, 0x0302, 0x1E91 },
+    { 0x007A, 0x0307, 0x017C },
+    { 0x007A, 0x030C, 0x017E },
+    { 0x007A, 0x0323, 0x1E93 },
+    { 0x007A, 0x0331, 0x1E95 },
+    { 0x00A8, 0x0300, 0x1FED },
+    { 0x00A8, 0x0301, 0x0385 },
+    { 0x00A8, 0x0342, 0x1FC1 },
+    { 0x00C2, 0x0300, 0x1EA6 },
+    { 0x00C2, 0x0301, 0x1EA4 },
+    { 0x00C2, 0x0303, 0x1EAA },
+    { 0x00C2, 0x0309, 0x1EA8 },
+    { 0x00C4, 0x0304, 0x01DE },
+    { 0x00C5, 0x0301, 0x01FA },
+    { 0x00C6, 0x0301, 0x01FC },
+    { 0x00C6, 0x0304, 0x01E2 },
+    { 0x00C7, 0x0301, 0x1E08 },
+    { 0x00CA, 0x0300, 0x1EC0 },
+    { 0x00CA, 0x0301, 0x1EBE },
+    { 0x00CA, 0x0303, 0x1EC4 },
+    { 0x00CA, 0x0309, 0x1EC2 },
+    { 0x00CF, 0x0301, 0x1E2E },
+    { 0x00D4, 0x0300, 0x1ED2 },
+    { 0x00D4, 0x0301, 0x1ED0 },
+    { 0x00D4, 0x0303, 0x1ED6 },
+    { 0x00D4, 0x0309, 0x1ED4 },
+    { 0x00D5, 0x0301, 0x1E4C },
+    { 0x00D5, 0x0304, 0x022C },
+    { 0x00D5, 0x0308, 0x1E4E },
+    { 0x00D6, 0x0304, 0x022A },
+    { 0x00D8, 0x0301, 0x01FE },
+    { 0x00DC, 0x0300, 0x01DB },
+    { 0x00DC, 0x0301, 0x01D7 },
+    { 0x00DC, 0x0304, 0x01D5 },
+    { 0x00DC, 0x030C, 0x01D9 },
+    { 0x00E2, 0x0300, 0x1EA7 },
+    { 0x00E2, 0x0301, 0x1EA5 },
+    { 0x00E2, 0x0303, 0x1EAB },
+    { 0x00E2, 0x0309, 0x1EA9 },
+    { 0x00E4, 0x0304, 0x01DF },
+    { 0x00E5, 0x0301, 0x01FB },
+    { 0x00E6, 0x0301, 0x01FD },
+    { 0x00E6, 0x0304, 0x01E3 },
+    { 0x00E7, 0x0301, 0x1E09 },
+    { 0x00EA, 0x0300, 0x1EC1 },
+    { 0x00EA, 0x0301, 0x1EBF },
+    { 0x00EA, 0x0303, 0x1EC5 },
+    { 0x00EA, 0x0309, 0x1EC3 },
+    { 0x00EF, 0x0301, 0x1E2F },
+    { 0x00F4, 0x0300, 0x1ED3 },
+    { 0x00F4, 0x0301, 0x1ED1 },
+    { 0x00F4, 0x0303, 0x1ED7 },
+    { 0x00F4, 0x0309, 0x1ED5 },
+    { 0x00F5, 0x0301, 0x1E4D },
+    { 0x00F5, 0x0304, 0x022D },
+    { 0x00F5, 0x0308, 0x1E4F },
+    { 0x00F6, 0x0304, 0x022B },
+    { 0x00F8, 0x0301, 0x01FF },
+    { 0x00FC, 0x0300, 0x01DC },
+    { 0x00FC, 0x0301, 0x01D8 },
+    { 0x00FC, 0x0304, 0x01D6 },
+    { 0x00FC, 0x030C, 0x01DA },
+    { 0x0102, 0x0300, 0x1EB0 },
+    { 0x0102, 0x0301, 0x1EAE },
+    { 0x0102, 0x0303, 0x1EB4 },
+    { 0x0102, 0x0309, 0x1EB2 },
+    { 0x0103, 0x0300, 0x1EB1 },
+    { 0x0103, 0x0301, 0x1EAF },
+    { 0x0103, 0x0303, 0x1EB5 },
+    { 0x0103, 0x0309, 0x1EB3 },
+    { 0x0112, 0x0300, 0x1E14 },
+    { 0x0112, 0x0301, 0x1E16 },
+    { 0x0113, 0x0300, 0x1E15 },
+    { 0x0113, 0x0301, 0x1E17 },
+    { 0x014C, 0x0300, 0x1E50 },
+    { 0x014C, 0x0301, 0x1E52 },
+    { 0x014D, 0x0300, 0x1E51 },
+    { 0x014D, 0x0301, 0x1E53 },
+    { 0x015A, 0x0307, 0x1E64 },
+    { 0x015B, 0x0307, 0x1E65 },
+    { 0x0160, 0x0307, 0x1E66 },
+    { 0x0161, 0x0307, 0x1E67 },
+    { 0x0168, 0x0301, 0x1E78 },
+    { 0x0169, 0x0301, 0x1E79 },
+    { 0x016A, 0x0308, 0x1E7A },
+    { 0x016B, 0x0308, 0x1E7B },
+    { 0x017F, 0x0307, 0x1E9B },
+    { 0x01A0, 0x0300, 0x1EDC },
+    { 0x01A0, 0x0301, 0x1EDA },
+    { 0x01A0, 0x0303, 0x1EE0 },
+    { 0x01A0, 0x0309, 0x1EDE },
+    { 0x01A0, 0x0323, 0x1EE2 },
+    { 0x01A1, 0x0300, 0x1EDD },
+    { 0x01A1, 0x0301, 0x1EDB },
+    { 0x01A1, 0x0303, 0x1EE1 },
+    { 0x01A1, 0x0309, 0x1EDF },
+    { 0x01A1, 0x0323, 0x1EE3 },
+    { 0x01AF, 0x0300, 0x1EEA },
+    { 0x01AF, 0x0301, 0x1EE8 },
+    { 0x01AF, 0x0303, 0x1EEE },
+    { 0x01AF, 0x0309, 0x1EEC },
+    { 0x01AF, 0x0323, 0x1EF0 },
+    { 0x01B0, 0x0300, 0x1EEB },
+    { 0x01B0, 0x0301, 0x1EE9 },
+    { 0x01B0, 0x0303, 0x1EEF },
+    { 0x01B0, 0x0309, 0x1EED },
+    { 0x01B0, 0x0323, 0x1EF1 },
+    { 0x01B7, 0x030C, 0x01EE },
+    { 0x01EA, 0x0304, 0x01EC },
+    { 0x01EB, 0x0304, 0x01ED },
+    { 0x0226, 0x0304, 0x01E0 },
+    { 0x0227, 0x0304, 0x01E1 },
+    { 0x0228, 0x0306, 0x1E1C },
+    { 0x0229, 0x0306, 0x1E1D },
+    { 0x022E, 0x0304, 0x0230 },
+    { 0x022F, 0x0304, 0x0231 },
+    { 0x0292, 0x030C, 0x01EF },
+    { 0x0391, 0x0300, 0x1FBA },
+    { 0x0391, 0x0301, 0x0386 },
+    { 0x0391, 0x0304, 0x1FB9 },
+    { 0x0391, 0x0306, 0x1FB8 },
+    { 0x0391, 0x0313, 0x1F08 },
+    { 0x0391, 0x0314, 0x1F09 },
+    { 0x0391, 0x0345, 0x1FBC },
+    { 0x0395, 0x0300, 0x1FC8 },
+    { 0x0395, 0x0301, 0x0388 },
+    { 0x0395, 0x0313, 0x1F18 },
+    { 0x0395, 0x0314, 0x1F19 },
+    { 0x0397, 0x0300, 0x1FCA },
+    { 0x0397, 0x0301, 0x0389 },
+    { 0x0397, 0x0313, 0x1F28 },
+    { 0x0397, 0x0314, 0x1F29 },
+    { 0x0397, 0x0345, 0x1FCC },
+    { 0x0399, 0x0300, 0x1FDA },
+    { 0x0399, 0x0301, 0x038A },
+    { 0x0399, 0x0304, 0x1FD9 },
+    { 0x0399, 0x0306, 0x1FD8 },
+    { 0x0399, 0x0308, 0x03AA },
+    { 0x0399, 0x0313, 0x1F38 },
+    { 0x0399, 0x0314, 0x1F39 },
+    { 0x039F, 0x0300, 0x1FF8 },
+    { 0x039F, 0x0301, 0x038C },
+    { 0x039F, 0x0313, 0x1F48 },
+    { 0x039F, 0x0314, 0x1F49 },
+    { 0x03A1, 0x0314, 0x1FEC },
+    { 0x03A5, 0x0300, 0x1FEA },
+    { 0x03A5, 0x0301, 0x038E },
+    { 0x03A5, 0x0304, 0x1FE9 },
+    { 0x03A5, 0x0306, 0x1FE8 },
+    { 0x03A5, 0x0308, 0x03AB },
+    { 0x03A5, 0x0314, 0x1F59 },
+    { 0x03A9, 0x0300, 0x1FFA },
+    { 0x03A9, 0x0301, 0x038F },
+    { 0x03A9, 0x0313, 0x1F68 },
+    { 0x03A9, 0x0314, 0x1F69 },
+    { 0x03A9, 0x0345, 0x1FFC },
+    { 0x03AC, 0x0345, 0x1FB4 },
+    { 0x03AE, 0x0345, 0x1FC4 },
+    { 0x03B1, 0x0300, 0x1F70 },
+    { 0x03B1, 0x0301, 0x03AC },
+    { 0x03B1, 0x0304, 0x1FB1 },
+    { 0x03B1, 0x0306, 0x1FB0 },
+    { 0x03B1, 0x0313, 0x1F00 },
+    { 0x03B1, 0x0314, 0x1F01 },
+    { 0x03B1, 0x0342, 0x1FB6 },
+    { 0x03B1, 0x0345, 0x1FB3 },
+    { 0x03B5, 0x0300, 0x1F72 },
+    { 0x03B5, 0x0301, 0x03AD },
+    { 0x03B5, 0x0313, 0x1F10 },
+    { 0x03B5, 0x0314, 0x1F11 },
+    { 0x03B7, 0x0300, 0x1F74 },
+    { 0x03B7, 0x0301, 0x03AE },
+    { 0x03B7, 0x0313, 0x1F20 },
+    { 0x03B7, 0x0314, 0x1F21 },
+    { 0x03B7, 0x0342, 0x1FC6 },
+    { 0x03B7, 0x0345, 0x1FC3 },
+    { 0x03B9, 0x0300, 0x1F76 },
+    { 0x03B9, 0x0301, 0x03AF },
+    { 0x03B9, 0x0304, 0x1FD1 },
+    { 0x03B9, 0x0306, 0x1FD0 },
+    { 0x03B9, 0x0308, 0x03CA },
+    { 0x03B9, 0x0313, 0x1F30 },
+    { 0x03B9, 0x0314, 0x1F31 },
+    { 0x03B9, 0x0342, 0x1FD6 },
+    { 0x03BF, 0x0300, 0x1F78 },
+    { 0x03BF, 0x0301, 0x03CC },
+    { 0x03BF, 0x0313, 0x1F40 },
+    { 0x03BF, 0x0314, 0x1F41 },
+    { 0x03C1, 0x0313, 0x1FE4 },
+    { 0x03C1, 0x0314, 0x1FE5 },
+    { 0x03C5, 0x0300, 0x1F7A },
+    { 0x03C5, 0x0301, 0x03CD },
+    { 0x03C5, 0x0304, 0x1FE1 },
+    { 0x03C5, 0x0306, 0x1FE0 },
+    { 0x03C5, 0x0308, 0x03CB },
+    { 0x03C5, 0x0313, 0x1F50 },
+    { 0x03C5, 0x0314, 0x1F51 },
+    { 0x03C5, 0x0342, 0x1FE6 },
+    { 0x03C9, 0x0300, 0x1F7C },
+    { 0x03C9, 0x0301, 0x03CE },
+    { 0x03C9, 0x0313, 0x1F60 },
+    { 0x03C9, 0x0314, 0x1F61 },
+    { 0x03C9, 0x0342, 0x1FF6 },
+    { 0x03C9, 0x0345, 0x1FF3 },
+    { 0x03CA, 0x0300, 0x1FD2 },
+    { 0x03CA, 0x0301, 0x0390 },
+    { 0x03CA, 0x0342, 0x1FD7 },
+    { 0x03CB, 0x0300, 0x1FE2 },
+    { 0x03CB, 0x0301, 0x03B0 },
+    { 0x03CB, 0x0342, 0x1FE7 },
+    { 0x03CE, 0x0345, 0x1FF4 },
+    { 0x03D2, 0x0301, 0x03D3 },
+    { 0x03D2, 0x0308, 0x03D4 },
+    { 0x0406, 0x0308, 0x0407 },
+    { 0x0410, 0x0306, 0x04D0 },
+    { 0x0410, 0x0308, 0x04D2 },
+    { 0x0413, 0x0301, 0x0403 },
+    { 0x0415, 0x0300, 0x0400 },
+    { 0x0415, 0x0306, 0x04D6 },
+    { 0x0415, 0x0308, 0x0401 },
+    { 0x0416, 0x0306, 0x04C1 },
+    { 0x0416, 0x0308, 0x04DC },
+    { 0x0417, 0x0308, 0x04DE },
+    { 0x0418, 0x0300, 0x040D },
+    { 0x0418, 0x0304, 0x04E2 },
+    { 0x0418, 0x0306, 0x0419 },
+    { 0x0418, 0x0308, 0x04E4 },
+    { 0x041A, 0x0301, 0x040C },
+    { 0x041E, 0x0308, 0x04E6 },
+    { 0x0423, 0x0304, 0x04EE },
+    { 0x0423, 0x0306, 0x040E },
+    { 0x0423, 0x0308, 0x04F0 },
+    { 0x0423, 0x030B, 0x04F2 },
+    { 0x0427, 0x0308, 0x04F4 },
+    { 0x042B, 0x0308, 0x04F8 },
+    { 0x042D, 0x0308, 0x04EC },
+    { 0x0430, 0x0306, 0x04D1 },
+    { 0x0430, 0x0308, 0x04D3 },
+    { 0x0433, 0x0301, 0x0453 },
+    { 0x0435, 0x0300, 0x0450 },
+    { 0x0435, 0x0306, 0x04D7 },
+    { 0x0435, 0x0308, 0x0451 },
+    { 0x0436, 0x0306, 0x04C2 },
+    { 0x0436, 0x0308, 0x04DD },
+    { 0x0437, 0x0308, 0x04DF },
+    { 0x0438, 0x0300, 0x045D },
+    { 0x0438, 0x0304, 0x04E3 },
+    { 0x0438, 0x0306, 0x0439 },
+    { 0x0438, 0x0308, 0x04E5 },
+    { 0x043A, 0x0301, 0x045C },
+    { 0x043E, 0x0308, 0x04E7 },
+    { 0x0443, 0x0304, 0x04EF },
+    { 0x0443, 0x0306, 0x045E },
+    { 0x0443, 0x0308, 0x04F1 },
+    { 0x0443, 0x030B, 0x04F3 },
+    { 0x0447, 0x0308, 0x04F5 },
+    { 0x044B, 0x0308, 0x04F9 },
+    { 0x044D, 0x0308, 0x04ED },
+    { 0x0456, 0x0308, 0x0457 },
+    { 0x0474, 0x030F, 0x0476 },
+    { 0x0475, 0x030F, 0x0477 },
+    { 0x04D8, 0x0308, 0x04DA },
+    { 0x04D9, 0x0308, 0x04DB },
+    { 0x04E8, 0x0308, 0x04EA },
+    { 0x04E9, 0x0308, 0x04EB },
+    { 0x0627, 0x0653, 0x0622 },
+    { 0x0627, 0x0654, 0x0623 },
+    { 0x0627, 0x0655, 0x0625 },
+    { 0x0648, 0x0654, 0x0624 },
+    { 0x064A, 0x0654, 0x0626 },
+    { 0x06C1, 0x0654, 0x06C2 },
+    { 0x06D2, 0x0654, 0x06D3 },
+    { 0x06D5, 0x0654, 0x06C0 },
+    { 0x0928, 0x093C, 0x0929 },
+    { 0x0930, 0x093C, 0x0931 },
+    { 0x0933, 0x093C, 0x0934 },
+    { 0x09C7, 0x09BE, 0x09CB },
+    { 0x09C7, 0x09D7, 0x09CC },
+    { 0x0B47, 0x0B3E, 0x0B4B },
+    { 0x0B47, 0x0B56, 0x0B48 },
+    { 0x0B47, 0x0B57, 0x0B4C },
+    { 0x0B92, 0x0BD7, 0x0B94 },
+    { 0x0BC6, 0x0BBE, 0x0BCA },
+    { 0x0BC6, 0x0BD7, 0x0BCC },
+    { 0x0BC7, 0x0BBE, 0x0BCB },
+    { 0x0C46, 0x0C56, 0x0C48 },
+    { 0x0CBF, 0x0CD5, 0x0CC0 },
+    { 0x0CC6, 0x0CC2, 0x0CCA },
+    { 0x0CC6, 0x0CD5, 0x0CC7 },
+    { 0x0CC6, 0x0CD6, 0x0CC8 },
+    { 0x0CCA, 0x0CD5, 0x0CCB },
+    { 0x0D46, 0x0D3E, 0x0D4A },
+    { 0x0D46, 0x0D57, 0x0D4C },
+    { 0x0D47, 0x0D3E, 0x0D4B },
+    { 0x0DD9, 0x0DCA, 0x0DDA },
+    { 0x0DD9, 0x0DCF, 0x0DDC },
+    { 0x0DD9, 0x0DDF, 0x0DDE },
+    { 0x0DDC, 0x0DCA, 0x0DDD },
+    { 0x1025, 0x102E, 0x1026 },
+    { 0x1B05, 0x1B35, 0x1B06 },
+    { 0x1B07, 0x1B35, 0x1B08 },
+    { 0x1B09, 0x1B35, 0x1B0A },
+    { 0x1B0B, 0x1B35, 0x1B0C },
+    { 0x1B0D, 0x1B35, 0x1B0E },
+    { 0x1B11, 0x1B35, 0x1B12 },
+    { 0x1B3A, 0x1B35, 0x1B3B },
+    { 0x1B3C, 0x1B35, 0x1B3D },
+    { 0x1B3E, 0x1B35, 0x1B40 },
+    { 0x1B3F, 0x1B35, 0x1B41 },
+    { 0x1B42, 0x1B35, 0x1B43 },
+    { 0x1E36, 0x0304, 0x1E38 },
+    { 0x1E37, 0x0304, 0x1E39 },
+    { 0x1E5A, 0x0304, 0x1E5C },
+    { 0x1E5B, 0x0304, 0x1E5D },
+    { 0x1E62, 0x0307, 0x1E68 },
+    { 0x1E63, 0x0307, 0x1E69 },
+    { 0x1EA0, 0x0302, 0x1EAC },
+    { 0x1EA0, 0x0306, 0x1EB6 },
+    { 0x1EA1, 0x0302, 0x1EAD },
+    { 0x1EA1, 0x0306, 0x1EB7 },
+    { 0x1EB8, 0x0302, 0x1EC6 },
+    { 0x1EB9, 0x0302, 0x1EC7 },
+    { 0x1ECC, 0x0302, 0x1ED8 },
+    { 0x1ECD, 0x0302, 0x1ED9 },
+    { 0x1F00, 0x0300, 0x1F02 },
+    { 0x1F00, 0x0301, 0x1F04 },
+    { 0x1F00, 0x0342, 0x1F06 },
+    { 0x1F00, 0x0345, 0x1F80 },
+    { 0x1F01, 0x0300, 0x1F03 },
+    { 0x1F01, 0x0301, 0x1F05 },
+    { 0x1F01, 0x0342, 0x1F07 },
+    { 0x1F01, 0x0345, 0x1F81 },
+    { 0x1F02, 0x0345, 0x1F82 },
+    { 0x1F03, 0x0345, 0x1F83 },
+    { 0x1F04, 0x0345, 0x1F84 },
+    { 0x1F05, 0x0345, 0x1F85 },
+    { 0x1F06, 0x0345, 0x1F86 },
+    { 0x1F07, 0x0345, 0x1F87 },
+    { 0x1F08, 0x0300, 0x1F0A },
+    { 0x1F08, 0x0301, 0x1F0C },
+    { 0x1F08, 0x0342, 0x1F0E },
+    { 0x1F08, 0x0345, 0x1F88 },
+    { 0x1F09, 0x0300, 0x1F0B },
+    { 0x1F09, 0x0301, 0x1F0D },
+    { 0x1F09, 0x0342, 0x1F0F },
+    { 0x1F09, 0x0345, 0x1F89 },
+    { 0x1F0A, 0x0345, 0x1F8A },
+    { 0x1F0B, 0x0345, 0x1F8B },
+    { 0x1F0C, 0x0345, 0x1F8C },
+    { 0x1F0D, 0x0345, 0x1F8D },
+    { 0x1F0E, 0x0345, 0x1F8E },
+    { 0x1F0F, 0x0345, 0x1F8F },
+    { 0x1F10, 0x0300, 0x1F12 },
+    { 0x1F10, 0x0301, 0x1F14 },
+    { 0x1F11, 0x0300, 0x1F13 },
+    { 0x1F11, 0x0301, 0x1F15 },
+    { 0x1F18, 0x0300, 0x1F1A },
+    { 0x1F18, 0x0301, 0x1F1C },
+    { 0x1F19, 0x0300, 0x1F1B },
+    { 0x1F19, 0x0301, 0x1F1D },
+    { 0x1F20, 0x0300, 0x1F22 },
+    { 0x1F20, 0x0301, 0x1F24 },
+    { 0x1F20, 0x0342, 0x1F26 },
+    { 0x1F20, 0x0345, 0x1F90 },
+    { 0x1F21, 0x0300, 0x1F23 },
+    { 0x1F21, 0x0301, 0x1F25 },
+    { 0x1F21, 0x0342, 0x1F27 },
+    { 0x1F21, 0x0345, 0x1F91 },
+    { 0x1F22, 0x0345, 0x1F92 },
+    { 0x1F23, 0x0345, 0x1F93 },
+    { 0x1F24, 0x0345, 0x1F94 },
+    { 0x1F25, 0x0345, 0x1F95 },
+    { 0x1F26, 0x0345, 0x1F96 },
+    { 0x1F27, 0x0345, 0x1F97 },
+    { 0x1F28, 0x0300, 0x1F2A },
+    { 0x1F28, 0x0301, 0x1F2C },
+    { 0x1F28, 0x0342, 0x1F2E },
+    { 0x1F28, 0x0345, 0x1F98 },
+    { 0x1F29, 0x0300, 0x1F2B },
+    { 0x1F29, 0x0301, 0x1F2D },
+    { 0x1F29, 0x0342, 0x1F2F },
+    { 0x1F29, 0x0345, 0x1F99 },
+    { 0x1F2A, 0x0345, 0x1F9A },
+    { 0x1F2B, 0x0345, 0x1F9B },
+    { 0x1F2C, 0x0345, 0x1F9C },
+    { 0x1F2D, 0x0345, 0x1F9D },
+    { 0x1F2E, 0x0345, 0x1F9E },
+    { 0x1F2F, 0x0345, 0x1F9F },
+    { 0x1F30, 0x0300, 0x1F32 },
+    { 0x1F30, 0x0301, 0x1F34 },
+    { 0x1F30, 0x0342, 0x1F36 },
+    { 0x1F31, 0x0300, 0x1F33 },
+    { 0x1F31, 0x0301, 0x1F35 },
+    { 0x1F31, 0x0342, 0x1F37 },
+    { 0x1F38, 0x0300, 0x1F3A },
+    { 0x1F38, 0x0301, 0x1F3C },
+    { 0x1F38, 0x0342, 0x1F3E },
+    { 0x1F39, 0x0300, 0x1F3B },
+    { 0x1F39, 0x0301, 0x1F3D },
+    { 0x1F39, 0x0342, 0x1F3F },
+    { 0x1F40, 0x0300, 0x1F42 },
+    { 0x1F40, 0x0301, 0x1F44 },
+    { 0x1F41, 0x0300, 0x1F43 },
+    { 0x1F41, 0x0301, 0x1F45 },
+    { 0x1F48, 0x0300, 0x1F4A },
+    { 0x1F48, 0x0301, 0x1F4C },
+    { 0x1F49, 0x0300, 0x1F4B },
+    { 0x1F49, 0x0301, 0x1F4D },
+    { 0x1F50, 0x0300, 0x1F52 },
+    { 0x1F50, 0x0301, 0x1F54 },
+    { 0x1F50, 0x0342, 0x1F56 },
+    { 0x1F51, 0x0300, 0x1F53 },
+    { 0x1F51, 0x0301, 0x1F55 },
+    { 0x1F51, 0x0342, 0x1F57 },
+    { 0x1F59, 0x0300, 0x1F5B },
+    { 0x1F59, 0x0301, 0x1F5D },
+    { 0x1F59, 0x0342, 0x1F5F },
+    { 0x1F60, 0x0300, 0x1F62 },
+    { 0x1F60, 0x0301, 0x1F64 },
+    { 0x1F60, 0x0342, 0x1F66 },
+    { 0x1F60, 0x0345, 0x1FA0 },
+    { 0x1F61, 0x0300, 0x1F63 },
+    { 0x1F61, 0x0301, 0x1F65 },
+    { 0x1F61, 0x0342, 0x1F67 },
+    { 0x1F61, 0x0345, 0x1FA1 },
+    { 0x1F62, 0x0345, 0x1FA2 },
+    { 0x1F63, 0x0345, 0x1FA3 },
+    { 0x1F64, 0x0345, 0x1FA4 },
+    { 0x1F65, 0x0345, 0x1FA5 },
+    { 0x1F66, 0x0345, 0x1FA6 },
+    { 0x1F67, 0x0345, 0x1FA7 },
+    { 0x1F68, 0x0300, 0x1F6A },
+    { 0x1F68, 0x0301, 0x1F6C },
+    { 0x1F68, 0x0342, 0x1F6E },
+    { 0x1F68, 0x0345, 0x1FA8 },
+    { 0x1F69, 0x0300, 0x1F6B },
+    { 0x1F69, 0x0301, 0x1F6D },
+    { 0x1F69, 0x0342, 0x1F6F },
+    { 0x1F69, 0x0345, 0x1FA9 },
+    { 0x1F6A, 0x0345, 0x1FAA },
+    { 0x1F6B, 0x0345, 0x1FAB },
+    { 0x1F6C, 0x0345, 0x1FAC },
+    { 0x1F6D, 0x0345, 0x1FAD },
+    { 0x1F6E, 0x0345, 0x1FAE },
+    { 0x1F6F, 0x0345, 0x1FAF },
+    { 0x1F70, 0x0345, 0x1FB2 },
+    { 0x1F74, 0x0345, 0x1FC2 },
+    { 0x1F7C, 0x0345, 0x1FF2 },
+    { 0x1FB6, 0x0345, 0x1FB7 },
+    { 0x1FBF, 0x0300, 0x1FCD },
+    { 0x1FBF, 0x0301, 0x1FCE },
+    { 0x1FBF, 0x0342, 0x1FCF },
+    { 0x1FC6, 0x0345, 0x1FC7 },
+    { 0x1FF6, 0x0345, 0x1FF7 },
+    { 0x1FFE, 0x0300, 0x1FDD },
+    { 0x1FFE, 0x0301, 0x1FDE },
+    { 0x1FFE, 0x0342, 0x1FDF },
+    { 0x2190, 0x0338, 0x219A },
+    { 0x2192, 0x0338, 0x219B },
+    { 0x2194, 0x0338, 0x21AE },
+    { 0x21D0, 0x0338, 0x21CD },
+    { 0x21D2, 0x0338, 0x21CF },
+    { 0x21D4, 0x0338, 0x21CE },
+    { 0x2203, 0x0338, 0x2204 },
+    { 0x2208, 0x0338, 0x2209 },
+    { 0x220B, 0x0338, 0x220C },
+    { 0x2223, 0x0338, 0x2224 },
+    { 0x2225, 0x0338, 0x2226 },
+    { 0x223C, 0x0338, 0x2241 },
+    { 0x2243, 0x0338, 0x2244 },
+    { 0x2245, 0x0338, 0x2247 },
+    { 0x2248, 0x0338, 0x2249 },
+    { 0x224D, 0x0338, 0x226D },
+    { 0x2261, 0x0338, 0x2262 },
+    { 0x2264, 0x0338, 0x2270 },
+    { 0x2265, 0x0338, 0x2271 },
+    { 0x2272, 0x0338, 0x2274 },
+    { 0x2273, 0x0338, 0x2275 },
+    { 0x2276, 0x0338, 0x2278 },
+    { 0x2277, 0x0338, 0x2279 },
+    { 0x227A, 0x0338, 0x2280 },
+    { 0x227B, 0x0338, 0x2281 },
+    { 0x227C, 0x0338, 0x22E0 },
+    { 0x227D, 0x0338, 0x22E1 },
+    { 0x2282, 0x0338, 0x2284 },
+    { 0x2283, 0x0338, 0x2285 },
+    { 0x2286, 0x0338, 0x2288 },
+    { 0x2287, 0x0338, 0x2289 },
+    { 0x2291, 0x0338, 0x22E2 },
+    { 0x2292, 0x0338, 0x22E3 },
+    { 0x22A2, 0x0338, 0x22AC },
+    { 0x22A8, 0x0338, 0x22AD },
+    { 0x22A9, 0x0338, 0x22AE },
+    { 0x22AB, 0x0338, 0x22AF },
+    { 0x22B2, 0x0338, 0x22EA },
+    { 0x22B3, 0x0338, 0x22EB },
+    { 0x22B4, 0x0338, 0x22EC },
+    { 0x22B5, 0x0338, 0x22ED },
+    { 0x3046, 0x3099, 0x3094 },
+    { 0x304B, 0x3099, 0x304C },
+    { 0x304D, 0x3099, 0x304E },
+    { 0x304F, 0x3099, 0x3050 },
+    { 0x3051, 0x3099, 0x3052 },
+    { 0x3053, 0x3099, 0x3054 },
+    { 0x3055, 0x3099, 0x3056 },
+    { 0x3057, 0x3099, 0x3058 },
+    { 0x3059, 0x3099, 0x305A },
+    { 0x305B, 0x3099, 0x305C },
+    { 0x305D, 0x3099, 0x305E },
+    { 0x305F, 0x3099, 0x3060 },
+    { 0x3061, 0x3099, 0x3062 },
+    { 0x3064, 0x3099, 0x3065 },
+    { 0x3066, 0x3099, 0x3067 },
+    { 0x3068, 0x3099, 0x3069 },
+    { 0x306F, 0x3099, 0x3070 },
+    { 0x306F, 0x309A, 0x3071 },
+    { 0x3072, 0x3099, 0x3073 },
+    { 0x3072, 0x309A, 0x3074 },
+    { 0x3075, 0x3099, 0x3076 },
+    { 0x3075, 0x309A, 0x3077 },
+    { 0x3078, 0x3099, 0x3079 },
+    { 0x3078, 0x309A, 0x307A },
+    { 0x307B, 0x3099, 0x307C },
+    { 0x307B, 0x309A, 0x307D },
+    { 0x309D, 0x3099, 0x309E },
+    { 0x30A6, 0x3099, 0x30F4 },
+    { 0x30AB, 0x3099, 0x30AC },
+    { 0x30AD, 0x3099, 0x30AE },
+    { 0x30AF, 0x3099, 0x30B0 },
+    { 0x30B1, 0x3099, 0x30B2 },
+    { 0x30B3, 0x3099, 0x30B4 },
+    { 0x30B5, 0x3099, 0x30B6 },
+    { 0x30B7, 0x3099, 0x30B8 },
+    { 0x30B9, 0x3099, 0x30BA },
+    { 0x30BB, 0x3099, 0x30BC },
+    { 0x30BD, 0x3099, 0x30BE },
+    { 0x30BF, 0x3099, 0x30C0 },
+    { 0x30C1, 0x3099, 0x30C2 },
+    { 0x30C4, 0x3099, 0x30C5 },
+    { 0x30C6, 0x3099, 0x30C7 },
+    { 0x30C8, 0x3099, 0x30C9 },
+    { 0x30CF, 0x3099, 0x30D0 },
+    { 0x30CF, 0x309A, 0x30D1 },
+    { 0x30D2, 0x3099, 0x30D3 },
+    { 0x30D2, 0x309A, 0x30D4 },
+    { 0x30D5, 0x3099, 0x30D6 },
+    { 0x30D5, 0x309A, 0x30D7 },
+    { 0x30D8, 0x3099, 0x30D9 },
+    { 0x30D8, 0x309A, 0x30DA },
+    { 0x30DB, 0x3099, 0x30DC },
+    { 0x30DB, 0x309A, 0x30DD },
+    { 0x30EF, 0x3099, 0x30F7 },
+    { 0x30F0, 0x3099, 0x30F8 },
+    { 0x30F1, 0x3099, 0x30F9 },
+    { 0x30F2, 0x3099, 0x30FA },
+    { 0x30FD, 0x3099, 0x30FE },
+    { 0x11099, 0x110BA, 0x1109A },
+    { 0x1109B, 0x110BA, 0x1109C },
+    { 0x110A5, 0x110BA, 0x110AB },
+    { 0x11131, 0x11127, 0x1112E },
+    { 0x11132, 0x11127, 0x1112F },
+    { 0x11347, 0x1133E, 0x1134B },
+    { 0x11347, 0x11357, 0x1134C },
+    { 0x114B9, 0x114B0, 0x114BC },
+    { 0x114B9, 0x114BA, 0x114BB },
+    { 0x114B9, 0x114BD, 0x114BE },
+    { 0x115B8, 0x115AF, 0x115BA },
+    { 0x115B9, 0x115AF, 0x115BB },
+    { 0x11935, 0x11930, 0x11938 },
+};
+
@@ -23,6 +23,8 @@
 #include "Clownfish/Class.h"
 #include "Clownfish/Vector.h"
 #include "Clownfish/Err.h"
+#include "Clownfish/Util/Audit.h"
+#include "Clownfish/Util/HashMix.h"
 #include "Clownfish/Util/Memory.h"
 #include "Clownfish/Util/SortUtils.h"
 
@@ -42,7 +44,7 @@ S_overflow_error(void);
 
 Vector*
 Vec_new(size_t capacity) {
-    Vector *self = (Vector*)Class_Make_Obj(VECTOR);
+    Vector *self = (Vector*)MAKE_OBJ(VECTOR);
     Vec_init(self, capacity);
     return self;
 }
@@ -279,6 +281,17 @@ Vec_Equals_IMP(Vector *self, Obj *other) {
     return true;
 }
 
+size_t
+Vec_Hash_Sum_IMP(Vector *self) {
+    uint64_t hash_sum = self->size;
+    for (size_t i = 0, max = self->size; i < max; i++) {
+        Obj *elem = self->elems[i];
+        uint64_t elem_sum = elem ? (uint64_t)Obj_Hash_Sum(elem) : 0;
+        hash_sum = HashMix_u64(hash_sum * 31 + elem_sum);
+    }
+    return (size_t)hash_sum;
+}
+
 Vector*
 Vec_Slice_IMP(Vector *self, size_t offset, size_t length) {
     // Adjust ranges if necessary.
@@ -43,7 +43,7 @@ var cfbindGO string
 var installedLibPath string
 
 func init() {
-	_, buildGO, _, _ = runtime.Caller(1)
+	_, buildGO, _, _ = runtime.Caller(0)
 	buildDir = path.Dir(buildGO)
 	configGO = path.Join(buildDir, "clownfish", "config.go")
 	cfbindGO = path.Join(buildDir, "clownfish", "cfbind.go")
@@ -65,6 +65,20 @@ GoCfish_RunRoutine(CFISH_Err_Attempt_t routine, void *context) {
 	routine(context);
 }
 
+// Marshal the content of many objects across the cgo boundary in one call.
+// The returned buffer must be freed with cfish_Memory_wrapped_free. Vector
+// elements must be Strings, while Hash keys of other types are exported as
+// the result of their To_String method.
+extern void*
+GoCfish_Export_Strings(cfish_Vector *vec, size_t *num_strings,
+                       size_t *data_size);
+extern void*
+GoCfish_Export_Hash(cfish_Hash *hash, size_t *num_entries,
+                    size_t *key_data_size);
+extern void*
+GoCfish_Export_Hash_Keys(cfish_Hash *hash, size_t *num_keys,
+                         size_t *data_size);
+
 */
 import "C"
 import "runtime"
@@ -168,9 +182,16 @@ func NewMethod(name string, callbackFunc unsafe.Pointer, offset uint32) Method {
 }
 
 func NewString(goString string) String {
-	str := C.CString(goString)
-	len := C.size_t(len(goString))
-	cfObj := C.cfish_Str_new_steal_utf8(str, len)
+	cfObj := goToString(goString, false)
+	return WRAPString(cfObj)
+}
+
+// Create a String from a Go string which is known to contain valid UTF-8.
+// Skips UTF-8 validation, so passing invalid UTF-8 results in undefined
+// behavior.
+func NewStringFromTrustedUTF8(goString string) String {
+	cfObj := C.cfish_Str_new_from_trusted_utf8(goStringData(goString),
+		C.size_t(len(goString)))
 	return WRAPString(unsafe.Pointer(cfObj))
 }
 
@@ -202,16 +223,16 @@ func NewHashIterator(hash Hash) HashIterator {
 	return WRAPHashIterator(unsafe.Pointer(cfObj))
 }
 
+// Keys returns the keys of the Hash. Keys which aren't Strings are
+// stringified, so the result may contain the same string more than once.
 func (h *HashIMP) Keys() []string {
 	self := (*C.cfish_Hash)(Unwrap(h, "h"))
-	keysCF := C.CFISH_Hash_Keys(self)
-	numKeys := C.CFISH_Vec_Get_Size(keysCF)
-	keys := make([]string, 0, int(numKeys))
-	for i := C.size_t(0); i < numKeys; i++ {
-		keys = append(keys, CFStringToGo(unsafe.Pointer(C.CFISH_Vec_Fetch(keysCF, i))))
-	}
-	C.cfish_decref(unsafe.Pointer(keysCF))
-	return keys
+	var numKeys, dataSize C.size_t
+	block := C.GoCfish_Export_Hash_Keys(self, &numKeys, &dataSize)
+	defer C.cfish_Memory_wrapped_free(block)
+	sizes := sizeTSlice(block, numKeys)
+	data := unsafe.Pointer(uintptr(block) + uintptr(numKeys)*unsafe.Sizeof(C.size_t(0)))
+	return splitExportedStrings(sizes, data, dataSize)
 }
 
 func (o *ObjIMP) INITOBJ(ptr unsafe.Pointer) {
@@ -329,9 +350,10 @@ func Unwrap(value Obj, name string) unsafe.Pointer {
 func goToString(value interface{}, nullable bool) unsafe.Pointer {
 	switch v := value.(type) {
 	case string:
-		size := len(v)
-		str := C.CString(v)
-		return unsafe.Pointer(C.cfish_Str_new_steal_utf8(str, C.size_t(size)))
+		// Copy straight out of Go memory rather than going through
+		// C.CString.
+		size := C.size_t(len(v))
+		return unsafe.Pointer(C.cfish_Str_new_from_utf8(goStringData(v), size))
 	case Obj:
 		certifyCF(v, C.CFISH_STRING, nullable)
 		return unsafe.Pointer(C.cfish_incref(unsafe.Pointer(v.TOPTR())))
@@ -340,6 +362,16 @@ func goToString(value interface{}, nullable bool) unsafe.Pointer {
 	panic(NewErr(mess))
 }
 
+// Return a pointer to the content of a Go string which may be passed to C
+// functions that copy it without retaining it.
+func goStringData(s string) *C.char {
+	if len(s) == 0 {
+		return nil
+	}
+	header := (*reflect.StringHeader)(unsafe.Pointer(&s))
+	return (*C.char)(unsafe.Pointer(header.Data))
+}
+
 func goToBlob(value interface{}, nullable bool) unsafe.Pointer {
 	switch v := value.(type) {
 	case []byte:
@@ -473,11 +505,9 @@ func goToHash(value interface{}, nullable bool) unsafe.Pointer {
 			hash := C.cfish_Hash_new(C.size_t(size))
 			for key, val := range v {
 				newVal := GoToClownfish(val, nil, true)
-				keySize := len(key)
-				keyStr := C.CString(key)
-				cfKey := C.cfish_Str_new_steal_utf8(keyStr, C.size_t(keySize))
-				defer C.cfish_dec_refcount(unsafe.Pointer(cfKey))
+				cfKey := (*C.cfish_String)(goToString(key, false))
 				C.CFISH_Hash_Store(hash, cfKey, (*C.cfish_Obj)(newVal))
+				C.cfish_dec_refcount(unsafe.Pointer(cfKey))
 			}
 			return unsafe.Pointer(hash)
 		}
@@ -580,6 +610,27 @@ func VectorToGo(ptr unsafe.Pointer) []interface{} {
 	return slice
 }
 
+// Convert a Vector of Strings to a slice of Go strings.  The content of all
+// Strings is marshaled in a single cgo call and copied into Go memory at
+// once; the returned strings share that memory.
+func VectorToGoStrings(ptr unsafe.Pointer) []string {
+	vec := (*C.cfish_Vector)(ptr)
+	if vec == nil {
+		return nil
+	}
+	class := C.cfish_Obj_get_class((*C.cfish_Obj)(ptr))
+	if class != C.CFISH_VECTOR {
+		mess := "Not a Vector: " + StringToGo(unsafe.Pointer(C.CFISH_Class_Get_Name(class)))
+		panic(NewErr(mess))
+	}
+	var numStrings, dataSize C.size_t
+	block := C.GoCfish_Export_Strings(vec, &numStrings, &dataSize)
+	defer C.cfish_Memory_wrapped_free(block)
+	sizes := sizeTSlice(block, numStrings)
+	data := unsafe.Pointer(uintptr(block) + uintptr(numStrings)*unsafe.Sizeof(C.size_t(0)))
+	return splitExportedStrings(sizes, data, dataSize)
+}
+
 func HashToGo(ptr unsafe.Pointer) map[string]interface{} {
 	hash := (*C.cfish_Hash)(ptr)
 	if hash == nil {
@@ -590,18 +641,50 @@ func HashToGo(ptr unsafe.Pointer) map[string]interface{} {
 		mess := "Not a Hash: " + StringToGo(unsafe.Pointer(C.CFISH_Class_Get_Name(class)))
 		panic(NewErr(mess))
 	}
-	size := C.CFISH_Hash_Get_Size(hash)
-	m := make(map[string]interface{}, int(size))
-	iter := C.cfish_HashIter_new(hash)
-	defer C.cfish_dec_refcount(unsafe.Pointer(iter))
-	for C.CFISH_HashIter_Next(iter) {
-		key := C.CFISH_HashIter_Get_Key(iter)
-		val := C.CFISH_HashIter_Get_Value(iter)
-		m[StringToGo(unsafe.Pointer(key))] = ToGo(unsafe.Pointer(val))
+	var numEntries, keyDataSize C.size_t
+	block := C.GoCfish_Export_Hash(hash, &numEntries, &keyDataSize)
+	defer C.cfish_Memory_wrapped_free(block)
+	if numEntries > C.size_t(maxInt) {
+		panic(fmt.Sprintf("Overflow: %d > %d", numEntries, maxInt))
+	}
+	n := int(numEntries)
+	values := (*[1 << 28]unsafe.Pointer)(block)[:n:n]
+	sizesPtr := unsafe.Pointer(uintptr(block) + uintptr(n)*unsafe.Sizeof(block))
+	sizes := sizeTSlice(sizesPtr, numEntries)
+	data := unsafe.Pointer(uintptr(sizesPtr) + uintptr(n)*unsafe.Sizeof(C.size_t(0)))
+	keys := splitExportedStrings(sizes, data, keyDataSize)
+	m := make(map[string]interface{}, n)
+	for i, key := range keys {
+		m[key] = ToGo(values[i])
 	}
 	return m
 }
 
+func sizeTSlice(ptr unsafe.Pointer, size C.size_t) []C.size_t {
+	if size > C.size_t(maxInt) {
+		panic(fmt.Sprintf("Overflow: %d > %d", size, maxInt))
+	}
+	n := int(size)
+	return (*[1 << 28]C.size_t)(ptr)[:n:n]
+}
+
+// Copy the concatenated string data produced by the GoCfish_Export_*
+// functions into Go memory with a single copy, then slice it up.
+func splitExportedStrings(sizes []C.size_t, data unsafe.Pointer, dataSize C.size_t) []string {
+	if dataSize > C.size_t(C.INT_MAX) {
+		panic(fmt.Sprintf("Overflow: %d > %d", dataSize, C.INT_MAX))
+	}
+	joined := C.GoStringN((*C.char)(data), C.int(dataSize))
+	strings := make([]string, len(sizes))
+	offset := 0
+	for i, size := range sizes {
+		end := offset + int(size)
+		strings[i] = joined[offset:end]
+		offset = end
+	}
+	return strings
+}
+
 func (e *ErrIMP) Error() string {
 	mess := C.CFISH_Err_Get_Mess((*C.cfish_Err)(unsafe.Pointer(e.ref)))
 	return StringToGo(unsafe.Pointer(mess))
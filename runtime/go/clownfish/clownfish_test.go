@@ -35,6 +35,14 @@ func TestStringToGo(t *testing.T) {
 	}
 }
 
+func TestTrustedStringToGo(t *testing.T) {
+	strings := []string{"foo", "", "z\u0000z", "\u263a"}
+	for _, val := range strings {
+		got := StringToGo(unsafe.Pointer(NewStringFromTrustedUTF8(val).TOPTR()))
+		deepCheck(t, got, val)
+	}
+}
+
 func TestBlobToGo(t *testing.T) {
 	strings := []string{"foo", "", "z\u0000z"}
 	for _, str := range strings {
@@ -91,6 +99,21 @@ func TestVectorToGo(t *testing.T) {
 	deepCheck(t, got, expected)
 }
 
+func TestVectorToGoStrings(t *testing.T) {
+	expected := []string{"foo", "", "z\u0000z", "\u263a"}
+	vec := NewVector(len(expected))
+	for _, str := range expected {
+		vec.Push(NewString(str))
+	}
+	got := VectorToGoStrings(unsafe.Pointer(vec.TOPTR()))
+	deepCheck(t, got, expected)
+
+	vec.Push(NewInteger(42))
+	defer func() { recover() }()
+	VectorToGoStrings(unsafe.Pointer(vec.TOPTR()))     // should panic
+	t.Error("Non-String element should trigger error") // should be unreachable
+}
+
 func TestHashToGo(t *testing.T) {
 	hash := NewHash(0)
 	hash.Store("str", NewString("foo"))
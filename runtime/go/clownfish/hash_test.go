@@ -19,6 +19,7 @@ package clownfish
 import "testing"
 import "reflect"
 import "sort"
+import "unsafe"
 
 func TestHashStoreFetch(t *testing.T) {
 	hash := NewHash(0)
@@ -80,6 +81,35 @@ func TestHashKeys(t *testing.T) {
 	}
 }
 
+func TestHashObjKeys(t *testing.T) {
+	hash := NewHash(0)
+	hash.Store("a", 1)
+	hash.StoreObj(int64(42), "foo")
+	keys := hash.Keys()
+	sort.Strings(keys)
+	expected := []string{"42", "a"}
+	if !reflect.DeepEqual(keys, expected) {
+		t.Errorf("Expected '%v', got '%v'", expected, keys)
+	}
+	converted := ToGo(unsafe.Pointer(hash.TOPTR())).(map[string]interface{})
+	if val, ok := converted["42"].(string); !ok || val != "foo" {
+		t.Errorf("Non-String key should be stringified, got '%v'", converted)
+	}
+}
+
+func TestHashCollidingObjKeys(t *testing.T) {
+	hash := NewHash(0)
+	hash.Store("42", "string")
+	hash.StoreObj(int64(42), "integer")
+	if size := hash.GetSize(); size != 2 {
+		t.Errorf("Expected 2 keys, got %d", size)
+	}
+	converted := ToGo(unsafe.Pointer(hash.TOPTR())).(map[string]interface{})
+	if len(converted) != 1 || converted["42"] != "integer" {
+		t.Errorf("Last colliding key should win, got '%v'", converted)
+	}
+}
+
 func TestHashValues(t *testing.T) {
 	hash := NewHash(0)
 	hash.Store("foo", "a")
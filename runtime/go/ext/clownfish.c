@@ -33,10 +33,13 @@
 #include "Clownfish/Class.h"
 #include "Clownfish/Err.h"
 #include "Clownfish/Hash.h"
+#include "Clownfish/HashIterator.h"
 #include "Clownfish/Method.h"
 #include "Clownfish/Num.h"
 #include "Clownfish/Obj.h"
 #include "Clownfish/String.h"
+#include "Clownfish/Util/Audit.h"
+#include "Clownfish/Util/Instrument.h"
 #include "Clownfish/Util/Memory.h"
 #include "Clownfish/Vector.h"
 
@@ -66,6 +69,12 @@ SI_is_string_type(cfish_Class *klass) {
     return false;
 }
 
+static CFISH_INLINE bool
+SI_is_interned_string(cfish_Obj *obj) {
+    return SI_is_string_type(obj->klass)
+           && CFISH_Str_Is_Interned((cfish_String*)obj);
+}
+
 uint32_t
 cfish_get_refcount(void *vself) {
     cfish_Obj *self = (cfish_Obj*)vself;
@@ -75,13 +84,17 @@ cfish_get_refcount(void *vself) {
 Obj*
 cfish_inc_refcount(void *vself) {
     Obj *self = (Obj*)vself;
+    if (!AUDIT_CHECK_REFCOUNT(self, "INCREF")) { return self; }
 
     // Handle special cases.
     cfish_Class *const klass = self->klass;
     if (klass->flags & CFISH_fREFCOUNTSPECIAL) {
         if (SI_is_string_type(klass)) {
-            // Only copy-on-incref Strings get special-cased.  Ordinary
-            // strings fall through to the general case.
+            // Only copy-on-incref and interned Strings get special-cased.
+            // Ordinary strings fall through to the general case.
+            if (CFISH_Str_Is_Interned((cfish_String*)self)) {
+                return self;
+            }
             if (CFISH_Str_Is_Copy_On_IncRef((cfish_String*)self)) {
                 const char *utf8 = CFISH_Str_Get_Ptr8((cfish_String*)self);
                 size_t size = CFISH_Str_Get_Size((cfish_String*)self);
@@ -100,9 +113,10 @@ cfish_inc_refcount(void *vself) {
 uint32_t
 cfish_dec_refcount(void *vself) {
     cfish_Obj *self = (Obj*)vself;
+    if (!AUDIT_CHECK_REFCOUNT(self, "DECREF")) { return 0; }
     cfish_Class *klass = self->klass;
     if (klass->flags & CFISH_fREFCOUNTSPECIAL) {
-        if (SI_immortal(klass)) {
+        if (SI_immortal(klass) || SI_is_interned_string(self)) {
             return self->refcount;
         }
     }
@@ -138,6 +152,22 @@ Class_Make_Obj_IMP(Class *self) {
     Obj *obj = (Obj*)Memory_wrapped_calloc(self->obj_alloc_size, 1);
     obj->klass = self;
     obj->refcount = 1;
+    INSTRUMENT_ALLOC(obj);
+    AUDIT_ALLOC(obj);
+    return obj;
+}
+
+Obj*
+Class_Make_Obj_Extra_IMP(Class *self, size_t extra) {
+    if (extra > SIZE_MAX - self->obj_alloc_size) {
+        THROW(ERR, "Object size overflow");
+    }
+    Obj *obj
+        = (Obj*)Memory_wrapped_calloc(self->obj_alloc_size + extra, 1);
+    obj->klass = self;
+    obj->refcount = 1;
+    INSTRUMENT_ALLOC(obj);
+    AUDIT_ALLOC(obj);
     return obj;
 }
 
@@ -147,6 +177,7 @@ Class_Init_Obj_IMP(Class *self, void *allocation) {
     Obj *obj = (Obj*)allocation;
     obj->klass = self;
     obj->refcount = 1;
+    AUDIT_INIT(obj);
     return obj;
 }
 
@@ -250,6 +281,122 @@ Err_trap(Err_Attempt_t routine, void *context) {
     return GoCfish_TrapErr(routine, context);
 }
 
+/****************************** Bulk export ********************************/
+
+void*
+GoCfish_Export_Strings(Vector *vec, size_t *num_strings, size_t *data_size) {
+    size_t size = Vec_Get_Size(vec);
+    size_t total = 0;
+    for (size_t i = 0; i < size; i++) {
+        Obj *elem = Vec_Fetch(vec, i);
+        if (!elem || !Obj_is_a(elem, STRING)) {
+            THROW(ERR, "Element %u64 of Vector is not a String", (uint64_t)i);
+        }
+        total += Str_Get_Size((String*)elem);
+    }
+
+    // Layout: `size` byte counts followed by the concatenated UTF-8 data.
+    char   *block = (char*)MALLOCATE(size * sizeof(size_t) + total + 1);
+    size_t *sizes = (size_t*)block;
+    char   *dest  = block + size * sizeof(size_t);
+    for (size_t i = 0; i < size; i++) {
+        String *string = (String*)Vec_Fetch(vec, i);
+        size_t  str_size = Str_Get_Size(string);
+        memcpy(dest, Str_Get_Ptr8(string), str_size);
+        sizes[i] = str_size;
+        dest += str_size;
+    }
+
+    *num_strings = size;
+    *data_size   = total;
+    return block;
+}
+
+// Host maps are keyed by strings, so keys which aren't Strings are
+// stringified with To_String. Returns an array of `size` new references
+// which must be freed with S_free_key_strings.
+static String**
+S_export_key_strings(Hash *hash, size_t size, size_t *total) {
+    String **keys = (String**)MALLOCATE(size * sizeof(String*) + 1);
+    size_t   tick = 0;
+    *total = 0;
+    HashIterator *iter = HashIter_new(hash);
+    while (HashIter_Next(iter)) {
+        Obj *key = HashIter_Get_Obj_Key(iter);
+        keys[tick] = Obj_is_a(key, STRING)
+                     ? (String*)INCREF(key)
+                     : Obj_To_String(key);
+        *total += Str_Get_Size(keys[tick]);
+        tick++;
+    }
+    DECREF(iter);
+    return keys;
+}
+
+static void
+S_free_key_strings(String **keys, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        DECREF(keys[i]);
+    }
+    FREEMEM(keys);
+}
+
+static char*
+S_copy_key_data(String **keys, size_t size, size_t *sizes, char *dest) {
+    for (size_t i = 0; i < size; i++) {
+        size_t key_size = Str_Get_Size(keys[i]);
+        memcpy(dest, Str_Get_Ptr8(keys[i]), key_size);
+        sizes[i] = key_size;
+        dest += key_size;
+    }
+    return dest;
+}
+
+void*
+GoCfish_Export_Hash(Hash *hash, size_t *num_entries, size_t *key_data_size) {
+    size_t   size  = Hash_Get_Size(hash);
+    size_t   total = 0;
+    String **keys  = S_export_key_strings(hash, size, &total);
+
+    // Layout: `size` value pointers, `size` key byte counts, then the
+    // concatenated UTF-8 data of the keys.
+    char   *block  = (char*)MALLOCATE(size * (sizeof(Obj*) + sizeof(size_t))
+                                      + total + 1);
+    Obj   **values = (Obj**)block;
+    size_t *sizes  = (size_t*)(block + size * sizeof(Obj*));
+    S_copy_key_data(keys, size, sizes, (char*)(sizes + size));
+    S_free_key_strings(keys, size);
+
+    size_t tick = 0;
+    HashIterator *iter = HashIter_new(hash);
+    while (HashIter_Next(iter)) {
+        values[tick] = HashIter_Get_Value(iter);
+        tick++;
+    }
+    DECREF(iter);
+
+    *num_entries   = size;
+    *key_data_size = total;
+    return block;
+}
+
+void*
+GoCfish_Export_Hash_Keys(Hash *hash, size_t *num_keys, size_t *data_size) {
+    size_t   size  = Hash_Get_Size(hash);
+    size_t   total = 0;
+    String **keys  = S_export_key_strings(hash, size, &total);
+
+    // Same layout as GoCfish_Export_Strings.
+    char   *block = (char*)MALLOCATE(size * sizeof(size_t) + total + 1);
+    size_t *sizes = (size_t*)block;
+    S_copy_key_data(keys, size, sizes, block + size * sizeof(size_t));
+    S_free_key_strings(keys, size);
+
+    *num_keys  = size;
+    *data_size = total;
+    return block;
+}
+
 /***************************** To_Host methods *****************************/
 
 void*
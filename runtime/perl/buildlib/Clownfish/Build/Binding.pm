@@ -54,6 +54,12 @@ CODE:
     RETVAL = CFISH_OBJ_TO_SV_NOINC(obj);
 }
 OUTPUT: RETVAL
+
+void
+intern_hash_keys(enable)
+    SV *enable;
+PPCODE:
+    XSBind_set_intern_hash_keys(XSBind_sv_true(aTHX_ enable));
 END_XS_CODE
 
     my $binding = Clownfish::CFC::Binding::Perl::Class->new(
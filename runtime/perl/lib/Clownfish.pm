@@ -26,7 +26,7 @@ our $MAJOR_VERSION = 0.005000;
 
 use Exporter 'import';
 BEGIN {
-    our @EXPORT_OK = qw( to_clownfish );
+    our @EXPORT_OK = qw( to_clownfish intern_hash_keys );
 }
 
 # On most UNIX variants, this flag makes DynaLoader pass RTLD_GLOBAL to
@@ -16,8 +16,8 @@
 use strict;
 use warnings;
 
-use Test::More tests => 14;
-use Clownfish qw( to_clownfish );
+use Test::More tests => 17;
+use Clownfish qw( to_clownfish intern_hash_keys );
 
 my $hash = Clownfish::Hash->new( capacity => 10 );
 $hash->store( "foo", Clownfish::String->new("bar") );
@@ -66,3 +66,18 @@ $roundtripped = $hash->to_perl;
 is_deeply( $roundtripped, $hashref,
            'to_perl handles deep circular references' );
 
+$hash = Clownfish::Hash->new;
+$hash->store_obj( Clownfish::Integer->new(42), "foo" );
+is_deeply( $hash->to_perl, { 42 => 'foo' },
+           'to_perl stringifies non-String keys' );
+$hash->store( '42', 'string' );
+$hash->store_obj( Clownfish::Integer->new(42), 'integer' );
+is_deeply( $hash->to_perl, { 42 => 'integer' },
+           'to_perl keeps the last of colliding stringified keys' );
+
+intern_hash_keys(1);
+my %plain = ( foo => 1, "\x{263a}" => [ 2 ] );
+is_deeply( to_clownfish( \%plain )->to_perl, \%plain,
+           'Round trip conversion with interned hash keys' );
+intern_hash_keys(0);
+
@@ -0,0 +1,103 @@
+# Licensed to the Apache Software Foundation (ASF) under one or more
+# contributor license agreements.  See the NOTICE file distributed with
+# this work for additional information regarding copyright ownership.
+# The ASF licenses this file to You under the Apache License, Version 2.0
+# (the "License"); you may not use this file except in compliance with
+# the License.  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+use strict;
+use warnings;
+
+use Test::More tests => 6;
+
+# Vector's sort() calls Compare_To from C, which dispatches to the Perl
+# overrides below.  The callbacks cache the sub they resolved, so these tests
+# check that the cache notices changes to the class hierarchy.
+
+package SortObj;
+use base qw( Clownfish::Obj );
+{
+    our %value;
+
+    sub new_with_value {
+        my ( $class, $value ) = @_;
+        my $self = $class->new;
+        $value{$$self} = $value;
+        return $self;
+    }
+
+    sub compare_to {
+        my ( $self, $other ) = @_;
+        return $value{$$self} <=> $value{$$other};
+    }
+}
+
+package SubSortObj;
+use base qw( SortObj );
+
+package ReverseSortObj;
+use base qw( SortObj );
+{
+    sub compare_to {
+        my ( $self, $other ) = @_;
+        return $SortObj::value{$$other} <=> $SortObj::value{$$self};
+    }
+}
+
+package main;
+use Clownfish;
+
+sub sorted_values {
+    my $class  = shift;
+    my $vector = Clownfish::Vector->new;
+    $vector->push( $class->new_with_value($_) ) for ( 3, 1, 4, 1, 5, 9, 2 );
+    $vector->sort;
+    return [ map { $SortObj::value{ ${ $vector->fetch($_) } } }
+             0 .. $vector->get_size - 1 ];
+}
+
+my @ascending  = ( 1, 1, 2, 3, 4, 5, 9 );
+my @descending = reverse @ascending;
+
+is_deeply( sorted_values('SortObj'), \@ascending, "override called from C" );
+is_deeply( sorted_values('SubSortObj'), \@ascending,
+    "inherited override called from C" );
+
+{
+    no warnings 'redefine';
+    *SortObj::compare_to = sub {
+        my ( $self, $other ) = @_;
+        return $SortObj::value{$$other} <=> $SortObj::value{$$self};
+    };
+}
+is_deeply( sorted_values('SortObj'), \@descending,
+    "redefined sub is called" );
+is_deeply( sorted_values('SubSortObj'), \@descending,
+    "redefined sub in parent class is called" );
+
+{
+    no warnings 'redefine';
+    eval q{
+        package SortObj;
+        sub compare_to {
+            my ( $self, $other ) = @_;
+            return $SortObj::value{$$self} <=> $SortObj::value{$$other};
+        }
+    };
+    die $@ if $@;
+}
+is_deeply( sorted_values('SubSortObj'), \@ascending,
+    "sub redefined with string eval is called" );
+
+@SubSortObj::ISA = qw( ReverseSortObj );
+is_deeply( sorted_values('SubSortObj'), \@descending,
+    "change of \@ISA is picked up" );
+
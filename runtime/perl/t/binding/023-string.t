@@ -17,7 +17,7 @@ use strict;
 use warnings;
 use lib 'buildlib';
 
-use Test::More tests => 6;
+use Test::More tests => 11;
 use Encode qw( _utf8_off );
 use Clownfish;
 
@@ -51,6 +51,23 @@ while (my $cp = $iter->next) {
 }
 is( $buf, $wanted, 'iter next' );
 
+$string = Clownfish::String->new("a,b,,$smiley");
+is_deeply( $string->split(','), [ 'a', 'b', '', $smiley ], 'split' );
+is_deeply( $string->split_char( ord($smiley) ), [ 'a,b,,', '' ],
+    'split_char' );
+eval { $string->split_char(0xD800) };
+like( $@, qr/Invalid code point/, 'split_char rejects surrogates' );
+
+$string = Clownfish::String->new(" foo	bar ");
+is_deeply( $string->split_whitespace, [ 'foo', 'bar' ], 'split_whitespace' );
+
+my $tokenizer = Clownfish::StringTokenizer->new( string => $string );
+my @tokens;
+while ( defined( my $token = $tokenizer->next ) ) {
+    push @tokens, $token;
+}
+is_deeply( \@tokens, [ 'foo', 'bar' ], 'StringTokenizer' );
+
 {
     package MyStringCallbackTest;
     use base qw(Clownfish::Test::StringCallbackTest);
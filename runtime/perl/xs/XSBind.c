@@ -33,12 +33,17 @@
 #include "Clownfish/PtrHash.h"
 #include "Clownfish/TestHarness/TestUtils.h"
 #include "Clownfish/Util/Atomic.h"
+#include "Clownfish/Util/Audit.h"
+#include "Clownfish/Util/Instrument.h"
 #include "Clownfish/Util/StringHelper.h"
 #include "Clownfish/Util/Memory.h"
 
 #define XSBIND_REFCOUNT_FLAG   1
 #define XSBIND_REFCOUNT_SHIFT  1
 
+// Whether hash keys are interned when converting Perl hashes.
+static bool XSBind_intern_hash_keys = false;
+
 // Used to remember converted objects in array and hash conversion to
 // handle circular references. The root object and SV are stored separately
 // to allow lazy creation of the seen PtrHash.
@@ -312,7 +317,14 @@ S_perl_hash_to_cfish_hash(pTHX_ HV *phash, cfish_ConversionCache *cache) {
             THROW(CFISH_ERR, "Can't convert to Clownfish::Obj");
         }
 
-        CFISH_Hash_Store_Utf8(retval, key_str, key_len, value);
+        if (XSBind_intern_hash_keys) {
+            cfish_String *key = cfish_Str_intern_trusted_utf8(key_str, key_len);
+            CFISH_Hash_Store(retval, key, value);
+            CFISH_DECREF(key);
+        }
+        else {
+            CFISH_Hash_Store_Utf8(retval, key_str, key_len, value);
+        }
     }
 
     if (cache == &new_cache && cache->seen) {
@@ -322,6 +334,11 @@ S_perl_hash_to_cfish_hash(pTHX_ HV *phash, cfish_ConversionCache *cache) {
     return retval;
 }
 
+void
+XSBind_set_intern_hash_keys(bool intern) {
+    XSBind_intern_hash_keys = intern;
+}
+
 static cfish_Vector*
 S_perl_array_to_cfish_array(pTHX_ AV *parray, cfish_ConversionCache *cache) {
     cfish_ConversionCache new_cache;
@@ -548,6 +565,12 @@ SI_is_string_type(cfish_Class *klass) {
     return false;
 }
 
+static CFISH_INLINE bool
+SI_is_interned_string(cfish_Obj *obj) {
+    return SI_is_string_type(obj->klass)
+           && CFISH_Str_Is_Interned((cfish_String*)obj);
+}
+
 // Returns a blessed RV.
 static SV*
 S_lazy_init_host_obj(pTHX_ cfish_Obj *self, bool increment) {
@@ -567,7 +590,7 @@ S_lazy_init_host_obj(pTHX_ cfish_Obj *self, bool increment) {
     SvREFCNT(inner_obj) += excess;
 
     // Overwrite refcount with host object.
-    if (SI_immortal(klass)) {
+    if (SI_immortal(klass) || SI_is_interned_string(self)) {
         SvSHARE(inner_obj);
         if (!cfish_Atomic_cas_ptr((void**)&self->ref, old_ref.host_obj,
                                   inner_obj)) {
@@ -606,13 +629,17 @@ cfish_get_refcount(void *vself) {
 cfish_Obj*
 cfish_inc_refcount(void *vself) {
     cfish_Obj *self = (cfish_Obj*)vself;
+    if (!CFISH_AUDIT_CHECK_REFCOUNT(self, "INCREF")) { return self; }
 
     // Handle special cases.
     cfish_Class *const klass = self->klass;
     if (klass->flags & CFISH_fREFCOUNTSPECIAL) {
         if (SI_is_string_type(klass)) {
-            // Only copy-on-incref Strings get special-cased.  Ordinary
-            // Strings fall through to the general case.
+            // Only copy-on-incref and interned Strings get special-cased.
+            // Ordinary Strings fall through to the general case.
+            if (CFISH_Str_Is_Interned((cfish_String*)self)) {
+                return self;
+            }
             if (CFISH_Str_Is_Copy_On_IncRef((cfish_String*)self)) {
                 const char *utf8 = CFISH_Str_Get_Ptr8((cfish_String*)self);
                 size_t size = CFISH_Str_Get_Size((cfish_String*)self);
@@ -639,10 +666,11 @@ cfish_inc_refcount(void *vself) {
 uint32_t
 cfish_dec_refcount(void *vself) {
     cfish_Obj *self = (cfish_Obj*)vself;
+    if (!CFISH_AUDIT_CHECK_REFCOUNT(self, "DECREF")) { return 0; }
 
     cfish_Class *klass = self->klass;
     if (klass->flags & CFISH_fREFCOUNTSPECIAL) {
-        if (SI_immortal(klass)) {
+        if (SI_immortal(klass) || SI_is_interned_string(self)) {
             return 1;
         }
     }
@@ -733,6 +761,23 @@ CFISH_Class_Make_Obj_IMP(cfish_Class *self) {
         = (cfish_Obj*)cfish_Memory_wrapped_calloc(self->obj_alloc_size, 1);
     obj->klass = self;
     obj->ref.count = (1 << XSBIND_REFCOUNT_SHIFT) | XSBIND_REFCOUNT_FLAG;
+    CFISH_INSTRUMENT_ALLOC(obj);
+    CFISH_AUDIT_ALLOC(obj);
+    return obj;
+}
+
+cfish_Obj*
+CFISH_Class_Make_Obj_Extra_IMP(cfish_Class *self, size_t extra) {
+    if (extra > SIZE_MAX - self->obj_alloc_size) {
+        CFISH_THROW(CFISH_ERR, "Object size overflow");
+    }
+    cfish_Obj *obj
+        = (cfish_Obj*)cfish_Memory_wrapped_calloc(self->obj_alloc_size + extra,
+                                                  1);
+    obj->klass = self;
+    obj->ref.count = (1 << XSBIND_REFCOUNT_SHIFT) | XSBIND_REFCOUNT_FLAG;
+    CFISH_INSTRUMENT_ALLOC(obj);
+    CFISH_AUDIT_ALLOC(obj);
     return obj;
 }
 
@@ -742,6 +787,7 @@ CFISH_Class_Init_Obj_IMP(cfish_Class *self, void *allocation) {
     cfish_Obj *obj = (cfish_Obj*)allocation;
     obj->klass = self;
     obj->ref.count = (1 << XSBIND_REFCOUNT_SHIFT) | XSBIND_REFCOUNT_FLAG;
+    CFISH_AUDIT_INIT(obj);
     return obj;
 }
 
@@ -1093,7 +1139,11 @@ CFISH_Hash_To_Host_IMP(cfish_Hash *self, void *vcache) {
 
     // Iterate over key-value pairs.
     while (CFISH_HashIter_Next(iter)) {
-        cfish_String *key      = CFISH_HashIter_Get_Key(iter);
+        // Perl hash keys are strings, so other keys are stringified.
+        cfish_Obj    *obj_key  = CFISH_HashIter_Get_Obj_Key(iter);
+        cfish_String *key      = cfish_Obj_is_a(obj_key, CFISH_STRING)
+                                 ? (cfish_String*)CFISH_INCREF(obj_key)
+                                 : CFISH_Obj_To_String(obj_key);
         const char   *key_ptr  = CFISH_Str_Get_Ptr8(key);
         I32           key_size = CFISH_Str_Get_Size(key);
 
@@ -1106,6 +1156,7 @@ CFISH_Hash_To_Host_IMP(cfish_Hash *self, void *vcache) {
         // Using a negative `klen` argument to signal UTF-8 is undocumented
         // in older Perl versions but works since 5.8.0.
         hv_store(perl_hash, key_ptr, -key_size, val_sv, 0);
+        CFISH_DECREF(key);
     }
 
     if (cache == &new_cache && cache->seen) {
@@ -145,6 +145,15 @@ cfish_XSBind_perl_to_cfish_noinc(pTHX_ SV *sv, cfish_Class *klass,
 CFISH_VISIBLE const char*
 cfish_XSBind_hash_key_to_utf8(pTHX_ HE *entry, STRLEN *size_ptr);
 
+/** Enable or disable interning of hash keys when converting Perl hashes to
+ * Clownfish Hashes.  See Clownfish::String#intern.  Disabled by default.
+ * Interned keys are never freed and only the first
+ * Clownfish::String#set_intern_capacity distinct keys are interned, so
+ * this is meant for hashes with a small, recurring set of keys.
+ */
+CFISH_VISIBLE void
+cfish_XSBind_set_intern_hash_keys(bool intern);
+
 /** Perl-specific wrapper for Err#trap.  The "routine" must be either a
  * subroutine reference or the name of a subroutine.
  */
@@ -224,6 +233,7 @@ cfish_XSBind_undef_arg_error(pTHX_ const char *label);
 #define XSBind_perl_to_cfish_nullable  cfish_XSBind_perl_to_cfish_nullable
 #define XSBind_perl_to_cfish_noinc     cfish_XSBind_perl_to_cfish_noinc
 #define XSBind_hash_key_to_utf8        cfish_XSBind_hash_key_to_utf8
+#define XSBind_set_intern_hash_keys    cfish_XSBind_set_intern_hash_keys
 #define XSBind_trap                    cfish_XSBind_trap
 #define XSBind_locate_args             cfish_XSBind_locate_args
 #define XSBind_arg_to_cfish            cfish_XSBind_arg_to_cfish
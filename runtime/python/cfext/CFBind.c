@@ -37,12 +37,26 @@
 #include "Clownfish/String.h"
 #include "Clownfish/TestHarness/TestUtils.h"
 #include "Clownfish/Util/Atomic.h"
+#include "Clownfish/Util/Audit.h"
+#include "Clownfish/Util/Instrument.h"
 #include "Clownfish/Util/Memory.h"
 #include "Clownfish/Util/StringHelper.h"
+#include "Clownfish/Util/ThreadLocal.h"
+
+#ifndef CFISH_HAS_THREAD_LOCAL
+  #error "The Python binding requires thread-local storage"
+#endif
+
+#ifdef CHY_HAS_PTHREAD_H
+  #include <pthread.h>
+#endif
 #include "Clownfish/Vector.h"
 
 static bool Err_initialized;
 
+// Whether dict keys are interned when converting Python dicts.
+static bool CFBind_intern_hash_keys = false;
+
 static PyTypeObject*
 S_get_cached_py_type(cfish_Class *klass);
 
@@ -98,6 +112,11 @@ S_py_list_to_vector(PyObject *list) {
     return vec;
 }
 
+void
+CFBind_set_intern_hash_keys(bool intern) {
+    CFBind_intern_hash_keys = intern;
+}
+
 static cfish_Hash*
 S_py_dict_to_hash(PyObject *dict) {
     Py_ssize_t pos = 0;
@@ -116,7 +135,16 @@ S_py_dict_to_hash(PyObject *dict) {
                 = CFISH_MAKE_MESS("Failed to stringify as UTF-8");
             CFBind_reraise_pyerr(CFISH_ERR, mess);
         }
-        CFISH_Hash_Store_Utf8(hash, ptr, size, CFBind_py_to_cfish(value, NULL));
+        cfish_Obj *converted = CFBind_py_to_cfish(value, NULL);
+        if (CFBind_intern_hash_keys) {
+            cfish_String *interned
+                = cfish_Str_intern_trusted_utf8(ptr, (size_t)size);
+            CFISH_Hash_Store(hash, interned, converted);
+            CFISH_DECREF(interned);
+        }
+        else {
+            CFISH_Hash_Store_Utf8(hash, ptr, size, converted);
+        }
         if (stringified != key) {
             Py_DECREF(stringified);
         }
@@ -829,6 +857,42 @@ CFBind_assoc_py_types(cfish_Class ***klass_handles, PyTypeObject **py_types,
     }
 }
 
+/**** GIL ******************************************************************/
+
+/* Set while the current thread runs without holding the GIL, that is within
+ * a `nogil` method or on a thread started by Clownfish.  Only code running
+ * in these places has to acquire the GIL before calling into Python.
+ */
+static CFISH_THREAD_LOCAL int S_lacks_gil;
+
+int
+CFBind_enter_nogil(void) {
+    int prev_lacks_gil = S_lacks_gil;
+    S_lacks_gil = true;
+    return prev_lacks_gil;
+}
+
+void
+CFBind_leave_nogil(int prev_lacks_gil) {
+    S_lacks_gil = prev_lacks_gil;
+}
+
+int
+CFBind_ensure_gil(PyGILState_STATE *state) {
+    if (!S_lacks_gil) { return false; }
+    *state = PyGILState_Ensure();
+    S_lacks_gil = false;
+    return true;
+}
+
+void
+CFBind_release_gil(PyGILState_STATE state, int acquired) {
+    if (acquired) {
+        S_lacks_gil = true;
+        PyGILState_Release(state);
+    }
+}
+
 /**** refcounting **********************************************************/
 
 uint32_t
@@ -838,14 +902,28 @@ cfish_get_refcount(void *vself) {
 
 cfish_Obj*
 cfish_inc_refcount(void *vself) {
+    if (!CFISH_AUDIT_CHECK_REFCOUNT(vself, "INCREF")) {
+        return (cfish_Obj*)vself;
+    }
     Py_INCREF(vself);
     return (cfish_Obj*)vself;
 }
 
 uint32_t
 cfish_dec_refcount(void *vself) {
+    if (!CFISH_AUDIT_CHECK_REFCOUNT(vself, "DECREF")) { return 0; }
     uint32_t modified_refcount = Py_REFCNT(vself);
-    Py_DECREF(vself);
+    if (modified_refcount == 1 && S_lacks_gil) {
+        // The object is about to be deallocated, which requires the GIL.
+        // Objects private to a `nogil` method may be destroyed without it.
+        PyGILState_STATE gil;
+        int acquired = CFBind_ensure_gil(&gil);
+        Py_DECREF(vself);
+        CFBind_release_gil(gil, acquired);
+    }
+    else {
+        Py_DECREF(vself);
+    }
     return modified_refcount;
 }
 
@@ -933,8 +1011,45 @@ S_get_cached_py_type(cfish_Class *self) {
 cfish_Obj*
 CFISH_Class_Make_Obj_IMP(cfish_Class *self) {
     PyTypeObject *py_type = S_get_cached_py_type(self);
+    // Objects may be created by `nogil` methods, e.g. when throwing an
+    // error, so make sure we hold the GIL while calling into Python's
+    // allocator.
+    PyGILState_STATE gil;
+    int acquired = CFBind_ensure_gil(&gil);
     cfish_Obj *obj = (cfish_Obj*)py_type->tp_alloc(py_type, 0);
+    CFBind_release_gil(gil, acquired);
     obj->klass = self;
+    CFISH_INSTRUMENT_ALLOC(obj);
+    CFISH_AUDIT_ALLOC(obj);
+    return obj;
+}
+
+cfish_Obj*
+CFISH_Class_Make_Obj_Extra_IMP(cfish_Class *self, size_t extra) {
+    PyTypeObject *py_type = S_get_cached_py_type(self);
+    size_t basic_size = (size_t)py_type->tp_basicsize;
+    if (extra > SIZE_MAX - basic_size) {
+        CFISH_THROW(CFISH_ERR, "Object size overflow");
+    }
+    // Clownfish types don't support cyclic GC, so tp_alloc allocates them
+    // with PyObject_Malloc and tp_free releases them with PyObject_Free.
+    // Allocate the trailing bytes the same way, because tp_alloc can't add
+    // them to a type without items.
+    size_t size = basic_size + extra;
+    PyGILState_STATE gil;
+    int acquired = CFBind_ensure_gil(&gil);
+    cfish_Obj *obj = (cfish_Obj*)PyObject_Malloc(size);
+    if (obj != NULL) {
+        memset(obj, 0, size);
+        PyObject_Init((PyObject*)obj, py_type);
+    }
+    CFBind_release_gil(gil, acquired);
+    if (obj == NULL) {
+        CFISH_THROW(CFISH_ERR, "Out of memory");
+    }
+    obj->klass = self;
+    CFISH_INSTRUMENT_ALLOC(obj);
+    CFISH_AUDIT_ALLOC(obj);
     return obj;
 }
 
@@ -949,10 +1064,12 @@ CFISH_Class_Init_Obj_IMP(cfish_Class *self, void *allocation) {
     // Class_Init_Obj() may be called on non-heap memory, such as
     // stack-allocated Clownfish Strings.  Therefore, we must perform a subset
     // of tasks selected from PyObject_Init() manually.
+    memset(allocation, 0, self->obj_alloc_size);
     cfish_Obj *obj = (cfish_Obj*)allocation;
     obj->ob_base.ob_refcnt = 1;
     obj->ob_base.ob_type = py_type;
     obj->klass = self;
+    CFISH_AUDIT_INIT(obj);
     return obj;
 }
 
@@ -989,23 +1106,56 @@ CFISH_Method_Host_Name_IMP(cfish_Method *self) {
 
 /**** Err ******************************************************************/
 
-/* TODO: Thread safety? */
-static cfish_Err *current_error;
-static cfish_Err *thrown_error;
-static jmp_buf  *current_env;
+/* Error state is kept per thread because `nogil` methods may throw while
+ * other threads run Python code.  The context itself lives in thread-local
+ * storage.  The error stored with Err_set_error is also attached to a
+ * pthread key, so that it's released when the thread exits.  Without
+ * pthreads, the last error of an exiting thread is kept alive.
+ */
+typedef struct {
+    cfish_Err *current_error;
+    cfish_Err *thrown_error;
+    jmp_buf   *current_env;
+} ErrContext;
+
+static CFISH_THREAD_LOCAL ErrContext err_context;
+
+#ifdef CHY_HAS_PTHREAD_H
+static pthread_key_t current_error_key;
+
+static void
+S_destroy_current_error(void *error) {
+    // Exiting threads don't hold the GIL.
+    if (Py_IsInitialized()) {
+        PyGILState_STATE gil = PyGILState_Ensure();
+        int prev_lacks_gil = S_lacks_gil;
+        S_lacks_gil = false;
+        CFISH_DECREF(error);
+        S_lacks_gil = prev_lacks_gil;
+        PyGILState_Release(gil);
+    }
+}
+#endif
+
+static ErrContext*
+S_get_err_context(void) {
+    return &err_context;
+}
 
 jmp_buf*
 CFBind_swap_env(jmp_buf *env) {
-    jmp_buf *prev_env = current_env;
-    current_env = env;
+    ErrContext *context = S_get_err_context();
+    jmp_buf *prev_env = context->current_env;
+    context->current_env = env;
     return prev_env;
 }
 
 int
 CFBind_migrate_cferr() {
-    if (thrown_error != NULL) {
-        cfish_Err *err = thrown_error;
-        thrown_error = NULL;
+    ErrContext *context = S_get_err_context();
+    if (context->thrown_error != NULL) {
+        cfish_Err *err = context->thrown_error;
+        context->thrown_error = NULL;
         cfish_String *mess = CFISH_Err_Get_Mess(err);
         char *utf8 = CFISH_Str_To_Utf8(mess);
         PyErr_SetString(PyExc_RuntimeError, utf8);
@@ -1016,29 +1166,56 @@ CFBind_migrate_cferr() {
     return false;
 }
 
+void
+CFBind_rethrow_cferr() {
+    ErrContext *context = S_get_err_context();
+    if (context->thrown_error != NULL) {
+        cfish_Err *err = context->thrown_error;
+        context->thrown_error = NULL;
+        cfish_Err_do_throw(err);
+    }
+}
+
 void
 cfish_Err_init_class(void) {
+#ifdef CHY_HAS_PTHREAD_H
+    int error = pthread_key_create(&current_error_key,
+                                   S_destroy_current_error);
+    if (error) {
+        fprintf(stderr, "pthread_key_create failed: %d\n", error);
+        exit(1);
+    }
+#endif
     Err_initialized = true;
 }
 
 cfish_Err*
 cfish_Err_get_error() {
-    return current_error;
+    return S_get_err_context()->current_error;
 }
 
 void
 cfish_Err_set_error(cfish_Err *error) {
-    if (current_error) {
-        CFISH_DECREF(current_error);
+    ErrContext *context = S_get_err_context();
+    if (context->current_error) {
+        CFISH_DECREF(context->current_error);
+    }
+    context->current_error = error;
+#ifdef CHY_HAS_PTHREAD_H
+    int pthread_error = pthread_setspecific(current_error_key, error);
+    if (pthread_error) {
+        fprintf(stderr, "pthread_setspecific failed: %d\n", pthread_error);
+        exit(1);
     }
-    current_error = error;
+#endif
 }
 
 void
 cfish_Err_do_throw(cfish_Err *error) {
-    if (current_env) {
-        thrown_error = error;
-        longjmp(*current_env, 1);
+    ErrContext *context = S_get_err_context();
+    if (context->current_env) {
+        context->thrown_error = error;
+        longjmp(*context->current_env, 1);
     }
     else {
         cfish_String *message = CFISH_Err_Get_Mess(error);
@@ -1066,39 +1243,42 @@ cfish_Err_warn_mess(cfish_String *message) {
 
 cfish_Err*
 cfish_Err_trap(CFISH_Err_Attempt_t routine, void *context) {
+    ErrContext *err_context = S_get_err_context();
     jmp_buf  env;
-    jmp_buf *prev_env = current_env;
-    current_env = &env;
+    jmp_buf *prev_env = err_context->current_env;
+    err_context->current_env = &env;
 
     if (!setjmp(env)) {
         routine(context);
     }
 
-    current_env = prev_env;
+    err_context->current_env = prev_env;
 
-    cfish_Err *error = thrown_error;
-    thrown_error = NULL;
+    cfish_Err *error = err_context->thrown_error;
+    err_context->thrown_error = NULL;
     return error;
 }
 
 /**** TestUtils ************************************************************/
 
+/* All threads share a single interpreter. Threads started by Clownfish
+ * don't hold the GIL, so they acquire it before calling into Python.
+ */
+
 void*
 cfish_TestUtils_clone_host_runtime() {
-    CFISH_THROW(CFISH_ERR, "TODO");
-    CFISH_UNREACHABLE_RETURN(void*);
+    return NULL;
 }
 
 void
 cfish_TestUtils_set_host_runtime(void *runtime) {
     CFISH_UNUSED_VAR(runtime);
-    CFISH_THROW(CFISH_ERR, "TODO");
+    S_lacks_gil = true;
 }
 
 void
 cfish_TestUtils_destroy_host_runtime(void *runtime) {
     CFISH_UNUSED_VAR(runtime);
-    CFISH_THROW(CFISH_ERR, "TODO");
 }
 
 /**** To_Host methods ******************************************************/
@@ -1151,14 +1331,16 @@ CFISH_Hash_To_Host_IMP(cfish_Hash *self, void *vcache) {
     // Iterate over key-value pairs.
     cfish_HashIterator *iter = cfish_HashIter_new(self);
     while (CFISH_HashIter_Next(iter)) {
-        cfish_String *key = (cfish_String*)CFISH_HashIter_Get_Key(iter);
-        if (!cfish_Obj_is_a((cfish_Obj*)key, CFISH_STRING)) {
-            CFISH_THROW(CFISH_ERR, "Non-string key: %o",
-                        cfish_Obj_get_class_name((cfish_Obj*)key));
-        }
+        // Keys which aren't Strings are stringified, like on the other
+        // hosts.
+        cfish_Obj *obj_key = CFISH_HashIter_Get_Obj_Key(iter);
+        cfish_String *key = cfish_Obj_is_a(obj_key, CFISH_STRING)
+                            ? (cfish_String*)CFISH_INCREF(obj_key)
+                            : CFISH_Obj_To_String(obj_key);
         size_t size = CFISH_Str_Get_Size(key);
         const char *ptr = CFISH_Str_Get_Ptr8(key);
         PyObject *py_key = PyUnicode_FromStringAndSize(ptr, size);
+        CFISH_DECREF(key);
         PyObject *py_val = CFBind_cfish_to_py(CFISH_HashIter_Get_Value(iter));
         PyDict_SetItem(dict, py_key, py_val);
         Py_DECREF(py_key);
@@ -50,6 +50,39 @@ CFBind_swap_env(jmp_buf *env);
 int
 CFBind_migrate_cferr(void);
 
+/** If a Clownfish error was trapped by CFBIND_TRY, throw it again (internal
+  * use only).  Callbacks use this to propagate errors after giving up the
+  * GIL.
+  */
+void
+CFBind_rethrow_cferr(void);
+
+/** Mark the current thread as running without the GIL and return the
+  * previous state (internal use only).  Wrappers of `nogil` methods call this
+  * after releasing the GIL.
+  */
+int
+CFBind_enter_nogil(void);
+
+/** Restore the state returned by CFBind_enter_nogil before reacquiring the
+  * GIL (internal use only).
+  */
+void
+CFBind_leave_nogil(int prev_lacks_gil);
+
+/** Acquire the GIL if the current thread runs without it and return true
+  * (internal use only).  Threads which are known to hold the GIL return
+  * false without touching `state`.
+  */
+int
+CFBind_ensure_gil(PyGILState_STATE *state);
+
+/** Release the GIL if it was acquired by CFBind_ensure_gil (internal use
+  * only).
+  */
+void
+CFBind_release_gil(PyGILState_STATE state, int acquired);
+
 /** Null-safe invocation of Obj_To_Host.
   */
 static CFISH_INLINE PyObject*
@@ -96,6 +129,15 @@ CFBind_cfish_to_py_zeroref(struct cfish_Obj *obj) {
 cfish_Obj*
 CFBind_py_to_cfish(PyObject *py_obj, cfish_Class *klass);
 
+/** Enable or disable interning of dict keys when converting Python dicts to
+  * Clownfish Hashes.  See Clownfish::String#intern.  Disabled by default.
+  * Interned keys are never freed and only the first
+  * Clownfish::String#set_intern_capacity distinct keys are interned, so
+  * this is meant for dicts with a small, recurring set of keys.
+  */
+void
+CFBind_set_intern_hash_keys(bool intern);
+
 /** As CFBind_py_to_cfish above, but returns NULL if the PyObject is None
   * or NULL.
   */
@@ -55,6 +55,22 @@ class TestHash(unittest.TestCase):
         keys = sorted(h.keys())
         self.assertEqual(keys, ["a", "b"])
 
+    def testObjKeysToPy(self):
+        inner = clownfish.Hash()
+        inner.store_obj(42, "foo")
+        outer = clownfish.Hash()
+        outer.store("inner", inner)
+        self.assertEqual(outer.fetch("inner"), {"42": "foo"})
+
+    def testCollidingObjKeysToPy(self):
+        inner = clownfish.Hash()
+        inner.store("42", "string")
+        inner.store_obj(42, "integer")
+        self.assertEqual(inner.get_size(), 2)
+        outer = clownfish.Hash()
+        outer.store("inner", inner)
+        self.assertEqual(outer.fetch("inner"), {"42": "integer"})
+
     def testValues(self):
         h = clownfish.Hash()
         h.store("foo", "a")
@@ -0,0 +1,81 @@
+# Licensed to the Apache Software Foundation (ASF) under one or more
+# contributor license agreements.  See the NOTICE file distributed with
+# this work for additional information regarding copyright ownership.
+# The ASF licenses this file to You under the Apache License, Version 2.0
+# (the "License"); you may not use this file except in compliance with
+# the License.  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import random
+import threading
+import unittest
+import clownfish
+
+# Vector.sort() is declared `nogil`, so the wrapper releases the GIL while
+# it runs.  Compare_To callbacks into Python must reacquire it, even when the
+# sort runs on a thread other than the main thread.
+
+def _can_override():
+    try:
+        class Probe(clownfish.Obj):
+            def to_string(self):
+                return "probe"
+        return True
+    except TypeError:
+        return False
+
+@unittest.skipUnless(_can_override(),
+                     "Clownfish classes can't be subclassed from Python yet")
+class TestNogilCallback(unittest.TestCase):
+
+    def testCallbackFromOtherThreads(self):
+        callers = set()
+        lock = threading.Lock()
+
+        class SortObj(clownfish.Obj):
+            def compare_to(self, other):
+                with lock:
+                    callers.add(threading.get_ident())
+                return (self.value > other.value) - (self.value < other.value)
+
+        num_threads = 4
+        values  = [[random.randrange(1000) for _ in range(500)]
+                   for _ in range(num_threads)]
+        results = [None] * num_threads
+        errors  = []
+
+        def sort_values(tid):
+            try:
+                vector = clownfish.Vector()
+                for value in values[tid]:
+                    obj = SortObj()
+                    obj.value = value
+                    vector.push(obj)
+                vector.sort()
+                results[tid] = [vector.fetch(i).value
+                                for i in range(vector.get_size())]
+            except Exception as e:
+                errors.append(e)
+
+        threads = [threading.Thread(target=sort_values, args=(tid,))
+                   for tid in range(num_threads)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        self.assertEqual(errors, [])
+        for tid in range(num_threads):
+            self.assertEqual(results[tid], sorted(values[tid]))
+        self.assertEqual(callers, set(thread.ident for thread in threads))
+        self.assertNotIn(threading.get_ident(), callers)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,95 @@
+# Licensed to the Apache Software Foundation (ASF) under one or more
+# contributor license agreements.  See the NOTICE file distributed with
+# this work for additional information regarding copyright ownership.
+# The ASF licenses this file to You under the Apache License, Version 2.0
+# (the "License"); you may not use this file except in compliance with
+# the License.  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import unittest
+import clownfish
+
+# Vector.sort() calls Compare_To from C, which dispatches to the Python
+# overrides below.  The callbacks cache the attribute they resolved, so these
+# tests check that the cache notices changes to types and instances.
+
+def _can_override():
+    try:
+        class Probe(clownfish.Obj):
+            def to_string(self):
+                return "probe"
+        return True
+    except TypeError:
+        return False
+
+def _ascending(self, other):
+    return (self.value > other.value) - (self.value < other.value)
+
+def _descending(self, other):
+    return _ascending(other, self)
+
+@unittest.skipUnless(_can_override(),
+                     "Clownfish classes can't be subclassed from Python yet")
+class TestOverride(unittest.TestCase):
+
+    def setUp(self):
+        class SortObj(clownfish.Obj):
+            compare_to = _ascending
+        class SubSortObj(SortObj):
+            pass
+        class ReverseSortObj(SortObj):
+            compare_to = _descending
+        self.SortObj        = SortObj
+        self.SubSortObj     = SubSortObj
+        self.ReverseSortObj = ReverseSortObj
+
+    def sortedValues(self, cls, instance_override=None):
+        vector = clownfish.Vector()
+        for value in [3, 1, 4, 1, 5, 9, 2]:
+            obj = cls()
+            obj.value = value
+            if instance_override is not None:
+                obj.compare_to = instance_override.__get__(obj)
+            vector.push(obj)
+        vector.sort()
+        return [vector.fetch(i).value for i in range(vector.get_size())]
+
+    ascending  = [1, 1, 2, 3, 4, 5, 9]
+    descending = [9, 5, 4, 3, 2, 1, 1]
+
+    def testOverrideCalledFromC(self):
+        self.assertEqual(self.sortedValues(self.SortObj), self.ascending)
+        self.assertEqual(self.sortedValues(self.SubSortObj), self.ascending)
+
+    def testTypeModification(self):
+        self.assertEqual(self.sortedValues(self.SortObj), self.ascending)
+        self.SortObj.compare_to = _descending
+        self.assertEqual(self.sortedValues(self.SortObj), self.descending)
+
+    def testBaseTypeModification(self):
+        self.assertEqual(self.sortedValues(self.SubSortObj), self.ascending)
+        self.SortObj.compare_to = _descending
+        self.assertEqual(self.sortedValues(self.SubSortObj), self.descending)
+        self.SubSortObj.compare_to = _ascending
+        self.assertEqual(self.sortedValues(self.SubSortObj), self.ascending)
+
+    def testBasesChange(self):
+        self.assertEqual(self.sortedValues(self.SubSortObj), self.ascending)
+        self.SubSortObj.__bases__ = (self.ReverseSortObj,)
+        self.assertEqual(self.sortedValues(self.SubSortObj), self.descending)
+
+    def testInstanceOverride(self):
+        self.assertEqual(self.sortedValues(self.SortObj), self.ascending)
+        self.assertEqual(self.sortedValues(self.SortObj, _descending),
+                         self.descending)
+        self.assertEqual(self.sortedValues(self.SortObj), self.ascending)
+
+if __name__ == '__main__':
+    unittest.main()